@@ -48,10 +48,12 @@ public class FleshRingEditor : ModuleRules
 				"EditorFramework",
 				"ApplicationCore",
 				"RenderCore",
+				"RHI",
 				"CommonMenuExtensions",
 				"MeshDescription",
 				"SkeletalMeshDescription",
 				"StaticMeshDescription",
+				"AssetRegistry",
 			}
 			);
 
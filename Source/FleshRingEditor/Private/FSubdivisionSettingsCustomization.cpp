@@ -8,6 +8,7 @@
 #include "FleshRingAsset.h"
 #include "FleshRingComponent.h"
 #include "FleshRingTypes.h"
+#include "FleshRingSkinnedRingLibrary.h"
 #include "FleshRingAssetEditor.h"
 #include "FleshRingDeformerInstance.h"
 #include "SFleshRingEditorViewport.h"
@@ -19,9 +20,11 @@
 #include "Styling/AppStyle.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "Editor.h"
-#include "RenderingThread.h"
+#include "Tasks/Task.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
 #include "Rendering/SlateRenderer.h"
 #include "UObject/UObjectGlobals.h"  // For CollectGarbage
 #include "FileHelpers.h"  // For FEditorFileUtils::PromptForCheckoutAndSave
@@ -37,7 +40,7 @@ FSubdivisionSettingsCustomization::~FSubdivisionSettingsCustomization()
 	// Clean up any in-progress async bake
 	if (bAsyncBakeInProgress)
 	{
-		CleanupAsyncBake(true);
+		CleanupAsyncBake(EAsyncBakeResult::Cancelled);
 	}
 }
 
@@ -71,6 +74,11 @@ void FSubdivisionSettingsCustomization::CustomizeChildren(
 	TSharedPtr<IPropertyHandle> MaxSubdivisionLevelHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, MaxSubdivisionLevel));
 	TSharedPtr<IPropertyHandle> SubdividedMeshHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, SubdividedMesh));
 	TSharedPtr<IPropertyHandle> BakedMeshHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, BakedMesh));
+	TSharedPtr<IPropertyHandle> BakeOutputHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, BakeOutput));
+	TSharedPtr<IPropertyHandle> SparseDeltaThresholdHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, SparseDeltaThreshold));
+	TSharedPtr<IPropertyHandle> SparseQuantizationErrorBoundHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, SparseQuantizationErrorBound));
+	TSharedPtr<IPropertyHandle> SkinnedRingLibraryHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, SkinnedRingLibrary));
+	TSharedPtr<IPropertyHandle> CookAffectedVertexDataHandle = PropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, bCookAffectedVertexData));
 
 	// =====================================
 	// Common Settings (Top-level)
@@ -153,10 +161,30 @@ void FSubdivisionSettingsCustomization::CustomizeChildren(
 		LOCTEXT("BakedMeshGroup", "Baked Mesh")
 	);
 
+	if (BakeOutputHandle.IsValid())
+	{
+		BakedMeshGroup.AddPropertyRow(BakeOutputHandle.ToSharedRef());
+	}
+	if (SparseDeltaThresholdHandle.IsValid())
+	{
+		BakedMeshGroup.AddPropertyRow(SparseDeltaThresholdHandle.ToSharedRef());
+	}
+	if (SparseQuantizationErrorBoundHandle.IsValid())
+	{
+		BakedMeshGroup.AddPropertyRow(SparseQuantizationErrorBoundHandle.ToSharedRef());
+	}
 	if (MaxSubdivisionLevelHandle.IsValid())
 	{
 		BakedMeshGroup.AddPropertyRow(MaxSubdivisionLevelHandle.ToSharedRef());
 	}
+	if (SkinnedRingLibraryHandle.IsValid())
+	{
+		BakedMeshGroup.AddPropertyRow(SkinnedRingLibraryHandle.ToSharedRef());
+	}
+	if (CookAffectedVertexDataHandle.IsValid())
+	{
+		BakedMeshGroup.AddPropertyRow(CookAffectedVertexDataHandle.ToSharedRef());
+	}
 
 	// Bake + Clear buttons
 	BakedMeshGroup.AddWidgetRow()
@@ -280,13 +308,18 @@ void FSubdivisionSettingsCustomization::SaveAsset(UFleshRingAsset* Asset)
 	UPackage* Package = Asset->GetOutermost();
 	if (Package && Package->IsDirty())
 	{
-		// Fully flush rendering before checkout dialog
-		// Ensures render resources for newly created meshes like BakedMesh are fully initialized
-		// before the checkout dialog appears (render thread synchronization)
-		FlushRenderingCommands();
-
+		// No render flush: saving serializes the meshes' LOD models, not their render resources
 		TArray<UPackage*> PackagesToSave;
 		PackagesToSave.Add(Package);
+
+		// Shared skinned ring library modified by the bake
+		if (UFleshRingSkinnedRingLibrary* Library = Asset->SubdivisionSettings.SkinnedRingLibrary)
+		{
+			if (Library->GetOutermost()->IsDirty())
+			{
+				PackagesToSave.AddUnique(Library->GetOutermost());
+			}
+		}
 		FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, false, false);
 	}
 }
@@ -418,7 +451,6 @@ FReply FSubdivisionSettingsCustomization::OnBakeMeshClicked()
 		if (PreviewScene.IsValid() && PreviewScene->HasValidPreviewMesh())
 		{
 			PreviewScene->ClearPreviewMesh();
-			FlushRenderingCommands();
 		}
 	}
 
@@ -440,7 +472,6 @@ FReply FSubdivisionSettingsCustomization::OnBakeMeshClicked()
 	if (!PreviewComponent->GetDeformer())
 	{
 		PreviewComponent->ForceInitializeForEditorPreview();
-		FlushRenderingCommands();
 
 		// Error if Deformer still doesn't exist after initialization
 		if (!PreviewComponent->GetDeformer())
@@ -456,35 +487,64 @@ FReply FSubdivisionSettingsCustomization::OnBakeMeshClicked()
 		OriginalPreviewMesh = SkelMeshComp->GetSkeletalMeshAsset();
 	}
 
-	// Start async bake (overlay + FTSTicker)
+	// Stale SubdividedMesh: CPU subdivision runs on a worker (Subdividing stage), the source mesh is swapped in afterwards
+	TSharedPtr<FFleshRingSubdivisionJob> SubdivisionJob;
+	USkeletalMesh* SourceMesh = nullptr;
+	if (Asset->NeedsBakeSubdivision())
+	{
+		SubdivisionJob = Asset->BeginSubdivision(PreviewComponent);
+	}
+
+	if (!SubdivisionJob.IsValid())
+	{
+		// Swap the bake source mesh in (Deformer recomputes over the next frames)
+		bool bSwapped = false;
+		SourceMesh = Asset->PrepareBakeSourceMesh(PreviewComponent, bSwapped);
+		if (!SourceMesh)
+		{
+			return FReply::Handled();
+		}
+	}
+
+	// Start staged async bake (overlay + progress notification + FTSTicker)
+	// CPU subdivision and every GPU wait are polled per tick - only the mesh builds block the game thread
 	bAsyncBakeInProgress = true;
+	bAsyncBakeCancelRequested = false;
+	AsyncBakeStage = SubdivisionJob.IsValid() ? EAsyncBakeStage::Subdividing : EAsyncBakeStage::WaitingForDeformer;
 	AsyncBakeFrameCount = 0;
 	PostCacheValidFrameCount = 0;
 	AsyncBakeAsset = Asset;
 	AsyncBakeComponent = PreviewComponent;
+	AsyncBakeSourceMesh = SourceMesh;
+
+	if (SubdivisionJob.IsValid())
+	{
+		AsyncSubdivisionJob = SubdivisionJob;
+		AsyncSubdivisionTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+			[SubdivisionJob]()
+			{
+				UFleshRingAsset::ComputeSubdivision(*SubdivisionJob);
+			});
+	}
 
 	// Show overlay (block input)
 	FleshRingEditor->ShowBakeOverlay(true, LOCTEXT("BakingMeshOverlay", "Baking mesh...\nPlease wait."));
 
-	// Start mesh swap (invalidate cache)
-	FlushRenderingCommands();
-	bool bImmediateSuccess = Asset->GenerateBakedMesh(PreviewComponent);
-
-	if (bImmediateSuccess)
+	FNotificationInfo Info(SubdivisionJob.IsValid()
+		? LOCTEXT("BakeProgressSubdivision", "Baking mesh: subdividing...")
+		: LOCTEXT("BakeProgressDeformer", "Baking mesh: waiting for deformation..."));
+	Info.bFireAndForget = false;
+	Info.bUseThrobber = true;
+	Info.ExpireDuration = 3.0f;
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		LOCTEXT("CancelBake", "Cancel"),
+		LOCTEXT("CancelBakeTooltip", "Cancel the bake and restore the preview mesh"),
+		FSimpleDelegate::CreateSP(this, &FSubdivisionSettingsCustomization::OnCancelAsyncBakeClicked),
+		SNotificationItem::CS_Pending));
+	AsyncBakeNotification = FSlateNotificationManager::Get().AddNotification(Info);
+	if (TSharedPtr<SNotificationItem> Notification = AsyncBakeNotification.Pin())
 	{
-		// Immediate success (cache already existed)
-		FleshRingEditor->ShowBakeOverlay(false);
-		bAsyncBakeInProgress = false;
-		RestoreOriginalPreviewMesh(PreviewComponent);
-
-		// Prevent memory leak: Call GC even in immediate success path
-		FlushRenderingCommands();
-		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
-
-		// Auto-save (includes Perforce checkout prompt)
-		SaveAsset(Asset);
-
-		return FReply::Handled();
+		Notification->SetCompletionState(SNotificationItem::CS_Pending);
 	}
 
 	// Start async ticker (continue rendering while waiting for GPU work to complete)
@@ -527,59 +587,138 @@ FReply FSubdivisionSettingsCustomization::OnClearBakedMeshClicked()
 
 bool FSubdivisionSettingsCustomization::OnAsyncBakeTick(float DeltaTime)
 {
-	// Validity check
-	if (!AsyncBakeAsset.IsValid() || !AsyncBakeComponent.IsValid())
+	if (bAsyncBakeCancelRequested)
 	{
-		CleanupAsyncBake(true);
+		CleanupAsyncBake(EAsyncBakeResult::Cancelled);
 		return false;  // Stop ticker
 	}
 
-	++AsyncBakeFrameCount;
+	// Validity check (the source mesh is resolved once the Subdividing stage is done)
+	if (!AsyncBakeAsset.IsValid() || !AsyncBakeComponent.IsValid() ||
+		(AsyncBakeStage != EAsyncBakeStage::Subdividing && !AsyncBakeSourceMesh.IsValid()))
+	{
+		CleanupAsyncBake(EAsyncBakeResult::Failed);
+		return false;  // Stop ticker
+	}
 
-	// Check Deformer cache status
 	UFleshRingDeformer* Deformer = AsyncBakeComponent->GetDeformer();
-	if (Deformer)
+	UFleshRingDeformerInstance* Instance = Deformer ? Deformer->GetActiveInstance() : nullptr;
+
+	++AsyncBakeFrameCount;
+
+	switch (AsyncBakeStage)
 	{
-		UFleshRingDeformerInstance* Instance = Deformer->GetActiveInstance();
-		if (Instance && Instance->HasCachedDeformedGeometry(0))
+	case EAsyncBakeStage::Subdividing:
+	{
+		if (!AsyncSubdivisionTask.IsCompleted())
 		{
-			// Cache is now valid - wait additional frames (ensure GPU computation is complete)
-			++PostCacheValidFrameCount;
+			return true;
+		}
 
-			if (PostCacheValidFrameCount < PostCacheValidWaitFrames)
-			{
-				return true;  // Continue waiting
-			}
+		// Build SubdividedMesh (game thread), then swap it in as the bake source mesh
+		TSharedPtr<FFleshRingSubdivisionJob> SubdivisionJob = MoveTemp(AsyncSubdivisionJob);
+		AsyncSubdivisionTask = {};
+		AsyncBakeAsset->FinishSubdivision(*SubdivisionJob);
 
-			// Waited long enough, flush GPU commands and attempt baking
-			FlushRenderingCommands();
+		bool bSwapped = false;
+		USkeletalMesh* SourceMesh = AsyncBakeAsset->PrepareBakeSourceMesh(AsyncBakeComponent.Get(), bSwapped);
+		if (!SourceMesh)
+		{
+			CleanupAsyncBake(EAsyncBakeResult::Failed);
+			return false;
+		}
 
-			bool bSuccess = AsyncBakeAsset->GenerateBakedMesh(AsyncBakeComponent.Get());
+		AsyncBakeSourceMesh = SourceMesh;
+		AsyncBakeStage = EAsyncBakeStage::WaitingForDeformer;
+		AsyncBakeFrameCount = 0;
+		SetAsyncBakeProgressText(LOCTEXT("BakeProgressDeformer", "Baking mesh: waiting for deformation..."));
+		return true;
+	}
 
-			if (bSuccess)
+	case EAsyncBakeStage::WaitingForDeformer:
+		// Check Deformer cache status
+		if (Instance && Instance->HasCachedDeformedGeometry(0))
+		{
+			// Cache is now valid - wait additional frames (ensure GPU computation is complete)
+			if (++PostCacheValidFrameCount < PostCacheValidWaitFrames)
 			{
-				CleanupAsyncBake(true);
-				return false;  // Stop ticker
+				return true;  // Continue waiting
 			}
-			else
+
+			// GPU -> staging copy, polled below (no render thread flush)
+			if (!Instance->BeginDeformedGeometryReadback(0))
 			{
-				// Cache is valid but failed? Something is wrong - retry
+				CleanupAsyncBake(EAsyncBakeResult::Failed);
+				return false;
 			}
+
+			AsyncBakeStage = EAsyncBakeStage::Readback;
+			AsyncBakeFrameCount = 0;
+			SetAsyncBakeProgressText(LOCTEXT("BakeProgressReadback", "Baking mesh: reading back deformed geometry..."));
+			return true;
+		}
+
+		// Check if maximum frames exceeded
+		if (AsyncBakeFrameCount >= MaxAsyncBakeFrames)
+		{
+			CleanupAsyncBake(EAsyncBakeResult::Failed);
+			return false;  // Stop ticker
 		}
+		return true;
+
+	case EAsyncBakeStage::Readback:
+	{
+		const EFleshRingReadbackStatus Status = Instance
+			? Instance->PollDeformedGeometryReadback(AsyncBakePositions, AsyncBakeNormals, AsyncBakeTangents)
+			: EFleshRingReadbackStatus::Failed;
+
+		if (Status == EFleshRingReadbackStatus::Ready)
+		{
+			// Build on the next tick so the notification shows the commit stage first
+			AsyncBakeStage = EAsyncBakeStage::Committing;
+			AsyncBakeFrameCount = 0;
+			SetAsyncBakeProgressText(LOCTEXT("BakeProgressCommit", "Baking mesh: building mesh..."));
+			return true;
+		}
+
+		if (Status == EFleshRingReadbackStatus::Failed || AsyncBakeFrameCount >= MaxAsyncReadbackFrames)
+		{
+			CleanupAsyncBake(EAsyncBakeResult::Failed);
+			return false;
+		}
+		return true;
 	}
 
-	// Check if maximum frames exceeded
-	if (AsyncBakeFrameCount >= MaxAsyncBakeFrames)
+	case EAsyncBakeStage::Committing:
 	{
-		CleanupAsyncBake(true);
-		return false;  // Stop ticker
+		// Final USkeletalMesh commit (game thread)
+		// Affected vertex data is cooked first, while the Deformer is still registered on the bake source mesh
+		AsyncBakeAsset->CookAffectedData(AsyncBakeComponent.Get());
+		const bool bSuccess = AsyncBakeAsset->CommitBakedGeometry(AsyncBakeSourceMesh.Get(),
+			AsyncBakePositions, AsyncBakeNormals, AsyncBakeTangents);
+		CleanupAsyncBake(bSuccess ? EAsyncBakeResult::Succeeded : EAsyncBakeResult::Failed);
+		return false;
+	}
 	}
 
-	// Continue waiting
-	return true;  // Continue ticker
+	return true;
 }
 
-void FSubdivisionSettingsCustomization::CleanupAsyncBake(bool bRestorePreviewMesh)
+void FSubdivisionSettingsCustomization::OnCancelAsyncBakeClicked()
+{
+	bAsyncBakeCancelRequested = true;
+	SetAsyncBakeProgressText(LOCTEXT("BakeProgressCancelling", "Cancelling bake..."));
+}
+
+void FSubdivisionSettingsCustomization::SetAsyncBakeProgressText(const FText& Text)
+{
+	if (TSharedPtr<SNotificationItem> Notification = AsyncBakeNotification.Pin())
+	{
+		Notification->SetText(Text);
+	}
+}
+
+void FSubdivisionSettingsCustomization::CleanupAsyncBake(EAsyncBakeResult Result)
 {
 	// Remove ticker
 	if (TickerHandle.IsValid())
@@ -588,10 +727,33 @@ void FSubdivisionSettingsCustomization::CleanupAsyncBake(bool bRestorePreviewMes
 		TickerHandle.Reset();
 	}
 
+	// Abandon subdivision still running on the worker (the task owns the job until it returns)
+	if (AsyncSubdivisionJob.IsValid())
+	{
+		UFleshRingAsset::CancelSubdivision(*AsyncSubdivisionJob);
+		AsyncSubdivisionJob.Reset();
+	}
+	AsyncSubdivisionTask = {};
+
+	// Drop readback still in flight (cancel / failure during Readback stage)
+	if (AsyncBakeComponent.IsValid())
+	{
+		if (UFleshRingDeformer* Deformer = AsyncBakeComponent->GetDeformer())
+		{
+			if (UFleshRingDeformerInstance* Instance = Deformer->GetActiveInstance())
+			{
+				Instance->CancelDeformedGeometryReadback();
+			}
+		}
+	}
+	AsyncBakePositions.Empty();
+	AsyncBakeNormals.Empty();
+	AsyncBakeTangents.Empty();
+
 	// NOTE: Overlay is hidden AFTER SaveAsset completes (keep input blocked until save finishes)
 
 	// Restore original preview mesh
-	if (bRestorePreviewMesh && AsyncBakeComponent.IsValid() && OriginalPreviewMesh.IsValid())
+	if (AsyncBakeComponent.IsValid() && OriginalPreviewMesh.IsValid())
 	{
 		USkeletalMeshComponent* SkelMeshComp = AsyncBakeComponent->GetResolvedTargetSkeletalMeshComponent();
 		if (SkelMeshComp && SkelMeshComp->GetSkeletalMeshAsset() != OriginalPreviewMesh.Get())
@@ -604,13 +766,12 @@ void FSubdivisionSettingsCustomization::CleanupAsyncBake(bool bRestorePreviewMes
 					Instance->ReleaseResources();
 				}
 			}
-			FlushRenderingCommands();
 
 			// Restore to original mesh
+			// Render state is recreated immediately so no proxy keeps the bake source mesh (render commands stay ordered, no flush)
 			SkelMeshComp->SetSkeletalMeshAsset(OriginalPreviewMesh.Get());
-			SkelMeshComp->MarkRenderStateDirty();
+			SkelMeshComp->RecreateRenderState_Concurrent();
 			SkelMeshComp->MarkRenderDynamicDataDirty();
-			FlushRenderingCommands();
 		}
 	}
 
@@ -633,7 +794,6 @@ void FSubdivisionSettingsCustomization::CleanupAsyncBake(bool bRestorePreviewMes
 						Instance->ReleaseResources();
 					}
 				}
-				FlushRenderingCommands();
 
 				// Switch to original mesh or TargetSkeletalMesh
 				USkeletalMesh* FallbackMesh = OriginalPreviewMesh.IsValid()
@@ -642,9 +802,8 @@ void FSubdivisionSettingsCustomization::CleanupAsyncBake(bool bRestorePreviewMes
 				if (FallbackMesh)
 				{
 					SkelMeshComp->SetSkeletalMeshAsset(FallbackMesh);
-					SkelMeshComp->MarkRenderStateDirty();
+					SkelMeshComp->RecreateRenderState_Concurrent();
 					SkelMeshComp->MarkRenderDynamicDataDirty();
-					FlushRenderingCommands();
 				}
 			}
 		}
@@ -652,10 +811,9 @@ void FSubdivisionSettingsCustomization::CleanupAsyncBake(bool bRestorePreviewMes
 		// Release pointer (break UPROPERTY reference)
 		AsyncBakeAsset->SubdivisionSettings.SubdividedMesh = nullptr;
 
-		// Fully release render resources
+		// Fully release render resources (fence wait blocks until released, no extra flush)
 		SubdividedMesh->ReleaseResources();
 		SubdividedMesh->ReleaseResourcesFence.Wait();
-		FlushRenderingCommands();
 
 		// Change Outer to TransientPackage (detach from Asset subobject)
 		SubdividedMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
@@ -671,11 +829,35 @@ void FSubdivisionSettingsCustomization::CleanupAsyncBake(bool bRestorePreviewMes
 	// Prevent memory leak: Execute GC after restoring original mesh
 	// At this point all references to SubdividedMesh/BakedMesh are released
 	// Synchronous GC cost is acceptable since user is waiting with overlay during bake
-	FlushRenderingCommands();  // Wait for render thread completion (needed even if condition not entered)
+	// (no flush: meshes whose render resources are still being released wait in IsReadyForFinishDestroy)
 	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 
-	// Auto-save (includes Perforce checkout prompt)
-	SaveAsset(AsyncBakeAsset.Get());
+	// Auto-save (includes Perforce checkout prompt) - cancelled / failed bakes leave the asset untouched
+	if (Result == EAsyncBakeResult::Succeeded)
+	{
+		SaveAsset(AsyncBakeAsset.Get());
+	}
+
+	if (TSharedPtr<SNotificationItem> Notification = AsyncBakeNotification.Pin())
+	{
+		switch (Result)
+		{
+		case EAsyncBakeResult::Succeeded:
+			Notification->SetText(LOCTEXT("BakeSucceeded", "Bake complete"));
+			Notification->SetCompletionState(SNotificationItem::CS_Success);
+			break;
+		case EAsyncBakeResult::Failed:
+			Notification->SetText(LOCTEXT("BakeFailed", "Bake failed (see Output Log)"));
+			Notification->SetCompletionState(SNotificationItem::CS_Fail);
+			break;
+		case EAsyncBakeResult::Cancelled:
+			Notification->SetText(LOCTEXT("BakeCancelled", "Bake cancelled"));
+			Notification->SetCompletionState(SNotificationItem::CS_None);
+			break;
+		}
+		Notification->ExpireAndFadeout();
+	}
+	AsyncBakeNotification.Reset();
 
 	// Hide overlay AFTER save completes (prevent user interaction during cleanup/save)
 	if (AsyncBakeAsset.IsValid() && GEditor)
@@ -699,40 +881,13 @@ void FSubdivisionSettingsCustomization::CleanupAsyncBake(bool bRestorePreviewMes
 
 	// Reset state
 	bAsyncBakeInProgress = false;
+	bAsyncBakeCancelRequested = false;
+	AsyncBakeStage = EAsyncBakeStage::WaitingForDeformer;
 	AsyncBakeFrameCount = 0;
 	PostCacheValidFrameCount = 0;
 	AsyncBakeAsset.Reset();
 	AsyncBakeComponent.Reset();
-	OriginalPreviewMesh.Reset();
-}
-
-void FSubdivisionSettingsCustomization::RestoreOriginalPreviewMesh(UFleshRingComponent* PreviewComponent)
-{
-	if (!PreviewComponent || !OriginalPreviewMesh.IsValid())
-	{
-		return;
-	}
-
-	USkeletalMeshComponent* SkelMeshComp = PreviewComponent->GetResolvedTargetSkeletalMeshComponent();
-	if (SkelMeshComp && SkelMeshComp->GetSkeletalMeshAsset() != OriginalPreviewMesh.Get())
-	{
-		// Release existing buffers
-		if (UFleshRingDeformer* Deformer = PreviewComponent->GetDeformer())
-		{
-			if (UFleshRingDeformerInstance* Instance = Deformer->GetActiveInstance())
-			{
-				Instance->ReleaseResources();
-			}
-		}
-		FlushRenderingCommands();
-
-		// Restore to original mesh
-		SkelMeshComp->SetSkeletalMeshAsset(OriginalPreviewMesh.Get());
-		SkelMeshComp->MarkRenderStateDirty();
-		SkelMeshComp->MarkRenderDynamicDataDirty();
-		FlushRenderingCommands();
-	}
-
+	AsyncBakeSourceMesh.Reset();
 	OriginalPreviewMesh.Reset();
 }
 
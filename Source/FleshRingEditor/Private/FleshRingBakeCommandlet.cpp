@@ -0,0 +1,436 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+#include "FleshRingBakeCommandlet.h"
+#include "FleshRingAsset.h"
+#include "FleshRingComponent.h"
+#include "FleshRingDeformer.h"
+#include "FleshRingDeformerInstance.h"
+#include "FleshRingPreviewScene.h"
+#include "FleshRingSkinnedRingLibrary.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetCompilingManager.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "RenderingThread.h"
+#include "Tasks/Task.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingBakeCommandlet, Log, All);
+
+namespace
+{
+	/** Frames to wait after the deformer cache becomes valid (same as editor async bake) */
+	constexpr int32 PostCacheValidWaitFrames = 3;
+
+	constexpr float FrameDeltaSeconds = 1.0f / 30.0f;
+
+	/** Offscreen capture size (only drives scene rendering, output unused) */
+	constexpr int32 CaptureSize = 64;
+
+	/** Bake output missing or any parameter hash differs from the stored one */
+	bool NeedsBake(const UFleshRingAsset* Asset)
+	{
+		if (Asset->NeedsBakeRegeneration())
+		{
+			return true;
+		}
+
+		// Subdivided full-mesh bakes also record the subdivision hash (SubdividedMesh itself is discarded after baking)
+		const FSubdivisionSettings& Settings = Asset->SubdivisionSettings;
+		return Settings.bEnableSubdivision && Settings.BakeOutput == EFleshRingBakeOutput::FullMesh &&
+			Settings.SubdivisionParamsHash != Asset->CalculateSubdivisionParamsHash();
+	}
+
+	/** Load packages concurrently and wait for all of them */
+	void LoadPackagesParallel(const TSet<FString>& PackageNames)
+	{
+		for (const FString& PackageName : PackageNames)
+		{
+			LoadPackageAsync(PackageName);
+		}
+		FlushAsyncLoading();
+	}
+
+	/** Release SubdividedMesh after bake (same as editor async bake cleanup, hash is kept) */
+	void DiscardSubdividedMesh(UFleshRingAsset* Asset)
+	{
+		USkeletalMesh* SubdividedMesh = Asset->SubdivisionSettings.SubdividedMesh;
+		if (!SubdividedMesh)
+		{
+			return;
+		}
+
+		Asset->SubdivisionSettings.SubdividedMesh = nullptr;
+
+		SubdividedMesh->ReleaseResources();
+		SubdividedMesh->ReleaseResourcesFence.Wait();
+		FlushRenderingCommands();
+
+		SubdividedMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+		SubdividedMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
+		SubdividedMesh->SetFlags(RF_Transient);
+		SubdividedMesh->MarkAsGarbage();
+	}
+
+	/** Offscreen preview scene of one asset, alive from subdivision gather until its bake is done */
+	struct FBakeScene
+	{
+		UFleshRingAsset* Asset = nullptr;
+		TUniquePtr<FFleshRingPreviewScene> PreviewScene;
+		UFleshRingComponent* Component = nullptr;
+		USkeletalMeshComponent* SkelMeshComp = nullptr;
+
+		/** SubdividedMesh regeneration gathered from Component's deformer (computed on a worker) */
+		TSharedPtr<FFleshRingSubdivisionJob> SubdivisionJob;
+	};
+
+	/** Create the preview scene of Asset and initialize its deformer */
+	bool SetupBakeScene(UFleshRingAsset* Asset, FBakeScene& OutScene)
+	{
+		FAdvancedPreviewScene::ConstructionValues CVS;
+		CVS.bCreatePhysicsScene = false;
+		OutScene.Asset = Asset;
+		OutScene.PreviewScene = MakeUnique<FFleshRingPreviewScene>(CVS);
+		OutScene.PreviewScene->SetFleshRingAsset(Asset);
+
+		UFleshRingComponent* Component = OutScene.PreviewScene->GetFleshRingComponent();
+		USkeletalMeshComponent* SkelMeshComp = Component ? Component->GetResolvedTargetSkeletalMeshComponent() : nullptr;
+		if (!SkelMeshComp)
+		{
+			UE_LOG(LogFleshRingBakeCommandlet, Error, TEXT("'%s': No target mesh in preview scene"), *Asset->GetPathName());
+			return false;
+		}
+
+		// No viewport: initialize the deformer directly instead of waiting for the first render
+		Component->ForceInitializeForEditorPreview();
+		FlushRenderingCommands();
+		if (!Component->GetDeformer())
+		{
+			UE_LOG(LogFleshRingBakeCommandlet, Error, TEXT("'%s': Deformer initialization failed"), *Asset->GetPathName());
+			return false;
+		}
+
+		OutScene.Component = Component;
+		OutScene.SkelMeshComp = SkelMeshComp;
+		return true;
+	}
+
+	/** Bake one asset in its offscreen preview scene (GPU deformer + readback) */
+	bool BakeAsset(FBakeScene& Scene, int32 MaxFrames)
+	{
+		UFleshRingAsset* Asset = Scene.Asset;
+		FFleshRingPreviewScene& PreviewScene = *Scene.PreviewScene;
+		UFleshRingComponent* Component = Scene.Component;
+		USkeletalMeshComponent* SkelMeshComp = Scene.SkelMeshComp;
+
+		// Offscreen capture renders the scene each frame so the deformer dispatches
+		UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>(GetTransientPackage(), NAME_None, RF_Transient);
+		RenderTarget->InitAutoFormat(CaptureSize, CaptureSize);
+		RenderTarget->UpdateResourceImmediate(true);
+
+		USceneCaptureComponent2D* Capture = NewObject<USceneCaptureComponent2D>(GetTransientPackage(), NAME_None, RF_Transient);
+		Capture->TextureTarget = RenderTarget;
+		Capture->bCaptureEveryFrame = false;
+		Capture->bCaptureOnMovement = false;
+		const FBoxSphereBounds Bounds = SkelMeshComp->Bounds;
+		const FVector CaptureLocation = Bounds.Origin - FVector::ForwardVector * Bounds.SphereRadius * 2.0;
+		PreviewScene.AddComponent(Capture, FTransform(FRotator::ZeroRotator, CaptureLocation));
+
+		UWorld* World = PreviewScene.GetWorld();
+		USkeletalMesh* OriginalMesh = SkelMeshComp->GetSkeletalMeshAsset();
+
+		// First call swaps to the bake source mesh (or succeeds directly if the cache is already valid)
+		bool bBaked = Asset->GenerateBakedMesh(Component);
+		int32 PostCacheValidFrames = 0;
+
+		for (int32 Frame = 0; Frame < MaxFrames && !bBaked; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, FrameDeltaSeconds);
+			Capture->CaptureScene();
+			World->SendAllEndOfFrameUpdates();
+			FlushRenderingCommands();
+
+			UFleshRingDeformer* Deformer = Component->GetDeformer();
+			UFleshRingDeformerInstance* Instance = Deformer ? Deformer->GetActiveInstance() : nullptr;
+			if (!Instance || !Instance->HasCachedDeformedGeometry(0))
+			{
+				continue;
+			}
+
+			if (++PostCacheValidFrames < PostCacheValidWaitFrames)
+			{
+				continue;
+			}
+
+			bBaked = Asset->GenerateBakedMesh(Component);
+		}
+
+		// Restore preview mesh before SubdividedMesh is released
+		if (SkelMeshComp->GetSkeletalMeshAsset() != OriginalMesh)
+		{
+			if (UFleshRingDeformer* Deformer = Component->GetDeformer())
+			{
+				if (UFleshRingDeformerInstance* Instance = Deformer->GetActiveInstance())
+				{
+					Instance->ReleaseResources();
+				}
+			}
+			FlushRenderingCommands();
+
+			SkelMeshComp->SetSkeletalMeshAsset(OriginalMesh);
+			SkelMeshComp->MarkRenderStateDirty();
+			FlushRenderingCommands();
+		}
+		PreviewScene.RemoveComponent(Capture);
+
+		DiscardSubdividedMesh(Asset);
+
+		if (!bBaked)
+		{
+			UE_LOG(LogFleshRingBakeCommandlet, Error, TEXT("'%s': Bake did not complete within %d frames"), *Asset->GetPathName(), MaxFrames);
+		}
+		return bBaked;
+	}
+
+	bool SaveAssetPackage(UObject* Asset)
+	{
+		UPackage* Package = Asset->GetOutermost();
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+		if (IFileManager::Get().IsReadOnly(*Filename))
+		{
+			UE_LOG(LogFleshRingBakeCommandlet, Error, TEXT("'%s' is read-only (check out before baking)"), *Filename);
+			return false;
+		}
+
+		FlushRenderingCommands();
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_NoError;
+		return UPackage::SavePackage(Package, Asset, *Filename, SaveArgs);
+	}
+}
+
+UFleshRingBakeCommandlet::UFleshRingBakeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UFleshRingBakeCommandlet::Main(const FString& Params)
+{
+	if (!FApp::CanEverRender())
+	{
+		UE_LOG(LogFleshRingBakeCommandlet, Error, TEXT("Baking needs a GPU: run with -AllowCommandletRendering"));
+		return 1;
+	}
+
+	const bool bForce = FParse::Param(*Params, TEXT("Force"));
+	const bool bDryRun = FParse::Param(*Params, TEXT("DryRun"));
+	const bool bNoSave = FParse::Param(*Params, TEXT("NoSave"));
+
+	int32 Shard = 0;
+	int32 NumShards = 1;
+	int32 MaxFrames = 120;
+	int32 Concurrency = 4;
+	FParse::Value(*Params, TEXT("Shard="), Shard);
+	FParse::Value(*Params, TEXT("NumShards="), NumShards);
+	FParse::Value(*Params, TEXT("MaxFrames="), MaxFrames);
+	FParse::Value(*Params, TEXT("Concurrency="), Concurrency);
+	NumShards = FMath::Max(NumShards, 1);
+	Concurrency = FMath::Max(Concurrency, 1);
+
+	TArray<FString> Paths;
+	FString PathsParam;
+	if (FParse::Value(*Params, TEXT("Paths="), PathsParam, /*bShouldStopOnSeparator=*/ false))
+	{
+		PathsParam.ParseIntoArray(Paths, TEXT(","));
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// 1. Find assets (optionally filtered by path, then by shard)
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(/*bSynchronousSearch=*/ true);
+
+	TArray<FAssetData> AllAssets;
+	AssetRegistry.GetAssetsByClass(UFleshRingAsset::StaticClass()->GetClassPathName(), AllAssets, /*bSearchSubClasses=*/ true);
+
+	TArray<FAssetData> Assets;
+	for (const FAssetData& AssetData : AllAssets)
+	{
+		const FString PackageName = AssetData.PackageName.ToString();
+		if (Paths.Num() > 0 && !Paths.ContainsByPredicate([&PackageName](const FString& Path) { return PackageName.StartsWith(Path); }))
+		{
+			continue;
+		}
+		// Stable across processes (FName hashes are not)
+		if (FCrc::StrCrc32(*PackageName) % NumShards != static_cast<uint32>(Shard))
+		{
+			continue;
+		}
+		Assets.Add(AssetData);
+	}
+	Assets.Sort([](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+
+	// 2. Load all assets in parallel, keep the stale ones
+	{
+		TSet<FString> PackageNames;
+		for (const FAssetData& AssetData : Assets)
+		{
+			PackageNames.Add(AssetData.PackageName.ToString());
+		}
+		LoadPackagesParallel(PackageNames);
+	}
+
+	TArray<UFleshRingAsset*> StaleAssets;
+	for (const FAssetData& AssetData : Assets)
+	{
+		UFleshRingAsset* Asset = Cast<UFleshRingAsset>(AssetData.GetAsset());
+		if (!Asset)
+		{
+			UE_LOG(LogFleshRingBakeCommandlet, Warning, TEXT("'%s': Failed to load"), *AssetData.GetObjectPathString());
+			continue;
+		}
+		if (bForce || NeedsBake(Asset))
+		{
+			StaleAssets.Add(Asset);
+		}
+	}
+
+	UE_LOG(LogFleshRingBakeCommandlet, Display, TEXT("FleshRing bake: %d assets (shard %d/%d), %d up to date, %d to bake"),
+		Assets.Num(), Shard, NumShards, Assets.Num() - StaleAssets.Num(), StaleAssets.Num());
+
+	if (bDryRun)
+	{
+		for (const UFleshRingAsset* Asset : StaleAssets)
+		{
+			UE_LOG(LogFleshRingBakeCommandlet, Display, TEXT("  Stale: %s"), *Asset->GetPathName());
+		}
+		return 0;
+	}
+
+	// 3. Load target / ring meshes of all stale assets in parallel, then finish their compilation (parallel across meshes)
+	{
+		TSet<FString> DependencyPackages;
+		for (const UFleshRingAsset* Asset : StaleAssets)
+		{
+			if (!Asset->TargetSkeletalMesh.IsNull())
+			{
+				DependencyPackages.Add(Asset->TargetSkeletalMesh.ToSoftObjectPath().GetLongPackageName());
+			}
+			for (const FFleshRingSettings& Ring : Asset->Rings)
+			{
+				if (!Ring.RingMesh.IsNull())
+				{
+					DependencyPackages.Add(Ring.RingMesh.ToSoftObjectPath().GetLongPackageName());
+				}
+			}
+		}
+		LoadPackagesParallel(DependencyPackages);
+		FAssetCompilingManager::Get().FinishAllCompilation();
+	}
+
+	const double PrepareTime = FPlatformTime::Seconds() - StartTime;
+
+	// 4. Bake in batches of Concurrency assets
+	//    CPU subdivision (region selection, topology, weight interpolation) of a batch runs concurrently on workers,
+	//    then mesh build, GPU readback and save run one asset at a time on the game thread
+	int32 NumBaked = 0;
+	int32 NumFailed = 0;
+	TSet<UFleshRingSkinnedRingLibrary*> SkinnedRingLibraries;
+	for (int32 BatchStart = 0; BatchStart < StaleAssets.Num(); BatchStart += Concurrency)
+	{
+		const int32 BatchNum = FMath::Min(Concurrency, StaleAssets.Num() - BatchStart);
+
+		TArray<FBakeScene> Scenes;
+		Scenes.SetNum(BatchNum);
+		TArray<UE::Tasks::FTask> SubdivisionTasks;
+		for (int32 BatchIndex = 0; BatchIndex < BatchNum; ++BatchIndex)
+		{
+			UFleshRingAsset* Asset = StaleAssets[BatchStart + BatchIndex];
+			FBakeScene& Scene = Scenes[BatchIndex];
+			if (!SetupBakeScene(Asset, Scene) || !Asset->NeedsBakeSubdivision())
+			{
+				continue;
+			}
+
+			Scene.SubdivisionJob = Asset->BeginSubdivision(Scene.Component);
+			if (Scene.SubdivisionJob.IsValid())
+			{
+				SubdivisionTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION,
+					[Job = Scene.SubdivisionJob]()
+					{
+						UFleshRingAsset::ComputeSubdivision(*Job);
+					}));
+			}
+		}
+		UE::Tasks::Wait(SubdivisionTasks);
+
+		for (int32 BatchIndex = 0; BatchIndex < BatchNum; ++BatchIndex)
+		{
+			const int32 Index = BatchStart + BatchIndex;
+			UFleshRingAsset* Asset = StaleAssets[Index];
+			FBakeScene& Scene = Scenes[BatchIndex];
+			const double AssetStartTime = FPlatformTime::Seconds();
+
+			bool bBaked = false;
+			if (Scene.Component)
+			{
+				// SubdividedMesh is current afterwards, so PrepareBakeSourceMesh uses it as is
+				if (Scene.SubdivisionJob.IsValid())
+				{
+					Asset->FinishSubdivision(*Scene.SubdivisionJob);
+				}
+				bBaked = BakeAsset(Scene, MaxFrames);
+			}
+			Scene = FBakeScene();
+
+			const bool bSaved = bBaked && (bNoSave || SaveAssetPackage(Asset));
+
+			if (bBaked && Asset->SubdivisionSettings.SkinnedRingLibrary)
+			{
+				SkinnedRingLibraries.Add(Asset->SubdivisionSettings.SkinnedRingLibrary);
+			}
+
+			if (bSaved)
+			{
+				++NumBaked;
+			}
+			else
+			{
+				++NumFailed;
+			}
+
+			UE_LOG(LogFleshRingBakeCommandlet, Display, TEXT("[%d/%d] %s: %s (%.2f s)"),
+				Index + 1, StaleAssets.Num(), *Asset->GetPathName(),
+				bSaved ? TEXT("baked") : (bBaked ? TEXT("save failed") : TEXT("bake failed")),
+				FPlatformTime::Seconds() - AssetStartTime);
+
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	// Shared skinned ring libraries are saved once after all their users are baked
+	if (!bNoSave)
+	{
+		for (UFleshRingSkinnedRingLibrary* Library : SkinnedRingLibraries)
+		{
+			if (IsValid(Library) && Library->GetOutermost()->IsDirty() && !SaveAssetPackage(Library))
+			{
+				++NumFailed;
+			}
+		}
+	}
+
+	UE_LOG(LogFleshRingBakeCommandlet, Display, TEXT("FleshRing bake done: %d baked, %d failed, %d up to date (prepare %.1f s, total %.1f s)"),
+		NumBaked, NumFailed, Assets.Num() - StaleAssets.Num(), PrepareTime, FPlatformTime::Seconds() - StartTime);
+
+	return NumFailed > 0 ? 1 : 0;
+}
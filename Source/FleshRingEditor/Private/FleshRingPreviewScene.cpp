@@ -636,10 +636,9 @@ void FFleshRingPreviewScene::ClearPreviewMesh()
 		// 1. Release pointer
 		PreviewSubdividedMesh = nullptr;
 
-		// 2. Fully release render resources
+		// 2. Fully release render resources (fence wait blocks until released, no extra flush)
 		OldMesh->ReleaseResources();
 		OldMesh->ReleaseResourcesFence.Wait();
-		FlushRenderingCommands();
 
 		// 3. Change Outer to TransientPackage
 		OldMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
@@ -896,7 +895,11 @@ void FFleshRingPreviewScene::GeneratePreviewMesh()
 	}
 
 	// 3. Execute bone-based Subdivision processor
-	FFleshRingSubdivisionProcessor Processor;
+	if (!PreviewSubdivisionProcessor.IsValid())
+	{
+		PreviewSubdivisionProcessor = MakeUnique<FFleshRingSubdivisionProcessor>();
+	}
+	FFleshRingSubdivisionProcessor& Processor = *PreviewSubdivisionProcessor;
 
 	if (!Processor.SetSourceMesh(SourcePositions, SourceIndices, SourceUVs, SourceTriangleMaterialIndices))
 	{
@@ -13,6 +13,7 @@ class UFleshRingMeshComponent;
 class UFleshRingComponent;
 class UFleshRingAsset;
 class AActor;
+class FFleshRingSubdivisionProcessor;
 
 /**
  * Preview scene for FleshRing editor
@@ -129,6 +130,9 @@ private:
 	/** Preview mesh cache valid flag */
 	bool bPreviewMeshCacheValid = false;
 
+	/** Preview subdivision processor kept between regenerations (unchanged source mesh keeps its half-edge mesh and result cache) */
+	TUniquePtr<FFleshRingSubdivisionProcessor> PreviewSubdivisionProcessor;
+
 	/** Currently selected Ring index (-1 = no selection) */
 	int32 SelectedRingIndex = -1;
 
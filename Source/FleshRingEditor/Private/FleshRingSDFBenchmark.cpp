@@ -0,0 +1,317 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingSDFBenchmark.cpp
+#include "FleshRingSDFBenchmark.h"
+#include "FleshRingSDF.h"
+#include "FleshRingSDFVolume.h"
+#include "FleshRingVirtualBandMesh.h"
+#include "FleshRingTypes.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSDFBenchmark, Log, All);
+
+namespace FleshRingSDFBenchmark
+{
+
+// ===== Procedural Rings =====
+
+static void BuildTorus(float MajorRadius, float MinorRadius, int32 MajorSegments, int32 MinorSegments, FFleshRingBenchmarkRing& OutRing)
+{
+	OutRing.Name = TEXT("Torus");
+	OutRing.Vertices.Reset();
+	OutRing.Indices.Reset();
+
+	for (int32 i = 0; i < MajorSegments; i++)
+	{
+		const float Theta = 2.0f * PI * i / MajorSegments;
+		for (int32 j = 0; j < MinorSegments; j++)
+		{
+			const float Phi = 2.0f * PI * j / MinorSegments;
+			const float Rho = MajorRadius + MinorRadius * FMath::Cos(Phi);
+			OutRing.Vertices.Add(FVector3f(Rho * FMath::Cos(Theta), Rho * FMath::Sin(Theta), MinorRadius * FMath::Sin(Phi)));
+		}
+	}
+
+	for (int32 i = 0; i < MajorSegments; i++)
+	{
+		const int32 NextI = (i + 1) % MajorSegments;
+		for (int32 j = 0; j < MinorSegments; j++)
+		{
+			const int32 NextJ = (j + 1) % MinorSegments;
+			const uint32 A = i * MinorSegments + j;
+			const uint32 B = NextI * MinorSegments + j;
+			const uint32 C = NextI * MinorSegments + NextJ;
+			const uint32 D = i * MinorSegments + NextJ;
+			OutRing.Indices.Append({ A, B, C, A, C, D });
+		}
+	}
+
+	// Exact corrected SDF: tube solid = 0, slice-enclosed hole = -distance, air = +distance
+	OutRing.AnalyticCorrectedSDF = [MajorRadius, MinorRadius](const FVector3f& P)
+	{
+		const float Rho = FMath::Sqrt(P.X * P.X + P.Y * P.Y);
+		const float Distance = FMath::Sqrt(FMath::Square(Rho - MajorRadius) + P.Z * P.Z) - MinorRadius;
+		if (Distance <= 0.0f)
+		{
+			return 0.0f;
+		}
+
+		// Inside the inner circle of this Z slice's annulus = donut hole
+		const float HalfWidthSq = MinorRadius * MinorRadius - P.Z * P.Z;
+		const bool bInHole = HalfWidthSq > 0.0f && Rho < MajorRadius - FMath::Sqrt(HalfWidthSq);
+		return bInHole ? -Distance : Distance;
+	};
+}
+
+static void BuildBand(const TCHAR* Name, const FVirtualBandSettings& Settings, FFleshRingBenchmarkRing& OutRing)
+{
+	OutRing.Name = Name;
+	FleshRingVirtualBandMesh::GenerateBandTriangles(Settings, OutRing.Vertices, OutRing.Indices);
+	OutRing.AnalyticCorrectedSDF = nullptr;
+}
+
+TArray<int32> GetDefaultResolutions()
+{
+	return { 32, 64, 128, 256 };
+}
+
+void BuildProceduralRingLibrary(TArray<FFleshRingBenchmarkRing>& OutRings)
+{
+	OutRings.Reset();
+
+	// Torus (analytic reference available)
+	BuildTorus(8.0f, 1.5f, 48, 16, OutRings.AddDefaulted_GetRef());
+
+	// Flat band: straight cylinder shell (no bulge sections)
+	{
+		FVirtualBandSettings FlatBand;
+		FlatBand.MidUpperRadius = 8.0f;
+		FlatBand.MidLowerRadius = 8.0f;
+		FlatBand.BandHeight = 3.0f;
+		FlatBand.BandThickness = 1.0f;
+		FlatBand.Upper = FVirtualBandSection(8.0f, 0.0f);
+		FlatBand.Lower = FVirtualBandSection(8.0f, 0.0f);
+		BuildBand(TEXT("FlatBand"), FlatBand, OutRings.AddDefaulted_GetRef());
+	}
+
+	// Buckle-like: concave hourglass profile (strong upper flare, tapered lower)
+	{
+		FVirtualBandSettings Buckle;
+		Buckle.MidUpperRadius = 7.0f;
+		Buckle.MidLowerRadius = 7.5f;
+		Buckle.BandHeight = 1.5f;
+		Buckle.BandThickness = 0.8f;
+		Buckle.Upper = FVirtualBandSection(11.0f, 3.0f);
+		Buckle.Lower = FVirtualBandSection(9.5f, 2.0f);
+		BuildBand(TEXT("Buckle"), Buckle, OutRings.AddDefaulted_GetRef());
+	}
+}
+
+// ===== GPU Run =====
+
+struct FBenchmarkGPUOutput
+{
+	double GenerateMs = 0.0;
+	double FloodFillMs = 0.0;
+	FFleshRingSDFVolume RawSDF;
+	FFleshRingSDFVolume CorrectedSDF;
+};
+
+static void RunGPU(const FFleshRingBenchmarkRing& Ring, const FBox3f& Bounds, int32 Resolution, TSharedRef<FBenchmarkGPUOutput, ESPMode::ThreadSafe> Output)
+{
+	const FIntVector SDFResolution(Resolution, Resolution, Resolution);
+	Output->RawSDF.BoundsMin = Output->CorrectedSDF.BoundsMin = Bounds.Min;
+	Output->RawSDF.BoundsMax = Output->CorrectedSDF.BoundsMax = Bounds.Max;
+	Output->RawSDF.Resolution = Output->CorrectedSDF.Resolution = SDFResolution;
+
+	ENQUEUE_RENDER_COMMAND(FleshRingSDFBenchmark)(
+		[Vertices = Ring.Vertices, Indices = Ring.Indices, Bounds, SDFResolution, Output](FRHICommandListImmediate& RHICmdList)
+		{
+			const FRDGTextureDesc SDFTextureDesc = FRDGTextureDesc::Create3D(
+				SDFResolution,
+				PF_R32_FLOAT,
+				FClearValueBinding::Black,
+				TexCreate_ShaderResource | TexCreate_UAV);
+
+			// Each stage is executed and waited on separately so GPU time can be attributed
+			RHICmdList.BlockUntilGPUIdle();
+			const double StartTime = FPlatformTime::Seconds();
+
+			TRefCountPtr<IPooledRenderTarget> RawPooled;
+			{
+				FRDGBuilder GraphBuilder(RHICmdList);
+				FRDGTextureRef RawSDFTexture = GraphBuilder.CreateTexture(SDFTextureDesc, TEXT("FleshRingBenchmark_RawSDF"));
+				GenerateMeshSDF(GraphBuilder, RawSDFTexture, Vertices, Indices, Bounds.Min, Bounds.Max, SDFResolution);
+				RawPooled = GraphBuilder.ConvertToExternalTexture(RawSDFTexture);
+				GraphBuilder.Execute();
+			}
+			RHICmdList.BlockUntilGPUIdle();
+			const double GenerateEndTime = FPlatformTime::Seconds();
+
+			TRefCountPtr<IPooledRenderTarget> CorrectedPooled;
+			{
+				FRDGBuilder GraphBuilder(RHICmdList);
+				FRDGTextureRef RawSDFTexture = GraphBuilder.RegisterExternalTexture(RawPooled);
+				FRDGTextureRef CorrectedSDFTexture = GraphBuilder.CreateTexture(SDFTextureDesc, TEXT("FleshRingBenchmark_CorrectedSDF"));
+				Apply2DSliceFloodFill(GraphBuilder, RawSDFTexture, CorrectedSDFTexture, SDFResolution);
+				CorrectedPooled = GraphBuilder.ConvertToExternalTexture(CorrectedSDFTexture);
+				GraphBuilder.Execute();
+			}
+			RHICmdList.BlockUntilGPUIdle();
+			const double FloodEndTime = FPlatformTime::Seconds();
+
+			Output->GenerateMs = (GenerateEndTime - StartTime) * 1000.0;
+			Output->FloodFillMs = (FloodEndTime - GenerateEndTime) * 1000.0;
+
+			// Readback (not timed)
+			FRHIGPUTextureReadback RawReadback(TEXT("FleshRingBenchmark_RawReadback"));
+			FRHIGPUTextureReadback CorrectedReadback(TEXT("FleshRingBenchmark_CorrectedReadback"));
+			{
+				FRDGBuilder GraphBuilder(RHICmdList);
+				AddEnqueueCopyPass(GraphBuilder, &RawReadback, GraphBuilder.RegisterExternalTexture(RawPooled));
+				AddEnqueueCopyPass(GraphBuilder, &CorrectedReadback, GraphBuilder.RegisterExternalTexture(CorrectedPooled));
+				GraphBuilder.Execute();
+			}
+			RHICmdList.BlockUntilGPUIdle();
+
+			Output->RawSDF.CopyFromReadback(RawReadback);
+			Output->CorrectedSDF.CopyFromReadback(CorrectedReadback);
+		});
+
+	FlushRenderingCommands();
+}
+
+void Run(
+	const TArray<FFleshRingBenchmarkRing>& Rings,
+	const TArray<int32>& Resolutions,
+	TArray<FFleshRingSDFBenchmarkResult>& OutResults)
+{
+	check(IsInGameThread());
+	OutResults.Reset();
+
+	for (const FFleshRingBenchmarkRing& Ring : Rings)
+	{
+		if (Ring.Vertices.Num() == 0 || Ring.Indices.Num() < 3)
+		{
+			UE_LOG(LogFleshRingSDFBenchmark, Warning, TEXT("SDFBenchmark: Ring '%s' has no triangles, skipped"), *Ring.Name);
+			continue;
+		}
+
+		const FBox3f Bounds(Ring.Vertices);
+		const int32 NumTriangles = Ring.Indices.Num() / 3;
+
+		for (const int32 Resolution : Resolutions)
+		{
+			if (Resolution <= 0)
+			{
+				continue;
+			}
+
+			FFleshRingSDFBenchmarkResult& Result = OutResults.AddDefaulted_GetRef();
+			Result.RingName = Ring.Name;
+			Result.Resolution = Resolution;
+			Result.NumTriangles = NumTriangles;
+
+			// Estimate: Raw + Corrected (R32F) + flood/vote masks (R32_UINT) alive together + mesh buffers
+			const int64 VoxelCount = static_cast<int64>(Resolution) * Resolution * Resolution;
+			Result.EstimatedPeakGPUBytes = VoxelCount * sizeof(float) * 4
+				+ Ring.Vertices.Num() * sizeof(FVector3f)
+				+ NumTriangles * sizeof(FIntVector);
+
+			TSharedRef<FBenchmarkGPUOutput, ESPMode::ThreadSafe> GPUOutput = MakeShared<FBenchmarkGPUOutput, ESPMode::ThreadSafe>();
+			RunGPU(Ring, Bounds, Resolution, GPUOutput);
+
+			if (!GPUOutput->RawSDF.IsValid() || !GPUOutput->CorrectedSDF.IsValid())
+			{
+				UE_LOG(LogFleshRingSDFBenchmark, Warning, TEXT("SDFBenchmark: %s @ %d^3 readback failed"), *Ring.Name, Resolution);
+				continue;
+			}
+
+			Result.GenerateMs = GPUOutput->GenerateMs;
+			Result.FloodFillMs = GPUOutput->FloodFillMs;
+
+			// CPU reference sign correction (must match GPU exactly)
+			TArray<float> CPUCorrected;
+			const double CPUStartTime = FPlatformTime::Seconds();
+			Apply2DSliceFloodFillCPU(GPUOutput->RawSDF.Distances, CPUCorrected, GPUOutput->RawSDF.Resolution);
+			Result.CPUFloodFillMs = (FPlatformTime::Seconds() - CPUStartTime) * 1000.0;
+
+			const TArray<float>& GPUCorrected = GPUOutput->CorrectedSDF.Distances;
+			for (int32 Index = 0; Index < GPUCorrected.Num(); ++Index)
+			{
+				if (CPUCorrected[Index] != GPUCorrected[Index])
+				{
+					Result.FloodMismatchVoxels++;
+				}
+			}
+
+			// Error against analytic reference (voxel centers)
+			if (Ring.AnalyticCorrectedSDF)
+			{
+				Result.bHasAnalyticReference = true;
+				const FVector3f BoundsSize = Bounds.GetSize();
+				double SumSquaredError = 0.0;
+
+				for (int32 Z = 0; Z < Resolution; ++Z)
+				{
+					for (int32 Y = 0; Y < Resolution; ++Y)
+					{
+						for (int32 X = 0; X < Resolution; ++X)
+						{
+							const FVector3f UVW = (FVector3f(X, Y, Z) + 0.5f) / static_cast<float>(Resolution);
+							const FVector3f VoxelPos = Bounds.Min + UVW * BoundsSize;
+							const float Expected = Ring.AnalyticCorrectedSDF(VoxelPos);
+							const float Actual = GPUCorrected[X + (Y + Z * Resolution) * Resolution];
+							const float Error = FMath::Abs(Actual - Expected);
+
+							Result.MaxAbsError = FMath::Max(Result.MaxAbsError, Error);
+							SumSquaredError += static_cast<double>(Error) * Error;
+							if ((Actual < 0.0f) != (Expected < 0.0f))
+							{
+								Result.SignMismatchVoxels++;
+							}
+						}
+					}
+				}
+				Result.RMSError = static_cast<float>(FMath::Sqrt(SumSquaredError / VoxelCount));
+			}
+
+			Result.bValid = true;
+
+			UE_LOG(LogFleshRingSDFBenchmark, Display,
+				TEXT("SDFBenchmark: %-8s %3d^3 Tris=%d | Generate %.2f ms, Flood %.2f ms (CPU ref %.2f ms, mismatch %d) | Est. peak GPU %.1f MB | %s"),
+				*Result.RingName, Result.Resolution, Result.NumTriangles,
+				Result.GenerateMs, Result.FloodFillMs, Result.CPUFloodFillMs, Result.FloodMismatchVoxels,
+				Result.EstimatedPeakGPUBytes / (1024.0 * 1024.0),
+				Result.bHasAnalyticReference
+					? *FString::Printf(TEXT("MaxErr %.4f, RMS %.4f, SignMismatch %d"), Result.MaxAbsError, Result.RMSError, Result.SignMismatchVoxels)
+					: TEXT("no analytic reference"));
+		}
+	}
+}
+
+FString ToCSV(const TArray<FFleshRingSDFBenchmarkResult>& Results)
+{
+	FString CSV = TEXT("Ring,Resolution,Triangles,GenerateMs,FloodFillMs,CPUFloodFillMs,EstimatedPeakGPUBytes,FloodMismatchVoxels,MaxAbsError,RMSError,SignMismatchVoxels\n");
+	for (const FFleshRingSDFBenchmarkResult& Result : Results)
+	{
+		if (!Result.bValid)
+		{
+			continue;
+		}
+
+		CSV += FString::Printf(TEXT("%s,%d,%d,%.3f,%.3f,%.3f,%lld,%d,%s,%s,%s\n"),
+			*Result.RingName, Result.Resolution, Result.NumTriangles,
+			Result.GenerateMs, Result.FloodFillMs, Result.CPUFloodFillMs,
+			Result.EstimatedPeakGPUBytes, Result.FloodMismatchVoxels,
+			Result.bHasAnalyticReference ? *FString::SanitizeFloat(Result.MaxAbsError) : TEXT(""),
+			Result.bHasAnalyticReference ? *FString::SanitizeFloat(Result.RMSError) : TEXT(""),
+			Result.bHasAnalyticReference ? *FString::FromInt(Result.SignMismatchVoxels) : TEXT(""));
+	}
+	return CSV;
+}
+
+} // namespace FleshRingSDFBenchmark
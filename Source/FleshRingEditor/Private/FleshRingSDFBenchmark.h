@@ -0,0 +1,86 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingSDFBenchmark.h
+// Cost/accuracy harness for Ring SDF generation (GenerateMeshSDF + Apply2DSliceFloodFill)
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Procedural ring mesh used as benchmark input (Ring local space, Z = ring axis)
+ */
+struct FFleshRingBenchmarkRing
+{
+	/** Display name (Torus, FlatBand, Buckle, ...) */
+	FString Name;
+
+	/** Closed triangle mesh */
+	TArray<FVector3f> Vertices;
+	TArray<uint32> Indices;
+
+	/**
+	 * Exact corrected SDF for this shape (same convention as Apply2DSliceFloodFill output:
+	 * hole = negative, ring solid = 0, air = positive). Unbound if no closed form exists.
+	 */
+	TFunction<float(const FVector3f&)> AnalyticCorrectedSDF;
+};
+
+/**
+ * Result of one (ring, resolution) benchmark run
+ */
+struct FFleshRingSDFBenchmarkResult
+{
+	FString RingName;
+	int32 Resolution = 0;
+	int32 NumTriangles = 0;
+
+	/** GPU wall time (dispatch + GPU idle wait) */
+	double GenerateMs = 0.0;
+	double FloodFillMs = 0.0;
+
+	/** CPU reference flood fill time (Apply2DSliceFloodFillCPU) */
+	double CPUFloodFillMs = 0.0;
+
+	/**
+	 * Estimated peak transient GPU memory of the pipeline, computed from resource sizes
+	 * (SDF textures + flood masks + mesh buffers), not measured
+	 */
+	int64 EstimatedPeakGPUBytes = 0;
+
+	/** Voxels where GPU and CPU reference sign correction disagree (expected 0) */
+	int32 FloodMismatchVoxels = 0;
+
+	/** Error against AnalyticCorrectedSDF (only if the ring has one) */
+	bool bHasAnalyticReference = false;
+	float MaxAbsError = 0.0f;
+	float RMSError = 0.0f;
+	int32 SignMismatchVoxels = 0;
+
+	/** Whether GPU readback succeeded (all other fields are meaningless otherwise) */
+	bool bValid = false;
+};
+
+/**
+ * SDF generation benchmark
+ *
+ * Runs the same GPU pipeline as UFleshRingComponent::GenerateSDF on procedural rings
+ * (analytic torus + FleshRingVirtualBandMesh bands) and reports time, estimated peak memory and error.
+ * Blocks the game thread (flushes rendering commands) - offline/commandlet use only.
+ */
+namespace FleshRingSDFBenchmark
+{
+	/** Default resolution sweep (32^3 .. 256^3) */
+	TArray<int32> GetDefaultResolutions();
+
+	/** Torus, flat band and concave buckle-like band */
+	void BuildProceduralRingLibrary(TArray<FFleshRingBenchmarkRing>& OutRings);
+
+	/** Run every ring at every resolution (game thread) */
+	void Run(
+		const TArray<FFleshRingBenchmarkRing>& Rings,
+		const TArray<int32>& Resolutions,
+		TArray<FFleshRingSDFBenchmarkResult>& OutResults);
+
+	/** CSV text (header + one row per result) */
+	FString ToCSV(const TArray<FFleshRingSDFBenchmarkResult>& Results);
+}
@@ -0,0 +1,64 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+#include "FleshRingSDFBenchmarkCommandlet.h"
+#include "FleshRingSDFBenchmark.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSDFBenchmarkCommandlet, Log, All);
+
+UFleshRingSDFBenchmarkCommandlet::UFleshRingSDFBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UFleshRingSDFBenchmarkCommandlet::Main(const FString& Params)
+{
+	if (!FApp::CanEverRender())
+	{
+		UE_LOG(LogFleshRingSDFBenchmarkCommandlet, Error, TEXT("SDF benchmark needs a GPU: run with -AllowCommandletRendering"));
+		return 1;
+	}
+
+	// Resolution sweep
+	TArray<int32> Resolutions;
+	FString ResolutionsParam;
+	if (FParse::Value(*Params, TEXT("Resolutions="), ResolutionsParam, /*bShouldStopOnSeparator=*/ false))
+	{
+		TArray<FString> Tokens;
+		ResolutionsParam.ParseIntoArray(Tokens, TEXT(","));
+		for (const FString& Token : Tokens)
+		{
+			const int32 Resolution = FCString::Atoi(*Token);
+			if (Resolution > 0)
+			{
+				Resolutions.Add(Resolution);
+			}
+		}
+	}
+	if (Resolutions.Num() == 0)
+	{
+		Resolutions = FleshRingSDFBenchmark::GetDefaultResolutions();
+	}
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("FleshRing") / TEXT("SDFBenchmark.csv");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	TArray<FFleshRingBenchmarkRing> Rings;
+	FleshRingSDFBenchmark::BuildProceduralRingLibrary(Rings);
+
+	TArray<FFleshRingSDFBenchmarkResult> Results;
+	FleshRingSDFBenchmark::Run(Rings, Resolutions, Results);
+
+	if (!FFileHelper::SaveStringToFile(FleshRingSDFBenchmark::ToCSV(Results), *OutputPath))
+	{
+		UE_LOG(LogFleshRingSDFBenchmarkCommandlet, Error, TEXT("Failed to write benchmark results to '%s'"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogFleshRingSDFBenchmarkCommandlet, Display, TEXT("SDF benchmark: %d results written to '%s'"), Results.Num(), *OutputPath);
+	return 0;
+}
@@ -102,8 +102,8 @@ void SFleshRingEditorViewport::RefreshSDFOnly()
 		if (FleshRingComp)
 		{
 			// 1. Regenerate SDF (based on VirtualBand parameters)
+			// Async: each Ring re-registers itself when its SDF lands (no render thread flush)
 			FleshRingComp->RefreshSDF();
-			FlushRenderingCommands();  // Wait for GPU work to complete
 
 			// 2. Update transforms + invalidate cache (trigger deformation recalculation)
 			FleshRingComp->UpdateRingTransforms();
@@ -6,11 +6,14 @@
 #include "IPropertyTypeCustomization.h"
 #include "PropertyHandle.h"
 #include "Containers/Ticker.h"
+#include "Tasks/Task.h"
 
 class IDetailChildrenBuilder;
 class UFleshRingAsset;
 class UFleshRingComponent;
 class USkeletalMesh;
+class SNotificationItem;
+struct FFleshRingSubdivisionJob;
 
 /**
  * Property type customization for the FSubdivisionSettings struct
@@ -66,14 +69,38 @@ private:
 
 	// ===== Async Baking Related =====
 
+	/** Stages of the async bake (one stage advanced per ticker call at most) */
+	enum class EAsyncBakeStage : uint8
+	{
+		/** CPU subdivision of a stale SubdividedMesh running on a worker */
+		Subdividing,
+		/** Waiting for the Deformer to cache deformed geometry of the bake source mesh */
+		WaitingForDeformer,
+		/** Non-blocking GPU readback in flight */
+		Readback,
+		/** Building BakedMesh / SparseBakeLODs on the game thread */
+		Committing
+	};
+
+	/** How an async bake ended */
+	enum class EAsyncBakeResult : uint8
+	{
+		Succeeded,
+		Failed,
+		Cancelled
+	};
+
 	/** Async bake tick callback */
 	bool OnAsyncBakeTick(float DeltaTime);
 
-	/** Async bake cleanup (called on success/failure) */
-	void CleanupAsyncBake(bool bRestorePreviewMesh);
+	/** Async bake cleanup (restores preview mesh, saves on success) */
+	void CleanupAsyncBake(EAsyncBakeResult Result);
+
+	/** Progress notification Cancel button */
+	void OnCancelAsyncBakeClicked();
 
-	/** Restores the original preview mesh (for sync bake) */
-	void RestoreOriginalPreviewMesh(UFleshRingComponent* PreviewComponent);
+	/** Updates the progress notification text */
+	void SetAsyncBakeProgressText(const FText& Text);
 
 	/** Cached main property handle */
 	TSharedPtr<IPropertyHandle> MainPropertyHandle;
@@ -83,18 +110,42 @@ private:
 	/** Whether async bake is in progress */
 	bool bAsyncBakeInProgress = false;
 
-	/** Async bake frame counter */
+	/** Whether Cancel was clicked (handled on the next tick) */
+	bool bAsyncBakeCancelRequested = false;
+
+	/** Current async bake stage */
+	EAsyncBakeStage AsyncBakeStage = EAsyncBakeStage::WaitingForDeformer;
+
+	/** Frame counter of the current stage */
 	int32 AsyncBakeFrameCount = 0;
 
 	/** Additional wait frame counter after cache becomes valid */
 	int32 PostCacheValidFrameCount = 0;
 
-	/** Maximum wait frames for async bake */
+	/** Maximum wait frames for the Deformer cache */
 	static constexpr int32 MaxAsyncBakeFrames = 30;
 
+	/** Maximum poll frames for the GPU readback */
+	static constexpr int32 MaxAsyncReadbackFrames = 300;
+
 	/** Number of wait frames after cache validation (ensures GPU computation completion) */
 	static constexpr int32 PostCacheValidWaitFrames = 3;
 
+	/** SubdividedMesh regeneration computed by AsyncSubdivisionTask (Subdividing stage) */
+	TSharedPtr<FFleshRingSubdivisionJob> AsyncSubdivisionJob;
+	UE::Tasks::FTask AsyncSubdivisionTask;
+
+	/** Bake source mesh swapped onto the preview component (SubdividedMesh / original) */
+	TWeakObjectPtr<USkeletalMesh> AsyncBakeSourceMesh;
+
+	/** Deformed geometry read back for the commit stage */
+	TArray<FVector3f> AsyncBakePositions;
+	TArray<FVector3f> AsyncBakeNormals;
+	TArray<FVector4f> AsyncBakeTangents;
+
+	/** Progress notification (Cancel button) */
+	TWeakPtr<SNotificationItem> AsyncBakeNotification;
+
 	/** Asset for async bake (weak reference) */
 	TWeakObjectPtr<UFleshRingAsset> AsyncBakeAsset;
 
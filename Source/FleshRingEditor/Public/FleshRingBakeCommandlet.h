@@ -0,0 +1,33 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FleshRingBakeCommandlet.generated.h"
+
+/**
+ * Headless batch bake of every UFleshRingAsset (build machines / content updates)
+ *
+ * - Incremental: assets whose bake and subdivision parameter hashes match the stored ones are skipped
+ * - Loading and mesh compilation of all stale assets run in parallel before baking
+ * - Stale assets are baked in batches (-Concurrency=N, default 4): the CPU subdivision stages of a batch
+ *   (region selection, topology, weight interpolation) run concurrently, then each asset's mesh build,
+ *   offscreen preview scene bake (GPU readback) and save run one at a time
+ * - Sharding splits the asset list across processes (-Shard=i -NumShards=N)
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe <Project> -run=FleshRingBake -AllowCommandletRendering
+ *     [-Paths=/Game/A,/Game/B] [-Force] [-DryRun] [-NoSave] [-Shard=0 -NumShards=1] [-MaxFrames=120] [-Concurrency=4]
+ */
+UCLASS()
+class UFleshRingBakeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFleshRingBakeCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,28 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FleshRingSDFBenchmarkCommandlet.generated.h"
+
+/**
+ * Ring SDF generation benchmark (FleshRingSDFBenchmark over procedural rings)
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe <Project> -run=FleshRingSDFBenchmark -AllowCommandletRendering
+ *     [-Resolutions=32,64,128,256] [-Output=<path.csv>]
+ *
+ * Default output: <ProjectSaved>/FleshRing/SDFBenchmark.csv
+ */
+UCLASS()
+class UFleshRingSDFBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFleshRingSDFBenchmarkCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+};
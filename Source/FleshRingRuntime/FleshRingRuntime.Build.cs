@@ -43,6 +43,7 @@ public class FleshRingRuntime : ModuleRules
                 "Renderer",
                 "RHI",
                 "Projects",
+                "DeveloperSettings",
                 "ProceduralMeshComponent",
                 "MeshDescription",
                 "StaticMeshDescription",
@@ -56,6 +57,8 @@ public class FleshRingRuntime : ModuleRules
 		if (Target.bBuildEditor)
 		{
 			PrivateDependencyModuleNames.Add("UnrealEd");
+			PrivateDependencyModuleNames.Add("DerivedDataCache");
+			PrivateDependencyModuleNames.Add("TargetPlatform");
 		}
 
 
@@ -9,12 +9,16 @@
 #include "FleshRingAffectedVertices.h"
 #include "FleshRingComponent.h"
 #include "FleshRingAsset.h"
+#include "FleshRingUtils.h"
 
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/SkeletalMesh.h"
 #include "Rendering/SkeletalMeshRenderData.h"
 #include "Rendering/SkeletalMeshLODRenderData.h"
 #include "Materials/MaterialInterface.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogFleshRingVertices, Log, All);
 
@@ -205,12 +209,18 @@ void FVertexSpatialHash::Build(const TArray<FVector3f>& Vertices, float InCellSi
     InvCellSize = 1.0f / CellSize;
     CachedVertices = Vertices;
 
+    MinCellKey = FIntVector(MAX_int32);
+    MaxCellKey = FIntVector(MIN_int32);
+
     // Insert all vertices into hash grid
     for (int32 i = 0; i < Vertices.Num(); ++i)
     {
         FIntVector CellKey = GetCellKey(FVector(Vertices[i]));
         uint64 Hash = HashCellKey(CellKey);
         CellMap.FindOrAdd(Hash).Add(i);
+
+        MinCellKey = FIntVector(FMath::Min(MinCellKey.X, CellKey.X), FMath::Min(MinCellKey.Y, CellKey.Y), FMath::Min(MinCellKey.Z, CellKey.Z));
+        MaxCellKey = FIntVector(FMath::Max(MaxCellKey.X, CellKey.X), FMath::Max(MaxCellKey.Y, CellKey.Y), FMath::Max(MaxCellKey.Z, CellKey.Z));
     }
 
 }
@@ -249,6 +259,95 @@ void FVertexSpatialHash::QueryAABB(const FVector& Min, const FVector& Max, TArra
     }
 }
 
+int32 FVertexSpatialHash::FindNearest(const FVector& Position, float& OutDistanceSquared) const
+{
+    OutDistanceSquared = FLT_MAX;
+
+    if (!IsBuilt())
+    {
+        return INDEX_NONE;
+    }
+
+    const FVector3f Query(Position);
+    int32 Nearest = INDEX_NONE;
+
+    // Shells past this distance contain no occupied cell
+    const FIntVector Center = GetCellKey(Position);
+    const int32 MaxShell = FMath::Max3(
+        FMath::Max(FMath::Abs(Center.X - MinCellKey.X), FMath::Abs(MaxCellKey.X - Center.X)),
+        FMath::Max(FMath::Abs(Center.Y - MinCellKey.Y), FMath::Abs(MaxCellKey.Y - Center.Y)),
+        FMath::Max(FMath::Abs(Center.Z - MinCellKey.Z), FMath::Abs(MaxCellKey.Z - Center.Z)));
+
+    // Far queries on a sparse grid visit more cells than vertices - scan linearly instead
+    int64 CellBudget = CachedVertices.Num();
+    bool bBudgetExceeded = false;
+
+    for (int32 Shell = 0; Shell <= MaxShell && !bBudgetExceeded; ++Shell)
+    {
+        // Vertices in this shell are at least (Shell - 1) cells away
+        const float ShellDistance = FMath::Max(Shell - 1, 0) * CellSize;
+        if (Nearest != INDEX_NONE && FMath::Square(ShellDistance) >= OutDistanceSquared)
+        {
+            break;
+        }
+
+        for (int32 X = -Shell; X <= Shell && !bBudgetExceeded; ++X)
+        {
+            for (int32 Y = -Shell; Y <= Shell; ++Y)
+            {
+                // Interior of the shell cube was visited by smaller shells
+                const bool bOnFace = FMath::Abs(X) == Shell || FMath::Abs(Y) == Shell;
+                const int32 ZStep = (bOnFace || Shell == 0) ? 1 : 2 * Shell;
+
+                for (int32 Z = -Shell; Z <= Shell; Z += ZStep)
+                {
+                    if (--CellBudget < 0)
+                    {
+                        bBudgetExceeded = true;
+                        break;
+                    }
+
+                    const TArray<int32>* CellVertices = CellMap.Find(HashCellKey(Center + FIntVector(X, Y, Z)));
+                    if (!CellVertices)
+                    {
+                        continue;
+                    }
+
+                    for (int32 VertexIndex : *CellVertices)
+                    {
+                        const float DistanceSquared = FVector3f::DistSquared(Query, CachedVertices[VertexIndex]);
+                        if (DistanceSquared < OutDistanceSquared)
+                        {
+                            OutDistanceSquared = DistanceSquared;
+                            Nearest = VertexIndex;
+                        }
+                    }
+                }
+
+                if (bBudgetExceeded)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    if (bBudgetExceeded)
+    {
+        for (int32 VertexIndex = 0; VertexIndex < CachedVertices.Num(); ++VertexIndex)
+        {
+            const float DistanceSquared = FVector3f::DistSquared(Query, CachedVertices[VertexIndex]);
+            if (DistanceSquared < OutDistanceSquared)
+            {
+                OutDistanceSquared = DistanceSquared;
+                Nearest = VertexIndex;
+            }
+        }
+    }
+
+    return Nearest;
+}
+
 void FVertexSpatialHash::QueryOBB(const FTransform& LocalToWorld, const FVector& LocalMin, const FVector& LocalMax, TArray<int32>& OutIndices) const
 {
     OutIndices.Reset();
@@ -306,7 +405,7 @@ void FDistanceBasedVertexSelector::SelectVertices(
 
     // InfluenceMode-based branching: Check SDFCache validity only in Auto mode
     bool bUseOBB = false;
-    if (Ring.InfluenceMode == EFleshRingInfluenceMode::Auto)
+    if (Ring.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::Auto)
     {
         bUseOBB = (Context.SDFCache && Context.SDFCache->bCached);
     }
@@ -690,6 +789,14 @@ void FSDFBoundsBasedVertexSelector::SelectVertices(
 
     const TArray<FVector3f>& AllVertices = Context.AllVertices;
 
+    // Narrow band rejection via CPU SDF copy (optional - bounds-only selection without it)
+    // Vertices deep inside the donut hole are never moved by TightnessCS (raymarch starts at SDF < 0),
+    // so dropping them shrinks PackedIndices and every downstream dispatch.
+    // Band = 1 voxel margin so trilinear/precision differences vs GPU sampling never flip a vertex.
+    const FFleshRingSDFVolume* CPUVolume = Context.SDFCache->CPUVolume.Get();
+    const float NarrowBandWidth = CPUVolume ? CPUVolume->GetMaxVoxelSize() : 0.0f;
+    int32 NarrowBandRejectedCount = 0;
+
     // ================================================================
     // UV Seam Welding: Position Group based selection
     // ================================================================
@@ -778,6 +885,13 @@ void FSDFBoundsBasedVertexSelector::SelectVertices(
             }
         }
 
+        // Narrow band test in Local Space (skip hole interior beyond falloff range)
+        if (CPUVolume && CPUVolume->IsBeyondInnerBand(FVector3f(LocalPos), NarrowBandWidth))
+        {
+            ++NarrowBandRejectedCount;
+            continue;
+        }
+
         // Add this vertex's position key (entire group gets selected)
         const FVector3f& Pos = AllVertices[VertexIdx];
         FIntVector PosKey(
@@ -812,6 +926,10 @@ void FSDFBoundsBasedVertexSelector::SelectVertices(
         }
     }
 
+    UE_LOG(LogFleshRingVertices, Verbose,
+        TEXT("SDFBoundsSelector Ring[%d]: %d selected, %d rejected by SDF narrow band%s"),
+        Context.RingIndex, OutAffected.Num(), NarrowBandRejectedCount,
+        CPUVolume ? TEXT("") : TEXT(" (no CPU SDF, bounds only)"));
 }
 
 void FSDFBoundsBasedVertexSelector::SelectSmoothingRegionVertices(
@@ -1002,7 +1120,7 @@ void FVirtualBandVertexSelector::SelectVertices(
     const TArray<FVector3f>& AllVertices = Context.AllVertices;
 
     // Get VirtualBand settings
-    const FVirtualBandSettings& BandSettings = Ring.VirtualBand;
+    const FVirtualBandSettings& BandSettings = Ring.GetEffectiveVirtualBand();
 
     // Calculate band transform (use Virtual Band specific BandOffset/BandRotation)
     const FTransform& BoneTransform = Context.BoneTransform;
@@ -1158,7 +1276,7 @@ void FVirtualBandVertexSelector::SelectSmoothingRegionVertices(
     const float BoundsZBottom = Context.RingSettings.SmoothingBoundsZBottom;
     const FFleshRingSettings& Ring = Context.RingSettings;
     const TArray<FVector3f>& AllVertices = Context.AllVertices;
-    const FVirtualBandSettings& BandSettings = Ring.VirtualBand;
+    const FVirtualBandSettings& BandSettings = Ring.GetEffectiveVirtualBand();
 
     // Use original Affected Vertices as-is if no Z extension
     if (BoundsZTop < 0.01f && BoundsZBottom < 0.01f)
@@ -1283,6 +1401,69 @@ void FVirtualBandVertexSelector::SelectSmoothingRegionVertices(
 
 }
 
+// ============================================================================
+// FRingAffectedData - memory / cooked data serialization
+// ============================================================================
+
+SIZE_T FRingAffectedData::GetAllocatedSize() const
+{
+    return Vertices.GetAllocatedSize()
+        + PackedIndices.GetAllocatedSize() + PackedInfluences.GetAllocatedSize() + PackedLayerTypes.GetAllocatedSize()
+        + RepresentativeIndices.GetAllocatedSize()
+        + SmoothingRegionIndices.GetAllocatedSize() + SmoothingRegionInfluences.GetAllocatedSize()
+        + SmoothingRegionIsAnchor.GetAllocatedSize() + SmoothingRegionRepresentativeIndices.GetAllocatedSize()
+        + SmoothingRegionLaplacianAdjacency.GetAllocatedSize() + SmoothingRegionPBDAdjacency.GetAllocatedSize()
+        + SmoothingRegionAdjacencyOffsets.GetAllocatedSize() + SmoothingRegionAdjacencyTriangles.GetAllocatedSize()
+        + SmoothingRegionHopDistances.GetAllocatedSize()
+        + BulgeIndices.GetAllocatedSize() + BulgeInfluences.GetAllocatedSize()
+        + SkinVertexIndices.GetAllocatedSize() + SkinVertexNormals.GetAllocatedSize() + StockingVertexIndices.GetAllocatedSize()
+        + AdjacencyOffsets.GetAllocatedSize() + AdjacencyTriangles.GetAllocatedSize() + LaplacianAdjacencyData.GetAllocatedSize()
+        + OriginalBoneDistances.GetAllocatedSize() + SlicePackedData.GetAllocatedSize() + AxisHeights.GetAllocatedSize()
+        + HopDistances.GetAllocatedSize() + HopBasedInfluences.GetAllocatedSize() + SeedThreadIndices.GetAllocatedSize();
+}
+
+FArchive& operator<<(FArchive& Ar, FRingAffectedData& Data)
+{
+    // Ring information / deformation parameters
+    Ar << Data.BoneName;
+    Ar << Data.RingCenter << Data.RingAxis;
+    Ar << Data.RingRadius << Data.RingThickness << Data.RingHeight;
+    Ar << Data.TightnessStrength << Data.FalloffType;
+
+    // Affected vertices (Packed* arrays are derived, rebuilt below)
+    Ar << Data.Vertices;
+    Ar << Data.RepresentativeIndices << Data.bHasUVDuplicates;
+
+    // Smoothing region
+    Ar << Data.SmoothingExpandMode;
+    Ar << Data.SmoothingRegionIndices << Data.SmoothingRegionInfluences << Data.SmoothingRegionIsAnchor;
+    Ar << Data.SmoothingRegionRepresentativeIndices << Data.bSmoothingRegionHasUVDuplicates;
+    Ar << Data.SmoothingRegionLaplacianAdjacency << Data.SmoothingRegionPBDAdjacency;
+    Ar << Data.SmoothingRegionAdjacencyOffsets << Data.SmoothingRegionAdjacencyTriangles;
+    Ar << Data.SmoothingRegionHopDistances << Data.MaxSmoothingHops;
+
+    // Bulge / layer vertices
+    Ar << Data.BulgeIndices << Data.BulgeInfluences;
+    Ar << Data.SkinVertexIndices << Data.SkinVertexNormals << Data.StockingVertexIndices;
+
+    // Adjacency / slice data
+    Ar << Data.AdjacencyOffsets << Data.AdjacencyTriangles;
+    Ar << Data.LaplacianAdjacencyData;
+    Ar << Data.OriginalBoneDistances << Data.SlicePackedData << Data.AxisHeights;
+
+    // Hop-based smoothing
+    Ar << Data.HopDistances << Data.HopBasedInfluences << Data.SeedThreadIndices;
+
+    Ar << Data.CookKey << Data.bSelectedWithSDF;
+
+    if (Ar.IsLoading() && !Ar.IsError())
+    {
+        Data.PackForGPU();
+    }
+
+    return Ar;
+}
+
 // ============================================================================
 // Affected Vertices Manager Implementation
 // ============================================================================
@@ -1359,14 +1540,12 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
                 TEXT("RegisterAffectedVertices: Failed to extract mesh indices, Normal recomputation will be disabled"));
         }
 
-        // Build topology cache (along with mesh data caching)
-        // Always build regardless of Laplacian smoothing to leverage cache in all functions
-        // Previously only built inside BuildLaplacianAdjacencyData(), so
-        // BuildRepresentativeIndices(), BuildAdjacencyData() etc. couldn't use the cache
-        if (CachedMeshIndices.Num() > 0 && !bTopologyCacheBuilt)
-        {
-            BuildTopologyCache(CachedMeshVertices, CachedMeshIndices);
-        }
+        // Identifies this LOD's geometry in cooked affected data
+        MeshDataHash = FCrc::MemCrc32(CachedMeshVertices.GetData(), CachedMeshVertices.Num() * CachedMeshVertices.GetTypeSize());
+        MeshDataHash = FCrc::MemCrc32(CachedMeshIndices.GetData(), CachedMeshIndices.Num() * CachedMeshIndices.GetTypeSize(), MeshDataHash);
+
+        // Topology cache is built lazily by the first Ring that needs vertex selection
+        // (Rings loaded from cooked data don't need it)
 
         bMeshDataCached = true;
     }
@@ -1375,6 +1554,7 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
     // Rebuild layer types every time to reflect MaterialLayerMappings changes
     // ================================================================
     RebuildVertexLayerTypes(Component, SkeletalMesh, LODIndex);
+    LayerTypesHash = FCrc::MemCrc32(CachedVertexLayerTypes.GetData(), CachedVertexLayerTypes.Num() * CachedVertexLayerTypes.GetTypeSize());
 
     // Local references (for compatibility with subsequent code)
     const TArray<FVector3f>& MeshVertices = CachedMeshVertices;
@@ -1403,6 +1583,20 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
         }
     }
 
+    // ================================================================
+    // Cooked affected data (baked into the asset for this LOD's mesh)
+    // ================================================================
+    const FFleshRingCookedLODAffectedData* CookedData = nullptr;
+#if WITH_EDITORONLY_DATA
+    CookedData = Component->FleshRingAsset->SubdivisionSettings.CookedAffectedData.FindByPredicate(
+        [this](const FFleshRingCookedLODAffectedData& Candidate)
+        {
+            return Candidate.Version == CookedDataVersion && Candidate.MeshDataHash == MeshDataHash;
+        });
+#endif
+    int32 NumCookedRings = 0;
+    int32 NumBuiltRings = 0;
+
     // Process each Ring
     for (int32 RingIdx = 0; RingIdx < NumRings; ++RingIdx)
     {
@@ -1463,6 +1657,23 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
             RingIdx, *RingSettings.BoneName.ToString(),
             BoneTransform.GetLocation().X, BoneTransform.GetLocation().Y, BoneTransform.GetLocation().Z);
 
+        const FRingSDFCache* SDFCache = Component->GetRingSDFCache(RingIdx);
+        const bool bAutoMode = (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::Auto);
+        const uint32 CookKey = CalculateRingCookKey(RingSettings, BoneTransform);
+
+        // ===== Cooked data: reuse if this Ring's settings/bind pose are unchanged =====
+        // An SDF still generating counts as SDF selection (it was valid when the data was cooked)
+        if (CookedData)
+        {
+            const bool bSelectWithSDF = bAutoMode && SDFCache && (SDFCache->IsValid() || SDFCache->IsPending());
+            if (LoadCookedRingData(*CookedData, RingIdx, CookKey, bSelectWithSDF, RingDataArray[RingIdx]))
+            {
+                RingDirtyFlags[RingIdx] = false;
+                ++NumCookedRings;
+                continue;
+            }
+        }
+
         // ================================================================
         // Create Ring data (FFleshRingSettings → FRingAffectedData)
         // ================================================================
@@ -1474,7 +1685,7 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
         const FQuat BoneRotation = BoneTransform.GetRotation();
 
         // Branch RingCenter/RingAxis/Geometry calculation based on InfluenceMode
-        if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualRing)
+        if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualRing)
         {
             // ===== VirtualRing mode: Use RingOffset/RingRotation =====
             const FVector WorldRingOffset = BoneRotation.RotateVector(RingSettings.RingOffset);
@@ -1488,10 +1699,10 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
             RingData.RingThickness = RingSettings.RingThickness;
             RingData.RingHeight = RingSettings.RingHeight;
         }
-        else if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualBand)
+        else if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualBand)
         {
             // ===== Virtual Band mode: Use dedicated BandOffset/BandRotation =====
-            const FVirtualBandSettings& BandSettings = RingSettings.VirtualBand;
+            const FVirtualBandSettings& BandSettings = RingSettings.GetEffectiveVirtualBand();
             const FVector WorldBandOffset = BoneRotation.RotateVector(BandSettings.BandOffset);
             RingData.RingCenter = BoneTransform.GetLocation() + WorldBandOffset;
 
@@ -1528,7 +1739,23 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
         // ================================================================
         // Build Context and select affected vertices
         // ================================================================
-        const FRingSDFCache* SDFCache = Component->GetRingSDFCache(RingIdx);
+
+        // Auto mode Ring whose SDF is still generating on GPU: register as empty and keep dirty
+        // UFleshRingComponent re-triggers registration for this Ring when the SDF texture lands
+        if (bAutoMode && SDFCache && SDFCache->IsPending())
+        {
+            UE_LOG(LogFleshRingVertices, Verbose,
+                TEXT("Ring[%d] '%s': SDF pending, deferring vertex selection"),
+                RingIdx, *RingSettings.BoneName.ToString());
+            RingDataArray[RingIdx] = MoveTemp(RingData);
+            continue;
+        }
+
+        // Build topology cache on first use (shared by all Rings of this LOD)
+        if (CachedMeshIndices.Num() > 0 && !bTopologyCacheBuilt)
+        {
+            BuildTopologyCache(CachedMeshVertices, CachedMeshIndices);
+        }
 
         FVertexSelectionContext Context(
             RingSettings,
@@ -1545,15 +1772,13 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
         // Auto mode + SDF valid → SDFBoundsBasedSelector
         // VirtualRing/VirtualBand mode or SDF invalid → DistanceBasedSelector/VirtualBandVertexSelector
         TSharedPtr<IVertexSelector> RingSelector;
-        const bool bUseSDFForThisRing =
-            (RingSettings.InfluenceMode == EFleshRingInfluenceMode::Auto) &&
-            (SDFCache && SDFCache->IsValid());
+        const bool bUseSDFForThisRing = bAutoMode && SDFCache && SDFCache->IsValid();
 
         if (bUseSDFForThisRing)
         {
             RingSelector = MakeShared<FSDFBoundsBasedVertexSelector>();
         }
-        else if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualBand)
+        else if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualBand)
         {
             // VirtualBand mode + SDF invalid → VirtualBandVertexSelector (distance-based variable radius)
             RingSelector = MakeShared<FVirtualBandVertexSelector>();
@@ -1579,7 +1804,7 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
             SDFSelector->SelectSmoothingRegionVertices(Context, RingData.Vertices, RingData);
             // Note: LayerTypes are queried directly by GPU from FullMeshLayerTypes
         }
-        else if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualBand)
+        else if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualBand)
         {
             // VirtualBand mode (SDF invalid): Z extension based on VirtualBand
             FVirtualBandVertexSelector* VBSelector = static_cast<FVirtualBandVertexSelector*>(RingSelector.Get());
@@ -1626,15 +1851,10 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
             }
 
             // Build PBD adjacency data (conditional: only when PBD is enabled)
-            if (RingSettings.bEnablePBDEdgeConstraint)
+            // The PBD pass runs over the refinement range (Z-extended), so only that adjacency is built
+            if (RingSettings.bEnablePBDEdgeConstraint && RingData.SmoothingRegionIndices.Num() > 0)
             {
-                BuildPBDAdjacencyData(RingData, CachedMeshIndices, MeshVertices, MeshVertices.Num());
-
-                // Also build PBD adjacency data for refinement vertices (Z-extended range)
-                if (RingData.SmoothingRegionIndices.Num() > 0)
-                {
-                    BuildSmoothingRegionPBDAdjacency(RingData, CachedMeshIndices, MeshVertices, MeshVertices.Num());
-                }
+                BuildSmoothingRegionPBDAdjacency(RingData, CachedMeshIndices, MeshVertices, MeshVertices.Num());
             }
 
             // Build slice data for bone ratio preservation (for Radial Smoothing)
@@ -1664,9 +1884,125 @@ bool FFleshRingAffectedVerticesManager::RegisterAffectedVertices(
             // BoundsExpand mode: preserve data set by SelectSmoothingRegionVertices
         }
 
+        // Cook key identifies this data when exported to the asset
+        RingData.CookKey = CookKey;
+        RingData.bSelectedWithSDF = bUseSDFForThisRing;
+
+#if !WITH_EDITORONLY_DATA
+        // AoS copy of PackedIndices/PackedInfluences/PackedLayerTypes, only needed while building
+        RingData.Vertices.Empty();
+#endif
+
         // Index-based assignment (instead of Add) + clear dirty flag
         RingDataArray[RingIdx] = MoveTemp(RingData);
         RingDirtyFlags[RingIdx] = false;
+        ++NumBuiltRings;
+    }
+
+    if (NumCookedRings > 0)
+    {
+        UE_LOG(LogFleshRingVertices, Log,
+            TEXT("RegisterAffectedVertices: LOD %d - %d Rings loaded from cooked data, %d built"),
+            LODIndex, NumCookedRings, NumBuiltRings);
+    }
+
+    return true;
+}
+
+// ============================================================================
+// Cooked affected data
+// ============================================================================
+
+uint32 FFleshRingAffectedVerticesManager::CalculateRingCookKey(const FFleshRingSettings& RingSettings, const FTransform& BoneTransform) const
+{
+    // Every Ring property can influence selection/adjacency, so hash the whole struct
+    // (except editor visibility, which is toggled freely)
+    FFleshRingSettings KeySettings = RingSettings;
+    KeySettings.bEditorVisible = true;
+
+    FString SettingsText;
+    FFleshRingSettings::StaticStruct()->ExportText(SettingsText, &KeySettings, nullptr, nullptr, PPF_None, nullptr);
+
+    uint32 Key = FCrc::StrCrc32(*SettingsText, LayerTypesHash);
+
+    // The settings only hold the Ring mesh path; editing that mesh in place must invalidate the cooked data too
+    const uint32 RingMeshHash = FleshRingUtils::HashStaticMeshGeometry(RingSettings.RingMesh.LoadSynchronous());
+    Key = FCrc::MemCrc32(&RingMeshHash, sizeof(RingMeshHash), Key);
+
+    const FVector Location = BoneTransform.GetLocation();
+    const FQuat Rotation = BoneTransform.GetRotation();
+    const double TransformValues[] = { Location.X, Location.Y, Location.Z, Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+    Key = FCrc::MemCrc32(TransformValues, sizeof(TransformValues), Key);
+
+    // 0 is reserved for "not cookable"
+    return Key != 0 ? Key : 1;
+}
+
+bool FFleshRingAffectedVerticesManager::LoadCookedRingData(
+    const FFleshRingCookedLODAffectedData& Cooked,
+    int32 RingIndex,
+    uint32 CookKey,
+    bool bSelectWithSDF,
+    FRingAffectedData& OutRingData) const
+{
+    if (!Cooked.Rings.IsValidIndex(RingIndex))
+    {
+        return false;
+    }
+
+    const FFleshRingCookedRingAffectedData& CookedRing = Cooked.Rings[RingIndex];
+    if (CookedRing.CookKey != CookKey || CookedRing.bSelectedWithSDF != bSelectWithSDF || CookedRing.Payload.Num() == 0)
+    {
+        return false;
+    }
+
+    FRingAffectedData LoadedData;
+    FMemoryReader Reader(CookedRing.Payload, /*bIsPersistent=*/ true);
+    Reader << LoadedData;
+
+    if (Reader.IsError() || LoadedData.CookKey != CookKey)
+    {
+        UE_LOG(LogFleshRingVertices, Warning,
+            TEXT("Ring[%d]: Cooked affected data is corrupt, rebuilding"), RingIndex);
+        return false;
+    }
+
+    OutRingData = MoveTemp(LoadedData);
+    return true;
+}
+
+bool FFleshRingAffectedVerticesManager::ExportCookedData(FFleshRingCookedLODAffectedData& OutCooked) const
+{
+    if (!bMeshDataCached)
+    {
+        return false;
+    }
+
+    // Dirty Rings hold stale or empty data (e.g. SDF still pending)
+    for (const bool bDirty : RingDirtyFlags)
+    {
+        if (bDirty)
+        {
+            return false;
+        }
+    }
+
+    OutCooked.Version = CookedDataVersion;
+    OutCooked.MeshDataHash = MeshDataHash;
+    OutCooked.Rings.Reset(RingDataArray.Num());
+
+    for (const FRingAffectedData& RingData : RingDataArray)
+    {
+        FFleshRingCookedRingAffectedData& CookedRing = OutCooked.Rings.AddDefaulted_GetRef();
+        CookedRing.CookKey = RingData.CookKey;
+        CookedRing.bSelectedWithSDF = RingData.bSelectedWithSDF;
+
+        // Rings that were skipped (no bone etc.) are rebuilt on load
+        if (RingData.CookKey != 0)
+        {
+            FMemoryWriter Writer(CookedRing.Payload, /*bIsPersistent=*/ true);
+            Writer << const_cast<FRingAffectedData&>(RingData);
+        }
     }
 
     return true;
@@ -1694,6 +2030,8 @@ void FFleshRingAffectedVerticesManager::ClearAll()
     CachedMeshVertices.Empty();
     CachedVertexLayerTypes.Empty();
     bMeshDataCached = false;
+    MeshDataHash = 0;
+    LayerTypesHash = 0;
 
     // Release Spatial Hash
     VertexSpatialHash.Clear();
@@ -1707,11 +2045,21 @@ int32 FFleshRingAffectedVerticesManager::GetTotalAffectedCount() const
     int32 Total = 0;
     for (const FRingAffectedData& RingData : RingDataArray)
     {
-        Total += RingData.Vertices.Num();
+        Total += RingData.PackedIndices.Num();
     }
     return Total;
 }
 
+SIZE_T FFleshRingAffectedVerticesManager::GetAllocatedSize() const
+{
+    SIZE_T Size = RingDataArray.GetAllocatedSize();
+    for (const FRingAffectedData& RingData : RingDataArray)
+    {
+        Size += RingData.GetAllocatedSize();
+    }
+    return Size + CachedMeshVertices.GetAllocatedSize() + CachedMeshIndices.GetAllocatedSize() + CachedVertexLayerTypes.GetAllocatedSize();
+}
+
 // ============================================================================
 // Per-Ring Dirty Flag System - manages per-Ring rebuild requirements
 // ============================================================================
@@ -2359,7 +2707,8 @@ void FFleshRingAffectedVerticesManager::BuildAdjacencyDataFromIndices(
     else
     {
         // Fallback: brute force (iterate all triangles)
-        UE_LOG(LogFleshRingVertices, Warning,
+        // Expected when every Ring was loaded from cooked data (topology cache is built lazily)
+        UE_LOG(LogFleshRingVertices, Verbose,
             TEXT("BuildAdjacencyDataFromIndices: Topology cache not built, falling back to brute force"));
 
         TMap<uint32, int32> VertexToIndex;
@@ -2743,8 +3092,8 @@ void FFleshRingAffectedVerticesManager::BuildSmoothingRegionLaplacianAdjacency(
 // ============================================================================
 // BuildSmoothingRegionPBDAdjacency - build PBD adjacency data for refinement vertices
 // ============================================================================
-// Builds PBD adjacency data based on SmoothingRegionIndices.
-// Same as BuildPBDAdjacencyData but uses extended range.
+// Builds PBD adjacency data based on SmoothingRegionIndices (the range the PBD pass runs over).
+// The affected vertex mask is only a temporary here; anchors are encoded as neighbor bits.
 
 void FFleshRingAffectedVerticesManager::BuildSmoothingRegionPBDAdjacency(
     FRingAffectedData& RingData,
@@ -2833,7 +3182,8 @@ void FFleshRingAffectedVerticesManager::BuildSmoothingRegionPBDAdjacency(
         }
     }
 
-    // Step 3: Pack adjacency data with rest lengths
+    // Step 3: Pack adjacency data with rest lengths (affected neighbors tagged as anchors)
+    const TBitArray<> AffectedMask = BuildAffectedVertexMask(RingData, TotalVertexCount);
     const int32 PackedSizePerVertex = FRingAffectedData::PBD_ADJACENCY_PACKED_SIZE;
     RingData.SmoothingRegionPBDAdjacency.Reset(NumRefinement * PackedSizePerVertex);
     RingData.SmoothingRegionPBDAdjacency.AddZeroed(NumRefinement * PackedSizePerVertex);
@@ -2857,7 +3207,8 @@ void FFleshRingAffectedVerticesManager::BuildSmoothingRegionPBDAdjacency(
             const uint32 NeighborIdx = Pair.Key;
             const float RestLength = Pair.Value;
 
-            RingData.SmoothingRegionPBDAdjacency[BaseOffset + 1 + SlotIdx * 2] = NeighborIdx;
+            RingData.SmoothingRegionPBDAdjacency[BaseOffset + 1 + SlotIdx * 2] =
+                AffectedMask[NeighborIdx] ? (NeighborIdx | FRingAffectedData::PBD_NEIGHBOR_ANCHOR_BIT) : NeighborIdx;
 
             uint32 RestLengthAsUint;
             FMemory::Memcpy(&RestLengthAsUint, &RestLength, sizeof(float));
@@ -2899,6 +3250,8 @@ void FFleshRingAffectedVerticesManager::BuildSmoothingRegionPBDAdjacency_HopBase
     }
 
     // Single-pass: pack directly from CachedVertexNeighbors (remove intermediate TMap)
+    // Affected neighbors are tagged as anchors
+    const TBitArray<> AffectedMask = BuildAffectedVertexMask(RingData, AllVertices.Num());
     const int32 PackedSizePerVertex = FRingAffectedData::PBD_ADJACENCY_PACKED_SIZE;
     RingData.SmoothingRegionPBDAdjacency.Reset(NumExtended * PackedSizePerVertex);
     RingData.SmoothingRegionPBDAdjacency.AddZeroed(NumExtended * PackedSizePerVertex);
@@ -2931,7 +3284,8 @@ void FFleshRingAffectedVerticesManager::BuildSmoothingRegionPBDAdjacency_HopBase
                 const FVector3f& Pos1 = AllVertices[NeighborIdx];
                 const float RestLength = FVector3f::Distance(Pos0, Pos1);
 
-                RingData.SmoothingRegionPBDAdjacency[BaseOffset + 1 + SlotIdx * 2] = NeighborIdx;
+                RingData.SmoothingRegionPBDAdjacency[BaseOffset + 1 + SlotIdx * 2] =
+                    AffectedMask[NeighborIdx] ? (NeighborIdx | FRingAffectedData::PBD_NEIGHBOR_ANCHOR_BIT) : NeighborIdx;
 
                 uint32 RestLengthAsUint;
                 FMemory::Memcpy(&RestLengthAsUint, &RestLength, sizeof(float));
@@ -2950,6 +3304,19 @@ void FFleshRingAffectedVerticesManager::BuildSmoothingRegionPBDAdjacency_HopBase
         NumExtended, RingData.SmoothingRegionPBDAdjacency.Num());
 }
 
+TBitArray<> FFleshRingAffectedVerticesManager::BuildAffectedVertexMask(const FRingAffectedData& RingData, int32 TotalVertexCount)
+{
+    TBitArray<> AffectedMask(false, TotalVertexCount);
+    for (const FAffectedVertex& Vert : RingData.Vertices)
+    {
+        if (Vert.VertexIndex < static_cast<uint32>(TotalVertexCount))
+        {
+            AffectedMask[Vert.VertexIndex] = true;
+        }
+    }
+    return AffectedMask;
+}
+
 // ============================================================================
 // BuildSmoothingRegionNormalAdjacency - build normal adjacency data for refinement vertices
 // ============================================================================
@@ -3200,196 +3567,6 @@ void FFleshRingAffectedVerticesManager::BuildSliceData(
         NumAffected, BucketToVertices.Num(), BucketSize);
 }
 
-// ============================================================================
-// BuildPBDAdjacencyData - build PBD edge constraint adjacency data (cache optimized)
-// ============================================================================
-// Optimization: O(T) → O(A × avg_neighbors_per_vertex) using CachedVertexNeighbors
-
-void FFleshRingAffectedVerticesManager::BuildPBDAdjacencyData(
-    FRingAffectedData& RingData,
-    const TArray<uint32>& MeshIndices,
-    const TArray<FVector3f>& AllVertices,
-    int32 TotalVertexCount)
-{
-    const int32 NumAffected = RingData.Vertices.Num();
-    if (NumAffected == 0 || MeshIndices.Num() < 3)
-    {
-        return;
-    }
-
-    // Step 1: Build VertexIndex → ThreadIndex lookup
-    TMap<uint32, int32> VertexToThreadIndex;
-    for (int32 ThreadIdx = 0; ThreadIdx < NumAffected; ++ThreadIdx)
-    {
-        VertexToThreadIndex.Add(RingData.Vertices[ThreadIdx].VertexIndex, ThreadIdx);
-    }
-
-    // Step 2: Build per-vertex neighbor set with rest lengths
-    // Cache optimization: look up neighbors from CachedVertexNeighbors, calculate rest length on-demand
-    TArray<TMap<uint32, float>> VertexNeighborsWithRestLen;
-    VertexNeighborsWithRestLen.SetNum(NumAffected);
-
-    if (bTopologyCacheBuilt && CachedVertexNeighbors.Num() > 0)
-    {
-        // Cached path: O(A × avg_neighbors_per_vertex)
-        for (int32 ThreadIdx = 0; ThreadIdx < NumAffected; ++ThreadIdx)
-        {
-            const uint32 VertexIndex = RingData.Vertices[ThreadIdx].VertexIndex;
-            const TSet<uint32>* NeighborsPtr = CachedVertexNeighbors.Find(VertexIndex);
-
-            if (NeighborsPtr)
-            {
-                const FVector3f& Pos0 = AllVertices[VertexIndex];
-
-                for (uint32 NeighborIdx : *NeighborsPtr)
-                {
-                    if (NeighborIdx < static_cast<uint32>(AllVertices.Num()))
-                    {
-                        const FVector3f& Pos1 = AllVertices[NeighborIdx];
-                        const float RestLength = FVector3f::Distance(Pos0, Pos1);
-                        VertexNeighborsWithRestLen[ThreadIdx].Add(NeighborIdx, RestLength);
-                    }
-                }
-            }
-        }
-    }
-    else
-    {
-        // Fallback: iterate all triangles (legacy method)
-        UE_LOG(LogFleshRingVertices, Warning,
-            TEXT("BuildPBDAdjacencyData: Topology cache not built, falling back to brute force"));
-
-        const int32 NumTriangles = MeshIndices.Num() / 3;
-        for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
-        {
-            const uint32 Idx0 = MeshIndices[TriIdx * 3 + 0];
-            const uint32 Idx1 = MeshIndices[TriIdx * 3 + 1];
-            const uint32 Idx2 = MeshIndices[TriIdx * 3 + 2];
-
-            const uint32 TriIndices[3] = { Idx0, Idx1, Idx2 };
-
-            for (int32 Edge = 0; Edge < 3; ++Edge)
-            {
-                const uint32 V0 = TriIndices[Edge];
-                const uint32 V1 = TriIndices[(Edge + 1) % 3];
-
-                if (int32* ThreadIdxPtr = VertexToThreadIndex.Find(V0))
-                {
-                    const int32 ThreadIdx = *ThreadIdxPtr;
-                    if (V1 < static_cast<uint32>(AllVertices.Num()))
-                    {
-                        if (!VertexNeighborsWithRestLen[ThreadIdx].Contains(V1))
-                        {
-                            const FVector3f& Pos0 = AllVertices[V0];
-                            const FVector3f& Pos1 = AllVertices[V1];
-                            const float RestLength = FVector3f::Distance(Pos0, Pos1);
-                            VertexNeighborsWithRestLen[ThreadIdx].Add(V1, RestLength);
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Step 3: Pack adjacency data with rest lengths
-    // Format: [Count, N0, RL0, N1, RL1, ...] per vertex (1 + MAX_NEIGHBORS*2 uints)
-    const int32 PackedSizePerVertex = FRingAffectedData::PBD_ADJACENCY_PACKED_SIZE;
-    RingData.PBDAdjacencyWithRestLengths.Reset(NumAffected * PackedSizePerVertex);
-    RingData.PBDAdjacencyWithRestLengths.AddZeroed(NumAffected * PackedSizePerVertex);
-
-    for (int32 ThreadIdx = 0; ThreadIdx < NumAffected; ++ThreadIdx)
-    {
-        const TMap<uint32, float>& NeighborsMap = VertexNeighborsWithRestLen[ThreadIdx];
-        const int32 NeighborCount = FMath::Min(NeighborsMap.Num(), FRingAffectedData::PBD_MAX_NEIGHBORS);
-        const int32 BaseOffset = ThreadIdx * PackedSizePerVertex;
-
-        // Count
-        RingData.PBDAdjacencyWithRestLengths[BaseOffset] = static_cast<uint32>(NeighborCount);
-
-        // Neighbors with rest lengths
-        int32 SlotIdx = 0;
-        for (const auto& Pair : NeighborsMap)
-        {
-            if (SlotIdx >= FRingAffectedData::PBD_MAX_NEIGHBORS)
-            {
-                break;
-            }
-
-            const uint32 NeighborIdx = Pair.Key;
-            const float RestLength = Pair.Value;
-
-            // Neighbor index
-            RingData.PBDAdjacencyWithRestLengths[BaseOffset + 1 + SlotIdx * 2] = NeighborIdx;
-
-            // Rest length (bit-cast float to uint)
-            uint32 RestLengthAsUint;
-            FMemory::Memcpy(&RestLengthAsUint, &RestLength, sizeof(float));
-            RingData.PBDAdjacencyWithRestLengths[BaseOffset + 1 + SlotIdx * 2 + 1] = RestLengthAsUint;
-
-            ++SlotIdx;
-        }
-    }
-
-    // Step 4: Build full influence map (influence for all vertices)
-    RingData.FullInfluenceMap.Reset(TotalVertexCount);
-    RingData.FullInfluenceMap.AddZeroed(TotalVertexCount);
-
-    for (int32 ThreadIdx = 0; ThreadIdx < NumAffected; ++ThreadIdx)
-    {
-        const FAffectedVertex& Vert = RingData.Vertices[ThreadIdx];
-        if (Vert.VertexIndex < static_cast<uint32>(TotalVertexCount))
-        {
-            RingData.FullInfluenceMap[Vert.VertexIndex] = Vert.Influence;
-        }
-    }
-
-    // Step 5: Build full deform amount map
-    // Note: DeformAmount is calculated in FleshRingDeformerInstance so
-    // here we set approximate values based on AxisHeight
-    // Actual values are used from DispatchData.DeformAmounts
-    RingData.FullDeformAmountMap.Reset(TotalVertexCount);
-    RingData.FullDeformAmountMap.AddZeroed(TotalVertexCount);
-
-    // Use half of Ring height as threshold
-    const float RingHalfWidth = RingData.RingHeight * 0.5f;
-
-    for (int32 ThreadIdx = 0; ThreadIdx < NumAffected; ++ThreadIdx)
-    {
-        const FAffectedVertex& Vert = RingData.Vertices[ThreadIdx];
-        if (Vert.VertexIndex < static_cast<uint32>(TotalVertexCount))
-        {
-            // Calculate DeformAmount based on AxisHeight
-            const float AxisHeight = RingData.AxisHeights.IsValidIndex(ThreadIdx)
-                ? RingData.AxisHeights[ThreadIdx] : 0.0f;
-            const float EdgeRatio = FMath::Clamp(
-                FMath::Abs(AxisHeight) / FMath::Max(RingHalfWidth, 0.01f), 0.0f, 2.0f);
-
-            // EdgeRatio > 1: Bulge region (positive), EdgeRatio < 1: Tightness region (negative)
-            RingData.FullDeformAmountMap[Vert.VertexIndex] = (EdgeRatio - 1.0f) * Vert.Influence;
-        }
-    }
-
-    // Step 6: Build full IsAnchor map (IsAnchor flags for all vertices)
-    // In Tolerance-based PBD, query neighbor's anchor status to determine weight distribution
-    // Affected Vertices = Anchor (1), Non-Affected = Free (0)
-    RingData.FullVertexAnchorFlags.Reset(TotalVertexCount);
-    RingData.FullVertexAnchorFlags.AddZeroed(TotalVertexCount);
-
-    for (int32 ThreadIdx = 0; ThreadIdx < NumAffected; ++ThreadIdx)
-    {
-        const FAffectedVertex& Vert = RingData.Vertices[ThreadIdx];
-        if (Vert.VertexIndex < static_cast<uint32>(TotalVertexCount))
-        {
-            // Affected Vertex = Anchor (fixed)
-            RingData.FullVertexAnchorFlags[Vert.VertexIndex] = 1;
-        }
-    }
-
-    UE_LOG(LogFleshRingVertices, Verbose,
-        TEXT("BuildPBDAdjacencyData: %d affected vertices, %d packed uints, %d total vertices in map, %d anchor flags"),
-        NumAffected, RingData.PBDAdjacencyWithRestLengths.Num(), TotalVertexCount, RingData.FullVertexAnchorFlags.Num());
-}
-
 // ============================================================================
 // BuildFullMeshAdjacency - build full mesh adjacency map
 // ============================================================================
@@ -0,0 +1,225 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingAnalyticProxy.cpp
+#include "FleshRingAnalyticProxy.h"
+#include "FleshRingMeshExtractor.h"
+#include "Engine/StaticMesh.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingAnalyticProxy, Log, All);
+
+namespace FleshRingAnalyticProxy
+{
+
+namespace
+{
+	constexpr int32 NumHeightBins = 16;
+
+	/** Measured radial profile per height bin */
+	struct FRadialProfile
+	{
+		float ZMin = 0.0f;
+		float BinHeight = 0.0f;
+		float InnerRadius[NumHeightBins];
+		float OuterRadius[NumHeightBins];
+		bool bHasSamples[NumHeightBins];
+
+		float GetBinCenterZ(int32 Bin) const
+		{
+			return ZMin + (Bin + 0.5f) * BinHeight;
+		}
+
+		/** Inner radius at arbitrary Z (linear between bin centers, clamped at ends) */
+		float SampleInner(float Z) const
+		{
+			const float BinCoord = FMath::Clamp((Z - ZMin) / BinHeight - 0.5f, 0.0f, static_cast<float>(NumHeightBins - 1));
+			const int32 Bin0 = FMath::FloorToInt32(BinCoord);
+			const int32 Bin1 = FMath::Min(Bin0 + 1, NumHeightBins - 1);
+			return FMath::Lerp(InnerRadius[Bin0], InnerRadius[Bin1], BinCoord - Bin0);
+		}
+	};
+
+	/** Build band settings for a given band section placement (band local Z: 0 = Mid Band center) */
+	FVirtualBandSettings MakeCandidate(const FRadialProfile& Profile, float TotalHeight, float BandBottom, float BandTop, float Thickness)
+	{
+		FVirtualBandSettings Band;
+		Band.BandOffset = FVector::ZeroVector;
+		Band.BandRotation = FQuat::Identity;
+		Band.BandEulerRotation = FRotator::ZeroRotator;
+		Band.Lower = FVirtualBandSection(Profile.InnerRadius[0], BandBottom - Profile.ZMin);
+		Band.Upper = FVirtualBandSection(Profile.InnerRadius[NumHeightBins - 1], Profile.ZMin + TotalHeight - BandTop);
+		Band.MidLowerRadius = FMath::Max(Profile.SampleInner(BandBottom), 0.1f);
+		Band.MidUpperRadius = FMath::Max(Profile.SampleInner(BandTop), 0.1f);
+		Band.BandHeight = FMath::Max(BandTop - BandBottom, 0.1f);
+		Band.BandThickness = FMath::Max(Thickness, 0.1f);
+		return Band;
+	}
+}
+
+bool FitBand(
+	const TArray<FVector3f>& Vertices,
+	const FVector3f& MeshScale,
+	FFleshRingAnalyticProxyFit& OutFit)
+{
+	OutFit = FFleshRingAnalyticProxyFit();
+
+	if (Vertices.Num() < NumHeightBins)
+	{
+		return false;
+	}
+
+	// Ring mesh local space with scale applied (same space the SDF volume is sized in)
+	TArray<FVector3f> Points;
+	Points.Reserve(Vertices.Num());
+	for (const FVector3f& Vertex : Vertices)
+	{
+		Points.Add(Vertex * MeshScale);
+	}
+
+	const FBox3f Bounds(Points);
+	const FVector3f Center = Bounds.GetCenter();
+	const float TotalHeight = Bounds.Max.Z - Bounds.Min.Z;
+	if (TotalHeight <= KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	// 1. Measure inner/outer radius per height bin
+	FRadialProfile Profile;
+	Profile.ZMin = Bounds.Min.Z;
+	Profile.BinHeight = TotalHeight / NumHeightBins;
+	for (int32 Bin = 0; Bin < NumHeightBins; ++Bin)
+	{
+		Profile.InnerRadius[Bin] = TNumericLimits<float>::Max();
+		Profile.OuterRadius[Bin] = 0.0f;
+		Profile.bHasSamples[Bin] = false;
+	}
+
+	auto GetBin = [&Profile](float Z)
+	{
+		return FMath::Clamp(FMath::FloorToInt32((Z - Profile.ZMin) / Profile.BinHeight), 0, NumHeightBins - 1);
+	};
+
+	for (const FVector3f& Point : Points)
+	{
+		const int32 Bin = GetBin(Point.Z);
+		const float Radius = FVector2f(Point.X - Center.X, Point.Y - Center.Y).Size();
+		Profile.InnerRadius[Bin] = FMath::Min(Profile.InnerRadius[Bin], Radius);
+		Profile.OuterRadius[Bin] = FMath::Max(Profile.OuterRadius[Bin], Radius);
+		Profile.bHasSamples[Bin] = true;
+	}
+
+	// Fill empty bins from nearest populated neighbor (sparse low-poly meshes)
+	int32 NumPopulated = 0;
+	for (int32 Bin = 0; Bin < NumHeightBins; ++Bin)
+	{
+		NumPopulated += Profile.bHasSamples[Bin] ? 1 : 0;
+	}
+	if (NumPopulated < 2 || !Profile.bHasSamples[0] || !Profile.bHasSamples[NumHeightBins - 1])
+	{
+		return false;
+	}
+	for (int32 Bin = 1; Bin < NumHeightBins; ++Bin)
+	{
+		if (!Profile.bHasSamples[Bin])
+		{
+			Profile.InnerRadius[Bin] = Profile.InnerRadius[Bin - 1];
+			Profile.OuterRadius[Bin] = Profile.OuterRadius[Bin - 1];
+		}
+	}
+
+	float ThicknessSum = 0.0f;
+	for (int32 Bin = 0; Bin < NumHeightBins; ++Bin)
+	{
+		ThicknessSum += Profile.OuterRadius[Bin] - Profile.InnerRadius[Bin];
+	}
+	const float Thickness = ThicknessSum / NumHeightBins;
+
+	// 2. Search band section placement (start/end bin boundaries) minimizing inner profile error
+	float BestProfileError = TNumericLimits<float>::Max();
+	FVirtualBandSettings BestBand;
+	float BestMidZ = 0.0f;
+
+	for (int32 StartBin = 0; StartBin < NumHeightBins; ++StartBin)
+	{
+		for (int32 EndBin = StartBin + 1; EndBin <= NumHeightBins; ++EndBin)
+		{
+			const float BandBottom = Profile.ZMin + StartBin * Profile.BinHeight;
+			const float BandTop = Profile.ZMin + EndBin * Profile.BinHeight;
+			const FVirtualBandSettings Candidate = MakeCandidate(Profile, TotalHeight, BandBottom, BandTop, Thickness);
+			const float MidZ = (BandBottom + BandTop) * 0.5f;
+
+			float SquaredError = 0.0f;
+			for (int32 Bin = 0; Bin < NumHeightBins; ++Bin)
+			{
+				const float Z = Profile.GetBinCenterZ(Bin);
+				SquaredError += FMath::Square(Candidate.GetRadiusAtHeight(Z - MidZ) - Profile.InnerRadius[Bin]);
+			}
+
+			if (SquaredError < BestProfileError)
+			{
+				BestProfileError = SquaredError;
+				BestBand = Candidate;
+				BestMidZ = MidZ;
+			}
+		}
+	}
+
+	// 3. Per-vertex error against fitted inner/outer surfaces (captures non-round cross sections too)
+	double SumSquaredError = 0.0;
+	float MaxError = 0.0f;
+	for (const FVector3f& Point : Points)
+	{
+		const float Radius = FVector2f(Point.X - Center.X, Point.Y - Center.Y).Size();
+		const float InnerRadius = BestBand.GetRadiusAtHeight(Point.Z - BestMidZ);
+		const float OuterRadius = InnerRadius + BestBand.BandThickness;
+		const float Error = FMath::Min(FMath::Abs(Radius - InnerRadius), FMath::Abs(Radius - OuterRadius));
+
+		SumSquaredError += static_cast<double>(Error) * Error;
+		MaxError = FMath::Max(MaxError, Error);
+	}
+
+	// Mid Band center in Ring mesh local (scaled) space
+	BestBand.BandOffset = FVector(Center.X, Center.Y, BestMidZ);
+
+	OutFit.Band = BestBand;
+	OutFit.NumSamples = Points.Num();
+	OutFit.RMSError = static_cast<float>(FMath::Sqrt(SumSquaredError / Points.Num()));
+	OutFit.MaxError = MaxError;
+	OutFit.bValid = true;
+	return true;
+}
+
+bool FitBandToMesh(
+	UStaticMesh* RingMesh,
+	const FVector& MeshScale,
+	FFleshRingAnalyticProxyFit& OutFit)
+{
+	OutFit = FFleshRingAnalyticProxyFit();
+
+	if (!RingMesh)
+	{
+		return false;
+	}
+
+	FFleshRingMeshData MeshData;
+	if (!UFleshRingMeshExtractor::ExtractMeshData(RingMesh, MeshData))
+	{
+		UE_LOG(LogFleshRingAnalyticProxy, Warning, TEXT("AnalyticProxy: Failed to extract mesh data from '%s'"), *RingMesh->GetName());
+		return false;
+	}
+
+	if (!FitBand(MeshData.Vertices, FVector3f(MeshScale), OutFit))
+	{
+		UE_LOG(LogFleshRingAnalyticProxy, Log, TEXT("AnalyticProxy: '%s' cannot be approximated by a band"), *RingMesh->GetName());
+		return false;
+	}
+
+	UE_LOG(LogFleshRingAnalyticProxy, Log,
+		TEXT("AnalyticProxy: '%s' fitted (RMS %.4f cm, Max %.4f cm, %d vertices) -> Radii L%.2f/ML%.2f/MU%.2f/U%.2f, Heights %.2f/%.2f/%.2f, Thickness %.2f"),
+		*RingMesh->GetName(), OutFit.RMSError, OutFit.MaxError, OutFit.NumSamples,
+		OutFit.Band.Lower.Radius, OutFit.Band.MidLowerRadius, OutFit.Band.MidUpperRadius, OutFit.Band.Upper.Radius,
+		OutFit.Band.Lower.Height, OutFit.Band.BandHeight, OutFit.Band.Upper.Height, OutFit.Band.BandThickness);
+	return true;
+}
+
+} // namespace FleshRingAnalyticProxy
@@ -7,6 +7,8 @@
 #include "Rendering/SkeletalMeshLODRenderData.h"
 #include "FleshRingSubdivisionProcessor.h"
 #include "FleshRingSkinnedMeshGenerator.h"
+#include "FleshRingSkinnedRingLibrary.h"
+#include "FleshRingSparseBake.h"
 
 #if WITH_EDITOR
 #include "UObject/ObjectSaveContext.h"
@@ -26,6 +28,14 @@
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Misc/TransactionObjectEvent.h"
+#include "FleshRingAnalyticProxy.h"
+#include "FleshRingSubdivisionDDC.h"
+#include "FleshRingLODTransfer.h"
+#include "FleshRingMeshOptimizer.h"
+#include "FleshRingBarycentricInterpolation.h"
+#include "Animation/MorphTarget.h"
+#include "Async/ParallelFor.h"
+#include <atomic>
 #endif
 
 DEFINE_LOG_CATEGORY_STATIC(LogFleshRingAsset, Log, All);
@@ -44,6 +54,44 @@ bool UFleshRingAsset::HasBakedMesh() const
 	return SubdivisionSettings.BakedMesh.Get() != nullptr;
 }
 
+bool UFleshRingAsset::HasSparseBake() const
+{
+	return SubdivisionSettings.SparseBakeLODs.Num() > 0 && SubdivisionSettings.SparseBakeLODs[0].IsValid();
+}
+
+TArray<TSharedPtr<FExternalMorphSet>> UFleshRingAsset::GetSparseMorphSets(const USkeletalMesh* BaseMesh)
+{
+	TArray<TSharedPtr<FExternalMorphSet>> MorphSets;
+	if (!BaseMesh || !HasSparseBake())
+	{
+		return MorphSets;
+	}
+
+	// Sets still held by another component on the same base mesh are reused (GPU buffers built once per asset)
+	TArray<TWeakPtr<FExternalMorphSet>>& CachedSets = SparseMorphSets.FindOrAdd(TObjectKey<USkeletalMesh>(BaseMesh));
+	const TArray<FFleshRingSparseBakeData>& SparseLODs = SubdivisionSettings.SparseBakeLODs;
+	CachedSets.SetNum(SparseLODs.Num());
+	MorphSets.SetNum(SparseLODs.Num());
+
+	for (int32 LODIndex = 0; LODIndex < SparseLODs.Num(); ++LODIndex)
+	{
+		MorphSets[LODIndex] = CachedSets[LODIndex].Pin();
+		if (!MorphSets[LODIndex].IsValid() && SparseLODs[LODIndex].IsValid())
+		{
+			MorphSets[LODIndex] = FleshRingSparseBake::CreateMorphSet(BaseMesh, LODIndex, SparseLODs[LODIndex],
+				FName(*FString::Printf(TEXT("FleshRingSparseBake_%s_LOD%d"), *GetName(), LODIndex)));
+			CachedSets[LODIndex] = MorphSets[LODIndex];
+		}
+	}
+
+	// LOD0 carries the ring effect; lower LODs without a set just render the original mesh
+	if (!MorphSets[0].IsValid())
+	{
+		MorphSets.Reset();
+	}
+	return MorphSets;
+}
+
 void UFleshRingAsset::PostLoad()
 {
 	Super::PostLoad();
@@ -83,6 +131,18 @@ void UFleshRingAsset::PostLoad()
 		}
 	}
 
+#if WITH_EDITOR
+	// Fit analytic proxies that were enabled but never fitted (e.g. Ring mesh changed outside the editor)
+	for (int32 RingIndex = 0; RingIndex < Rings.Num(); ++RingIndex)
+	{
+		const FFleshRingSettings& Ring = Rings[RingIndex];
+		if (Ring.bUseAnalyticProxy && Ring.InfluenceMode == EFleshRingInfluenceMode::MeshBased && Ring.AnalyticProxyFitError < 0.0f)
+		{
+			FitAnalyticProxies(RingIndex);
+		}
+	}
+#endif
+
 	// Reset editor selection state when asset is loaded
 	// (Serialized via UPROPERTY(), but always reset after load)
 	EditorSelectedRingIndex = -1;
@@ -337,36 +397,41 @@ uint32 UFleshRingAsset::CalculateSubdivisionParamsHash() const
 	// Subdivision settings
 	Hash = HashCombine(Hash, GetTypeHash(SubdivisionSettings.bEnableSubdivision));
 	Hash = HashCombine(Hash, GetTypeHash(SubdivisionSettings.MaxSubdivisionLevel));
+	for (int32 LODLevel : SubdivisionSettings.LowerLODSubdivisionLevels)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(LODLevel));
+	}
 	Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(SubdivisionSettings.MinEdgeLength * 100)));
 
-	// Ring settings (influence region related - affects subdivision target triangle selection)
+#if WITH_EDITOR
+	// Source mesh content (in-place reimport keeps the path)
+	if (USkeletalMesh* TargetMesh = TargetSkeletalMesh.Get())
+	{
+		if (FSkeletalMeshModel* ImportedModel = TargetMesh->GetImportedModel())
+		{
+			Hash = HashCombine(Hash, GetTypeHash(ImportedModel->GetIdString()));
+		}
+	}
+#endif
+
+	// Ring settings: region selection reads most Ring properties (SDF/band bounds, thickness, expansion,
+	// bulge ranges, smoothing bounds, and the DI affected set built from all of them), so hash the whole
+	// struct instead of picking fields (same approach as FFleshRingAffectedVerticesManager::CalculateRingCookKey)
 	for (const FFleshRingSettings& Ring : Rings)
 	{
-		// Basic Ring identification
-		Hash = HashCombine(Hash, GetTypeHash(Ring.BoneName.ToString()));
+		FFleshRingSettings KeySettings = Ring;
+		KeySettings.bEditorVisible = true;
+		KeySettings.RingName = NAME_None;
 
-		// InfluenceMode (Auto vs VirtualRing)
-		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Ring.InfluenceMode)));
+		FString SettingsText;
+		FFleshRingSettings::StaticStruct()->ExportText(SettingsText, &KeySettings, nullptr, nullptr, PPF_None, nullptr);
+		Hash = FCrc::StrCrc32(*SettingsText, Hash);
 
-		// Auto mode: RingMesh bounds + transform affect region
+		// RingMesh bounds drive Auto mode selection, and the mesh can be edited in place
 		if (!Ring.RingMesh.IsNull())
 		{
-			Hash = HashCombine(Hash, GetTypeHash(Ring.RingMesh.ToSoftObjectPath().ToString()));
+			Hash = HashCombine(Hash, FleshRingUtils::HashStaticMeshGeometry(Ring.RingMesh.LoadSynchronous()));
 		}
-		Hash = HashCombine(Hash, GetTypeHash(Ring.MeshOffset.ToString()));
-		Hash = HashCombine(Hash, GetTypeHash(Ring.MeshRotation.ToString()));
-		Hash = HashCombine(Hash, GetTypeHash(Ring.MeshScale.ToString()));
-
-		// VirtualRing mode: Torus parameters affect region
-		Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(Ring.RingRadius * 10)));
-		Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(Ring.RingHeight * 10)));
-		Hash = HashCombine(Hash, GetTypeHash(Ring.RingOffset.ToString()));
-		Hash = HashCombine(Hash, GetTypeHash(Ring.RingRotation.ToString()));
-
-		// Region expansion parameters (Refinement, Smoothing Volume)
-		Hash = HashCombine(Hash, GetTypeHash(Ring.bEnableRefinement));
-		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Ring.SmoothingVolumeMode)));
-		Hash = HashCombine(Hash, GetTypeHash(Ring.MaxSmoothingHops));
 	}
 
 	return Hash;
@@ -514,53 +579,29 @@ namespace SubdivisionHelpers
 		SelectedVertices.Append(Duplicates);
 	}
 
-	/**
-	 * Calculate component space transform along bone chain
-	 * @param BoneIndex - Bone index
-	 * @param RefSkeleton - Reference skeleton
-	 * @param RefBonePose - Reference bone pose
-	 * @return Component space bone transform
-	 */
-	FTransform CalculateBoneTransform(
-		int32 BoneIndex,
-		const FReferenceSkeleton& RefSkeleton,
-		const TArray<FTransform>& RefBonePose)
-	{
-		if (BoneIndex == INDEX_NONE || !RefBonePose.IsValidIndex(BoneIndex))
-		{
-			return FTransform::Identity;
-		}
-
-		FTransform BoneTransform = RefBonePose[BoneIndex];
-		int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
-
-		while (ParentIndex != INDEX_NONE)
-		{
-			BoneTransform = BoneTransform * RefBonePose[ParentIndex];
-			ParentIndex = RefSkeleton.GetParentIndex(ParentIndex);
-		}
-
-		return BoneTransform;
-	}
+	using FleshRingUtils::CalculateBoneTransform;
+	using FleshRingUtils::FRingSelectionVolume;
+	using FleshRingUtils::ResolveRingSelectionVolume;
 
 	/**
-	 * Select base affected vertices (Auto/VirtualRing mode)
-	 * @param Ring - Ring settings
+	 * Select base affected vertices (Auto/VirtualBand/VirtualRing mode)
+	 * @param Volume - Ring settings with resolved bone transform / mesh bounds
 	 * @param Positions - Vertex position array
-	 * @param BoneTransform - Bone's component space transform
 	 * @param OutAffectedVertices - Output: affected vertex index set
 	 * @param OutRingBounds - Output: Ring region's local bounds (valid only in Auto mode)
 	 * @param OutRingTransform - Output: Ring local → component transform
 	 * @return Success status
 	 */
 	bool SelectAffectedVertices(
-		const FFleshRingSettings& Ring,
+		const FRingSelectionVolume& Volume,
 		const TArray<FVector>& Positions,
-		const FTransform& BoneTransform,
 		TSet<uint32>& OutAffectedVertices,
 		FBox& OutRingBounds,
 		FTransform& OutRingTransform)
 	{
+		const FFleshRingSettings& Ring = Volume.Ring;
+		const FTransform& BoneTransform = Volume.BoneTransform;
+
 		OutAffectedVertices.Empty();
 		OutRingBounds = FBox(EForceInit::ForceInit);
 		OutRingTransform = FTransform::Identity;
@@ -570,24 +611,14 @@ namespace SubdivisionHelpers
 		constexpr float DefaultZMargin = 3.0f;  // cm
 		constexpr float DefaultRadialMargin = 1.5f;  // cm (for VirtualRing mode)
 
-		if (Ring.InfluenceMode == EFleshRingInfluenceMode::Auto && !Ring.RingMesh.IsNull())
+		if (Volume.bBoundsBased)
 		{
+			FBox MeshBounds = Volume.LocalBounds;
+			OutRingTransform = Volume.LocalToComponent;
+
 			// =====================================
-			// Auto mode: SDF bounds-based
+			// Auto / VirtualBand mode (incl. analytic proxy): SDF bounds-based
 			// =====================================
-			UStaticMesh* RingMesh = Ring.RingMesh.LoadSynchronous();
-			if (!RingMesh)
-			{
-				return false;
-			}
-
-			// RingMesh's local bounds
-			FBox MeshBounds = RingMesh->GetBoundingBox();
-
-			// Ring local → component space transform
-			FTransform MeshTransform(Ring.MeshRotation, Ring.MeshOffset);
-			MeshTransform.SetScale3D(Ring.MeshScale);
-			OutRingTransform = MeshTransform * BoneTransform;
 
 			// SDFBoundsExpandX/Y + default Z margin applied
 			// Add default margin in Z direction to include upper/lower boundary regions
@@ -616,14 +647,14 @@ namespace SubdivisionHelpers
 			// VirtualRing mode: Torus region-based
 			// =====================================
 			FVector LocalOffset = Ring.RingRotation.RotateVector(Ring.RingOffset);
-			FVector Center = BoneTransform.GetLocation() + LocalOffset;
-			FVector Axis = BoneTransform.GetRotation().RotateVector(
-				Ring.RingRotation.RotateVector(FVector::UpVector));
-			Axis.Normalize();
 
-			// Set Ring transform (used in BoundsExpand)
+			// Set Ring transform (used in BoundsExpand); the torus lives in the same frame
 			OutRingTransform = FTransform(Ring.RingRotation, LocalOffset) * BoneTransform;
 
+			FVector Center = OutRingTransform.GetLocation();
+			FVector Axis = OutRingTransform.GetRotation().RotateVector(FVector::UpVector);
+			Axis.Normalize();
+
 			// Torus parameters + default margin
 			// Add margin to include boundary region vertices
 			const float InnerRadius = FMath::Max(0.0f, Ring.RingRadius - DefaultRadialMargin);
@@ -1325,781 +1356,966 @@ namespace SubdivisionHelpers
 		}
 	}
 
-} // namespace SubdivisionHelpers
-
-// ============================================
-// UFleshRingAsset Editor-Only Functions
-// ============================================
-
-void UFleshRingAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
-{
-	Super::PostEditChangeProperty(PropertyChangedEvent);
-
-	// Sync FQuat when EulerRotation changes
-	for (FFleshRingSettings& Ring : Rings)
+	/** CPU copy of a render LOD's index buffer (empty when the index data is not CPU accessible) */
+	void CopyRenderIndices(const FSkeletalMeshLODRenderData& LODData, TArray<uint32>& OutIndices)
 	{
-		Ring.RingRotation = Ring.RingEulerRotation.Quaternion();
-		Ring.MeshRotation = Ring.MeshEulerRotation.Quaternion();
-		Ring.VirtualBand.BandRotation = Ring.VirtualBand.BandEulerRotation.Quaternion();
+		OutIndices.Reset();
+		if (const FRawStaticIndexBuffer16or32Interface* IndexBuffer = LODData.MultiSizeIndexContainer.GetIndexBuffer())
+		{
+			OutIndices.SetNumUninitialized(IndexBuffer->Num());
+			for (int32 i = 0; i < OutIndices.Num(); ++i)
+			{
+				OutIndices[i] = IndexBuffer->Get(i);
+			}
+		}
 	}
 
-	// Ensure RingName uniqueness (handle empty and duplicate names)
-	for (int32 i = 0; i < Rings.Num(); ++i)
+	/** Rest LOD0 render surface + deformation offsets (input of the lower LOD transfer, full and sparse bake) */
+	void BuildLODTransferSource(const FSkeletalMeshLODRenderData& RestLOD0,
+		const TArray<FVector3f>& DeformedPositions, const TArray<FVector3f>& DeformedNormals, bool bHasDeformedNormals,
+		FFleshRingLODTransferSource& OutSource)
 	{
-		FName& CurrentName = Rings[i].RingName;
+		OutSource = FFleshRingLODTransferSource();
 
-		// 1. Generate unique name if empty
-		if (CurrentName.IsNone())
+		const FPositionVertexBuffer& RestPositionBuffer = RestLOD0.StaticVertexBuffers.PositionVertexBuffer;
+		const int32 RestVertexCount = static_cast<int32>(RestPositionBuffer.GetNumVertices());
+		if (DeformedPositions.Num() != RestVertexCount)
 		{
-			CurrentName = MakeUniqueRingName(FName(TEXT("FleshRing")), i);
+			return;
 		}
 
-		// 2. Check for duplicates (compare with previous indices)
-		bool bIsDuplicate = false;
-		for (int32 j = 0; j < i; ++j)
+		bHasDeformedNormals &= DeformedNormals.Num() == RestVertexCount;
+		OutSource.RestPositions.SetNumUninitialized(RestVertexCount);
+		OutSource.PositionOffsets.SetNumUninitialized(RestVertexCount);
+		OutSource.NormalOffsets.SetNumZeroed(RestVertexCount);
+
+		for (int32 i = 0; i < RestVertexCount; ++i)
 		{
-			if (Rings[j].RingName == CurrentName)
+			OutSource.RestPositions[i] = RestPositionBuffer.VertexPosition(i);
+			OutSource.PositionOffsets[i] = DeformedPositions[i] - OutSource.RestPositions[i];
+			OutSource.MaxOffset = FMath::Max(OutSource.MaxOffset, OutSource.PositionOffsets[i].Size());
+
+			if (bHasDeformedNormals && !DeformedNormals[i].IsNearlyZero())
 			{
-				bIsDuplicate = true;
-				break;
+				const FVector4f RestNormal = RestLOD0.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(i);
+				OutSource.NormalOffsets[i] = DeformedNormals[i].GetSafeNormal() - FVector3f(RestNormal.X, RestNormal.Y, RestNormal.Z);
 			}
 		}
 
-		// 3. Generate unique name using MakeUniqueRingName if duplicate
-		if (bIsDuplicate)
+		CopyRenderIndices(RestLOD0, OutSource.RestIndices);
+
+		const FBox3f RestBounds(OutSource.RestPositions);
+		OutSource.BindSearchDistance = FMath::Max(RestBounds.GetExtent().GetMax() * 0.1f, 1.0f);
+	}
+
+	/** Sparse deltas of a lower render LOD from the transferred LOD0 deformation */
+	void BakeSparseLowerLOD(const FSkeletalMeshLODRenderData& LODData, int32 LODIndex,
+		const FFleshRingLODTransferSource& TransferSource, float PositionThreshold, FFleshRingSparseBakeData& OutData)
+	{
+		const FPositionVertexBuffer& PositionBuffer = LODData.StaticVertexBuffers.PositionVertexBuffer;
+		const FStaticMeshVertexBuffer& TangentBuffer = LODData.StaticVertexBuffers.StaticMeshVertexBuffer;
+		const int32 NumVertices = static_cast<int32>(PositionBuffer.GetNumVertices());
+
+		TArray<FVector3f> Positions;
+		Positions.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
 		{
-			CurrentName = MakeUniqueRingName(CurrentName, i);
+			Positions[i] = PositionBuffer.VertexPosition(i);
 		}
-	}
 
-	// Mark asset as modified
-	MarkPackageDirty();
+		TArray<FVector3f> PositionOffsets;
+		TArray<FVector3f> NormalOffsets;
+		const float SimplificationError = FleshRingLODTransfer::TransferOffsets(TransferSource, Positions, PositionOffsets, NormalOffsets);
 
-	// Check if change requires full refresh
-	bool bNeedsFullRefresh = false;
+		TArray<FVector3f> Normals;
+		Normals.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const FVector3f RestNormal = FVector3f(TangentBuffer.VertexTangentZ(i));
 
-	// Full update on array structure changes
-	if (PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayAdd ||
-		PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayRemove ||
-		PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayClear ||
-		PropertyChangedEvent.ChangeType == EPropertyChangeType::Duplicate ||
-		PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayMove)
-	{
-		bNeedsFullRefresh = true;
+			Positions[i] += PositionOffsets[i];
+
+			const FVector3f Normal = (RestNormal + NormalOffsets[i]).GetSafeNormal();
+			Normals[i] = (NormalOffsets[i].IsNearlyZero() || Normal.IsNearlyZero()) ? RestNormal : Normal;
+		}
+
+		FleshRingSparseBake::ExtractDeltas(LODData, Positions, Normals, PositionThreshold, OutData);
+
+		UE_LOG(LogFleshRingAsset, Log, TEXT("GenerateBakedMesh: Sparse bake LOD%d - transferred LOD0 deformation to %d / %d vertices (simplification error %.3f cm)"),
+			LODIndex, OutData.Num(), NumVertices, SimplificationError);
 	}
+} // namespace SubdivisionHelpers
 
-	// Full update on specific property changes
-	if (PropertyChangedEvent.Property)
-	{
-		FName PropName = PropertyChangedEvent.Property->GetFName();
+// ============================================
+// Staged subdivision (BeginSubdivision -> ComputeSubdivision -> FinishSubdivision)
+// ============================================
 
-		if (PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, TargetSkeletalMesh) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, bEnableSubdivision) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingMesh) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, BoneName) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, InfluenceMode) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MeshOffset) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MeshRotation) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MeshScale))
-		{
-			bNeedsFullRefresh = true;
+/** One LOD of a staged subdivision: source data gathered on the game thread, topology + interpolated streams computed on any thread */
+struct FFleshRingSubdivisionLODJob
+{
+	int32 LODIndex = 0;
+	int32 MaxLevel = 0;
 
-			// Sync Material Layer Mappings when TargetSkeletalMesh changes
-			if (PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, TargetSkeletalMesh))
-			{
-				SyncMaterialLayerMappings();
-			}
+	// Gathered on the game thread
+	// Double-precision copies feed region selection / Processor; float streams feed interpolation
+	uint32 SourceVertexCount = 0;
+	TArray<FVector> SourcePositions;
+	TArray<FVector2D> SourceUVs;
+	TArray<uint32> SourceIndices;
+	TArray<int32> SourceTriangleMaterialIndices;
+	FFleshRingVertexStreams SourceStreams;
+	TArray<FSubdivisionRingParams> RingParams;
+	TArray<FleshRingUtils::FRingSelectionVolume> RingVolumes;
+	TSet<int32> DITriangleIndices;
+	bool bUsedDIData = false;
+	FString TopologyDDCKey;
+
+	/** The asset's processor for this LOD (island cache survives between bakes), released once the topology is computed */
+	TSharedPtr<FFleshRingSubdivisionProcessor> Processor;
+
+	// Computed by ComputeSubdivision
+	bool bComputed = false;
+	FSubdivisionTopologyResult TopologyResult;
+	FFleshRingBarycentricParents Parents;
+	FFleshRingVertexStreams NewStreams;
+};
 
-		}
+struct FFleshRingSubdivisionJob
+{
+	/** Mesh the LOD data was gathered from (FinishSubdivision duplicates it) */
+	TWeakObjectPtr<USkeletalMesh> SourceMesh;
 
-		// Update debug visualization when VirtualRing mode Ring parameters change
-		// Recollect Affected Vertices when AffectedLayerMask changes
-		if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingRadius) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingThickness) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingHeight) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, AffectedLayerMask))
-		{
-			bNeedsFullRefresh = true;
-		}
+	/** CalculateSubdivisionParamsHash() at gather time, stored with the result */
+	uint32 ParamsHash = 0;
 
-		// Rebuild CachedVertexLayerTypes when Material Layer Mappings LayerType changes
-		if (PropName == GET_MEMBER_NAME_CHECKED(FMaterialLayerMapping, LayerType) ||
-			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, MaterialLayerMappings))
-		{
-			bNeedsFullRefresh = true;
-		}
+	float MinEdgeLength = 1.0f;
 
-		// Rebuild AffectedVertices when hop-based smoothing parameters change
-		if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MaxSmoothingHops) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, SmoothingVolumeMode))
-		{
-			bNeedsFullRefresh = true;
-		}
+	TArray<FFleshRingSubdivisionLODJob> LODs;
 
-		// Rebuild SmoothingRegion when smoothing enable flags change
-		// BuildHopDistanceData() is called conditionally on bAnySmoothingEnabled
-		// so cache invalidation is needed when these flags change
-		if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bEnableRefinement) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bEnableLaplacianSmoothing) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bEnablePBDEdgeConstraint) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bEnableHeatPropagation))
-		{
-			bNeedsFullRefresh = true;
-		}
+	/** Set by CancelSubdivision, ComputeSubdivision stops before the next LOD */
+	std::atomic<bool> bCancelled = false;
+};
 
-		// Full update when preview subdivision parameters change (cache invalidated via hash comparison in PreviewScene)
-		if (PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, PreviewSubdivisionLevel) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, PreviewBoneHopCount) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, PreviewBoneWeightThreshold) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, MinEdgeLength))
+namespace SubdivisionHelpers
+{
+	/**
+	 * Copy one render LOD of SourceMesh and resolve everything region selection needs from UObjects
+	 * @param SourceComponent - DI region source (nullptr = Ring-based region)
+	 * @return false if the LOD has no render data
+	 */
+	bool GatherSubdivisionLOD(const UFleshRingAsset& Asset, USkeletalMesh* SourceMesh, UFleshRingComponent* SourceComponent,
+		uint32 ParamsHash, FFleshRingSubdivisionLODJob& LOD)
+	{
+		// ============================================
+		// 1. Acquire source mesh render data
+		// ============================================
+		FSkeletalMeshRenderData* RenderData = SourceMesh->GetResourceForRendering();
+		if (!RenderData || !RenderData->LODRenderData.IsValidIndex(LOD.LODIndex))
 		{
-			bNeedsFullRefresh = true;
+			UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: No RenderData for LOD%d"), LOD.LODIndex);
+			return false;
 		}
 
-		// Cache invalidation needed when Normal/Tangent Recompute parameters change
-		// GPU normal/tangent cache must be invalidated when these properties change
-		if (PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, bEnableNormalRecompute) ||
-			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, NormalRecomputeMethod) ||
-			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, bEnableNormalHopBlending) ||
-			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, NormalBlendFalloffType) ||
-			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, bEnableDisplacementBlending) ||
-			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, MaxDisplacementForBlend) ||
-			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, bEnableTangentRecompute))
-		{
-			bNeedsFullRefresh = true;
-		}
+		const FSkeletalMeshLODRenderData& SourceLODData = RenderData->LODRenderData[LOD.LODIndex];
+		const uint32 SourceVertexCount = SourceLODData.StaticVertexBuffers.PositionVertexBuffer.GetNumVertices();
+		LOD.SourceVertexCount = SourceVertexCount;
 
-		// Detect VirtualBand-related property changes
-		// Check MemberProperty chain to determine if it's a VirtualBand sub-property
-		bool bIsVirtualBandProperty = false;
+		// ============================================
+		// 2. Extract source vertex data
+		// ============================================
+		TArray<FVector>& SourcePositions = LOD.SourcePositions;
+		TArray<FVector2D>& SourceUVs = LOD.SourceUVs;
+		FFleshRingVertexStreams& SourceStreams = LOD.SourceStreams;
 
-		// Direct property name check (VirtualBand related)
-		if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, VirtualBand) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, MidUpperRadius) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, MidLowerRadius) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, BandHeight) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, BandThickness) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, Upper) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, Lower) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSection, Radius) ||
-			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSection, Height))
+		SourcePositions.SetNum(SourceVertexCount);
+		SourceUVs.SetNum(SourceVertexCount);
+		SourceStreams.Positions.SetNum(SourceVertexCount);
+		SourceStreams.Normals.SetNum(SourceVertexCount);
+		SourceStreams.Tangents.SetNum(SourceVertexCount);
+		SourceStreams.UVs.SetNum(SourceVertexCount);
+
+		for (uint32 i = 0; i < SourceVertexCount; ++i)
 		{
-			bIsVirtualBandProperty = true;
+			SourceStreams.Positions[i] = SourceLODData.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(i);
+			SourceStreams.Normals[i] = FVector3f(SourceLODData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(i));
+			SourceStreams.Tangents[i] = SourceLODData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(i);
+			SourceStreams.UVs[i] = SourceLODData.StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(i, 0);
+			SourcePositions[i] = FVector(SourceStreams.Positions[i]);
+			SourceUVs[i] = FVector2D(SourceStreams.UVs[i]);
 		}
 
-		// Find VirtualBand in MemberProperty chain
-		if (!bIsVirtualBandProperty && PropertyChangedEvent.MemberProperty)
+		// Extract indices
+		TArray<uint32>& SourceIndices = LOD.SourceIndices;
+		const FRawStaticIndexBuffer16or32Interface* IndexBuffer = SourceLODData.MultiSizeIndexContainer.GetIndexBuffer();
+		if (IndexBuffer)
 		{
-			FName MemberName = PropertyChangedEvent.MemberProperty->GetFName();
-			if (MemberName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, VirtualBand))
+			const int32 NumIndices = IndexBuffer->Num();
+			SourceIndices.SetNum(NumIndices);
+			for (int32 i = 0; i < NumIndices; ++i)
 			{
-				bIsVirtualBandProperty = true;
+				SourceIndices[i] = IndexBuffer->Get(i);
 			}
 		}
 
-		if (bIsVirtualBandProperty)
+		// Extract material indices per section (per triangle)
 		{
-			bNeedsFullRefresh = true;
-		}
+			const int32 NumTriangles = SourceIndices.Num() / 3;
+			LOD.SourceTriangleMaterialIndices.SetNum(NumTriangles);
 
-		// Clear Subdivision meshes when TargetSkeletalMesh changes (needs regeneration with new mesh)
-		// (PreviewSubdividedMesh is managed in FleshRingPreviewScene - regenerated in OnAssetChanged)
-		if (PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, TargetSkeletalMesh))
-		{
-			// Also clear SubdividedMesh (needs regeneration since source mesh changed)
-			if (SubdivisionSettings.SubdividedMesh)
+			// Assign material indices based on triangle range of each section
+			for (const FSkelMeshRenderSection& Section : SourceLODData.RenderSections)
 			{
-				ClearSubdividedMesh();
-				// Prevent duplicate broadcast since ClearSubdividedMesh() calls OnAssetChanged.Broadcast()
-				bNeedsFullRefresh = false;
+				const int32 StartTriangle = Section.BaseIndex / 3;
+				const int32 EndTriangle = StartTriangle + Section.NumTriangles;
+
+				for (int32 TriIdx = StartTriangle; TriIdx < EndTriangle && TriIdx < NumTriangles; ++TriIdx)
+				{
+					LOD.SourceTriangleMaterialIndices[TriIdx] = Section.MaterialIndex;
+				}
 			}
 		}
 
-		// Clean up SubdividedMesh when bEnableSubdivision is set to false
-		// (Prevents crashes from state inconsistency)
-		if (PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, bEnableSubdivision))
+		// Extract bone weights
+		const int32 MaxBoneInfluences = SourceLODData.GetVertexBufferMaxBoneInfluences();
+		SourceStreams.NumBoneInfluences = MaxBoneInfluences;
+		SourceStreams.BoneIndices.SetNumZeroed(SourceVertexCount * MaxBoneInfluences);  // Converted to actual skeleton bone indices
+		SourceStreams.BoneWeights.SetNumZeroed(SourceVertexCount * MaxBoneInfluences);
+
+		// Create per-vertex section index map (for BoneMap conversion)
+		TArray<int32> VertexToSectionIndex;
+		VertexToSectionIndex.Init(INDEX_NONE, SourceVertexCount);
+
+		// Iterate index buffer to determine which section each vertex belongs to
+		for (int32 SectionIdx = 0; SectionIdx < SourceLODData.RenderSections.Num(); ++SectionIdx)
 		{
-			if (!SubdivisionSettings.bEnableSubdivision && SubdivisionSettings.SubdividedMesh)
+			const FSkelMeshRenderSection& Section = SourceLODData.RenderSections[SectionIdx];
+			const int32 StartIndex = Section.BaseIndex;
+			const int32 EndIndex = StartIndex + Section.NumTriangles * 3;
+
+			for (int32 IdxPos = StartIndex; IdxPos < EndIndex; ++IdxPos)
 			{
-				// ClearSubdividedMesh() internally calls OnAssetChanged.Broadcast()
-				ClearSubdividedMesh();
-				// Prevent duplicate broadcast
-				bNeedsFullRefresh = false;
+				uint32 VertexIdx = SourceIndices[IdxPos];
+				if (VertexIdx < SourceVertexCount && VertexToSectionIndex[VertexIdx] == INDEX_NONE)
+				{
+					VertexToSectionIndex[VertexIdx] = SectionIdx;
+				}
 			}
 		}
 
-		// Transform-related properties (Offset, Rotation, Scale, Radius, Strength, Falloff, etc.)
-		// don't need full update - handled via lightweight update
+		const FSkinWeightVertexBuffer* SkinWeightBuffer = SourceLODData.GetSkinWeightVertexBuffer();
+		if (SkinWeightBuffer && SkinWeightBuffer->GetNumVertices() > 0)
+		{
+			for (uint32 i = 0; i < SourceVertexCount; ++i)
+			{
+				// Find section the vertex belongs to
+				int32 SectionIdx = VertexToSectionIndex[i];
+				const TArray<FBoneIndexType>* BoneMap = nullptr;
+				if (SectionIdx != INDEX_NONE && SectionIdx < SourceLODData.RenderSections.Num())
+				{
+					BoneMap = &SourceLODData.RenderSections[SectionIdx].BoneMap;
+				}
+
+				for (int32 j = 0; j < MaxBoneInfluences; ++j)
+				{
+					uint16 LocalBoneIdx = SkinWeightBuffer->GetBoneIndex(i, j);
+					uint8 Weight = SkinWeightBuffer->GetBoneWeight(i, j);
+
+					// Convert to actual skeleton bone index using BoneMap
+					uint16 GlobalBoneIdx = LocalBoneIdx;
+					if (BoneMap && LocalBoneIdx < BoneMap->Num())
+					{
+						GlobalBoneIdx = (*BoneMap)[LocalBoneIdx];
+					}
+
+					SourceStreams.BoneIndices[i * MaxBoneInfluences + j] = GlobalBoneIdx;
+					SourceStreams.BoneWeights[i * MaxBoneInfluences + j] = Weight;
+				}
+			}
+		}
+
+		// ============================================
+		// 3. Ring selection volumes (RingMesh bounds need the loaded UStaticMesh)
+		// ============================================
+		const FReferenceSkeleton& RefSkeleton = SourceMesh->GetRefSkeleton();
+		const TArray<FTransform>& RefBonePose = RefSkeleton.GetRefBonePose();
+
+		for (const FFleshRingSettings& Ring : Asset.Rings)
+		{
+			const int32 BoneIndex = RefSkeleton.FindBoneIndex(Ring.BoneName);
+			const FRingSelectionVolume& Volume = LOD.RingVolumes.Add_GetRef(
+				ResolveRingSelectionVolume(Ring, CalculateBoneTransform(BoneIndex, RefSkeleton, RefBonePose)));
+
+			FSubdivisionRingParams& RingParams = LOD.RingParams.AddDefaulted_GetRef();
+			if (BoneIndex == INDEX_NONE)
+			{
+				UE_LOG(LogFleshRingAsset, Warning, TEXT("  Bone '%s' not found, using default center"),
+					*Ring.BoneName.ToString());
+				RingParams.bUseSDFBounds = false;
+				RingParams.Center = FVector::ZeroVector;
+				RingParams.Axis = FVector::UpVector;
+				RingParams.Radius = Ring.RingRadius;
+				RingParams.Width = Ring.RingHeight;
+			}
+			else
+			{
+				// RingMesh / (fitted) band bounds, or VirtualRing torus
+				FleshRingUtils::MakeSubdivisionRingParams(Volume, RingParams);
+			}
+		}
+
+		// ============================================
+		// 4. Topology cache key
+		// ============================================
+		// Affected triangles from SourceComponent's DI (preferred region source, see ComputeSubdivisionLOD) depend on runtime SDF state,
+		// so the extracted set itself is part of the topology key
+		LOD.bUsedDIData = SourceComponent &&
+			ExtractAffectedTrianglesFromDI(SourceComponent, SourceMesh, SourcePositions, SourceIndices, LOD.DITriangleIndices);
+
+		uint32 TopologyHash = HashCombine(ParamsHash, HashCombine(GetTypeHash(LOD.LODIndex), GetTypeHash(LOD.MaxLevel)));
+		if (LOD.bUsedDIData)
+		{
+			TArray<int32> SortedDITriangles = LOD.DITriangleIndices.Array();
+			SortedDITriangles.Sort();
+			TopologyHash = FCrc::MemCrc32(SortedDITriangles.GetData(), SortedDITriangles.Num() * sizeof(int32), TopologyHash);
+		}
+		LOD.TopologyDDCKey = FleshRingSubdivisionDDC::BuildKey(SourceMesh, TopologyHash);
+
+		return true;
 	}
 
-	// Broadcast full refresh only for structural changes
-	// VirtualBand properties only update on drag end (ValueSet), excluding Interactive
-	if (bNeedsFullRefresh && PropertyChangedEvent.ChangeType != EPropertyChangeType::Interactive)
+	/**
+	 * Topology (DDC cached) + attribute interpolation of one gathered LOD, touches no UObject
+	 * @return false if the processor failed
+	 */
+	bool ComputeSubdivisionLOD(FFleshRingSubdivisionLODJob& LOD, float MinEdgeLength)
 	{
-		OnAssetChanged.Broadcast(this);
-	}
-}
+		const TArray<FVector>& SourcePositions = LOD.SourcePositions;
+		const TArray<uint32>& SourceIndices = LOD.SourceIndices;
+		FSubdivisionTopologyResult& TopologyResult = LOD.TopologyResult;
 
-// Helper: Skeletal mesh validity check (common utility wrapper)
-static bool IsSkeletalMeshValidForUse(USkeletalMesh* Mesh)
-{
-	return FleshRingUtils::IsSkeletalMeshValid(Mesh, /*bLogWarnings=*/ false);
-}
+		// Unchanged source mesh + parameters: reuse cached topology (skips region selection + refinement)
+		if (FleshRingSubdivisionDDC::Get(LOD.TopologyDDCKey, LOD.SourceVertexCount, TopologyResult))
+		{
+			UE_LOG(LogFleshRingAsset, Log, TEXT("GenerateSubdividedMesh: Using cached topology (%d vertices, %d triangles)"),
+				TopologyResult.SubdividedVertexCount, TopologyResult.SubdividedTriangleCount);
+		}
+		else
+		{
+			if (!LOD.Processor.IsValid())
+			{
+				LOD.Processor = MakeShared<FFleshRingSubdivisionProcessor>();
+			}
+			FFleshRingSubdivisionProcessor& Processor = *LOD.Processor;
 
-void UFleshRingAsset::PostTransacted(const FTransactionObjectEvent& TransactionEvent)
-{
-	Super::PostTransacted(TransactionEvent);
+			// Unchanged source data keeps the processor's base mesh + island caches
+			if (!Processor.SetSourceMesh(SourcePositions, SourceIndices, LOD.SourceUVs, LOD.SourceTriangleMaterialIndices))
+			{
+				UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: SetSourceMesh failed"));
+				return false;
+			}
 
-	// Only process Undo/Redo events
-	if (TransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
-	{
-		return;
-	}
+			// Processor settings
+			FSubdivisionProcessorSettings Settings;
+			Settings.MaxSubdivisionLevel = LOD.MaxLevel;
+			Settings.MinEdgeLength = MinEdgeLength;
+			Processor.SetSettings(Settings);
 
-	// Detect Ring count changes (fixes hash comparison failure on Undo/Redo)
-	// LastKnownRingCount is not UPROPERTY so it's not included in transaction
-	// -> Not restored on Undo/Redo, enabling Ring add/delete detection
-	const int32 CurrentRingCount = Rings.Num();
-	LastKnownRingCount = CurrentRingCount;
+			// Set parameters for all Rings
+			Processor.ClearRingParams();
+			for (const FSubdivisionRingParams& RingParams : LOD.RingParams)
+			{
+				Processor.AddRingParams(RingParams);
+			}
 
-	// PreviewSubdividedMesh is now managed by FleshRingPreviewScene
-	// On Undo/Redo, just send asset change notification and PreviewScene handles regeneration via hash comparison
+			// ============================================
+			// Calculate Affected region (triangle-based)
+			// ============================================
+			// Priority:
+			// 1. Extract AffectedVertices positions from SourceComponent's DI -> Find triangles containing those positions
+			//    - Use PreviewMesh's subdivided vertex positions to accurately select original mesh triangles
+			//    - Includes new vertices (created by subdivision) so no region is missed
+			// 2. Fallback: Calculate based on original mesh vertices -> Convert to triangles
+			{
+				// Method 1: Triangles extracted from SourceComponent's DI (Point-in-Triangle), done at gather time
+				TSet<int32> CombinedTriangleIndices = MoveTemp(LOD.DITriangleIndices);
 
-	// Asset change notification (for Deformer parameter update, etc.)
-	OnAssetChanged.Broadcast(this);
-}
+				// Method 2: Fallback - Calculate vertices based on original mesh then convert to triangles
+				if (!LOD.bUsedDIData)
+				{
+					TSet<uint32> CombinedVertexIndices;
 
-void UFleshRingAsset::GenerateSubdividedMesh(UFleshRingComponent* SourceComponent)
-{
-	// Disable transaction - prevent mesh creation/cleanup from being included in Undo history
-	// Setting GUndo to nullptr causes Modify() calls to be ignored, not recorded in transaction
-	ITransaction* PreviousGUndo = GUndo;
-	GUndo = nullptr;
-	ON_SCOPE_EXIT { GUndo = PreviousGUndo; };
+					// Position grouping for UV Seam welding
+					TMap<FIntVector, TArray<uint32>> PositionGroups = BuildPositionGroups(SourcePositions);
 
-	// If SourceComponent exists, utilize DeformerInstance's AffectedVertices data
-	// Convert accurately calculated region from DI to original mesh indices via position-based matching
-	// If SourceComponent is null, fallback to direct calculation based on original mesh
+					// Build adjacency map (for HopBased)
+					TMap<uint32, TSet<uint32>> AdjacencyMap = BuildAdjacencyMap(SourceIndices);
 
-	// Remove previous SubdividedMesh first if exists (prevent name collision)
-	if (SubdivisionSettings.SubdividedMesh)
-	{
-		// Prevent memory leak: perform complete cleanup
-		USkeletalMesh* OldMesh = SubdivisionSettings.SubdividedMesh;
+					// UV Seam handling: Expand so same-position vertices share neighbors
+					ExpandAdjacencyForUVSeams(AdjacencyMap, PositionGroups);
 
-		// 1. Release pointer
-		SubdivisionSettings.SubdividedMesh = nullptr;
+					for (const FRingSelectionVolume& Volume : LOD.RingVolumes)
+					{
+						const FFleshRingSettings& Ring = Volume.Ring;
 
-		// 2. Fully release render resources
-		OldMesh->ReleaseResources();
-		OldMesh->ReleaseResourcesFence.Wait();
-		FlushRenderingCommands();
+						// 1. Select base Affected vertices
+						TSet<uint32> AffectedVertices;
+						FBox RingBounds;
+						FTransform RingTransform;
 
-		// 3. Change Outer to TransientPackage
-		OldMesh->Rename(nullptr, GetTransientPackage(),
-			REN_DontCreateRedirectors | REN_NonTransactional);
+						if (!SelectAffectedVertices(Volume, SourcePositions, AffectedVertices, RingBounds, RingTransform))
+						{
+							continue;
+						}
 
-		// 4. Clear flags
-		OldMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
-		OldMesh->SetFlags(RF_Transient);
+						// 2. Expansion based on SmoothingVolumeMode
+						TSet<uint32> ExtendedVertices;
 
-		// 5. Mark as garbage collection target
-		OldMesh->MarkAsGarbage();
+						if (!Ring.bEnableRefinement)
+						{
+							ExtendedVertices = AffectedVertices;
+						}
+						else if (Ring.SmoothingVolumeMode == ESmoothingVolumeMode::BoundsExpand)
+						{
+							ExpandByBounds(Ring, SourcePositions, RingTransform, RingBounds,
+								AffectedVertices, ExtendedVertices);
+						}
+						else // HopBased
+						{
+							ExpandByHops(AffectedVertices, AdjacencyMap, Ring.MaxSmoothingHops, ExtendedVertices);
+						}
 
-		// Note: Don't call OnAssetChanged.Broadcast()
-		// SubdividedMesh is for runtime, preview uses PreviewSubdividedMesh
-		// Broadcasting would reinitialize preview DeformerInstance causing deformation data loss
+						// 3. Select Bulge vertices (Union with smoothing region)
+						TSet<uint32> BulgeVertices;
+						SelectBulgeVertices(Ring, SourcePositions, Volume.BoneTransform, BulgeVertices);
+						ExtendedVertices.Append(BulgeVertices);
 
-		// Only directly update world FleshRingComponents (exclude preview)
-		if (GEngine)
-		{
-			for (const FWorldContext& Context : GEngine->GetWorldContexts())
-			{
-				if (UWorld* World = Context.World())
-				{
-					for (TActorIterator<AActor> It(World); It; ++It)
+						// 4. UV Seam handling: Also add same-position vertices of selected vertices
+						AddPositionDuplicates(ExtendedVertices, SourcePositions, PositionGroups);
+
+						// Add to union set
+						CombinedVertexIndices.Append(ExtendedVertices);
+					}
+
+					// Vertex -> Triangle conversion (for fallback case)
+					const int32 NumTriangles = SourceIndices.Num() / 3;
+					for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
 					{
-						if (UFleshRingComponent* Comp = It->FindComponentByClass<UFleshRingComponent>())
+						uint32 V0 = SourceIndices[TriIdx * 3 + 0];
+						uint32 V1 = SourceIndices[TriIdx * 3 + 1];
+						uint32 V2 = SourceIndices[TriIdx * 3 + 2];
+
+						if (CombinedVertexIndices.Contains(V0) ||
+							CombinedVertexIndices.Contains(V1) ||
+							CombinedVertexIndices.Contains(V2))
 						{
-							if (Comp->FleshRingAsset == this)
-							{
-								// ApplyAsset() sees SubdivisionSettings.SubdividedMesh == nullptr and switches to original mesh
-								Comp->ApplyAsset();
-							}
+							CombinedTriangleIndices.Add(TriIdx);
 						}
 					}
 				}
+
+				// Set triangle-based mode
+				if (CombinedTriangleIndices.Num() > 0)
+				{
+					Processor.SetTargetTriangleIndices(CombinedTriangleIndices);
+				}
+				else
+				{
+					UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateSubdividedMesh: No triangles selected, falling back to Ring params"));
+					Processor.ClearTargetTriangleIndices();
+				}
 			}
+
+			// Execute Subdivision
+			if (!Processor.Process(TopologyResult))
+			{
+				UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: Subdivision process failed"));
+				return false;
+			}
+
+			FleshRingSubdivisionDDC::Put(LOD.TopologyDDCKey, TopologyResult);
 		}
-	}
 
-	if (!SubdivisionSettings.bEnableSubdivision)
-	{
-		UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateSubdividedMesh: Subdivision is disabled"));
-		return;
-	}
+		// Hand the processor back (the next bake may start before this job is finished)
+		LOD.Processor.Reset();
 
-	if (TargetSkeletalMesh.IsNull())
-	{
-		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: TargetSkeletalMesh is not set"));
-		return;
-	}
+		// Vertex cache / fetch locality: reorder before interpolation so all per-vertex data follows
+		// (final ACMR is measured on the built render index buffer in FinishSubdivision)
+		{
+			float ACMRBefore = 0.0f;
+			float ACMRAfter = 0.0f;
+			FleshRingMeshOptimizer::OptimizeTopology(TopologyResult, ACMRBefore, ACMRAfter);
+			UE_LOG(LogFleshRingAsset, Verbose, TEXT("GenerateSubdividedMesh: LOD%d topology reordered, pre-build ACMR %.3f -> %.3f"),
+				LOD.LODIndex, ACMRBefore, ACMRAfter);
+		}
 
-	USkeletalMesh* SourceMesh = TargetSkeletalMesh.LoadSynchronous();
-	if (!SourceMesh)
-	{
-		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: Failed to load SourceMesh"));
-		return;
-	}
+		// Generate new vertex data (incl. bone weights) via Barycentric interpolation
+		LOD.Parents.Build(TopologyResult.VertexData, LOD.SourceVertexCount);
+		FleshRingBarycentricInterpolation::Interpolate(LOD.SourceStreams, LOD.Parents, LOD.NewStreams);
 
-	if (Rings.Num() == 0)
-	{
-		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: Ring is not configured"));
-		return;
-	}
+		// Source copies are no longer needed (the job may wait in a queue until FinishSubdivision)
+		LOD.SourcePositions.Empty();
+		LOD.SourceUVs.Empty();
+		LOD.SourceIndices.Empty();
+		LOD.SourceTriangleMaterialIndices.Empty();
+		LOD.SourceStreams = FFleshRingVertexStreams();
 
-	// ============================================
-	// 1. Acquire source mesh render data
-	// ============================================
-	FSkeletalMeshRenderData* RenderData = SourceMesh->GetResourceForRendering();
-	if (!RenderData || RenderData->LODRenderData.Num() == 0)
-	{
-		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: No RenderData"));
-		return;
+		return true;
 	}
+} // namespace SubdivisionHelpers
 
-	const FSkeletalMeshLODRenderData& SourceLODData = RenderData->LODRenderData[0];
-	const uint32 SourceVertexCount = SourceLODData.StaticVertexBuffers.PositionVertexBuffer.GetNumVertices();
-
-	// ============================================
-	// 2. Extract source vertex data
-	// ============================================
-	TArray<FVector> SourcePositions;
-	TArray<FVector> SourceNormals;
-	TArray<FVector4> SourceTangents;
-	TArray<FVector2D> SourceUVs;
+// ============================================
+// UFleshRingAsset Editor-Only Functions
+// ============================================
 
-	SourcePositions.SetNum(SourceVertexCount);
-	SourceNormals.SetNum(SourceVertexCount);
-	SourceTangents.SetNum(SourceVertexCount);
-	SourceUVs.SetNum(SourceVertexCount);
+void UFleshRingAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
 
-	for (uint32 i = 0; i < SourceVertexCount; ++i)
+	// Sync FQuat when EulerRotation changes
+	for (FFleshRingSettings& Ring : Rings)
 	{
-		SourcePositions[i] = FVector(SourceLODData.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(i));
-		SourceNormals[i] = FVector(SourceLODData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(i));
-		FVector4f TangentX = SourceLODData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(i);
-		SourceTangents[i] = FVector4(TangentX.X, TangentX.Y, TangentX.Z, TangentX.W);
-		SourceUVs[i] = FVector2D(SourceLODData.StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(i, 0));
+		Ring.RingRotation = Ring.RingEulerRotation.Quaternion();
+		Ring.MeshRotation = Ring.MeshEulerRotation.Quaternion();
+		Ring.VirtualBand.BandRotation = Ring.VirtualBand.BandEulerRotation.Quaternion();
 	}
 
-	// Extract indices
-	TArray<uint32> SourceIndices;
-	const FRawStaticIndexBuffer16or32Interface* IndexBuffer = SourceLODData.MultiSizeIndexContainer.GetIndexBuffer();
-	if (IndexBuffer)
+	// Ensure RingName uniqueness (handle empty and duplicate names)
+	for (int32 i = 0; i < Rings.Num(); ++i)
 	{
-		const int32 NumIndices = IndexBuffer->Num();
-		SourceIndices.SetNum(NumIndices);
-		for (int32 i = 0; i < NumIndices; ++i)
+		FName& CurrentName = Rings[i].RingName;
+
+		// 1. Generate unique name if empty
+		if (CurrentName.IsNone())
 		{
-			SourceIndices[i] = IndexBuffer->Get(i);
+			CurrentName = MakeUniqueRingName(FName(TEXT("FleshRing")), i);
 		}
-	}
-
-	// Extract material indices per section (per triangle)
-	TArray<int32> SourceTriangleMaterialIndices;
-	{
-		const int32 NumTriangles = SourceIndices.Num() / 3;
-		SourceTriangleMaterialIndices.SetNum(NumTriangles);
 
-		// Assign material indices based on triangle range of each section
-		for (const FSkelMeshRenderSection& Section : SourceLODData.RenderSections)
+		// 2. Check for duplicates (compare with previous indices)
+		bool bIsDuplicate = false;
+		for (int32 j = 0; j < i; ++j)
 		{
-			const int32 StartTriangle = Section.BaseIndex / 3;
-			const int32 EndTriangle = StartTriangle + Section.NumTriangles;
-
-			for (int32 TriIdx = StartTriangle; TriIdx < EndTriangle && TriIdx < NumTriangles; ++TriIdx)
+			if (Rings[j].RingName == CurrentName)
 			{
-				SourceTriangleMaterialIndices[TriIdx] = Section.MaterialIndex;
+				bIsDuplicate = true;
+				break;
 			}
 		}
 
+		// 3. Generate unique name using MakeUniqueRingName if duplicate
+		if (bIsDuplicate)
+		{
+			CurrentName = MakeUniqueRingName(CurrentName, i);
+		}
 	}
 
-	// Extract bone weights
-	const int32 MaxBoneInfluences = SourceLODData.GetVertexBufferMaxBoneInfluences();
-	TArray<TArray<uint16>> SourceBoneIndices;  // Converted to actual skeleton bone indices
-	TArray<TArray<uint8>> SourceBoneWeights;
+	// Mark asset as modified
+	MarkPackageDirty();
 
-	SourceBoneIndices.SetNum(SourceVertexCount);
-	SourceBoneWeights.SetNum(SourceVertexCount);
+	// Check if change requires full refresh
+	bool bNeedsFullRefresh = false;
 
-	// Create per-vertex section index map (for BoneMap conversion)
-	TArray<int32> VertexToSectionIndex;
-	VertexToSectionIndex.SetNum(SourceVertexCount);
-	for (int32& SectionIdx : VertexToSectionIndex)
+	// Full update on array structure changes
+	if (PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayAdd ||
+		PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayRemove ||
+		PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayClear ||
+		PropertyChangedEvent.ChangeType == EPropertyChangeType::Duplicate ||
+		PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayMove)
 	{
-		SectionIdx = INDEX_NONE;
+		bNeedsFullRefresh = true;
 	}
 
-	// Iterate index buffer to determine which section each vertex belongs to
-	for (int32 SectionIdx = 0; SectionIdx < SourceLODData.RenderSections.Num(); ++SectionIdx)
+	// Full update on specific property changes
+	if (PropertyChangedEvent.Property)
 	{
-		const FSkelMeshRenderSection& Section = SourceLODData.RenderSections[SectionIdx];
-		const int32 StartIndex = Section.BaseIndex;
-		const int32 EndIndex = StartIndex + Section.NumTriangles * 3;
-
-		for (int32 IdxPos = StartIndex; IdxPos < EndIndex; ++IdxPos)
-		{
-			uint32 VertexIdx = SourceIndices[IdxPos];
-			if (VertexIdx < SourceVertexCount && VertexToSectionIndex[VertexIdx] == INDEX_NONE)
-			{
-				VertexToSectionIndex[VertexIdx] = SectionIdx;
-			}
-		}
-	}
+		FName PropName = PropertyChangedEvent.Property->GetFName();
 
-	const FSkinWeightVertexBuffer* SkinWeightBuffer = SourceLODData.GetSkinWeightVertexBuffer();
-	if (SkinWeightBuffer && SkinWeightBuffer->GetNumVertices() > 0)
-	{
-		for (uint32 i = 0; i < SourceVertexCount; ++i)
+		if (PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, TargetSkeletalMesh) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, bEnableSubdivision) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingMesh) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, BoneName) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, InfluenceMode) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MeshOffset) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MeshRotation) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MeshScale) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bUseAnalyticProxy) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, AnalyticProxyMaxError))
 		{
-			SourceBoneIndices[i].SetNum(MaxBoneInfluences);
-			SourceBoneWeights[i].SetNum(MaxBoneInfluences);
+			bNeedsFullRefresh = true;
 
-			// Find section the vertex belongs to
-			int32 SectionIdx = VertexToSectionIndex[i];
-			const TArray<FBoneIndexType>* BoneMap = nullptr;
-			if (SectionIdx != INDEX_NONE && SectionIdx < SourceLODData.RenderSections.Num())
+			// Refit analytic proxies when the Ring mesh shape (or proxy usage) changes
+			if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingMesh) ||
+				PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, InfluenceMode) ||
+				PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MeshScale) ||
+				PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bUseAnalyticProxy))
 			{
-				BoneMap = &SourceLODData.RenderSections[SectionIdx].BoneMap;
+				FitAnalyticProxies();
 			}
 
-			for (int32 j = 0; j < MaxBoneInfluences; ++j)
+			// Sync Material Layer Mappings when TargetSkeletalMesh changes
+			if (PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, TargetSkeletalMesh))
 			{
-				uint16 LocalBoneIdx = SkinWeightBuffer->GetBoneIndex(i, j);
-				uint8 Weight = SkinWeightBuffer->GetBoneWeight(i, j);
+				SyncMaterialLayerMappings();
+			}
 
-				// Convert to actual skeleton bone index using BoneMap
-				uint16 GlobalBoneIdx = LocalBoneIdx;
-				if (BoneMap && LocalBoneIdx < BoneMap->Num())
-				{
-					GlobalBoneIdx = (*BoneMap)[LocalBoneIdx];
-				}
+		}
 
-				SourceBoneIndices[i][j] = GlobalBoneIdx;
-				SourceBoneWeights[i][j] = Weight;
-			}
+		// Update debug visualization when VirtualRing mode Ring parameters change
+		// Recollect Affected Vertices when AffectedLayerMask changes
+		if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingRadius) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingThickness) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, RingHeight) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, AffectedLayerMask))
+		{
+			bNeedsFullRefresh = true;
 		}
-	}
 
-	// ============================================
-	// 3. Calculate topology with Subdivision processor
-	// ============================================
-	FFleshRingSubdivisionProcessor Processor;
+		// Rebuild CachedVertexLayerTypes when Material Layer Mappings LayerType changes
+		if (PropName == GET_MEMBER_NAME_CHECKED(FMaterialLayerMapping, LayerType) ||
+			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, MaterialLayerMappings))
+		{
+			bNeedsFullRefresh = true;
+		}
 
-	if (!Processor.SetSourceMesh(SourcePositions, SourceIndices, SourceUVs, SourceTriangleMaterialIndices))
-	{
-		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: SetSourceMesh failed"));
-		return;
-	}
+		// Rebuild AffectedVertices when hop-based smoothing parameters change
+		if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, MaxSmoothingHops) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, SmoothingVolumeMode))
+		{
+			bNeedsFullRefresh = true;
+		}
 
-	// Processor settings
-	FSubdivisionProcessorSettings Settings;
-	Settings.MaxSubdivisionLevel = SubdivisionSettings.MaxSubdivisionLevel;
-	Settings.MinEdgeLength = SubdivisionSettings.MinEdgeLength;
-	Processor.SetSettings(Settings);
+		// Rebuild SmoothingRegion when smoothing enable flags change
+		// BuildHopDistanceData() is called conditionally on bAnySmoothingEnabled
+		// so cache invalidation is needed when these flags change
+		if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bEnableRefinement) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bEnableLaplacianSmoothing) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bEnablePBDEdgeConstraint) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, bEnableHeatPropagation))
+		{
+			bNeedsFullRefresh = true;
+		}
 
-	// Set parameters for all Rings
-	const USkeleton* Skeleton = SourceMesh->GetSkeleton();
-	const FReferenceSkeleton& RefSkeleton = SourceMesh->GetRefSkeleton();
-	const TArray<FTransform>& RefBonePose = RefSkeleton.GetRefBonePose();
+		// Full update when preview subdivision parameters change (cache invalidated via hash comparison in PreviewScene)
+		if (PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, PreviewSubdivisionLevel) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, PreviewBoneHopCount) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, PreviewBoneWeightThreshold) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, MinEdgeLength))
+		{
+			bNeedsFullRefresh = true;
+		}
 
-	Processor.ClearRingParams();
+		// Cache invalidation needed when Normal/Tangent Recompute parameters change
+		// GPU normal/tangent cache must be invalidated when these properties change
+		if (PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, bEnableNormalRecompute) ||
+			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, NormalRecomputeMethod) ||
+			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, bEnableNormalHopBlending) ||
+			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, NormalBlendFalloffType) ||
+			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, bEnableDisplacementBlending) ||
+			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, MaxDisplacementForBlend) ||
+			PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, bEnableTangentRecompute))
+		{
+			bNeedsFullRefresh = true;
+		}
 
-	for (int32 RingIdx = 0; RingIdx < Rings.Num(); ++RingIdx)
-	{
-		const FFleshRingSettings& Ring = Rings[RingIdx];
-		FSubdivisionRingParams RingParams;
+		// Detect VirtualBand-related property changes
+		// Check MemberProperty chain to determine if it's a VirtualBand sub-property
+		bool bIsVirtualBandProperty = false;
 
-		int32 BoneIndex = RefSkeleton.FindBoneIndex(Ring.BoneName);
+		// Direct property name check (VirtualBand related)
+		if (PropName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, VirtualBand) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, MidUpperRadius) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, MidLowerRadius) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, BandHeight) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, BandThickness) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, Upper) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSettings, Lower) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSection, Radius) ||
+			PropName == GET_MEMBER_NAME_CHECKED(FVirtualBandSection, Height))
+		{
+			bIsVirtualBandProperty = true;
+		}
 
-		if (BoneIndex != INDEX_NONE)
+		// Find VirtualBand in MemberProperty chain
+		if (!bIsVirtualBandProperty && PropertyChangedEvent.MemberProperty)
 		{
-			// Calculate component space transform (accumulate along parent bone chain)
-			FTransform BoneTransform = RefBonePose[BoneIndex];
-			int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
-			while (ParentIndex != INDEX_NONE)
+			FName MemberName = PropertyChangedEvent.MemberProperty->GetFName();
+			if (MemberName == GET_MEMBER_NAME_CHECKED(FFleshRingSettings, VirtualBand))
 			{
-				BoneTransform = BoneTransform * RefBonePose[ParentIndex];
-				ParentIndex = RefSkeleton.GetParentIndex(ParentIndex);
+				bIsVirtualBandProperty = true;
 			}
+		}
 
-			// Auto mode: Use RingMesh bounds
-			if (Ring.InfluenceMode == EFleshRingInfluenceMode::Auto && !Ring.RingMesh.IsNull())
-			{
-				UStaticMesh* RingMesh = Ring.RingMesh.LoadSynchronous();
-				if (RingMesh)
-				{
-					RingParams.bUseSDFBounds = true;
-
-					// Get local bounds of RingMesh
-					FBox MeshBounds = RingMesh->GetBoundingBox();
-
-					// Calculate transform same way as FleshRingComponent::GenerateSDF
-					FTransform MeshTransform = FTransform(Ring.MeshRotation, Ring.MeshOffset);
-					MeshTransform.SetScale3D(Ring.MeshScale);
-					FTransform LocalToComponent = MeshTransform * BoneTransform;
+		if (bIsVirtualBandProperty)
+		{
+			bNeedsFullRefresh = true;
+		}
 
-					RingParams.SDFBoundsMin = FVector(MeshBounds.Min);
-					RingParams.SDFBoundsMax = FVector(MeshBounds.Max);
-					RingParams.SDFLocalToComponent = LocalToComponent;
-				}
-				else
-				{
-					RingParams.bUseSDFBounds = false;
-				}
-			}
-			else
+		// Clear Subdivision meshes when TargetSkeletalMesh changes (needs regeneration with new mesh)
+		// (PreviewSubdividedMesh is managed in FleshRingPreviewScene - regenerated in OnAssetChanged)
+		if (PropName == GET_MEMBER_NAME_CHECKED(UFleshRingAsset, TargetSkeletalMesh))
+		{
+			// Also clear SubdividedMesh (needs regeneration since source mesh changed)
+			if (SubdivisionSettings.SubdividedMesh)
 			{
-				// VirtualRing mode: Use Torus parameters
-				RingParams.bUseSDFBounds = false;
-
-				FVector LocalOffset = Ring.RingRotation.RotateVector(Ring.RingOffset);
-				RingParams.Center = BoneTransform.GetLocation() + LocalOffset;
-				RingParams.Axis = Ring.RingRotation.RotateVector(FVector::UpVector);
-				RingParams.Radius = Ring.RingRadius;
-				RingParams.Width = Ring.RingHeight;
+				ClearSubdividedMesh();
+				// Prevent duplicate broadcast since ClearSubdividedMesh() calls OnAssetChanged.Broadcast()
+				bNeedsFullRefresh = false;
 			}
 		}
-		else
+
+		// Clean up SubdividedMesh when bEnableSubdivision is set to false
+		// (Prevents crashes from state inconsistency)
+		if (PropName == GET_MEMBER_NAME_CHECKED(FSubdivisionSettings, bEnableSubdivision))
 		{
-			UE_LOG(LogFleshRingAsset, Warning, TEXT("  Bone '%s' not found, using default center"),
-				*Ring.BoneName.ToString());
-			RingParams.bUseSDFBounds = false;
-			RingParams.Center = FVector::ZeroVector;
-			RingParams.Axis = FVector::UpVector;
-			RingParams.Radius = Ring.RingRadius;
-			RingParams.Width = Ring.RingHeight;
+			if (!SubdivisionSettings.bEnableSubdivision && SubdivisionSettings.SubdividedMesh)
+			{
+				// ClearSubdividedMesh() internally calls OnAssetChanged.Broadcast()
+				ClearSubdividedMesh();
+				// Prevent duplicate broadcast
+				bNeedsFullRefresh = false;
+			}
 		}
 
-		Processor.AddRingParams(RingParams);
+		// Transform-related properties (Offset, Rotation, Scale, Radius, Strength, Falloff, etc.)
+		// don't need full update - handled via lightweight update
 	}
 
-	// ============================================
-	// 3-1. Calculate Affected region (triangle-based)
-	// ============================================
-	// Priority:
-	// 1. Extract AffectedVertices positions from SourceComponent's DI -> Find triangles containing those positions
-	//    - Use PreviewMesh's subdivided vertex positions to accurately select original mesh triangles
-	//    - Includes new vertices (created by subdivision) so no region is missed
-	// 2. Fallback: Calculate based on original mesh vertices -> Convert to triangles
+	// Broadcast full refresh only for structural changes
+	// VirtualBand properties only update on drag end (ValueSet), excluding Interactive
+	if (bNeedsFullRefresh && PropertyChangedEvent.ChangeType != EPropertyChangeType::Interactive)
 	{
-		using namespace SubdivisionHelpers;
+		OnAssetChanged.Broadcast(this);
+	}
+}
 
-		TSet<int32> CombinedTriangleIndices;
-		bool bUsedDIData = false;
+// Helper: Skeletal mesh validity check (common utility wrapper)
+static bool IsSkeletalMeshValidForUse(USkeletalMesh* Mesh)
+{
+	return FleshRingUtils::IsSkeletalMeshValid(Mesh, /*bLogWarnings=*/ false);
+}
 
-		// Method 1: Try extracting triangles from SourceComponent's DI (Point-in-Triangle)
-		if (SourceComponent)
-		{
-			if (ExtractAffectedTrianglesFromDI(SourceComponent, SourceMesh, SourcePositions, SourceIndices, CombinedTriangleIndices))
-			{
-				bUsedDIData = true;
-			}
-		}
+void UFleshRingAsset::PostTransacted(const FTransactionObjectEvent& TransactionEvent)
+{
+	Super::PostTransacted(TransactionEvent);
 
-		// Method 2: Fallback - Calculate vertices based on original mesh then convert to triangles
-		if (!bUsedDIData)
-		{
+	// Only process Undo/Redo events
+	if (TransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
+	{
+		return;
+	}
+
+	// Detect Ring count changes (fixes hash comparison failure on Undo/Redo)
+	// LastKnownRingCount is not UPROPERTY so it's not included in transaction
+	// -> Not restored on Undo/Redo, enabling Ring add/delete detection
+	const int32 CurrentRingCount = Rings.Num();
+	LastKnownRingCount = CurrentRingCount;
 
-			TSet<uint32> CombinedVertexIndices;
+	// PreviewSubdividedMesh is now managed by FleshRingPreviewScene
+	// On Undo/Redo, just send asset change notification and PreviewScene handles regeneration via hash comparison
+
+	// Asset change notification (for Deformer parameter update, etc.)
+	OnAssetChanged.Broadcast(this);
+}
+
+void UFleshRingAsset::GenerateSubdividedMesh(UFleshRingComponent* SourceComponent)
+{
+	// Disable transaction - prevent mesh creation/cleanup from being included in Undo history
+	// Setting GUndo to nullptr causes Modify() calls to be ignored, not recorded in transaction
+	ITransaction* PreviousGUndo = GUndo;
+	GUndo = nullptr;
+	ON_SCOPE_EXIT { GUndo = PreviousGUndo; };
 
-			// Position grouping for UV Seam welding
-			TMap<FIntVector, TArray<uint32>> PositionGroups = BuildPositionGroups(SourcePositions);
+	// If SourceComponent exists, utilize DeformerInstance's AffectedVertices data
+	// Convert accurately calculated region from DI to original mesh indices via position-based matching
+	// If SourceComponent is null, fallback to direct calculation based on original mesh
 
-			// Build adjacency map (for HopBased)
-			TMap<uint32, TSet<uint32>> AdjacencyMap = BuildAdjacencyMap(SourceIndices);
+	// Remove previous SubdividedMesh first if exists (also when regeneration below fails)
+	DiscardSubdividedMeshForRebuild();
 
-			// UV Seam handling: Expand so same-position vertices share neighbors
-			ExpandAdjacencyForUVSeams(AdjacencyMap, PositionGroups);
+	TSharedPtr<FFleshRingSubdivisionJob> Job = BeginSubdivision(SourceComponent);
+	if (!Job.IsValid())
+	{
+		return;
+	}
 
-			for (int32 RingIdx = 0; RingIdx < Rings.Num(); ++RingIdx)
-			{
-				const FFleshRingSettings& Ring = Rings[RingIdx];
+	ComputeSubdivision(*Job);
+	FinishSubdivision(*Job);
+}
 
-				// Calculate bone transform
-				int32 BoneIndex = RefSkeleton.FindBoneIndex(Ring.BoneName);
-				FTransform BoneTransform = CalculateBoneTransform(BoneIndex, RefSkeleton, RefBonePose);
+void UFleshRingAsset::DiscardSubdividedMeshForRebuild()
+{
+	if (!SubdivisionSettings.SubdividedMesh)
+	{
+		return;
+	}
 
-				// 1. Select base Affected vertices
-				TSet<uint32> AffectedVertices;
-				FBox RingBounds;
-				FTransform RingTransform;
+	// Prevent memory leak: perform complete cleanup
+	USkeletalMesh* OldMesh = SubdivisionSettings.SubdividedMesh;
 
-				if (!SelectAffectedVertices(Ring, SourcePositions, BoneTransform,
-					AffectedVertices, RingBounds, RingTransform))
-				{
-					continue;
-				}
+	// 1. Release pointer
+	SubdivisionSettings.SubdividedMesh = nullptr;
 
-				// 2. Expansion based on SmoothingVolumeMode
-				TSet<uint32> ExtendedVertices;
+	// 2. Fully release render resources (fence wait blocks until released, no extra flush)
+	OldMesh->ReleaseResources();
+	OldMesh->ReleaseResourcesFence.Wait();
 
-				if (!Ring.bEnableRefinement)
-				{
-					ExtendedVertices = AffectedVertices;
-				}
-				else if (Ring.SmoothingVolumeMode == ESmoothingVolumeMode::BoundsExpand)
-				{
-					ExpandByBounds(Ring, SourcePositions, RingTransform, RingBounds,
-						AffectedVertices, ExtendedVertices);
-				}
-				else // HopBased
-				{
-					ExpandByHops(AffectedVertices, AdjacencyMap, Ring.MaxSmoothingHops, ExtendedVertices);
-				}
+	// 3. Change Outer to TransientPackage
+	OldMesh->Rename(nullptr, GetTransientPackage(),
+		REN_DontCreateRedirectors | REN_NonTransactional);
 
-				// 3. Select Bulge vertices (Union with smoothing region)
-				TSet<uint32> BulgeVertices;
-				SelectBulgeVertices(Ring, SourcePositions, BoneTransform, BulgeVertices);
-				ExtendedVertices.Append(BulgeVertices);
+	// 4. Clear flags
+	OldMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
+	OldMesh->SetFlags(RF_Transient);
 
-				// 4. UV Seam handling: Also add same-position vertices of selected vertices
-				AddPositionDuplicates(ExtendedVertices, SourcePositions, PositionGroups);
+	// 5. Mark as garbage collection target
+	OldMesh->MarkAsGarbage();
 
-				// Add to union set
-				CombinedVertexIndices.Append(ExtendedVertices);
-			}
+	// Note: Don't call OnAssetChanged.Broadcast()
+	// SubdividedMesh is for runtime, preview uses PreviewSubdividedMesh
+	// Broadcasting would reinitialize preview DeformerInstance causing deformation data loss
 
-			// Vertex -> Triangle conversion (for fallback case)
-			const int32 NumTriangles = SourceIndices.Num() / 3;
-			for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
+	// Only directly update world FleshRingComponents (exclude preview)
+	if (GEngine)
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (UWorld* World = Context.World())
 			{
-				uint32 V0 = SourceIndices[TriIdx * 3 + 0];
-				uint32 V1 = SourceIndices[TriIdx * 3 + 1];
-				uint32 V2 = SourceIndices[TriIdx * 3 + 2];
-
-				if (CombinedVertexIndices.Contains(V0) ||
-					CombinedVertexIndices.Contains(V1) ||
-					CombinedVertexIndices.Contains(V2))
+				for (TActorIterator<AActor> It(World); It; ++It)
 				{
-					CombinedTriangleIndices.Add(TriIdx);
+					if (UFleshRingComponent* Comp = It->FindComponentByClass<UFleshRingComponent>())
+					{
+						if (Comp->FleshRingAsset == this)
+						{
+							// ApplyAsset() sees SubdivisionSettings.SubdividedMesh == nullptr and switches to original mesh
+							Comp->ApplyAsset();
+						}
+					}
 				}
 			}
 		}
+	}
+}
 
-		// Set triangle-based mode
-		if (CombinedTriangleIndices.Num() > 0)
-		{
-			Processor.SetTargetTriangleIndices(CombinedTriangleIndices);
-		}
-		else
-		{
-			UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateSubdividedMesh: No triangles selected, falling back to Ring params"));
-		}
+TSharedPtr<FFleshRingSubdivisionJob> UFleshRingAsset::BeginSubdivision(UFleshRingComponent* SourceComponent)
+{
+	if (!SubdivisionSettings.bEnableSubdivision)
+	{
+		UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateSubdividedMesh: Subdivision is disabled"));
+		return nullptr;
 	}
 
-	// Execute Subdivision
-	FSubdivisionTopologyResult TopologyResult;
-	if (!Processor.Process(TopologyResult))
+	if (TargetSkeletalMesh.IsNull())
 	{
-		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: Subdivision process failed"));
-		return;
+		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: TargetSkeletalMesh is not set"));
+		return nullptr;
 	}
 
-	// ============================================
-	// 4. Generate new vertex data via Barycentric interpolation
-	// ============================================
-	const int32 NewVertexCount = TopologyResult.VertexData.Num();
-	TArray<FVector> NewPositions;
-	TArray<FVector> NewNormals;
-	TArray<FVector4> NewTangents;
-	TArray<FVector2D> NewUVs;
-	TArray<TArray<uint16>> NewBoneIndices;
-	TArray<TArray<uint8>> NewBoneWeights;
-
-	NewPositions.SetNum(NewVertexCount);
-	NewNormals.SetNum(NewVertexCount);
-	NewTangents.SetNum(NewVertexCount);
-	NewUVs.SetNum(NewVertexCount);
-	NewBoneIndices.SetNum(NewVertexCount);
-	NewBoneWeights.SetNum(NewVertexCount);
-
-	// Declare outside loop for memory reuse (minimize heap allocations)
-	TMap<uint16, float> BoneWeightMap;
-	TArray<TPair<uint16, float>> SortedWeights;
+	USkeletalMesh* SourceMesh = TargetSkeletalMesh.LoadSynchronous();
+	if (!SourceMesh)
+	{
+		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: Failed to load SourceMesh"));
+		return nullptr;
+	}
 
-	for (int32 i = 0; i < NewVertexCount; ++i)
+	if (Rings.Num() == 0)
 	{
-		const FSubdivisionVertexData& VD = TopologyResult.VertexData[i];
-		const float U = VD.BarycentricCoords.X;
-		const float V = VD.BarycentricCoords.Y;
-		const float W = VD.BarycentricCoords.Z;
+		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: Ring is not configured"));
+		return nullptr;
+	}
 
-		const uint32 P0 = FMath::Min(VD.ParentV0, (uint32)(SourceVertexCount - 1));
-		const uint32 P1 = FMath::Min(VD.ParentV1, (uint32)(SourceVertexCount - 1));
-		const uint32 P2 = FMath::Min(VD.ParentV2, (uint32)(SourceVertexCount - 1));
+	// Region selection reads DI AffectedVertices: publish any in-flight Ring SDFs first
+	// (pending Rings would otherwise contribute an empty region)
+	if (SourceComponent)
+	{
+		SourceComponent->FinishPendingSDFGeneration();
+	}
 
-		// Position interpolation
-		NewPositions[i] = SourcePositions[P0] * U + SourcePositions[P1] * V + SourcePositions[P2] * W;
+	TSharedPtr<FFleshRingSubdivisionJob> Job = MakeShared<FFleshRingSubdivisionJob>();
+	Job->SourceMesh = SourceMesh;
+	Job->ParamsHash = CalculateSubdivisionParamsHash();
+	Job->MinEdgeLength = SubdivisionSettings.MinEdgeLength;
 
-		// Normal interpolation and normalization
-		FVector InterpolatedNormal = SourceNormals[P0] * U + SourceNormals[P1] * V + SourceNormals[P2] * W;
-		NewNormals[i] = InterpolatedNormal.GetSafeNormal();
+	// Each LOD uses its own level (0 = keep native LOD topology)
+	// Region selection from DI AffectedVertices only matches LOD0 positions; lower LODs use the Ring-based fallback
+	const int32 NumSourceLODs = SourceMesh->GetLODNum();
+	for (int32 LODIndex = 0; LODIndex < NumSourceLODs; ++LODIndex)
+	{
+		const int32 LODMaxLevel = SubdivisionSettings.GetMaxSubdivisionLevelForLOD(LODIndex);
+		if (LODMaxLevel <= 0)
+		{
+			continue;
+		}
 
-		// Tangent interpolation
-		FVector4 InterpTangent = SourceTangents[P0] * U + SourceTangents[P1] * V + SourceTangents[P2] * W;
-		FVector TangentDir = FVector(InterpTangent.X, InterpTangent.Y, InterpTangent.Z).GetSafeNormal();
-		NewTangents[i] = FVector4(TangentDir.X, TangentDir.Y, TangentDir.Z, SourceTangents[P0].W);
+		FFleshRingSubdivisionLODJob& LODJob = Job->LODs.AddDefaulted_GetRef();
+		LODJob.LODIndex = LODIndex;
+		LODJob.MaxLevel = LODMaxLevel;
 
-		// UV interpolation
-		NewUVs[i] = SourceUVs[P0] * U + SourceUVs[P1] * V + SourceUVs[P2] * W;
+		// Reuse this LOD's processor so a bake after moving one Ring only re-refines that Ring's island
+		// (a processor still held by an unfinished job is replaced instead of shared)
+		TSharedPtr<FFleshRingSubdivisionProcessor>& LODProcessor = SubdivisionProcessors.FindOrAdd(LODIndex);
+		if (!LODProcessor.IsValid() || !LODProcessor.IsUnique())
+		{
+			LODProcessor = MakeShared<FFleshRingSubdivisionProcessor>();
+		}
+		LODJob.Processor = LODProcessor;
 
-		// Bone Weight interpolation (barycentric interpolation at byte precision)
-		NewBoneIndices[i].SetNum(MaxBoneInfluences);
-		NewBoneWeights[i].SetNum(MaxBoneInfluences);
+		if (!SubdivisionHelpers::GatherSubdivisionLOD(*this, SourceMesh, LODIndex == 0 ? SourceComponent : nullptr, Job->ParamsHash, LODJob))
+		{
+			if (LODIndex == 0)
+			{
+				return nullptr;
+			}
+			UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateSubdividedMesh: LOD%d subdivision failed, keeping native topology"), LODIndex);
+			Job->LODs.Pop();
+		}
+	}
 
-		// Clear contents only with Reset() (keep memory)
-		BoneWeightMap.Reset();
-		SortedWeights.Reset();
+	return Job;
+}
 
-		for (int32 j = 0; j < MaxBoneInfluences; ++j)
+void UFleshRingAsset::ComputeSubdivision(FFleshRingSubdivisionJob& Job)
+{
+	for (FFleshRingSubdivisionLODJob& LODJob : Job.LODs)
+	{
+		if (Job.bCancelled)
 		{
-			if (SourceBoneWeights[P0][j] > 0)
-				BoneWeightMap.FindOrAdd(SourceBoneIndices[P0][j]) += (SourceBoneWeights[P0][j] / 255.0f) * U;
-			if (SourceBoneWeights[P1][j] > 0)
-				BoneWeightMap.FindOrAdd(SourceBoneIndices[P1][j]) += (SourceBoneWeights[P1][j] / 255.0f) * V;
-			if (SourceBoneWeights[P2][j] > 0)
-				BoneWeightMap.FindOrAdd(SourceBoneIndices[P2][j]) += (SourceBoneWeights[P2][j] / 255.0f) * W;
+			return;
 		}
+		LODJob.bComputed = SubdivisionHelpers::ComputeSubdivisionLOD(LODJob, Job.MinEdgeLength);
+	}
+}
 
-		for (const auto& Pair : BoneWeightMap) { SortedWeights.Add(TPair<uint16, float>(Pair.Key, Pair.Value)); }
-		SortedWeights.Sort([](const TPair<uint16, float>& A, const TPair<uint16, float>& B) { return A.Value > B.Value; });
+void UFleshRingAsset::CancelSubdivision(FFleshRingSubdivisionJob& Job)
+{
+	Job.bCancelled = true;
+}
 
-		float TotalWeight = 0.0f;
-		for (int32 j = 0; j < FMath::Min(SortedWeights.Num(), MaxBoneInfluences); ++j) { TotalWeight += SortedWeights[j].Value; }
+bool UFleshRingAsset::NeedsBakeSubdivision() const
+{
+	return SubdivisionSettings.bEnableSubdivision && SubdivisionSettings.BakeOutput != EFleshRingBakeOutput::SparseDeltas &&
+		(!SubdivisionSettings.SubdividedMesh || NeedsSubdivisionRegeneration());
+}
 
-		for (int32 j = 0; j < MaxBoneInfluences; ++j)
-		{
-			if (j < SortedWeights.Num() && TotalWeight > 0.0f)
-			{
-				NewBoneIndices[i][j] = SortedWeights[j].Key;
-				NewBoneWeights[i][j] = FMath::Clamp<uint8>(FMath::RoundToInt((SortedWeights[j].Value / TotalWeight) * 255.0f), 0, 255);
-			}
-			else
-			{
-				NewBoneIndices[i][j] = 0;
-				NewBoneWeights[i][j] = 0;
-			}
-		}
+void UFleshRingAsset::FinishSubdivision(FFleshRingSubdivisionJob& Job)
+{
+	// Disable transaction - prevent mesh creation/cleanup from being included in Undo history
+	ITransaction* PreviousGUndo = GUndo;
+	GUndo = nullptr;
+	ON_SCOPE_EXIT { GUndo = PreviousGUndo; };
+
+	// Remove previous SubdividedMesh first if exists (prevent name collision)
+	DiscardSubdividedMeshForRebuild();
+
+	USkeletalMesh* SourceMesh = Job.SourceMesh.Get();
+	if (!SourceMesh)
+	{
+		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: SourceMesh was released before the subdivision finished"));
+		return;
 	}
 
 	// ============================================
-	// 5. Create new USkeletalMesh (source mesh duplication approach)
+	// 1. Create new USkeletalMesh (source mesh duplication approach)
 	// ============================================
-	// (Previous SubdividedMesh was cleaned up at function start)
-
 	// Duplicate source mesh to inherit all internal structures (MorphTarget, LOD data, etc.)
 	// Use unique name (prevent name collision since old mesh may be pending GC)
 	FString MeshName = FString::Printf(TEXT("%s_Subdivided_%s"),
@@ -2117,14 +2333,104 @@ void UFleshRingAsset::GenerateSubdividedMesh(UFleshRingComponent* SourceComponen
 	// If TransBuffer references this mesh, it won't be GC'd even after ClearSubdividedMesh()
 	SubdivisionSettings.SubdividedMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
 
+	// ============================================
+	// 2. Write each computed LOD into the duplicated mesh
+	// ============================================
+	FBox BoundingBox(ForceInit);
+
+	for (const FFleshRingSubdivisionLODJob& LODJob : Job.LODs)
+	{
+		FBox LODBounds(ForceInit);
+		const bool bLODBuilt = LODJob.bComputed &&
+			BuildSubdividedLOD(SourceMesh, SubdivisionSettings.SubdividedMesh, LODJob, LODBounds);
+
+		if (LODJob.LODIndex == 0)
+		{
+			if (!bLODBuilt)
+			{
+				SubdivisionSettings.SubdividedMesh->ConditionalBeginDestroy();
+				SubdivisionSettings.SubdividedMesh = nullptr;
+				return;
+			}
+			BoundingBox = LODBounds;
+		}
+		else if (!bLODBuilt)
+		{
+			UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateSubdividedMesh: LOD%d subdivision failed, keeping native topology"), LODJob.LODIndex);
+		}
+	}
+
+	// Build mesh (LOD model -> render data)
+	SubdivisionSettings.SubdividedMesh->Build();
+
+	// Verify Build result
+	FSkeletalMeshRenderData* NewRenderData = SubdivisionSettings.SubdividedMesh->GetResourceForRendering();
+	if (!NewRenderData || NewRenderData->LODRenderData.Num() == 0)
+	{
+		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: Build failed - no RenderData"));
+		SubdivisionSettings.SubdividedMesh->ConditionalBeginDestroy();
+		SubdivisionSettings.SubdividedMesh = nullptr;
+		return;
+	}
+
+	// Vertex cache efficiency of the index buffers the GPU actually draws (Build may split and reorder vertices)
+	if (FSkeletalMeshRenderData* SourceRenderData = SourceMesh->GetResourceForRendering())
+	{
+		for (int32 LODIndex = 0; LODIndex < NewRenderData->LODRenderData.Num(); ++LODIndex)
+		{
+			if (SubdivisionSettings.GetMaxSubdivisionLevelForLOD(LODIndex) <= 0 || !SourceRenderData->LODRenderData.IsValidIndex(LODIndex))
+			{
+				continue;
+			}
+
+			TArray<uint32> SourceRenderIndices;
+			TArray<uint32> SubdividedRenderIndices;
+			SubdivisionHelpers::CopyRenderIndices(SourceRenderData->LODRenderData[LODIndex], SourceRenderIndices);
+			SubdivisionHelpers::CopyRenderIndices(NewRenderData->LODRenderData[LODIndex], SubdividedRenderIndices);
+
+			UE_LOG(LogFleshRingAsset, Log, TEXT("GenerateSubdividedMesh: LOD%d render ACMR %.3f (source) -> %.3f (subdivided, FIFO %d)"),
+				LODIndex,
+				FleshRingMeshOptimizer::ComputeACMR(SourceRenderIndices),
+				FleshRingMeshOptimizer::ComputeACMR(SubdividedRenderIndices),
+				FleshRingMeshOptimizer::ACMRCacheSize);
+		}
+	}
+
+	// Initialize render resources
+	// (no flush: InitResources commands run before any render command using the mesh)
+	SubdivisionSettings.SubdividedMesh->InitResources();
+
+	// Recalculate bounding box
+	SubdivisionSettings.SubdividedMesh->SetImportedBounds(FBoxSphereBounds(BoundingBox));
+	SubdivisionSettings.SubdividedMesh->CalculateExtendedBounds();
+
+	// Save parameter hash of the gathered settings (for regeneration decision)
+	SubdivisionSettings.SubdivisionParamsHash = Job.ParamsHash;
+	MarkPackageDirty();
+
+	// Note: SubdividedMesh is only used during bake process (editor preview)
+	// World components use BakedMesh at runtime, not SubdividedMesh
+	// No need to notify world components here
+}
+
+bool UFleshRingAsset::BuildSubdividedLOD(USkeletalMesh* SourceMesh, USkeletalMesh* TargetMesh,
+	const FFleshRingSubdivisionLODJob& LODJob, FBox& OutBounds)
+{
+	const int32 LODIndex = LODJob.LODIndex;
+	const uint32 SourceVertexCount = LODJob.SourceVertexCount;
+	const FSubdivisionTopologyResult& TopologyResult = LODJob.TopologyResult;
+	const FFleshRingBarycentricParents& Parents = LODJob.Parents;
+	const FFleshRingVertexStreams& NewStreams = LODJob.NewStreams;
+	const int32 NewVertexCount = TopologyResult.VertexData.Num();
+
 	// Remove existing MeshDescription from duplicated mesh
-	if (SubdivisionSettings.SubdividedMesh->HasMeshDescription(0))
+	if (TargetMesh->HasMeshDescription(LODIndex))
 	{
-		SubdivisionSettings.SubdividedMesh->ClearMeshDescription(0);
+		TargetMesh->ClearMeshDescription(LODIndex);
 	}
 
 	// ============================================
-	// 6. Create MeshDescription
+	// Create MeshDescription
 	// ============================================
 	const int32 NumFaces = TopologyResult.Indices.Num() / 3;
 	FMeshDescription MeshDescription;
@@ -2136,7 +2442,7 @@ void UFleshRingAsset::GenerateSubdividedMesh(UFleshRingComponent* SourceComponen
 	for (int32 i = 0; i < NewVertexCount; ++i)
 	{
 		const FVertexID VertexID = MeshDescription.CreateVertex();
-		MeshDescription.GetVertexPositions()[VertexID] = FVector3f(NewPositions[i]);
+		MeshDescription.GetVertexPositions()[VertexID] = NewStreams.Positions[i];
 	}
 
 	// Create polygon groups (material sections) - create group per MaterialIndex
@@ -2193,15 +2499,15 @@ void UFleshRingAsset::GenerateSubdividedMesh(UFleshRingComponent* SourceComponen
 		VertexInstanceIDs.Add(VertexInstanceID);
 
 		// UV
-		MeshAttributes.GetVertexInstanceUVs().Set(VertexInstanceID, 0, FVector2f(NewUVs[VertexIndex]));
+		MeshAttributes.GetVertexInstanceUVs().Set(VertexInstanceID, 0, NewStreams.UVs[VertexIndex]);
 
 		// Normal
-		MeshAttributes.GetVertexInstanceNormals().Set(VertexInstanceID, FVector3f(NewNormals[VertexIndex]));
+		MeshAttributes.GetVertexInstanceNormals().Set(VertexInstanceID, NewStreams.Normals[VertexIndex]);
 
 		// Tangent
 		MeshAttributes.GetVertexInstanceTangents().Set(VertexInstanceID,
-			FVector3f(NewTangents[VertexIndex].X, NewTangents[VertexIndex].Y, NewTangents[VertexIndex].Z));
-		MeshAttributes.GetVertexInstanceBinormalSigns().Set(VertexInstanceID, NewTangents[VertexIndex].W);
+			FVector3f(NewStreams.Tangents[VertexIndex]));
+		MeshAttributes.GetVertexInstanceBinormalSigns().Set(VertexInstanceID, NewStreams.Tangents[VertexIndex].W);
 	}
 
 	// Register triangles as polygons
@@ -2229,13 +2535,14 @@ void UFleshRingAsset::GenerateSubdividedMesh(UFleshRingComponent* SourceComponen
 		FVertexID VertexID(i);
 		TArray<UE::AnimationCore::FBoneWeight> BoneWeightArray;
 
-		for (int32 j = 0; j < MaxBoneInfluences; ++j)
+		for (int32 j = 0; j < NewStreams.NumBoneInfluences; ++j)
 		{
-			if (NewBoneWeights[i][j] > 0)
+			const int32 InfluenceIndex = i * NewStreams.NumBoneInfluences + j;
+			if (NewStreams.BoneWeights[InfluenceIndex] > 0)
 			{
 				UE::AnimationCore::FBoneWeight BW;
-				BW.SetBoneIndex(NewBoneIndices[i][j]);
-				BW.SetWeight(NewBoneWeights[i][j] / 255.0f);
+				BW.SetBoneIndex(NewStreams.BoneIndices[InfluenceIndex]);
+				BW.SetWeight(NewStreams.BoneWeights[InfluenceIndex] / 255.0f);
 				BoneWeightArray.Add(BW);
 			}
 		}
@@ -2243,20 +2550,90 @@ void UFleshRingAsset::GenerateSubdividedMesh(UFleshRingComponent* SourceComponen
 		SkinWeights.Set(VertexID, BoneWeightArray);
 	}
 
+	// Morph targets: the duplicated UMorphTarget deltas index the source LOD's vertices,
+	// so blend them at the subdivided vertices; Build regenerates this LOD's morph data from these attributes
+	int32 NumRemappedMorphTargets = 0;
+	for (UMorphTarget* MorphTarget : SourceMesh->GetMorphTargets())
+	{
+		if (!MorphTarget || !MorphTarget->GetMorphLODModels().IsValidIndex(LODIndex))
+		{
+			continue;
+		}
+
+		const FMorphTargetLODModel& MorphLODModel = MorphTarget->GetMorphLODModels()[LODIndex];
+		if (MorphLODModel.Vertices.Num() == 0)
+		{
+			continue;
+		}
+
+		// Sparse deltas -> dense per source vertex
+		TArray<FVector3f> SourcePositionDeltas;
+		TArray<FVector3f> SourceNormalDeltas;
+		SourcePositionDeltas.SetNumZeroed(SourceVertexCount);
+		SourceNormalDeltas.SetNumZeroed(SourceVertexCount);
+		for (const FMorphTargetDelta& Delta : MorphLODModel.Vertices)
+		{
+			if (Delta.SourceIdx < SourceVertexCount)
+			{
+				SourcePositionDeltas[Delta.SourceIdx] = Delta.PositionDelta;
+				SourceNormalDeltas[Delta.SourceIdx] = Delta.TangentZDelta;
+			}
+		}
+
+		TArray<FVector3f> NewPositionDeltas;
+		TArray<FVector3f> NewNormalDeltas;
+		NewPositionDeltas.SetNumUninitialized(NewVertexCount);
+		NewNormalDeltas.SetNumUninitialized(NewVertexCount);
+		ParallelFor(NewVertexCount, [&](int32 i)
+		{
+			const uint32 P0 = Parents.Parent0[i];
+			const uint32 P1 = Parents.Parent1[i];
+			const uint32 P2 = Parents.Parent2[i];
+			NewPositionDeltas[i] = SourcePositionDeltas[P0] * Parents.Weight0[i] +
+				SourcePositionDeltas[P1] * Parents.Weight1[i] +
+				SourcePositionDeltas[P2] * Parents.Weight2[i];
+			NewNormalDeltas[i] = SourceNormalDeltas[P0] * Parents.Weight0[i] +
+				SourceNormalDeltas[P1] * Parents.Weight1[i] +
+				SourceNormalDeltas[P2] * Parents.Weight2[i];
+		});
+
+		const FName MorphName = MorphTarget->GetFName();
+		MeshAttributes.RegisterMorphTargetAttribute(MorphName, true);
+		TVertexAttributesRef<FVector3f> MorphPositionDeltas = MeshAttributes.GetVertexMorphPositionDelta(MorphName);
+		TVertexInstanceAttributesRef<FVector3f> MorphNormalDeltas = MeshAttributes.GetVertexInstanceMorphNormalDelta(MorphName);
+
+		for (int32 i = 0; i < NewVertexCount; ++i)
+		{
+			MorphPositionDeltas.Set(FVertexID(i), NewPositionDeltas[i]);
+		}
+		for (int32 i = 0; i < VertexInstanceIDs.Num(); ++i)
+		{
+			MorphNormalDeltas.Set(VertexInstanceIDs[i], NewNormalDeltas[TopologyResult.Indices[i]]);
+		}
+
+		++NumRemappedMorphTargets;
+	}
+
+	if (NumRemappedMorphTargets > 0)
+	{
+		UE_LOG(LogFleshRingAsset, Log, TEXT("GenerateSubdividedMesh: LOD%d - remapped %d morph targets to subdivided vertices"),
+			LODIndex, NumRemappedMorphTargets);
+	}
+
 	// Save MeshDescription to SkeletalMesh
-	SubdivisionSettings.SubdividedMesh->CreateMeshDescription(0, MoveTemp(MeshDescription));
+	TargetMesh->CreateMeshDescription(LODIndex, MoveTemp(MeshDescription));
 
 	// Release existing render resources (remove data duplicated by DuplicateObject)
-	SubdivisionSettings.SubdividedMesh->ReleaseResources();
-	SubdivisionSettings.SubdividedMesh->ReleaseResourcesFence.Wait();
+	TargetMesh->ReleaseResources();
+	TargetMesh->ReleaseResourcesFence.Wait();
 
 	// Commit MeshDescription to actual LOD model data
 	USkeletalMesh::FCommitMeshDescriptionParams CommitParams;
 	CommitParams.bMarkPackageDirty = false;
-	SubdivisionSettings.SubdividedMesh->CommitMeshDescription(0, CommitParams);
+	TargetMesh->CommitMeshDescription(LODIndex, CommitParams);
 
 	// Build settings: Prevent vertex merging + Recompute tangents only with MikkTSpace
-	if (FSkeletalMeshLODInfo* LODInfo = SubdivisionSettings.SubdividedMesh->GetLODInfo(0))
+	if (FSkeletalMeshLODInfo* LODInfo = TargetMesh->GetLODInfo(LODIndex))
 	{
 		LODInfo->BuildSettings.bRecomputeNormals = false;    // Keep interpolated normals (recomputing causes faceted look)
 		LODInfo->BuildSettings.bRecomputeTangents = true;    // Recompute tangents with MikkTSpace
@@ -2267,39 +2644,14 @@ void UFleshRingAsset::GenerateSubdividedMesh(UFleshRingComponent* SourceComponen
 		LODInfo->BuildSettings.ThresholdUV = 0.0f;
 	}
 
-	// Build mesh (LOD model -> render data)
-	SubdivisionSettings.SubdividedMesh->Build();
-
-	// Verify Build result
-	FSkeletalMeshRenderData* NewRenderData = SubdivisionSettings.SubdividedMesh->GetResourceForRendering();
-	if (!NewRenderData || NewRenderData->LODRenderData.Num() == 0)
-	{
-		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateSubdividedMesh: Build failed - no RenderData"));
-		SubdivisionSettings.SubdividedMesh->ConditionalBeginDestroy();
-		SubdivisionSettings.SubdividedMesh = nullptr;
-		return;
-	}
-
-	// Initialize render resources
-	SubdivisionSettings.SubdividedMesh->InitResources();
-	FlushRenderingCommands();
-
-	// Recalculate bounding box
-	FBox BoundingBox(ForceInit);
+	// Bounds (LOD0 drives imported bounds)
+	OutBounds = FBox(ForceInit);
 	for (int32 i = 0; i < NewVertexCount; ++i)
 	{
-		BoundingBox += NewPositions[i];
+		OutBounds += FVector(NewStreams.Positions[i]);
 	}
-	SubdivisionSettings.SubdividedMesh->SetImportedBounds(FBoxSphereBounds(BoundingBox));
-	SubdivisionSettings.SubdividedMesh->CalculateExtendedBounds();
-
-	// Save parameter hash (for regeneration decision)
-	SubdivisionSettings.SubdivisionParamsHash = CalculateSubdivisionParamsHash();
-	MarkPackageDirty();
 
-	// Note: SubdividedMesh is only used during bake process (editor preview)
-	// World components use BakedMesh at runtime, not SubdividedMesh
-	// No need to notify world components here
+	return true;
 }
 
 void UFleshRingAsset::ClearSubdividedMesh()
@@ -2310,6 +2662,9 @@ void UFleshRingAsset::ClearSubdividedMesh()
 	GUndo = nullptr;
 	ON_SCOPE_EXIT { GUndo = PreviousGUndo; };
 
+	// Incremental subdivision state belongs to the mesh being cleared
+	SubdivisionProcessors.Empty();
+
 	if (SubdivisionSettings.SubdividedMesh)
 	{
 		// Move previous mesh to Transient package so GC can clean it up
@@ -2320,45 +2675,114 @@ void UFleshRingAsset::ClearSubdividedMesh()
 		SubdivisionSettings.SubdividedMesh = nullptr;
 		SubdivisionSettings.SubdivisionParamsHash = 0;
 
-		// 2. Fully release render resources (ReleaseResourcesFence.Wait() required!)
-		OldMesh->ReleaseResources();
-		OldMesh->ReleaseResourcesFence.Wait();
-		FlushRenderingCommands();
+		// 2. Fully release render resources (ReleaseResourcesFence.Wait() required, no extra flush)
+		OldMesh->ReleaseResources();
+		OldMesh->ReleaseResourcesFence.Wait();
+
+		// 3. Change Outer to TransientPackage (detach from Asset sub-objects)
+		OldMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+
+		// 4. Remove RF_Transactional flag - prevent Undo/Redo system from referencing it
+		OldMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
+		OldMesh->SetFlags(RF_Transient);
+
+		// 5. Mark as garbage collection target
+		OldMesh->MarkAsGarbage();
+
+		// Note: SubdividedMesh is only used during bake process
+		// World components use BakedMesh at runtime, no need to notify them
+		// OnAssetChanged is for editor preview scene only
+		OnAssetChanged.Broadcast(this);
+
+		MarkPackageDirty();
+	}
+}
+
+void UFleshRingAsset::SetEditorSelectedRingIndex(int32 RingIndex, EFleshRingSelectionType SelectionType)
+{
+	EditorSelectedRingIndex = RingIndex;
+	EditorSelectionType = SelectionType;
+
+	// Delegate broadcast (detail panel -> viewport/tree sync)
+	OnRingSelectionChanged.Broadcast(RingIndex);
+}
+
+// =====================================
+// Baked Mesh related functions
+// =====================================
+
+bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
+{
+	// Async bake support approach:
+	// 1. If current mesh is not SourceMesh -> swap only and return false (async system waits)
+	// 2. If SourceMesh and cache is valid -> proceed with Readback
+	// 3. If SourceMesh but cache not yet valid -> return false (async system waits)
+	bool bSwapped = false;
+	USkeletalMesh* SourceMesh = PrepareBakeSourceMesh(SourceComponent, bSwapped);
+	if (!SourceMesh || bSwapped)
+	{
+		return false;
+	}
+
+	UFleshRingDeformer* Deformer = SourceComponent->GetDeformer();
+	UFleshRingDeformerInstance* DeformerInstance = Deformer ? Deformer->GetActiveInstance() : nullptr;
+	if (!DeformerInstance || !DeformerInstance->HasCachedDeformedGeometry(0))
+	{
+		// Cache not yet valid - async system will retry
+		return false;
+	}
+
+	// GPU Readback (SourceMesh basis - direct correspondence)
+	TArray<FVector3f> DeformedPositions;
+	TArray<FVector3f> DeformedNormals;
+	TArray<FVector4f> DeformedTangents;
+
+	if (!DeformerInstance->ReadbackDeformedGeometry(DeformedPositions, DeformedNormals, DeformedTangents, 0))
+	{
+		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateBakedMesh: GPU Readback failed"));
+		// Mesh restoration handled by async system (CleanupAsyncBake)
+		return false;
+	}
 
-		// 3. Change Outer to TransientPackage (detach from Asset sub-objects)
-		OldMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+	CookAffectedData(SourceComponent);
 
-		// 4. Remove RF_Transactional flag - prevent Undo/Redo system from referencing it
-		OldMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
-		OldMesh->SetFlags(RF_Transient);
+	return CommitBakedGeometry(SourceMesh, DeformedPositions, DeformedNormals, DeformedTangents);
+}
 
-		// 5. Mark as garbage collection target
-		OldMesh->MarkAsGarbage();
+void UFleshRingAsset::CookAffectedData(UFleshRingComponent* SourceComponent)
+{
+	if (!SubdivisionSettings.bCookAffectedVertexData)
+	{
+		SubdivisionSettings.CookedAffectedData.Empty();
+		return;
+	}
 
-		// Note: SubdividedMesh is only used during bake process
-		// World components use BakedMesh at runtime, no need to notify them
-		// OnAssetChanged is for editor preview scene only
-		OnAssetChanged.Broadcast(this);
+	UFleshRingDeformer* Deformer = SourceComponent ? SourceComponent->GetDeformer() : nullptr;
+	UFleshRingDeformerInstance* DeformerInstance = Deformer ? Deformer->GetActiveInstance() : nullptr;
 
-		MarkPackageDirty();
+	TArray<FFleshRingCookedLODAffectedData> CookedLODs;
+	if (!DeformerInstance || !DeformerInstance->ExportCookedAffectedData(CookedLODs))
+	{
+		// Keep the previous cooked data, entries are validated per Ring on load anyway
+		UE_LOG(LogFleshRingAsset, Warning, TEXT("CookAffectedData: No registered affected vertex data to cook"));
+		return;
 	}
-}
 
-void UFleshRingAsset::SetEditorSelectedRingIndex(int32 RingIndex, EFleshRingSelectionType SelectionType)
-{
-	EditorSelectedRingIndex = RingIndex;
-	EditorSelectionType = SelectionType;
+	SubdivisionSettings.CookedAffectedData = MoveTemp(CookedLODs);
 
-	// Delegate broadcast (detail panel -> viewport/tree sync)
-	OnRingSelectionChanged.Broadcast(RingIndex);
+	int64 TotalSize = 0;
+	for (const FFleshRingCookedLODAffectedData& CookedLOD : SubdivisionSettings.CookedAffectedData)
+	{
+		TotalSize += CookedLOD.GetDataSize();
+	}
+	UE_LOG(LogFleshRingAsset, Log, TEXT("CookAffectedData: %d LODs, %.1f KB"),
+		SubdivisionSettings.CookedAffectedData.Num(), TotalSize / 1024.0f);
 }
 
-// =====================================
-// Baked Mesh related functions
-// =====================================
-
-bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
+USkeletalMesh* UFleshRingAsset::PrepareBakeSourceMesh(UFleshRingComponent* SourceComponent, bool& bOutSwapped)
 {
+	bOutSwapped = false;
+
 	// Disable transaction - prevent mesh creation/cleanup from being included in Undo history
 	// If TransBuffer references mesh, it won't be GC'd
 	// Setting GUndo to nullptr causes Modify() calls to be ignored, not recorded in transaction
@@ -2369,25 +2793,28 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 	if (!SourceComponent)
 	{
 		UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateBakedMesh: SourceComponent is null"));
-		return false;
+		return nullptr;
 	}
 
 	USkeletalMeshComponent* SkelMeshComp = SourceComponent->GetResolvedTargetSkeletalMeshComponent();
 	if (!SkelMeshComp)
 	{
 		UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateBakedMesh: SourceComponent has no resolved target mesh"));
-		return false;
+		return nullptr;
 	}
 
 	// =====================================
 	// Determine source mesh: Subdivision ON -> SubdividedMesh, OFF -> original mesh
+	// Sparse Deltas are stored against the original mesh, so Subdivision is skipped
 	// =====================================
 	USkeletalMesh* SourceMesh = nullptr;
+	const bool bSparseBake = SubdivisionSettings.BakeOutput == EFleshRingBakeOutput::SparseDeltas;
 
-	if (SubdivisionSettings.bEnableSubdivision)
+	if (SubdivisionSettings.bEnableSubdivision && !bSparseBake)
 	{
 		// Subdivision ON: Generate/use SubdividedMesh
-		if (!SubdivisionSettings.SubdividedMesh || NeedsSubdivisionRegeneration())
+		// Blocking regeneration (commandlet); the editor bake finishes an async BeginSubdivision job before calling this
+		if (NeedsBakeSubdivision())
 		{
 			GenerateSubdividedMesh(SourceComponent);
 		}
@@ -2412,76 +2839,63 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 	if (!SourceMesh)
 	{
 		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateBakedMesh: No source mesh available"));
-		return false;
+		return nullptr;
 	}
 
 	UFleshRingDeformer* Deformer = SourceComponent->GetDeformer();
 	if (!Deformer)
 	{
 		UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateBakedMesh: Deformer is null"));
-		return false;
+		return nullptr;
 	}
 
 	UFleshRingDeformerInstance* DeformerInstance = Deformer->GetActiveInstance();
 	if (!DeformerInstance)
 	{
 		UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateBakedMesh: DeformerInstance is null"));
-		return false;
+		return nullptr;
 	}
 
 	// =====================================
 	// GPU Baking: Render SourceMesh and Readback
 	// (Subdivision ON: SubdividedMesh / OFF: original mesh)
 	// =====================================
-	//
-	// Async bake support approach:
-	// 1. If current mesh is not SourceMesh -> swap only and return false (async system waits)
-	// 2. If SourceMesh and cache is valid -> proceed with Readback
-	// 3. If SourceMesh but cache not yet valid -> return false (async system waits)
-
-	USkeletalMesh* CurrentMesh = SkelMeshComp->GetSkeletalMeshAsset();
-	const bool bAlreadyUsingSourceMesh = (CurrentMesh == SourceMesh);
-
-	if (!bAlreadyUsingSourceMesh)
+	if (SkelMeshComp->GetSkeletalMeshAsset() != SourceMesh)
 	{
 		// Step 1: Swap to SourceMesh (first call)
 		SkelMeshComp->SetSkeletalMeshAsset(SourceMesh);
 
-		// Step 2: Complete MeshObject regeneration (synchronous)
-		// RecreateRenderState_Concurrent() is async so MeshObject doesn't update immediately
-		// Use UnregisterComponent/RegisterComponent for synchronous regeneration
+		// Step 2: Complete MeshObject regeneration
+		// RecreateRenderState_Concurrent() is deferred to the end of frame, so the MeshObject wouldn't update immediately
+		// Use UnregisterComponent/RegisterComponent to recreate it now (render commands stay ordered, no flush needed)
 		SkelMeshComp->UnregisterComponent();
 		SkelMeshComp->RegisterComponent();
-		FlushRenderingCommands();
 
 		// Step 3: Complete Deformer reinitialization (re-register LODData/AffectedVertices for new mesh)
-		// Must call after MeshObject regeneration to read new mesh's RenderData
+		// Reads the new mesh's RenderData (game thread side), the deformer recomputes over the next frames
 		DeformerInstance->InvalidateForMeshChange();
 
-		// Swap mesh only and return - async system waits until cache valid then recalls
-		return false;
+		bOutSwapped = true;
 	}
 
-	// SourceMesh already set - check cache
-	if (!DeformerInstance->HasCachedDeformedGeometry(0))
-	{
-		// Cache not yet valid - async system will retry
-		return false;
-	}
+	return SourceMesh;
+}
 
-	// Cache valid - proceed with Readback
-	// GPU Readback (SourceMesh basis - direct correspondence)
-	TArray<FVector3f> DeformedPositions;
-	TArray<FVector3f> DeformedNormals;
-	TArray<FVector4f> DeformedTangents;
+bool UFleshRingAsset::CommitBakedGeometry(USkeletalMesh* SourceMesh,
+	TArray<FVector3f>& DeformedPositions, TArray<FVector3f>& DeformedNormals, TArray<FVector4f>& DeformedTangents)
+{
+	ITransaction* PreviousGUndo = GUndo;
+	GUndo = nullptr;
+	ON_SCOPE_EXIT { GUndo = PreviousGUndo; };
 
-	if (!DeformerInstance->ReadbackDeformedGeometry(DeformedPositions, DeformedNormals, DeformedTangents, 0))
+	if (!SourceMesh)
 	{
-		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateBakedMesh: GPU Readback failed"));
-		// Mesh restoration handled by async system (CleanupAsyncBake)
+		UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateBakedMesh: No source mesh available"));
 		return false;
 	}
 
+	const bool bSparseBake = SubdivisionSettings.BakeOutput == EFleshRingBakeOutput::SparseDeltas;
+
 	// Readback verification
 	const FSkeletalMeshRenderData* SourceRenderData = SourceMesh->GetResourceForRendering();
 	if (!SourceRenderData || SourceRenderData->LODRenderData.Num() == 0)
@@ -2501,6 +2915,76 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 		return false;
 	}
 
+	// =====================================
+	// Sparse Deltas: keep displaced vertices only, no mesh duplication
+	// (before default Normal/Tangent fill - missing streams count as unchanged)
+	// =====================================
+	if (bSparseBake)
+	{
+		// LOD0: readback deltas, lower LODs: LOD0 deformation transferred to their own render vertices
+		TArray<FFleshRingSparseBakeData> NewSparseLODs;
+		NewSparseLODs.SetNum(SourceRenderData->LODRenderData.Num());
+
+		if (!FleshRingSparseBake::ExtractDeltas(SourceLODData, DeformedPositions, DeformedNormals,
+			SubdivisionSettings.SparseDeltaThreshold, NewSparseLODs[0]))
+		{
+			UE_LOG(LogFleshRingAsset, Error, TEXT("GenerateBakedMesh: Sparse delta extraction failed"));
+			return false;
+		}
+
+		if (NewSparseLODs.Num() > 1)
+		{
+			FFleshRingLODTransferSource TransferSource;
+			SubdivisionHelpers::BuildLODTransferSource(SourceLODData, DeformedPositions, DeformedNormals,
+				DeformedNormals.Num() == (int32)SourceVertexCount, TransferSource);
+
+			for (int32 LODIndex = 1; LODIndex < NewSparseLODs.Num(); ++LODIndex)
+			{
+				SubdivisionHelpers::BakeSparseLowerLOD(SourceRenderData->LODRenderData[LODIndex], LODIndex, TransferSource,
+					SubdivisionSettings.SparseDeltaThreshold, NewSparseLODs[LODIndex]);
+			}
+		}
+
+		// Replaces any previous bake (full mesh included)
+		ClearBakedMesh();
+
+		for (int32 LODIndex = 0; LODIndex < NewSparseLODs.Num(); ++LODIndex)
+		{
+			FFleshRingSparseBakeData& NewSparseData = NewSparseLODs[LODIndex];
+			if (!NewSparseData.IsValid())
+			{
+				continue;
+			}
+
+			const FSkeletalMeshLODRenderData& LODData = SourceRenderData->LODRenderData[LODIndex];
+
+			// 16-bit position / normal deltas (float kept if the error bound can't be met)
+			FleshRingSparseBake::FQuantizeStats QuantizeStats;
+			const bool bQuantized = FleshRingSparseBake::Quantize(SubdivisionSettings.SparseQuantizationErrorBound, NewSparseData, QuantizeStats);
+
+			const SIZE_T FullVertexDataSize = LODData.StaticVertexBuffers.PositionVertexBuffer.GetStride() * LODData.GetNumVertices() +
+				LODData.StaticVertexBuffers.StaticMeshVertexBuffer.GetResourceSize();
+			UE_LOG(LogFleshRingAsset, Log, TEXT("GenerateBakedMesh: Sparse bake LOD%d - %d / %d vertices, %.1f KB (float %.1f KB, full vertex data %.1f KB)"),
+				LODIndex, NewSparseData.Num(), LODData.GetNumVertices(), QuantizeStats.QuantizedSize / 1024.0, QuantizeStats.FloatSize / 1024.0, FullVertexDataSize / 1024.0);
+			if (bQuantized)
+			{
+				UE_LOG(LogFleshRingAsset, Log, TEXT("GenerateBakedMesh: Sparse bake LOD%d quantized - max error position %.5f cm (bound %.5f), normal delta %.6f"),
+					LODIndex, QuantizeStats.MaxPositionError, SubdivisionSettings.SparseQuantizationErrorBound, QuantizeStats.MaxNormalError);
+			}
+		}
+
+		SubdivisionSettings.SparseBakeLODs = MoveTemp(NewSparseLODs);
+		StoreBakedRingTransforms();
+		SubdivisionSettings.BakeParamsHash = CalculateBakeParamsHash();
+
+		GenerateSkinnedRingMeshes(SourceMesh);
+
+		MarkPackageDirty();
+		OnAssetChanged.Broadcast(this);
+
+		return true;
+	}
+
 	// Fill default Normal/Tangent values (if missing)
 	const bool bHasNormals = DeformedNormals.Num() == (int32)SourceVertexCount;
 	const bool bHasTangents = DeformedTangents.Num() == (int32)SourceVertexCount;
@@ -2679,10 +3163,9 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 	// =====================================
 	// Commit MeshDescription and build (same as SubdividedMesh)
 	// =====================================
-	// Release existing render resources
+	// Release existing render resources (fence wait blocks until released, no extra flush)
 	NewBakedMesh->ReleaseResources();
 	NewBakedMesh->ReleaseResourcesFence.Wait();
-	FlushRenderingCommands();
 
 	// Commit MeshDescription to LOD model
 	USkeletalMesh::FCommitMeshDescriptionParams CommitParams;
@@ -2701,6 +3184,12 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 		LODInfo->BuildSettings.ThresholdUV = 0.0f;
 	}
 
+	// Lower LODs follow the LOD0 deformation at their own vertex counts
+	FFleshRingLODTransferSource TransferSource;
+	SubdivisionHelpers::BuildLODTransferSource(SourceRenderData->LODRenderData[0], DeformedPositions,
+		DeformedNormals, bHasNormals, TransferSource);
+	TransferDeformationToLowerLODs(NewBakedMesh, TransferSource);
+
 	// Build mesh (create RenderData)
 	NewBakedMesh->Build();
 
@@ -2714,8 +3203,8 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 	}
 
 	// Initialize render resources
+	// (no flush: InitResources commands run before any render command using the mesh)
 	NewBakedMesh->InitResources();
-	FlushRenderingCommands();
 
 	// Recalculate bounding box
 	FBox BoundingBox(ForceInit);
@@ -2727,15 +3216,7 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 	NewBakedMesh->CalculateExtendedBounds();
 
 	// Save Ring transforms (stored in bone-relative coordinates)
-	SubdivisionSettings.BakedRingTransforms.Empty();
-	for (const FFleshRingSettings& Ring : Rings)
-	{
-		FTransform RingRelativeTransform;
-		RingRelativeTransform.SetLocation(Ring.MeshOffset);
-		RingRelativeTransform.SetRotation(FQuat(Ring.MeshRotation));
-		RingRelativeTransform.SetScale3D(Ring.MeshScale);
-		SubdivisionSettings.BakedRingTransforms.Add(RingRelativeTransform);
-	}
+	StoreBakedRingTransforms();
 
 	// New mesh is fully ready so now clean up previous BakedMesh
 	// (Previous mesh preserved if creation fails)
@@ -2743,10 +3224,9 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 	{
 		USkeletalMesh* OldMesh = SubdivisionSettings.BakedMesh;
 
-		// 1. Fully release render resources (ReleaseResourcesFence.Wait() required!)
+		// 1. Fully release render resources (ReleaseResourcesFence.Wait() required - blocks until released, no extra flush)
 		OldMesh->ReleaseResources();
 		OldMesh->ReleaseResourcesFence.Wait();
-		FlushRenderingCommands();
 
 		// 2. Change Outer to TransientPackage (detach from Asset sub-objects)
 		OldMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
@@ -2762,8 +3242,10 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 	// Bug fix: Previously called BakedRingTransforms.Empty() here which immediately deleted
 	// the Ring transform data filled above - removed
 
-	// Save result
+	// Save result (full mesh replaces any previous sparse bake)
 	SubdivisionSettings.BakedMesh = NewBakedMesh;
+	SubdivisionSettings.SparseBakeLODs.Empty();
+	SparseMorphSets.Empty();
 	SubdivisionSettings.BakeParamsHash = CalculateBakeParamsHash();
 
 	// Remove RF_Transactional - prevent Undo/Redo system from referencing it
@@ -2784,6 +3266,147 @@ bool UFleshRingAsset::GenerateBakedMesh(UFleshRingComponent* SourceComponent)
 	return true;
 }
 
+void UFleshRingAsset::StoreBakedRingTransforms()
+{
+	SubdivisionSettings.BakedRingTransforms.Empty();
+	for (const FFleshRingSettings& Ring : Rings)
+	{
+		FTransform RingRelativeTransform;
+		RingRelativeTransform.SetLocation(Ring.MeshOffset);
+		RingRelativeTransform.SetRotation(FQuat(Ring.MeshRotation));
+		RingRelativeTransform.SetScale3D(Ring.MeshScale);
+		SubdivisionSettings.BakedRingTransforms.Add(RingRelativeTransform);
+	}
+}
+
+void UFleshRingAsset::TransferDeformationToLowerLODs(USkeletalMesh* BakedMesh, const FFleshRingLODTransferSource& TransferSource)
+{
+	const int32 NumLODs = BakedMesh ? BakedMesh->GetLODNum() : 0;
+	if (NumLODs <= 1 || !TransferSource.HasDeformation())
+	{
+		return;
+	}
+
+	for (int32 LODIndex = 1; LODIndex < NumLODs; ++LODIndex)
+	{
+		// Reduction-generated LODs have no MeshDescription; Build() regenerates them from deformed LOD0
+		FMeshDescription* MeshDesc = BakedMesh->HasMeshDescription(LODIndex) ? BakedMesh->GetMeshDescription(LODIndex) : nullptr;
+		if (!MeshDesc)
+		{
+			continue;
+		}
+
+		TVertexAttributesRef<FVector3f> VertexPositions = MeshDesc->GetVertexPositions();
+
+		TArray<FVertexID> VertexIDs;
+		TArray<FVector3f> TargetPositions;
+		VertexIDs.Reserve(MeshDesc->Vertices().Num());
+		TargetPositions.Reserve(MeshDesc->Vertices().Num());
+		for (const FVertexID VertexID : MeshDesc->Vertices().GetElementIDs())
+		{
+			VertexIDs.Add(VertexID);
+			TargetPositions.Add(VertexPositions[VertexID]);
+		}
+
+		TArray<FVector3f> PositionOffsets;
+		TArray<FVector3f> NormalOffsets;
+		const float SimplificationError = FleshRingLODTransfer::TransferOffsets(TransferSource, TargetPositions, PositionOffsets, NormalOffsets);
+
+		// Positions: rest + blended LOD0 offset
+		TMap<FVertexID, int32> MovedVertexToTarget;
+		for (int32 i = 0; i < VertexIDs.Num(); ++i)
+		{
+			if (PositionOffsets[i].IsNearlyZero())
+			{
+				continue;
+			}
+
+			VertexPositions[VertexIDs[i]] = TargetPositions[i] + PositionOffsets[i];
+			MovedVertexToTarget.Add(VertexIDs[i], i);
+		}
+
+		if (MovedVertexToTarget.Num() == 0)
+		{
+			continue;
+		}
+
+		// Normals: rest + blended LOD0 normal change (tangents recomputed by MikkTSpace)
+		FSkeletalMeshAttributes MeshAttributes(*MeshDesc);
+		TVertexInstanceAttributesRef<FVector3f> InstanceNormals = MeshAttributes.GetVertexInstanceNormals();
+
+		for (const FVertexInstanceID InstanceID : MeshDesc->VertexInstances().GetElementIDs())
+		{
+			const int32* TargetIdx = MovedVertexToTarget.Find(MeshDesc->GetVertexInstanceVertex(InstanceID));
+			if (!TargetIdx || NormalOffsets[*TargetIdx].IsNearlyZero())
+			{
+				continue;
+			}
+
+			const FVector3f NewNormal = (InstanceNormals[InstanceID] + NormalOffsets[*TargetIdx]).GetSafeNormal();
+			if (!NewNormal.IsNearlyZero())
+			{
+				InstanceNormals[InstanceID] = NewNormal;
+			}
+		}
+
+		USkeletalMesh::FCommitMeshDescriptionParams CommitParams;
+		CommitParams.bMarkPackageDirty = false;
+		BakedMesh->CommitMeshDescription(LODIndex, CommitParams);
+
+		// Same build settings as LOD0 (keep transferred normals, no vertex merging)
+		if (FSkeletalMeshLODInfo* LODInfo = BakedMesh->GetLODInfo(LODIndex))
+		{
+			LODInfo->BuildSettings.bRecomputeNormals = false;
+			LODInfo->BuildSettings.bRecomputeTangents = true;
+			LODInfo->BuildSettings.bUseMikkTSpace = true;
+			LODInfo->BuildSettings.bRemoveDegenerates = false;
+			LODInfo->BuildSettings.ThresholdPosition = 0.0f;
+			LODInfo->BuildSettings.ThresholdTangentNormal = 0.0f;
+			LODInfo->BuildSettings.ThresholdUV = 0.0f;
+		}
+
+		UE_LOG(LogFleshRingAsset, Log, TEXT("GenerateBakedMesh: LOD%d - transferred LOD0 deformation to %d / %d vertices (simplification error %.3f cm)"),
+			LODIndex, MovedVertexToTarget.Num(), VertexIDs.Num(), SimplificationError);
+	}
+}
+
+/**
+ * Discard skinned ring meshes no longer referenced by Asset
+ * Library-owned meshes are only released (the library discards them once unused),
+ * meshes owned by the asset are moved to the transient package for GC
+ */
+static void DiscardSkinnedRingMeshes(UFleshRingAsset* Asset, const TArray<TObjectPtr<USkeletalMesh>>& OldMeshes, const TArray<USkeletalMesh*>& KeepMeshes)
+{
+	TArray<UFleshRingSkinnedRingLibrary*, TInlineAllocator<2>> Libraries;
+
+	for (USkeletalMesh* OldMesh : OldMeshes)
+	{
+		if (!OldMesh || KeepMeshes.Contains(OldMesh))
+		{
+			continue;
+		}
+
+		if (UFleshRingSkinnedRingLibrary* Library = Cast<UFleshRingSkinnedRingLibrary>(OldMesh->GetOuter()))
+		{
+			Libraries.AddUnique(Library);
+			continue;
+		}
+
+		OldMesh->ReleaseResources();
+		OldMesh->ReleaseResourcesFence.Wait();
+
+		OldMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+		OldMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
+		OldMesh->SetFlags(RF_Transient);
+		OldMesh->MarkAsGarbage();
+	}
+
+	for (UFleshRingSkinnedRingLibrary* Library : Libraries)
+	{
+		Library->ReleaseUser(Asset, KeepMeshes);
+	}
+}
+
 void UFleshRingAsset::ClearBakedMesh()
 {
 	// Disable transaction - prevent mesh cleanup from being included in Undo history
@@ -2801,10 +3424,9 @@ void UFleshRingAsset::ClearBakedMesh()
 		// 1. Release pointer (disconnect Asset's UPROPERTY reference)
 		SubdivisionSettings.BakedMesh = nullptr;
 
-		// 2. Fully release render resources (ReleaseResourcesFence.Wait() required!)
+		// 2. Fully release render resources (ReleaseResourcesFence.Wait() required, no extra flush)
 		OldMesh->ReleaseResources();
 		OldMesh->ReleaseResourcesFence.Wait();
-		FlushRenderingCommands();
 
 		// 3. Change Outer to TransientPackage (detach from Asset sub-objects)
 		OldMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
@@ -2818,53 +3440,74 @@ void UFleshRingAsset::ClearBakedMesh()
 
 	}
 
-	// Cleanup skinned ring meshes
-	for (USkeletalMesh* SkinnedRingMesh : SubdivisionSettings.BakedSkinnedRingMeshes)
-	{
-		if (SkinnedRingMesh)
-		{
-			SkinnedRingMesh->ReleaseResources();
-			SkinnedRingMesh->ReleaseResourcesFence.Wait();
-			FlushRenderingCommands();
-
-			SkinnedRingMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
-			SkinnedRingMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
-			SkinnedRingMesh->SetFlags(RF_Transient);
-			SkinnedRingMesh->MarkAsGarbage();
-		}
-	}
+	// Cleanup skinned ring meshes (shared ones are released to their library)
+	DiscardSkinnedRingMeshes(this, SubdivisionSettings.BakedSkinnedRingMeshes, {});
 	SubdivisionSettings.BakedSkinnedRingMeshes.Empty();
 
+	SubdivisionSettings.SparseBakeLODs.Empty();
+	SparseMorphSets.Empty();
 	SubdivisionSettings.BakedRingTransforms.Empty();
 	SubdivisionSettings.BakeParamsHash = 0;
 
 	MarkPackageDirty();
 }
 
-void UFleshRingAsset::GenerateSkinnedRingMeshes(USkeletalMesh* SourceMesh)
+void UFleshRingAsset::FitAnalyticProxies(int32 RingIndex)
 {
-	// Clear existing skinned ring meshes
-	for (USkeletalMesh* OldMesh : SubdivisionSettings.BakedSkinnedRingMeshes)
+	for (int32 Index = 0; Index < Rings.Num(); ++Index)
 	{
-		if (OldMesh)
+		if (RingIndex != INDEX_NONE && Index != RingIndex)
+		{
+			continue;
+		}
+
+		FFleshRingSettings& Ring = Rings[Index];
+		if (!Ring.bUseAnalyticProxy || Ring.InfluenceMode != EFleshRingInfluenceMode::MeshBased)
+		{
+			continue;
+		}
+
+		Ring.FittedBandProxy = FVirtualBandSettings();
+		Ring.AnalyticProxyFitError = -1.0f;
+
+		UStaticMesh* RingMesh = Ring.RingMesh.LoadSynchronous();
+		FFleshRingAnalyticProxyFit Fit;
+		if (!FleshRingAnalyticProxy::FitBandToMesh(RingMesh, Ring.MeshScale, Fit))
 		{
-			OldMesh->ReleaseResources();
-			OldMesh->ReleaseResourcesFence.Wait();
-			FlushRenderingCommands();
-			OldMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
-			OldMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
-			OldMesh->SetFlags(RF_Transient);
-			OldMesh->MarkAsGarbage();
+			UE_LOG(LogFleshRingAsset, Log, TEXT("Ring[%d] '%s': Analytic proxy fit failed, using SDF"),
+				Index, *Ring.GetDisplayName(Index));
+			continue;
 		}
+
+		Ring.FittedBandProxy = Fit.Band;
+		Ring.AnalyticProxyFitError = Fit.MaxError;
+
+		UE_LOG(LogFleshRingAsset, Log, TEXT("Ring[%d] '%s': Analytic proxy fit error %.4f cm (max %.4f cm) -> %s"),
+			Index, *Ring.GetDisplayName(Index), Fit.MaxError, Ring.AnalyticProxyMaxError,
+			Ring.UsesAnalyticProxy() ? TEXT("VirtualBand proxy") : TEXT("SDF"));
 	}
-	SubdivisionSettings.BakedSkinnedRingMeshes.Empty();
+
+	MarkPackageDirty();
+}
+
+void UFleshRingAsset::GenerateSkinnedRingMeshes(USkeletalMesh* SourceMesh)
+{
+	// Existing meshes are discarded after generation so shared meshes still in use are kept
+	const TArray<TObjectPtr<USkeletalMesh>> OldMeshes = MoveTemp(SubdivisionSettings.BakedSkinnedRingMeshes);
+	SubdivisionSettings.BakedSkinnedRingMeshes.Reset();
 
 	if (!SourceMesh)
 	{
 		UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateSkinnedRingMeshes: SourceMesh is null"));
+		DiscardSkinnedRingMeshes(this, OldMeshes, {});
 		return;
 	}
 
+	// Shared meshes are keyed on the geometry of the mesh actually sampled (the bake source)
+	UFleshRingSkinnedRingLibrary* Library = SubdivisionSettings.SkinnedRingLibrary;
+	int32 NumGenerated = 0;
+	int32 NumReused = 0;
+
 	// Generate skinned ring mesh for each ring
 	for (int32 RingIndex = 0; RingIndex < Rings.Num(); ++RingIndex)
 	{
@@ -2893,7 +3536,7 @@ void UFleshRingAsset::GenerateSkinnedRingMeshes(USkeletalMesh* SourceMesh)
 
 		// Get the bone's component space transform from RefSkeleton
 		// This is needed to convert ring position from bone-local to component space
-		// Uses same calculation pattern as SDFBoundsSelector (line ~1838) and CalculateBoneTransform
+		// Uses the same calculation as FleshRingUtils::CalculateBoneTransform (subdivision region selection)
 		const FReferenceSkeleton& RefSkeleton = SourceMesh->GetRefSkeleton();
 		const TArray<FTransform>& RefBonePose = RefSkeleton.GetRefBonePose();
 		const int32 BoneIndex = RefSkeleton.FindBoneIndex(Ring.BoneName);
@@ -2910,6 +3553,30 @@ void UFleshRingAsset::GenerateSkinnedRingMeshes(USkeletalMesh* SourceMesh)
 		// Same pattern as SDFBoundsSelector: LocalToComponent = MeshTransform * BoneTransform
 		FTransform RingTransform = RingRelativeTransform * BoneComponentTransform;
 
+		if (Library)
+		{
+			bool bGenerated = false;
+			USkeletalMesh* SharedMesh = Library->FindOrGenerate(
+				this, RingMesh, SourceMesh, Ring.BoneName, BoneIndex,
+				RingTransform, Ring.RingSkinSamplingRadius, bGenerated);
+
+			if (!SharedMesh)
+			{
+				UE_LOG(LogFleshRingAsset, Warning, TEXT("GenerateSkinnedRingMeshes: Failed to create skinned ring mesh for Ring[%d]"), RingIndex);
+			}
+			else if (bGenerated)
+			{
+				++NumGenerated;
+			}
+			else
+			{
+				++NumReused;
+			}
+
+			SubdivisionSettings.BakedSkinnedRingMeshes.Add(SharedMesh);
+			continue;
+		}
+
 		// Generate skinned ring mesh (with bone chain filtering to prevent sampling from unrelated bones)
 		FString MeshName = FString::Printf(TEXT("%s_SkinnedRing_%d"), *GetName(), RingIndex);
 
@@ -2936,12 +3603,28 @@ void UFleshRingAsset::GenerateSkinnedRingMeshes(USkeletalMesh* SourceMesh)
 		SubdivisionSettings.BakedSkinnedRingMeshes.Add(SkinnedRingMesh);
 	}
 
+	// Discard old meshes the new list no longer references
+	TArray<USkeletalMesh*> KeepMeshes;
+	for (USkeletalMesh* Mesh : SubdivisionSettings.BakedSkinnedRingMeshes)
+	{
+		if (Mesh)
+		{
+			KeepMeshes.Add(Mesh);
+		}
+	}
+	DiscardSkinnedRingMeshes(this, OldMeshes, KeepMeshes);
+
+	if (Library)
+	{
+		UE_LOG(LogFleshRingAsset, Log, TEXT("GenerateSkinnedRingMeshes: %d shared from '%s' (%d generated, %d reused)"),
+			NumGenerated + NumReused, *Library->GetName(), NumGenerated, NumReused);
+	}
 }
 
 bool UFleshRingAsset::NeedsBakeRegeneration() const
 {
-	// Needs regeneration if no BakedMesh
-	if (!SubdivisionSettings.BakedMesh)
+	// Needs regeneration if no BakedMesh / sparse bake
+	if (!SubdivisionSettings.BakedMesh && !HasSparseBake())
 	{
 		return true;
 	}
@@ -2955,6 +3638,26 @@ uint32 UFleshRingAsset::CalculateBakeParamsHash() const
 	// Base on Subdivision parameter hash
 	uint32 Hash = CalculateSubdivisionParamsHash();
 
+	// Output format (sparse deltas skip subdivision, threshold changes the stored vertex set)
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(SubdivisionSettings.BakeOutput)));
+	if (SubdivisionSettings.BakeOutput == EFleshRingBakeOutput::SparseDeltas)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(SubdivisionSettings.SparseDeltaThreshold * 100000)));
+		Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(SubdivisionSettings.SparseQuantizationErrorBound * 100000)));
+	}
+
+	// Switching skinned ring library re-targets the skinned ring meshes
+	if (SubdivisionSettings.SkinnedRingLibrary)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(SubdivisionSettings.SkinnedRingLibrary->GetPathName()));
+	}
+
+	// Enabling cooked affected data needs a bake to produce it
+	if (SubdivisionSettings.bCookAffectedVertexData)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(SubdivisionSettings.bCookAffectedVertexData));
+	}
+
 	// Add per-Ring deformation parameters
 	for (const FFleshRingSettings& Ring : Rings)
 	{
@@ -2973,6 +3676,9 @@ uint32 UFleshRingAsset::CalculateBakeParamsHash() const
 		Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(Ring.BulgeAxialRange * 100)));
 		Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(Ring.BulgeRadialRange * 100)));
 
+		// Analytic proxy (SDF vs fitted band changes the deformation shape)
+		Hash = HashCombine(Hash, GetTypeHash(Ring.UsesAnalyticProxy()));
+
 		// Smoothing settings
 		Hash = HashCombine(Hash, GetTypeHash(Ring.bEnableRefinement));
 		Hash = HashCombine(Hash, GetTypeHash(Ring.bEnableSmoothing));
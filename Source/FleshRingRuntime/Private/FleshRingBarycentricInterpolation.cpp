@@ -0,0 +1,230 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingBarycentricInterpolation.cpp
+#include "FleshRingBarycentricInterpolation.h"
+#include "FleshRingSubdivisionProcessor.h"
+#include "Async/ParallelFor.h"
+#include "GPUSkinPublicDefs.h"
+
+void FFleshRingBarycentricParents::Build(const TArray<FSubdivisionVertexData>& VertexData, int32 SourceVertexCount)
+{
+	const int32 NumVertices = VertexData.Num();
+	Parent0.SetNumUninitialized(NumVertices);
+	Parent1.SetNumUninitialized(NumVertices);
+	Parent2.SetNumUninitialized(NumVertices);
+	Weight0.SetNumUninitialized(NumVertices);
+	Weight1.SetNumUninitialized(NumVertices);
+	Weight2.SetNumUninitialized(NumVertices);
+
+	const uint32 MaxParent = static_cast<uint32>(FMath::Max(SourceVertexCount - 1, 0));
+	for (int32 i = 0; i < NumVertices; ++i)
+	{
+		const FSubdivisionVertexData& VD = VertexData[i];
+		Parent0[i] = FMath::Min(VD.ParentV0, MaxParent);
+		Parent1[i] = FMath::Min(VD.ParentV1, MaxParent);
+		Parent2[i] = FMath::Min(VD.ParentV2, MaxParent);
+		Weight0[i] = VD.BarycentricCoords.X;
+		Weight1[i] = VD.BarycentricCoords.Y;
+		Weight2[i] = VD.BarycentricCoords.Z;
+	}
+}
+
+namespace FleshRingBarycentricInterpolation
+{
+
+namespace
+{
+	// Three parents x max influences each
+	constexpr int32 MaxBoneCandidates = 3 * MAX_TOTAL_INFLUENCES;
+
+	FORCEINLINE VectorRegister4Float Blend(
+		const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C,
+		const VectorRegister4Float& U, const VectorRegister4Float& V, const VectorRegister4Float& W)
+	{
+		return VectorMultiplyAdd(C, W, VectorMultiplyAdd(B, V, VectorMultiply(A, U)));
+	}
+
+	/** Normalize xyz (zero if degenerate, matches GetSafeNormal) */
+	FORCEINLINE VectorRegister4Float SafeNormalize3(const VectorRegister4Float& Vec)
+	{
+		const float LengthSq = VectorGetComponent(VectorDot3(Vec, Vec), 0);
+		if (LengthSq <= UE_SMALL_NUMBER)
+		{
+			return VectorZeroFloat();
+		}
+		return VectorMultiply(Vec, VectorSetFloat1(1.0f / FMath::Sqrt(LengthSq)));
+	}
+
+	void InterpolateBoneWeights(
+		const FFleshRingVertexStreams& Source,
+		const uint32 ParentIndices[3],
+		const float ParentWeights[3],
+		uint16* OutBoneIndices,
+		uint8* OutBoneWeights)
+	{
+		const int32 NumInfluences = Source.NumBoneInfluences;
+
+		// Merge influences of the three parents per bone
+		uint16 CandidateBones[MaxBoneCandidates];
+		float CandidateWeights[MaxBoneCandidates];
+		int32 NumCandidates = 0;
+
+		for (int32 p = 0; p < 3; ++p)
+		{
+			const int32 Base = ParentIndices[p] * NumInfluences;
+			for (int32 j = 0; j < NumInfluences; ++j)
+			{
+				const uint8 Weight = Source.BoneWeights[Base + j];
+				if (Weight == 0)
+				{
+					continue;
+				}
+
+				const uint16 Bone = Source.BoneIndices[Base + j];
+				const float Contribution = (Weight / 255.0f) * ParentWeights[p];
+
+				int32 Slot = 0;
+				while (Slot < NumCandidates && CandidateBones[Slot] != Bone)
+				{
+					++Slot;
+				}
+				if (Slot == NumCandidates)
+				{
+					CandidateBones[NumCandidates] = Bone;
+					CandidateWeights[NumCandidates] = 0.0f;
+					++NumCandidates;
+				}
+				CandidateWeights[Slot] += Contribution;
+			}
+		}
+
+		// Top-N selection (descending weight, lower bone index wins ties - deterministic)
+		const int32 NumKept = FMath::Min(NumCandidates, NumInfluences);
+		float TotalWeight = 0.0f;
+		for (int32 k = 0; k < NumKept; ++k)
+		{
+			int32 Best = k;
+			for (int32 c = k + 1; c < NumCandidates; ++c)
+			{
+				if (CandidateWeights[c] > CandidateWeights[Best] ||
+					(CandidateWeights[c] == CandidateWeights[Best] && CandidateBones[c] < CandidateBones[Best]))
+				{
+					Best = c;
+				}
+			}
+			Swap(CandidateBones[k], CandidateBones[Best]);
+			Swap(CandidateWeights[k], CandidateWeights[Best]);
+			TotalWeight += CandidateWeights[k];
+		}
+
+		FMemory::Memzero(OutBoneIndices, NumInfluences * sizeof(uint16));
+		FMemory::Memzero(OutBoneWeights, NumInfluences * sizeof(uint8));
+		if (NumKept == 0 || TotalWeight <= 0.0f)
+		{
+			return;
+		}
+
+		// Renormalize kept influences, rounding residual goes to the dominant bone so the sum stays 255
+		int32 QuantizedSum = 0;
+		for (int32 k = 0; k < NumKept; ++k)
+		{
+			const int32 Quantized = FMath::Clamp(FMath::RoundToInt((CandidateWeights[k] / TotalWeight) * 255.0f), 0, 255);
+			OutBoneIndices[k] = CandidateBones[k];
+			OutBoneWeights[k] = static_cast<uint8>(Quantized);
+			QuantizedSum += Quantized;
+		}
+		OutBoneWeights[0] = static_cast<uint8>(FMath::Clamp(OutBoneWeights[0] + (255 - QuantizedSum), 0, 255));
+	}
+}
+
+void Interpolate(
+	const FFleshRingVertexStreams& Source,
+	const FFleshRingBarycentricParents& Parents,
+	FFleshRingVertexStreams& Out)
+{
+	const int32 NumSourceVertices = Source.NumVertices();
+	const int32 NumVertices = Parents.Num();
+
+	const bool bNormals = Source.Normals.Num() == NumSourceVertices;
+	const bool bTangents = Source.Tangents.Num() == NumSourceVertices;
+	const bool bUVs = Source.UVs.Num() == NumSourceVertices;
+	const bool bBones = Source.HasBoneWeights() && Source.BoneIndices.Num() == Source.BoneWeights.Num() &&
+		Source.NumBoneInfluences <= MAX_TOTAL_INFLUENCES;
+
+	Out.Positions.SetNumUninitialized(NumVertices);
+	Out.Normals.SetNumUninitialized(bNormals ? NumVertices : 0);
+	Out.Tangents.SetNumUninitialized(bTangents ? NumVertices : 0);
+	Out.UVs.SetNumUninitialized(bUVs ? NumVertices : 0);
+	Out.NumBoneInfluences = bBones ? Source.NumBoneInfluences : 0;
+	Out.BoneIndices.SetNumUninitialized(bBones ? NumVertices * Source.NumBoneInfluences : 0);
+	Out.BoneWeights.SetNumUninitialized(bBones ? NumVertices * Source.NumBoneInfluences : 0);
+
+	if (NumVertices == 0 || NumSourceVertices == 0)
+	{
+		return;
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumVertices, ChunkSize);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Begin = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Begin + ChunkSize, NumVertices);
+
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const uint32 P0 = Parents.Parent0[i];
+			const uint32 P1 = Parents.Parent1[i];
+			const uint32 P2 = Parents.Parent2[i];
+
+			const VectorRegister4Float U = VectorSetFloat1(Parents.Weight0[i]);
+			const VectorRegister4Float V = VectorSetFloat1(Parents.Weight1[i]);
+			const VectorRegister4Float W = VectorSetFloat1(Parents.Weight2[i]);
+
+			// Position
+			const VectorRegister4Float Position = Blend(
+				VectorLoadFloat3(&Source.Positions[P0].X),
+				VectorLoadFloat3(&Source.Positions[P1].X),
+				VectorLoadFloat3(&Source.Positions[P2].X), U, V, W);
+			VectorStoreFloat3(Position, &Out.Positions[i].X);
+
+			// Normal
+			if (bNormals)
+			{
+				const VectorRegister4Float Normal = Blend(
+					VectorLoadFloat3_W0(&Source.Normals[P0].X),
+					VectorLoadFloat3_W0(&Source.Normals[P1].X),
+					VectorLoadFloat3_W0(&Source.Normals[P2].X), U, V, W);
+				VectorStoreFloat3(SafeNormalize3(Normal), &Out.Normals[i].X);
+			}
+
+			// Tangent (binormal sign is not blended)
+			if (bTangents)
+			{
+				const VectorRegister4Float Tangent = Blend(
+					VectorLoadFloat3_W0(&Source.Tangents[P0].X),
+					VectorLoadFloat3_W0(&Source.Tangents[P1].X),
+					VectorLoadFloat3_W0(&Source.Tangents[P2].X), U, V, W);
+				VectorStoreFloat3(SafeNormalize3(Tangent), &Out.Tangents[i].X);
+				Out.Tangents[i].W = Source.Tangents[P0].W;
+			}
+
+			// UV
+			if (bUVs)
+			{
+				Out.UVs[i] = Source.UVs[P0] * Parents.Weight0[i] + Source.UVs[P1] * Parents.Weight1[i] + Source.UVs[P2] * Parents.Weight2[i];
+			}
+
+			// Bone weights
+			if (bBones)
+			{
+				const uint32 ParentIndices[3] = { P0, P1, P2 };
+				const float ParentWeights[3] = { Parents.Weight0[i], Parents.Weight1[i], Parents.Weight2[i] };
+				InterpolateBoneWeights(Source, ParentIndices, ParentWeights,
+					&Out.BoneIndices[i * Source.NumBoneInfluences],
+					&Out.BoneWeights[i * Source.NumBoneInfluences]);
+			}
+		}
+	});
+}
+
+}
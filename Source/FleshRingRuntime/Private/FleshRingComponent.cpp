@@ -10,6 +10,8 @@
 #include "FleshRingDeformerInstance.h"
 #include "FleshRingBulgeTypes.h"
 #include "FleshRingFalloff.h"
+#include "FleshRingSparseBake.h"
+#include "FleshRingRuntimeSettings.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/SkeletalMesh.h"
 #include "Engine/VolumeTexture.h"
@@ -18,6 +20,7 @@
 #include "Engine/World.h"
 #include "RenderGraphBuilder.h"
 #include "RenderingThread.h"
+#include "RHIGPUReadback.h"
 #include "TextureResource.h"
 #if WITH_EDITOR
 #include "DrawDebugHelpers.h"
@@ -85,8 +88,8 @@ bool UFleshRingComponent::HasAnyNonSDFRings() const
 	for (const FFleshRingSettings& RingSettings : FleshRingAsset->Rings)
 	{
 		// VirtualRing or VirtualBand modes work without SDF (distance-based logic)
-		if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualRing ||
-			RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualBand)
+		if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualRing ||
+			RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualBand)
 		{
 			return true;
 		}
@@ -97,13 +100,15 @@ bool UFleshRingComponent::HasAnyNonSDFRings() const
 UFleshRingComponent::UFleshRingComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	// Async SDF generation is published from TickComponent (editor preview included)
+	bTickInEditor = true;
 }
 
 void UFleshRingComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (bEnableFleshRing && FleshRingAsset && FleshRingAsset->HasBakedMesh())
+	if (bEnableFleshRing && FleshRingAsset && (FleshRingAsset->HasBakedMesh() || FleshRingAsset->HasSparseBake()))
 	{
 		if (!ResolvedTargetMesh.IsValid())
 		{
@@ -133,6 +138,7 @@ void UFleshRingComponent::BeginPlay()
 void UFleshRingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	// Ring meshes are cleaned up in OnUnregister()
+	RemoveSparseBake();
 	CleanupDeformer();
 
 #if WITH_EDITOR
@@ -259,6 +265,9 @@ void UFleshRingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 	{
 		return;
 	}
+
+	// Publish Ring SDFs whose GPU generation finished since last frame
+	PollPendingSDFGeneration();
 	
 	// NOTE: MarkRenderDynamicDataDirty/MarkRenderTransformDirty is not called in TickComponent
 	// Optimus approach: Engine's SendRenderDynamicData_Concurrent() automatically calls deformer's EnqueueWork
@@ -288,6 +297,7 @@ void UFleshRingComponent::SetTargetSkeletalMeshComponent(USkeletalMeshComponent*
 		// Cleanup ring meshes and deformer
 		CleanupRingMeshes();
 		CleanupOrphanedRingMeshComponents();
+		RemoveSparseBake();
 		if (InternalDeformer)
 		{
 			CleanupDeformer();
@@ -414,6 +424,12 @@ void UFleshRingComponent::ResolveTargetMesh()
 
 void UFleshRingComponent::SetupDeformer()
 {
+	// Bake-only games: deformer shaders and compute system are not available
+	if (!UFleshRingRuntimeSettings::IsDeformerAvailable())
+	{
+		return;
+	}
+
 	USkeletalMeshComponent* TargetMesh = ResolvedTargetMesh.Get();
 	if (!TargetMesh)
 	{
@@ -549,12 +565,65 @@ void UFleshRingComponent::ReinitializeDeformer()
 }
 #endif // WITH_EDITOR
 
-void UFleshRingComponent::GenerateSDF()
+/**
+ * In-flight readback of a Ring SDF into its PendingVolume
+ * Readback is only touched on the render thread; the flags are read on the game thread
+ */
+struct FRingSDFPendingReadback
 {
-	// Wait for previous render commands to complete
-	FlushRenderingCommands();
+	TUniquePtr<FRHIGPUTextureReadback> Readback;
 
-	if (!FleshRingAsset)
+	/** A poll command is queued (at most one per Ring) */
+	std::atomic<bool> bPollQueued{ false };
+
+	/** PendingVolume holds the result (or readback failed and it stays empty) */
+	std::atomic<bool> bComplete{ false };
+
+	/** Copy into Volume once the GPU copy has landed (render thread) */
+	void ResolveIfReady(FFleshRingSDFVolume& Volume, bool bBlock, FRHICommandListImmediate& RHICmdList)
+	{
+		if (bComplete.load())
+		{
+			return;
+		}
+		if (Readback.IsValid() && !Readback->IsReady())
+		{
+			if (!bBlock)
+			{
+				return;
+			}
+			RHICmdList.BlockUntilGPUIdle();
+		}
+		if (!Readback.IsValid() || !Volume.CopyFromReadback(*Readback))
+		{
+			UE_LOG(LogFleshRingComponent, Warning, TEXT("FleshRingComponent: SDF readback failed, selection falls back to SDF bounds"));
+		}
+		Readback.Reset();
+		bComplete.store(true);
+	}
+};
+
+void FRingSDFCache::ReleasePooledTexture()
+{
+	if (!PooledTexture.IsValid())
+	{
+		return;
+	}
+
+	// Render commands execute in order, so every dispatch already queued with this texture runs first
+	ENQUEUE_RENDER_COMMAND(ReleaseFleshRingSDF)(
+		[Texture = MoveTemp(PooledTexture)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			Texture.SafeRelease();
+		});
+	PooledTexture = nullptr;
+}
+
+void UFleshRingComponent::GenerateSDF()
+{
+	// No flush needed: in-flight generations write into their own PendingTexture slot,
+	// so resetting the cache here simply drops their result when they land
+	if (!FleshRingAsset || !UFleshRingRuntimeSettings::IsDeformerAvailable())
 	{
 		return;
 	}
@@ -578,7 +647,7 @@ void UFleshRingComponent::GenerateSDF()
 		// VirtualBand mode uses FVirtualBandVertexSelector/FVirtualBandInfluenceProvider
 		// to directly use BandSettings parameters for distance-based Tight/Bulge calculation
 		// Operates without SDF texture, so skip generation
-		if (Ring.InfluenceMode == EFleshRingInfluenceMode::VirtualBand)
+		if (Ring.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualBand)
 		{
 			continue;
 		}
@@ -586,7 +655,7 @@ void UFleshRingComponent::GenerateSDF()
 		// ===== VirtualRing mode: No SDF needed, skip =====
 		// VirtualRing mode only uses Ring parameters (RingOffset/RingRotation/RingRadius, etc.)
 		// Should not generate SDF even if Ring Mesh exists (mesh is only for visualization)
-		if (Ring.InfluenceMode == EFleshRingInfluenceMode::VirtualRing)
+		if (Ring.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualRing)
 		{
 			continue;
 		}
@@ -649,9 +718,14 @@ void UFleshRingComponent::GenerateSDF()
 		FVector3f CapturedBoundsMin = BoundsMin;
 		FVector3f CapturedBoundsMax = BoundsMax;
 
-		// Capture cache pointer (update directly on render thread)
-		// TRefCountPtr is thread-safe so can reference directly
+		// Cache is only touched on game thread; render thread writes into PendingTexture slot
 		FRingSDFCache* CachePtr = &RingSDFCaches[RingIndex];
+		CachePtr->PendingTexture = MakeShared<TRefCountPtr<IPooledRenderTarget>, ESPMode::ThreadSafe>();
+		CachePtr->PendingVolume = MakeShared<FFleshRingSDFVolume, ESPMode::ThreadSafe>();
+		CachePtr->PendingVolume->BoundsMin = BoundsMin;
+		CachePtr->PendingVolume->BoundsMax = BoundsMax;
+		CachePtr->PendingVolume->Resolution = SDFResolution;
+		CachePtr->PendingReadback = MakeShared<FRingSDFPendingReadback, ESPMode::ThreadSafe>();
 
 		// Pre-set metadata (on game thread)
 		CachePtr->BoundsMin = BoundsMin;
@@ -674,8 +748,8 @@ void UFleshRingComponent::GenerateSDF()
 			 CapturedResolution,
 			 CapturedBoundsMin,
 			 CapturedBoundsMax,
-			 RingIndex,
-			 CachePtr](FRHICommandListImmediate& RHICmdList)
+			 PendingTexture = CachePtr->PendingTexture,
+			 PendingReadback = CachePtr->PendingReadback](FRHICommandListImmediate& RHICmdList)
 			{
 				FRDGBuilder GraphBuilder(RHICmdList);
 
@@ -709,18 +783,133 @@ void UFleshRingComponent::GenerateSDF()
 				// Key: Convert RDG texture -> Pooled texture (before Execute!)
 				// ConvertToExternalTexture must be called before Execute
 				// Texture is preserved after Execute, available for next frame
-				CachePtr->PooledTexture = GraphBuilder.ConvertToExternalTexture(CorrectedSDFTexture);
-				CachePtr->bCached = true;
+				*PendingTexture = GraphBuilder.ConvertToExternalTexture(CorrectedSDFTexture);
+
+				// CPU copy for narrow band vertex selection (one-time per generation)
+				// Not waited on here: PollPendingSDFGeneration() resolves it once the GPU copy lands
+				PendingReadback->Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("FleshRing_SDFReadback"));
+				AddEnqueueCopyPass(GraphBuilder, PendingReadback->Readback.Get(), CorrectedSDFTexture);
 
 				// Execute RDG
 				GraphBuilder.Execute();
 			});
+
+		// Per-Ring completion fence: Ring stays pending (skipped by selector/deformer) until it signals
+		CachePtr->GenerationFence.BeginFence();
 	}
 
-	// Wait until SDF generation render commands complete
-	// This ensures SDFCache->IsValid() is true after GenerateSDF() returns
-	// (Resolves issue where SDF is not yet available in first frame after mode switch during async generation)
-	FlushRenderingCommands();
+	// No flush: game thread continues immediately.
+	// PollPendingSDFGeneration() publishes each Ring when its fence completes
+	// and re-registers that Ring's affected vertices.
+}
+
+void UFleshRingComponent::PollPendingSDFGeneration(bool bWaitForCompletion)
+{
+	TArray<int32> ReadyRingIndices;
+
+	for (int32 RingIndex = 0; RingIndex < RingSDFCaches.Num(); ++RingIndex)
+	{
+		FRingSDFCache& Cache = RingSDFCaches[RingIndex];
+		if (!Cache.IsPending())
+		{
+			continue;
+		}
+
+		if (bWaitForCompletion)
+		{
+			Cache.GenerationFence.Wait();
+		}
+		else if (!Cache.GenerationFence.IsFenceComplete())
+		{
+			continue;
+		}
+
+		// Ring is published together with its CPU copy, so selection never runs bounds-only
+		// on a Ring whose SDF is about to arrive
+		if (Cache.PendingReadback.IsValid() && !Cache.PendingReadback->bComplete.load())
+		{
+			TSharedPtr<FRingSDFPendingReadback, ESPMode::ThreadSafe> PendingReadback = Cache.PendingReadback;
+			TSharedPtr<FFleshRingSDFVolume, ESPMode::ThreadSafe> PendingVolume = Cache.PendingVolume;
+
+			if (bWaitForCompletion)
+			{
+				ENQUEUE_RENDER_COMMAND(FinishFleshRingSDFReadback)(
+					[PendingReadback, PendingVolume](FRHICommandListImmediate& RHICmdList)
+					{
+						PendingReadback->ResolveIfReady(*PendingVolume, /*bBlock=*/ true, RHICmdList);
+					});
+				FRenderCommandFence ReadbackFence;
+				ReadbackFence.BeginFence();
+				ReadbackFence.Wait();
+			}
+			else
+			{
+				if (!PendingReadback->bPollQueued.exchange(true))
+				{
+					ENQUEUE_RENDER_COMMAND(PollFleshRingSDFReadback)(
+						[PendingReadback, PendingVolume](FRHICommandListImmediate& RHICmdList)
+						{
+							PendingReadback->ResolveIfReady(*PendingVolume, /*bBlock=*/ false, RHICmdList);
+							PendingReadback->bPollQueued.store(false);
+						});
+				}
+				continue;
+			}
+		}
+
+		// Publish result (render commands have executed, slots are no longer written)
+		Cache.PooledTexture = *Cache.PendingTexture;
+		Cache.PendingTexture.Reset();
+		if (Cache.PendingVolume.IsValid() && Cache.PendingVolume->IsValid())
+		{
+			Cache.CPUVolume = Cache.PendingVolume;
+		}
+		Cache.PendingVolume.Reset();
+		Cache.PendingReadback.Reset();
+		Cache.bCached = Cache.PooledTexture.IsValid();
+
+		if (Cache.bCached)
+		{
+			ReadyRingIndices.Add(RingIndex);
+		}
+		else
+		{
+			UE_LOG(LogFleshRingComponent, Warning, TEXT("FleshRingComponent: Ring[%d] SDF generation produced no texture"), RingIndex);
+		}
+	}
+
+	if (ReadyRingIndices.Num() == 0)
+	{
+		return;
+	}
+
+	// Re-trigger registration only for Rings that just became ready
+	USkeletalMeshComponent* SkelMeshComp = ResolvedTargetMesh.Get();
+	UFleshRingDeformerInstance* FleshRingInstance = SkelMeshComp ? Cast<UFleshRingDeformerInstance>(SkelMeshComp->GetMeshDeformerInstance()) : nullptr;
+
+	for (int32 RingIndex : ReadyRingIndices)
+	{
+		if (FleshRingInstance)
+		{
+			FleshRingInstance->InvalidateTightnessCache(RingIndex);
+		}
+#if WITH_EDITORONLY_DATA
+		else
+		{
+			InvalidateDebugCaches(RingIndex);
+		}
+#endif
+	}
+
+	if (SkelMeshComp)
+	{
+		SkelMeshComp->MarkRenderDynamicDataDirty();
+	}
+}
+
+void UFleshRingComponent::FinishPendingSDFGeneration()
+{
+	PollPendingSDFGeneration(/*bWaitForCompletion=*/ true);
 }
 
 void UFleshRingComponent::UpdateSDF()
@@ -751,13 +940,12 @@ void UFleshRingComponent::InitializeForEditorPreview()
 		return;
 	}
 
-	// Generate SDF and wait for completion
+	// Start SDF generation (async - pending Rings register themselves once their SDF lands)
 	GenerateSDF();
-	FlushRenderingCommands();
 
-	// Setup Deformer only if valid SDF cache exists or VirtualRing mode Ring exists
+	// Setup Deformer only if valid/pending SDF cache exists or VirtualRing mode Ring exists
 	// (Auto mode SDF failures are still skipped individually, VirtualRing mode works without SDF)
-	if (!HasAnyValidSDFCaches() && !HasAnyNonSDFRings())
+	if (!HasAnyValidSDFCaches() && !HasAnyPendingSDFCaches() && !HasAnyNonSDFRings())
 	{
 		UE_LOG(LogFleshRingComponent, Warning, TEXT("InitializeForEditorPreview: No valid SDF caches and no VirtualRing mode rings, skipping Deformer setup"));
 		bEditorPreviewInitialized = true;
@@ -895,8 +1083,6 @@ bool UFleshRingComponent::RefreshWithDeformerReuse()
 	USkeletalMeshComponent* TargetMesh = ResolvedTargetMesh.Get();
 	if (TargetMesh && !TargetMesh->GetMeshDeformerInstance())
 	{
-		// * Cleanup SDF cache first (won't be cleaned in CleanupDeformer if InternalDeformer is set to null)
-		FlushRenderingCommands();
 		for (FRingSDFCache& Cache : RingSDFCaches)
 		{
 			Cache.Reset();
@@ -908,10 +1094,9 @@ bool UFleshRingComponent::RefreshWithDeformerReuse()
 		return false;
 	}
 
-	// Wait for render commands to complete (SDF generation commands must complete before cache can be released)
-	FlushRenderingCommands();
-
 	// Cleanup only SDF cache (keep Deformer)
+	// No flush: in-flight generations complete into their own shared slot (per-Ring GenerationFence)
+	// and Reset() hands the published texture to the render thread for release
 	for (FRingSDFCache& Cache : RingSDFCaches)
 	{
 		Cache.Reset();
@@ -1045,7 +1230,7 @@ void UFleshRingComponent::SetEnableFleshRing(bool bEnable)
 	{
 		// Enable: Apply BakedMesh (if available) or setup Deformer
 		// ApplyBakedMesh() handles validation, mesh swap, and ring setup
-		if (FleshRingAsset && FleshRingAsset->HasBakedMesh())
+		if (FleshRingAsset && (FleshRingAsset->HasBakedMesh() || FleshRingAsset->HasSparseBake()))
 		{
 			ApplyBakedMesh();
 		}
@@ -1055,6 +1240,7 @@ void UFleshRingComponent::SetEnableFleshRing(bool bEnable)
 		// Disable: Restore original mesh, cleanup ring meshes
 		CleanupRingMeshes();
 		CleanupOrphanedRingMeshComponents();
+		RemoveSparseBake();
 
 		// Restore original mesh (only if BakedMesh was applied)
 		if (bUsingBakedMesh)
@@ -1102,6 +1288,7 @@ void UFleshRingComponent::SwapFleshRingAsset(UFleshRingAsset* NewAsset)
 	{
 		// Cleanup existing asset
 		CleanupRingMeshes();
+		RemoveSparseBake();
 
 		// Restore original mesh
 		// SetSkeletalMeshAsset automatically preserves animation state
@@ -1118,7 +1305,7 @@ void UFleshRingComponent::SwapFleshRingAsset(UFleshRingAsset* NewAsset)
 	}
 
 	// Use regular ApplyAsset if no baked mesh
-	if (!NewAsset->HasBakedMesh())
+	if (!NewAsset->HasBakedMesh() && !NewAsset->HasSparseBake())
 	{
 		UE_LOG(LogFleshRingComponent, Warning, TEXT("FleshRingComponent: NewAsset has no baked mesh, using regular ApplyAsset"));
 		FleshRingAsset = NewAsset;
@@ -1271,6 +1458,7 @@ FFleshRingModularResult UFleshRingComponent::Internal_SwapModularRingAsset(UFles
 
 	// 4. Cleanup existing Ring meshes and Deformer
 	CleanupRingMeshes();
+	RemoveSparseBake();
 	if (InternalDeformer)
 	{
 		CleanupDeformer();
@@ -1360,6 +1548,7 @@ void UFleshRingComponent::Internal_DetachModularRingAsset(bool bPreserveLeaderPo
 
 	// Remove ring meshes
 	CleanupRingMeshes();
+	RemoveSparseBake();
 
 	// Reset state (SkeletalMesh remains unchanged)
 	FleshRingAsset = nullptr;
@@ -1374,7 +1563,7 @@ void UFleshRingComponent::Internal_DetachModularRingAsset(bool bPreserveLeaderPo
 
 void UFleshRingComponent::ApplyBakedMesh()
 {
-	if (!FleshRingAsset || !FleshRingAsset->HasBakedMesh())
+	if (!FleshRingAsset || (!FleshRingAsset->HasBakedMesh() && !FleshRingAsset->HasSparseBake()))
 	{
 		UE_LOG(LogFleshRingComponent, Warning, TEXT("FleshRingComponent: ApplyBakedMesh called but no baked mesh available"));
 		return;
@@ -1442,10 +1631,37 @@ void UFleshRingComponent::ApplyBakedMesh()
 		CachedOriginalMesh = CurrentMesh;
 	}
 
-	// Apply baked mesh
-	// SetSkeletalMeshAsset automatically preserves animation state
-	USkeletalMesh* BakedMesh = FleshRingAsset->SubdivisionSettings.BakedMesh.Get();
-	TargetMesh->SetSkeletalMeshAsset(BakedMesh);
+	// Previous sparse bake (re-apply / asset swap)
+	RemoveSparseBake();
+
+	if (FleshRingAsset->HasBakedMesh())
+	{
+		// Apply baked mesh
+		// SetSkeletalMeshAsset automatically preserves animation state
+		USkeletalMesh* BakedMesh = FleshRingAsset->SubdivisionSettings.BakedMesh.Get();
+		TargetMesh->SetSkeletalMeshAsset(BakedMesh);
+	}
+	else
+	{
+		// Sparse bake: original mesh stays (shared with other variants), displaced vertices applied as pre-skinning morph
+		if (bUsingBakedMesh && CachedOriginalMesh.IsValid() && CurrentMesh != CachedOriginalMesh.Get())
+		{
+			TargetMesh->SetSkeletalMeshAsset(CachedOriginalMesh.Get());
+		}
+
+		// Morph sets are shared per asset and base mesh (built once, reused by every component)
+		SparseMorphSets = FleshRingAsset->GetSparseMorphSets(TargetMesh->GetSkeletalMeshAsset());
+		if (SparseMorphSets.Num() == 0)
+		{
+			UE_LOG(LogFleshRingComponent, Warning,
+				TEXT("[%s] ApplyBakedMesh: Sparse bake of '%s' could not be applied to '%s'. Ring effect not applied."),
+				*GetName(), *FleshRingAsset->GetName(), *TargetMesh->GetName());
+			return;
+		}
+
+		FleshRingSparseBake::AddToComponent(TargetMesh, static_cast<int32>(GetUniqueID()), SparseMorphSets);
+		SparseBakeTarget = TargetMesh;
+	}
 
 	// Extend bounds (deformation is already applied but for safety)
 	TargetMesh->SetBoundsScale(BoundsScale);
@@ -1461,6 +1677,17 @@ void UFleshRingComponent::ApplyBakedMesh()
 	bUsingBakedMesh = true;
 }
 
+void UFleshRingComponent::RemoveSparseBake()
+{
+	if (SparseMorphSets.Num() == 0)
+	{
+		return;
+	}
+
+	FleshRingSparseBake::RemoveFromComponent(SparseBakeTarget.Get(), static_cast<int32>(GetUniqueID()), SparseMorphSets);
+	SparseBakeTarget.Reset();
+}
+
 void UFleshRingComponent::ApplyBakedRingTransforms()
 {
 	if (!FleshRingAsset)
@@ -2611,7 +2838,7 @@ void UFleshRingComponent::CacheAffectedVerticesForDebug()
 		// - VirtualBand: Always distance-based (variable radius)
 		// - VirtualRing: Always distance-based (fixed radius)
 		const bool bUseSDFForThisRing =
-			(RingSettings.InfluenceMode == EFleshRingInfluenceMode::Auto) &&
+			(RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::Auto) &&
 			(SDFCache && SDFCache->IsValid());
 
 		// Falloff calculation lambda (inline version of CalculateFalloff)
@@ -2665,13 +2892,13 @@ void UFleshRingComponent::CacheAffectedVerticesForDebug()
 				RingData.Vertices.Add(AffectedVert);
 			}
 		}
-		else if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualBand)
+		else if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualBand)
 		{
 			// Virtual Band debug visualization disabled (code preserved)
 			/*
 			// ===== Virtual Band mode (SDF invalid): variable radius distance-based =====
 			// Use dedicated BandOffset/BandRotation
-			const FVirtualBandSettings& BandSettings = RingSettings.VirtualBand;
+			const FVirtualBandSettings& BandSettings = RingSettings.GetEffectiveVirtualBand();
 			const FQuat BoneRotation = BoneTransform.GetRotation();
 			const FVector WorldBandOffset = BoneRotation.RotateVector(BandSettings.BandOffset);
 			const FVector BandCenter = BoneTransform.GetLocation() + WorldBandOffset;
@@ -3035,7 +3262,7 @@ void UFleshRingComponent::CacheBulgeVerticesForDebug()
 		// ★ Branch by InfluenceMode: Access SDFCache only in Auto mode
 		const FRingSDFCache* SDFCache = nullptr;
 		bool bHasValidSDF = false;
-		if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::Auto)
+		if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::Auto)
 		{
 			SDFCache = GetRingSDFCache(RingIdx);
 			bHasValidSDF = (SDFCache && SDFCache->IsValid());
@@ -3064,7 +3291,7 @@ void UFleshRingComponent::CacheBulgeVerticesForDebug()
 			RingRadius = FMath::Max3(BoundsSize.X, BoundsSize.Y, BoundsSize.Z) * 0.5f;
 			DetectedDirection = SDFCache->DetectedBulgeDirection;
 		}
-		else if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualRing)
+		else if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualRing)
 		{
 			// ===== VirtualRing mode: Get directly from Ring parameters (Component Space) =====
 			bUseLocalSpace = false;
@@ -3281,7 +3508,7 @@ void UFleshRingComponent::DrawBulgeDirectionArrow(int32 RingIndex)
 	// ★ Branch by InfluenceMode: Access SDFCache only in Auto mode
 	const FRingSDFCache* SDFCache = nullptr;
 	bool bHasValidSDF = false;
-	if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::Auto)
+	if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::Auto)
 	{
 		SDFCache = GetRingSDFCache(RingIndex);
 		bHasValidSDF = (SDFCache && SDFCache->IsValid());
@@ -3318,7 +3545,7 @@ void UFleshRingComponent::DrawBulgeDirectionArrow(int32 RingIndex)
 		// Arrow size (proportional to SDF volume size)
 		ArrowLength = FVector(SDFCache->BoundsMax - SDFCache->BoundsMin).Size() * 0.15f;
 	}
-	else if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualRing)
+	else if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualRing)
 	{
 		// ===== VirtualRing mode: Get directly from Ring parameters =====
 		DetectedDirection = 0;  // VirtualRing mode cannot auto-detect
@@ -3451,9 +3678,9 @@ void UFleshRingComponent::DrawBulgeRange(int32 RingIndex)
 	const float FalloffCorrection = GetFalloffCorrection(RingSettings.BulgeFalloff);
 
 	// ===== VirtualBand mode: variable radius shape =====
-	if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualBand)
+	if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualBand)
 	{
-		const FVirtualBandSettings& Band = RingSettings.VirtualBand;
+		const FVirtualBandSettings& Band = RingSettings.GetEffectiveVirtualBand();
 
 		// Get Bone Transform
 		FTransform BoneTransform = FTransform::Identity;
@@ -3713,7 +3940,7 @@ void UFleshRingComponent::DrawBulgeRange(int32 RingIndex)
 	}
 
 	// ===== VirtualRing mode: legacy approach =====
-	if (RingSettings.InfluenceMode == EFleshRingInfluenceMode::VirtualRing)
+	if (RingSettings.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualRing)
 	{
 		FTransform BoneTransform = FTransform::Identity;
 		if (SkelMesh)
@@ -263,11 +263,13 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 	// TangentRecomputeCS output buffer (used in SkinningCS)
 	FRDGBufferRef RecomputedTangentsBuffer = nullptr;
 
+#if WITH_EDITORONLY_DATA
 	// DebugPointBuffer (for GPU debug rendering)
 	FRDGBufferRef DebugPointBuffer = nullptr;
 
 	// DebugBulgePointBuffer (for Bulge GPU debug rendering)
 	FRDGBufferRef DebugBulgePointBuffer = nullptr;
+#endif
 
 	if (WorkItem.bNeedTightnessCaching)
 	{
@@ -319,8 +321,9 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 		// Cache GPU-computed Influence values for visualization in DrawDebugPoint
 		// Buffer size is summed since InfluenceCumulativeOffset accumulates across multiple Rings
 		FRDGBufferRef DebugInfluencesBuffer = nullptr;
-		uint32 TotalInfluenceVertices = 0;
 
+#if WITH_EDITORONLY_DATA
+		uint32 TotalInfluenceVertices = 0;
 		if (WorkItem.bOutputDebugInfluences && NumRings > 0)
 		{
 			// Sum NumAffectedVertices from all Rings (multi-Ring support)
@@ -388,6 +391,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 				AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(DebugBulgePointBuffer), 0u);
 			}
 		}
+#endif
 
 		// Apply TightnessCS
 		if (WorkItem.RingDispatchDataPtr.IsValid())
@@ -470,7 +474,8 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 
 				// Enable debug Influence output
 				// DebugInfluences buffer also uses DebugPointBaseOffset (same offset)
-				if (WorkItem.bOutputDebugInfluences && DebugInfluencesBuffer)
+				// (only created when WorkItem.bOutputDebugInfluences is set)
+				if (DebugInfluencesBuffer)
 				{
 					Params.bOutputDebugInfluences = 1;
 					Params.DebugPointBaseOffset = DebugPointCumulativeOffset;
@@ -1102,12 +1107,6 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 					continue;
 				}
 
-				// FullVertexAnchorFlags validation
-				if (DispatchData.FullVertexAnchorFlags.Num() == 0)
-				{
-					continue;
-				}
-
 				// Affected vertex index buffer
 				FRDGBufferRef PBDIndicesBuffer = GraphBuilder.CreateBuffer(
 					FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumAffected),
@@ -1150,33 +1149,6 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 					);
 				}
 
-				// FullVertexAnchorFlags buffer (full mesh size, for neighbor anchor lookup)
-				FRDGBufferRef FullVertexAnchorFlagsBuffer = GraphBuilder.CreateBuffer(
-					FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), DispatchData.FullVertexAnchorFlags.Num()),
-					*FString::Printf(TEXT("FleshRing_FullVertexAnchorFlags_Ring%d"), RingIdx)
-				);
-
-				if (DispatchData.bPBDAnchorAffectedVertices)
-				{
-					// Use existing FullVertexAnchorFlags
-					GraphBuilder.QueueBufferUpload(
-						FullVertexAnchorFlagsBuffer,
-						DispatchData.FullVertexAnchorFlags.GetData(),
-						DispatchData.FullVertexAnchorFlags.Num() * sizeof(uint32),
-						ERDGInitialDataFlags::None
-					);
-				}
-				else
-				{
-					// Use cached Zero array (prevent per-tick allocation)
-					GraphBuilder.QueueBufferUpload(
-						FullVertexAnchorFlagsBuffer,
-						DispatchData.CachedZeroFullVertexAnchorFlags.GetData(),
-						DispatchData.FullVertexAnchorFlags.Num() * sizeof(uint32),
-						ERDGInitialDataFlags::None
-					);
-				}
-
 				// PBD adjacency data buffer (includes rest length)
 				FRDGBufferRef PBDAdjacencyBuffer = GraphBuilder.CreateBuffer(
 					FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), AdjacencySource.Num()),
@@ -1213,6 +1185,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 				PBDParams.Stiffness = DispatchData.PBDStiffness;
 				PBDParams.NumIterations = DispatchData.PBDIterations;
 				PBDParams.Tolerance = DispatchData.PBDTolerance;
+				PBDParams.bAnchorNeighbors = DispatchData.bPBDAnchorAffectedVertices;  // neighbor anchor bits in adjacency
 
 				// PBD Edge Constraint dispatch (Tolerance-based, in-place ping-pong)
 				DispatchFleshRingPBDEdgeCS_MultiPass(
@@ -1222,8 +1195,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 					PBDIndicesBuffer,
 					PBDRepresentativeIndicesBuffer,  // Representative vertex indices for UV seam welding
 					IsAnchorFlagsBuffer,             // per-thread anchor flags
-					FullVertexAnchorFlagsBuffer,           // full mesh anchor map (for neighbor lookup)
-					PBDAdjacencyBuffer
+					PBDAdjacencyBuffer               // adjacency with rest lengths + neighbor anchor bits
 				);
 
 				// [DEBUG] PBDEdgeCS log (uncomment if needed)
@@ -1896,6 +1868,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 			}
 		}
 
+#if WITH_EDITORONLY_DATA
 		// ===== Debug Point Output Pass (based on final deformed positions after all CS complete) =====
 		// Outputting from TightnessCS, BulgeCS would give intermediate positions,
 		// So unified output here after all deformation passes (including smoothing) complete
@@ -2007,6 +1980,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 				}
 			}
 		}
+#endif
 
 		// Convert to persistent buffer and cache
 		if (WorkItem.CachedBufferSharedPtr.IsValid())
@@ -2042,6 +2016,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 			}
 		}
 
+#if WITH_EDITORONLY_DATA
 		// Cache debug Influence buffer (for GPU value visualization in DrawDebugPoint)
 		if (WorkItem.CachedDebugInfluencesBufferSharedPtr.IsValid() && DebugInfluencesBuffer)
 		{
@@ -2117,6 +2092,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 		{
 			*WorkItem.CachedDebugBulgePointBufferSharedPtr = GraphBuilder.ConvertToExternalBuffer(DebugBulgePointBuffer);
 		}
+#endif
 	}
 	else
 	{
@@ -2147,6 +2123,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 			RecomputedTangentsBuffer = GraphBuilder.RegisterExternalBuffer(*WorkItem.CachedTangentsBufferSharedPtr);
 		}
 
+#if WITH_EDITORONLY_DATA
 		// Restore DebugPointBuffer in caching mode
 		if (WorkItem.CachedDebugPointBufferSharedPtr.IsValid() && WorkItem.CachedDebugPointBufferSharedPtr->IsValid())
 		{
@@ -2158,6 +2135,7 @@ void FFleshRingComputeWorker::ExecuteWorkItem(FRDGBuilder& GraphBuilder, FFleshR
 		{
 			DebugBulgePointBuffer = GraphBuilder.RegisterExternalBuffer(*WorkItem.CachedDebugBulgePointBufferSharedPtr);
 		}
+#endif
 	}
 
 	// Apply skinning
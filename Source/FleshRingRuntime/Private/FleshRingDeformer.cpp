@@ -3,8 +3,12 @@
 #include "FleshRingDeformer.h"
 #include "FleshRingDeformerInstance.h"
 #include "FleshRingComponent.h"
+#include "FleshRingRuntimeSettings.h"
 #include "Components/MeshComponent.h"
 #include "Components/PrimitiveComponent.h"
+#if WITH_EDITOR
+#include "Interfaces/ITargetPlatform.h"
+#endif
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FleshRingDeformer)
 
@@ -36,6 +40,20 @@ UMeshDeformerInstance* UFleshRingDeformer::CreateInstance(UMeshComponent* InMesh
 	return Instance;
 }
 
+#if WITH_EDITOR
+bool UFleshRingDeformer::NeedsLoadForTargetPlatform(const ITargetPlatform* TargetPlatform) const
+{
+	// Cooked games never create an instance in bake-only mode, so keep deformer assets out of that platform's cook
+	// (decided by the cook target's config, like the shader gating, not the host's)
+	if (TargetPlatform && !TargetPlatform->HasEditorOnlyData()
+		&& UFleshRingRuntimeSettings::IsBakedMeshOnlyRuntime(TargetPlatform->IniPlatformName()))
+	{
+		return false;
+	}
+	return Super::NeedsLoadForTargetPlatform(TargetPlatform);
+}
+#endif
+
 void UFleshRingDeformer::SetOwnerFleshRingComponent(UFleshRingComponent* InComponent)
 {
 	OwnerFleshRingComponent = InComponent;
@@ -12,6 +12,7 @@
 #include "Components/SkinnedMeshComponent.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
+#include "RHIGPUReadback.h"
 #include "SkeletalMeshDeformerHelpers.h"
 #include "SkeletalRenderPublic.h"
 #include "RenderingThread.h"
@@ -41,6 +42,10 @@ void UFleshRingDeformerInstance::BeginDestroy()
 	}
 	Scene = nullptr;
 
+#if WITH_EDITORONLY_DATA
+	CancelDeformedGeometryReadback();
+#endif
+
 	// Wait for render thread to complete current work
 	// Need flush as already queued work may be in progress
 	FlushRenderingCommands();
@@ -113,6 +118,9 @@ void UFleshRingDeformerInstance::SetupFromDeformer(
 							SuccessCount++;
 						}
 					}
+
+					UE_LOG(LogFleshRing, Log, TEXT("FleshRingDeformerInstance: Registered %d / %d LODs, affected vertex data %.1f KB"),
+						SuccessCount, NumLODs, GetAffectedDataAllocatedSize() / 1024.0f);
 				}
 			}
 		}
@@ -154,6 +162,7 @@ void UFleshRingDeformerInstance::ReleaseResources()
 			Data.CachedTangentsShared.Reset();
 		}
 
+#if WITH_EDITORONLY_DATA
 		// Release debug Influence buffer
 		if (Data.CachedDebugInfluencesShared.IsValid())
 		{
@@ -178,6 +187,7 @@ void UFleshRingDeformerInstance::ReleaseResources()
 		// Release Readback-related SharedPtr
 		Data.DebugInfluenceReadbackResult.Reset();
 		Data.bDebugInfluenceReadbackComplete.Reset();
+#endif
 
 		// Release source positions
 		Data.CachedSourcePositions.Empty();
@@ -302,6 +312,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 			}
 		}
 
+#if WITH_EDITORONLY_DATA
 		// Clear GPU debug buffers
 		if (CurrentLODData.CachedDebugInfluencesShared.IsValid())
 		{
@@ -318,6 +329,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 			CurrentLODData.CachedDebugBulgePointBufferShared->SafeRelease();
 			CurrentLODData.CachedDebugBulgePointBufferShared.Reset();
 		}
+#endif
 
 		return;
 	}
@@ -446,7 +458,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 	for (int32 RingIndex = 0; RingIndex < AllRingData.Num(); ++RingIndex)
 	{
 		const FRingAffectedData& RingData = AllRingData[RingIndex];
-		if (RingData.Vertices.Num() == 0)
+		if (RingData.PackedIndices.Num() == 0)
 		{
 			continue;
 		}
@@ -458,6 +470,16 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 			{
 				continue;
 			}
+
+			// Cooked data loaded before the SDF landed: wait for the SDF like a freshly selected Ring
+			if ((*RingSettingsPtr)[RingIndex].GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::Auto && FleshRingComponent.IsValid())
+			{
+				const FRingSDFCache* SDFCache = FleshRingComponent->GetRingSDFCache(RingIndex);
+				if (SDFCache && SDFCache->IsPending())
+				{
+					continue;
+				}
+			}
 		}
 
 		FFleshRingWorkItem::FRingDispatchData DispatchData;
@@ -598,23 +620,15 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 			DispatchData.bPBDAnchorAffectedVertices = Settings.bPBDAnchorAffectedVertices;
 		}
 
-		// PBD adjacency data and full map copy
-		DispatchData.PBDAdjacencyWithRestLengths = RingData.PBDAdjacencyWithRestLengths;
-		DispatchData.FullInfluenceMap = RingData.FullInfluenceMap;
-		DispatchData.FullDeformAmountMap = RingData.FullDeformAmountMap;
-		DispatchData.FullVertexAnchorFlags = RingData.FullVertexAnchorFlags;
-
 		// Zero array cache for when bPBDAnchorAffectedVertices=false (prevent per-tick allocation)
+		// Neighbor anchor status is packed into SmoothingRegionPBDAdjacency (no full mesh map)
 		if (!DispatchData.bPBDAnchorAffectedVertices && DispatchData.bEnablePBDEdgeConstraint)
 		{
 			// PBD target vertex count (using unified SmoothingRegion)
 			const int32 NumPBDVertices = DispatchData.SmoothingRegionIndices.Num();
-			const int32 NumTotalVertices = DispatchData.FullVertexAnchorFlags.Num();
-
-			if (NumPBDVertices > 0 && NumTotalVertices > 0)
+			if (NumPBDVertices > 0)
 			{
 				DispatchData.CachedZeroIsAnchorFlags.SetNumZeroed(NumPBDVertices);
-				DispatchData.CachedZeroFullVertexAnchorFlags.SetNumZeroed(NumTotalVertices);
 			}
 		}
 
@@ -622,7 +636,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 		EFleshRingInfluenceMode RingInfluenceMode = EFleshRingInfluenceMode::Auto;
 		if (RingSettingsPtr && RingSettingsPtr->IsValidIndex(RingIndex))
 		{
-			RingInfluenceMode = (*RingSettingsPtr)[RingIndex].InfluenceMode;
+			RingInfluenceMode = (*RingSettingsPtr)[RingIndex].GetEffectiveInfluenceMode();
 		}
 
 		// ===== VirtualBand parameter settings (always set regardless of SDF) =====
@@ -641,7 +655,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 			// VirtualBand variable radius parameter settings
 			if (RingSettingsPtr && RingSettingsPtr->IsValidIndex(RingIndex))
 			{
-				const FVirtualBandSettings& BandSettings = (*RingSettingsPtr)[RingIndex].VirtualBand;
+				const FVirtualBandSettings& BandSettings = (*RingSettingsPtr)[RingIndex].GetEffectiveVirtualBand();
 				DispatchData.Params.LowerRadius = BandSettings.Lower.Radius;
 				DispatchData.Params.MidLowerRadius = BandSettings.MidLowerRadius;
 				DispatchData.Params.MidUpperRadius = BandSettings.MidUpperRadius;
@@ -821,7 +835,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 		EFleshRingInfluenceMode BulgeRingInfluenceMode = EFleshRingInfluenceMode::Auto;
 		if (RingSettingsPtr && RingSettingsPtr->IsValidIndex(OriginalIdx))
 		{
-			BulgeRingInfluenceMode = (*RingSettingsPtr)[OriginalIdx].InfluenceMode;
+			BulgeRingInfluenceMode = (*RingSettingsPtr)[OriginalIdx].GetEffectiveInfluenceMode();
 		}
 
 		if (DispatchData.bHasValidSDF)
@@ -848,7 +862,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 				 RingSettingsPtr && RingSettingsPtr->IsValidIndex(OriginalIdx))
 		{
 			// VirtualBand mode + SDF invalid: Variable radius-based Bulge
-			const FVirtualBandSettings& BandSettings = (*RingSettingsPtr)[OriginalIdx].VirtualBand;
+			const FVirtualBandSettings& BandSettings = (*RingSettingsPtr)[OriginalIdx].GetEffectiveVirtualBand();
 
 			// Calculate Band center/axis (from DispatchData)
 			FVector3f BandCenter = FVector3f(DispatchData.Params.RingCenter);
@@ -974,6 +988,9 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 			CurrentLODData.CachedTangentsShared = MakeShared<TRefCountPtr<FRDGPooledBuffer>>();
 		}
 
+#if WITH_EDITORONLY_DATA
+		// Debug outputs are editor-only (see below), don't hold their buffers otherwise
+
 		// Create debug Influence buffer TSharedPtr (on first cache)
 		if (!CurrentLODData.CachedDebugInfluencesShared.IsValid())
 		{
@@ -991,8 +1008,10 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 		{
 			CurrentLODData.CachedDebugBulgePointBufferShared = MakeShared<TRefCountPtr<FRDGPooledBuffer>>();
 		}
+#endif
 	}
 
+#if WITH_EDITORONLY_DATA
 	// Determine whether debug Influence output is needed
 	// Only output when bShowDebugVisualization && bShowAffectedVertices are enabled in editor
 	bool bOutputDebugInfluences = false;
@@ -1000,7 +1019,6 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 	bool bOutputDebugBulgePoints = false;  // Bulge debug point output for GPU rendering
 	uint32 MaxAffectedVertexCount = 0;
 	uint32 MaxBulgeVertexCount = 0;
-#if WITH_EDITORONLY_DATA
 	if (FleshRingComponent.IsValid() && FleshRingComponent->bShowDebugVisualization && FleshRingComponent->bShowAffectedVertices)
 	{
 		bOutputDebugInfluences = true;
@@ -1061,7 +1079,6 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 			}
 		}
 	}
-#endif
 
 	// Initialize buffer for GPU debug rendering
 	// ★ DrawDebug method: Recalculate every frame without caching (accuracy > performance)
@@ -1083,6 +1100,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 			CurrentLODData.CachedDebugBulgePointBufferShared = MakeShared<TRefCountPtr<FRDGPooledBuffer>>();
 		}
 	}
+#endif
 
 	// Create work item
 	FFleshRingWorkItem WorkItem;
@@ -1353,6 +1371,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 	WorkItem.CachedBufferSharedPtr = CurrentLODData.CachedTightenedBindPoseShared;  // TSharedPtr copy (ref count increase)
 	WorkItem.CachedNormalsBufferSharedPtr = CurrentLODData.CachedNormalsShared;  // Normal cache buffer (ref count increase)
 	WorkItem.CachedTangentsBufferSharedPtr = CurrentLODData.CachedTangentsShared;  // Tangent cache buffer (ref count increase)
+#if WITH_EDITORONLY_DATA
 	WorkItem.CachedDebugInfluencesBufferSharedPtr = CurrentLODData.CachedDebugInfluencesShared;  // Debug Influence cache buffer
 	WorkItem.bOutputDebugInfluences = bOutputDebugInfluences;  // Enable debug Influence output
 	WorkItem.DebugInfluenceReadbackResultPtr = CurrentLODData.DebugInfluenceReadbackResult;  // Readback result storage array
@@ -1385,6 +1404,7 @@ void UFleshRingDeformerInstance::EnqueueWork(FEnqueueWorkDesc const& InDesc)
 		FTransform WorldTransform = TargetMeshComp->GetComponentTransform();
 		WorkItem.LocalToWorldMatrix = FMatrix44f(WorldTransform.ToMatrixWithScale());
 	}
+#endif
 
 	WorkItem.FallbackDelegate = InDesc.FallbackDelegate;
 
@@ -1439,237 +1459,343 @@ bool UFleshRingDeformerInstance::HasCachedDeformedGeometry(int32 LODIndex) const
 		return false;
 	}
 
+	// Rings with SDF still generating are not deformed yet - result would be incomplete
+	if (FleshRingComponent.IsValid() && FleshRingComponent->HasAnyPendingSDFCaches())
+	{
+		return false;
+	}
+
 	const FLODDeformationData& Data = LODData[LODIndex];
 	return Data.bTightenedBindPoseCached &&
 		Data.CachedTightenedBindPoseShared.IsValid() &&
 		Data.CachedTightenedBindPoseShared->IsValid();
 }
 
-bool UFleshRingDeformerInstance::ReadbackDeformedGeometry(
-	TArray<FVector3f>& OutPositions,
-	TArray<FVector3f>& OutNormals,
-	TArray<FVector4f>& OutTangents,
-	int32 LODIndex)
+bool UFleshRingDeformerInstance::ExportCookedAffectedData(TArray<FFleshRingCookedLODAffectedData>& OutLODs) const
 {
-	if (!HasCachedDeformedGeometry(LODIndex))
+	OutLODs.Reset();
+
+	for (const FLODDeformationData& Data : LODData)
 	{
-		UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: No cached deformed geometry for LOD %d"), LODIndex);
-		return false;
+		if (!Data.bAffectedVerticesRegistered)
+		{
+			continue;
+		}
+
+		FFleshRingCookedLODAffectedData CookedLOD;
+		if (Data.AffectedVerticesManager.ExportCookedData(CookedLOD))
+		{
+			OutLODs.Add(MoveTemp(CookedLOD));
+		}
 	}
 
-	const FLODDeformationData& Data = LODData[LODIndex];
-	const uint32 NumVertices = Data.CachedTightnessVertexCount;
+	return OutLODs.Num() > 0;
+}
 
-	if (NumVertices == 0)
+namespace
+{
+	/** Cached buffers of one deformed geometry readback, vertex counts clamped to the allocated sizes */
+	struct FDeformedGeometrySources
 	{
-		UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: NumVertices is 0"));
-		return false;
-	}
+		TRefCountPtr<FRDGPooledBuffer> Positions;
+		TRefCountPtr<FRDGPooledBuffer> Normals;
+		TRefCountPtr<FRDGPooledBuffer> Tangents;
 
-	// Wait for GPU work completion
-	FlushRenderingCommands();
+		uint32 NumPositions = 0;
+		uint32 NumNormals = 0;
+		uint32 NumTangents = 0;
+	};
 
-	// ===== Position Readback =====
-	bool bPositionSuccess = false;
-	if (Data.CachedTightenedBindPoseShared.IsValid() && Data.CachedTightenedBindPoseShared->IsValid())
+	/** Element count of a pooled buffer (0 if missing) */
+	uint32 GetAllocatedElementCount(const TSharedPtr<TRefCountPtr<FRDGPooledBuffer>>& Shared, uint32 ElementSize)
 	{
-		TRefCountPtr<FRDGPooledBuffer> PooledBuffer = *Data.CachedTightenedBindPoseShared;
-		FBufferRHIRef BufferRHI = PooledBuffer->GetRHI();
-
-		if (BufferRHI.IsValid())
+		if (!Shared.IsValid() || !Shared->IsValid() || !(*Shared)->GetRHI())
 		{
-			// ★ Buffer size may be larger than requested due to RDG buffer pooling
-			// Must use CachedTightnessVertexCount, not BufferRHI->GetSize()
-			const uint32 ActualBufferSize = BufferRHI->GetSize();
-			const uint32 AllocatedVertexCount = ActualBufferSize / (3 * sizeof(float));
+			return 0;
+		}
+		return (*Shared)->GetRHI()->GetSize() / ElementSize;
+	}
 
-			// Meaningful data count is the value stored at caching time
-			const uint32 CachedVertexCount = Data.CachedTightnessVertexCount;
+	/**
+	 * Resolve readback sources from the LOD cache
+	 * ★ Buffer size may be larger than requested due to RDG buffer pooling
+	 *   Meaningful data count is CachedVertexCount (value stored at caching time), not the buffer size
+	 * ★ Normal buffer is float3, Tangent buffer is float4
+	 */
+	bool GatherReadbackSources(
+		const TSharedPtr<TRefCountPtr<FRDGPooledBuffer>>& PositionsShared,
+		const TSharedPtr<TRefCountPtr<FRDGPooledBuffer>>& NormalsShared,
+		const TSharedPtr<TRefCountPtr<FRDGPooledBuffer>>& TangentsShared,
+		uint32 CachedVertexCount,
+		FDeformedGeometrySources& OutSources)
+	{
+		const uint32 AllocatedPositions = GetAllocatedElementCount(PositionsShared, sizeof(FVector3f));
+		if (AllocatedPositions == 0)
+		{
+			UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Position buffer unavailable"));
+			return false;
+		}
+		if (AllocatedPositions < CachedVertexCount)
+		{
+			UE_LOG(LogFleshRing, Error, TEXT("ReadbackDeformedGeometry: Buffer too small! Allocated=%u, Cached=%u"),
+				AllocatedPositions, CachedVertexCount);
+			return false;
+		}
+		OutSources.Positions = *PositionsShared;
+		OutSources.NumPositions = CachedVertexCount;
 
-			// Check if buffer is sufficient
-			if (AllocatedVertexCount < CachedVertexCount)
+		// Normal / Tangent are optional, not an error
+		const uint32 AllocatedNormals = GetAllocatedElementCount(NormalsShared, sizeof(FVector3f));
+		if (AllocatedNormals > 0)
+		{
+			if (AllocatedNormals < CachedVertexCount)
 			{
-				UE_LOG(LogFleshRing, Error, TEXT("ReadbackDeformedGeometry: Buffer too small! Allocated=%u, Cached=%u"),
-					AllocatedVertexCount, CachedVertexCount);
-				return false;
+				UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Normal buffer too small! Allocated=%u, Cached=%u"),
+					AllocatedNormals, CachedVertexCount);
 			}
+			OutSources.Normals = *NormalsShared;
+			OutSources.NumNormals = FMath::Min(CachedVertexCount, AllocatedNormals);
+		}
 
-			// Debug log (only when sizes differ)
-			if (CachedVertexCount != NumVertices)
+		const uint32 AllocatedTangents = GetAllocatedElementCount(TangentsShared, sizeof(FVector4f));
+		if (AllocatedTangents > 0)
+		{
+			if (AllocatedTangents < CachedVertexCount)
 			{
-				UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: CachedVertexCount (%u) != expected (%u)"),
-					CachedVertexCount, NumVertices);
+				UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Tangent buffer too small! Allocated=%u, Cached=%u"),
+					AllocatedTangents, CachedVertexCount);
 			}
+			OutSources.Tangents = *TangentsShared;
+			OutSources.NumTangents = FMath::Min(CachedVertexCount, AllocatedTangents);
+		}
 
-			// ★ Read only cached vertex count (ignore RDG pooled extra data)
-			const uint32 VertexCountToRead = CachedVertexCount;
-			const uint32 SizeToRead = VertexCountToRead * 3 * sizeof(float);
+		return true;
+	}
 
-			TArray<float> TempPositions;
-			TempPositions.SetNumUninitialized(VertexCountToRead * 3);
+	/** Synchronous Lock/Unlock copy (render thread) */
+	void LockAndCopyBuffer(FRHICommandListImmediate& RHICmdList, const TRefCountPtr<FRDGPooledBuffer>& Source, void* Dest, uint32 NumBytes)
+	{
+		if (!Source.IsValid() || NumBytes == 0)
+		{
+			return;
+		}
 
-			// UE5.7 synchronous Readback: Lock/Unlock performed on RenderThread
-			TArray<float>* DestPtr = &TempPositions;
-			uint32 ReadSize = SizeToRead;
-			ENQUEUE_RENDER_COMMAND(ReadbackPositions)(
-				[BufferRHI, ReadSize, DestPtr](FRHICommandListImmediate& RHICmdList)
-				{
-					void* MappedData = RHICmdList.LockBuffer(BufferRHI, 0, ReadSize, RLM_ReadOnly);
-					if (MappedData)
-					{
-						FMemory::Memcpy(DestPtr->GetData(), MappedData, ReadSize);
-						RHICmdList.UnlockBuffer(BufferRHI);
-					}
-				});
-			FlushRenderingCommands();
+		FRHIBuffer* BufferRHI = Source->GetRHI();
+		if (void* MappedData = RHICmdList.LockBuffer(BufferRHI, 0, NumBytes, RLM_ReadOnly))
+		{
+			FMemory::Memcpy(Dest, MappedData, NumBytes);
+			RHICmdList.UnlockBuffer(BufferRHI);
+		}
+	}
 
-			OutPositions.SetNum(VertexCountToRead);
-			for (uint32 i = 0; i < VertexCountToRead; ++i)
-			{
-				OutPositions[i] = FVector3f(
-					TempPositions[i * 3 + 0],
-					TempPositions[i * 3 + 1],
-					TempPositions[i * 3 + 2]);
-			}
-			bPositionSuccess = true;
+	void LogOptionalStreams(const FDeformedGeometrySources& Sources)
+	{
+		if (Sources.NumNormals == 0)
+		{
+			UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Normal readback failed (may be disabled)"));
+		}
+		if (Sources.NumTangents == 0)
+		{
+			UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Tangent readback failed (may be disabled)"));
 		}
 	}
+}
+
+/**
+ * Non-blocking readback state, shared between the game thread and render commands
+ * Render thread owns the GPU readbacks; game thread only reads the outputs once bComplete is set
+ */
+struct FFleshRingGeometryReadback
+{
+	FDeformedGeometrySources Sources;
+
+	TUniquePtr<FRHIGPUBufferReadback> PositionReadback;
+	TUniquePtr<FRHIGPUBufferReadback> NormalReadback;
+	TUniquePtr<FRHIGPUBufferReadback> TangentReadback;
 
-	if (!bPositionSuccess)
+	// Written on the render thread before bComplete is set
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Normals;
+	TArray<FVector4f> Tangents;
+
+	// One poll render command at a time
+	std::atomic<bool> bPollInFlight{ false };
+	std::atomic<bool> bComplete{ false };
+};
+
+bool UFleshRingDeformerInstance::ReadbackDeformedGeometry(
+	TArray<FVector3f>& OutPositions,
+	TArray<FVector3f>& OutNormals,
+	TArray<FVector4f>& OutTangents,
+	int32 LODIndex)
+{
+	if (!HasCachedDeformedGeometry(LODIndex))
 	{
-		UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Position readback failed"));
+		UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: No cached deformed geometry for LOD %d"), LODIndex);
 		return false;
 	}
 
-	// ===== Normal Readback =====
-	// ★ Normal buffer is float3 format! (shader stores 3 floats per vertex)
-	bool bNormalSuccess = false;
-	if (Data.CachedNormalsShared.IsValid() && Data.CachedNormalsShared->IsValid())
+	const FLODDeformationData& Data = LODData[LODIndex];
+	if (Data.CachedTightnessVertexCount == 0)
 	{
-		TRefCountPtr<FRDGPooledBuffer> PooledBuffer = *Data.CachedNormalsShared;
-		FBufferRHIRef BufferRHI = PooledBuffer->GetRHI();
+		UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: NumVertices is 0"));
+		return false;
+	}
 
-		if (BufferRHI.IsValid())
-		{
-			// ★ Normal buffer is float3 format (3 floats per vertex)
-			const uint32 ActualBufferSize = BufferRHI->GetSize();
-			const uint32 AllocatedVertexCount = ActualBufferSize / (3 * sizeof(float));  // float3!
-			const uint32 CachedVertexCount = Data.CachedTightnessVertexCount;
+	FDeformedGeometrySources Sources;
+	if (!GatherReadbackSources(Data.CachedTightenedBindPoseShared, Data.CachedNormalsShared, Data.CachedTangentsShared,
+		Data.CachedTightnessVertexCount, Sources))
+	{
+		UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Position readback failed"));
+		return false;
+	}
 
-			// Check if buffer is sufficient
-			if (AllocatedVertexCount < CachedVertexCount)
-			{
-				UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Normal buffer too small! Allocated=%u, Cached=%u"),
-					AllocatedVertexCount, CachedVertexCount);
-				// Normal is optional, not an error
-			}
+	OutPositions.SetNumZeroed(Sources.NumPositions);
+	OutNormals.SetNumZeroed(Sources.NumNormals);
+	OutTangents.SetNumZeroed(Sources.NumTangents);
 
-			// ★ Read only cached vertex count
-			const uint32 VertexCountToRead = FMath::Min(CachedVertexCount, AllocatedVertexCount);
-			const uint32 SizeToRead = VertexCountToRead * 3 * sizeof(float);  // float3!
+	// All three buffers in one render command -> single flush
+	// (locking is ordered after the deformation work already queued, no separate wait needed)
+	ENQUEUE_RENDER_COMMAND(FleshRingReadbackDeformedGeometry)(
+		[Sources, PositionDest = OutPositions.GetData(), NormalDest = OutNormals.GetData(), TangentDest = OutTangents.GetData()]
+		(FRHICommandListImmediate& RHICmdList)
+		{
+			LockAndCopyBuffer(RHICmdList, Sources.Positions, PositionDest, Sources.NumPositions * sizeof(FVector3f));
+			LockAndCopyBuffer(RHICmdList, Sources.Normals, NormalDest, Sources.NumNormals * sizeof(FVector3f));
+			LockAndCopyBuffer(RHICmdList, Sources.Tangents, TangentDest, Sources.NumTangents * sizeof(FVector4f));
+		});
+	FlushRenderingCommands();
 
-			TArray<float> TempNormals;
-			TempNormals.SetNumUninitialized(VertexCountToRead * 3);  // float3!
+	LogOptionalStreams(Sources);
+	return true;
+}
 
-			// UE5.7 synchronous Readback method
-			TArray<float>* DestPtr = &TempNormals;
-			uint32 ReadSize = SizeToRead;
-			ENQUEUE_RENDER_COMMAND(ReadbackNormals)(
-				[BufferRHI, ReadSize, DestPtr](FRHICommandListImmediate& RHICmdList)
-				{
-					void* MappedData = RHICmdList.LockBuffer(BufferRHI, 0, ReadSize, RLM_ReadOnly);
-					if (MappedData)
-					{
-						FMemory::Memcpy(DestPtr->GetData(), MappedData, ReadSize);
-						RHICmdList.UnlockBuffer(BufferRHI);
-					}
-				});
-			FlushRenderingCommands();
+bool UFleshRingDeformerInstance::BeginDeformedGeometryReadback(int32 LODIndex)
+{
+	CancelDeformedGeometryReadback();
 
-			OutNormals.SetNum(VertexCountToRead);
-			for (uint32 i = 0; i < VertexCountToRead; ++i)
-			{
-				OutNormals[i] = FVector3f(
-					TempNormals[i * 3 + 0],  // float3!
-					TempNormals[i * 3 + 1],
-					TempNormals[i * 3 + 2]);
-			}
-			bNormalSuccess = true;
-		}
+	if (!HasCachedDeformedGeometry(LODIndex))
+	{
+		UE_LOG(LogFleshRing, Warning, TEXT("BeginDeformedGeometryReadback: No cached deformed geometry for LOD %d"), LODIndex);
+		return false;
 	}
 
-	if (!bNormalSuccess)
+	const FLODDeformationData& Data = LODData[LODIndex];
+	if (Data.CachedTightnessVertexCount == 0)
 	{
-		UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Normal readback failed (may be disabled)"));
-		// Normal is optional, not an error, return empty array
-		OutNormals.Empty();
+		UE_LOG(LogFleshRing, Warning, TEXT("BeginDeformedGeometryReadback: NumVertices is 0"));
+		return false;
 	}
 
-	// ===== Tangent Readback =====
-	bool bTangentSuccess = false;
-	if (Data.CachedTangentsShared.IsValid() && Data.CachedTangentsShared->IsValid())
+	TSharedPtr<FFleshRingGeometryReadback, ESPMode::ThreadSafe> Readback = MakeShared<FFleshRingGeometryReadback, ESPMode::ThreadSafe>();
+	if (!GatherReadbackSources(Data.CachedTightenedBindPoseShared, Data.CachedNormalsShared, Data.CachedTangentsShared,
+		Data.CachedTightnessVertexCount, Readback->Sources))
 	{
-		TRefCountPtr<FRDGPooledBuffer> PooledBuffer = *Data.CachedTangentsShared;
-		FBufferRHIRef BufferRHI = PooledBuffer->GetRHI();
+		return false;
+	}
 
-		if (BufferRHI.IsValid())
+	// GPU -> staging copies through RDG (handles resource transitions of the pooled buffers)
+	ENQUEUE_RENDER_COMMAND(FleshRingEnqueueGeometryReadback)(
+		[Readback](FRHICommandListImmediate& RHICmdList)
 		{
-			// ★ Use CachedTightnessVertexCount like Position (handle RDG buffer pooling)
-			const uint32 ActualBufferSize = BufferRHI->GetSize();
-			const uint32 AllocatedVertexCount = ActualBufferSize / (4 * sizeof(float));
-			const uint32 CachedVertexCount = Data.CachedTightnessVertexCount;
+			FRDGBuilder GraphBuilder(RHICmdList);
 
-			// Check if buffer is sufficient
-			if (AllocatedVertexCount < CachedVertexCount)
+			auto EnqueueCopy = [&GraphBuilder](const TRefCountPtr<FRDGPooledBuffer>& Source, uint32 NumBytes, const TCHAR* Name)
 			{
-				UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Tangent buffer too small! Allocated=%u, Cached=%u"),
-					AllocatedVertexCount, CachedVertexCount);
-				// Tangent is optional, not an error
-			}
+				TUniquePtr<FRHIGPUBufferReadback> BufferReadback;
+				if (Source.IsValid() && NumBytes > 0)
+				{
+					BufferReadback = MakeUnique<FRHIGPUBufferReadback>(Name);
+					AddEnqueueCopyPass(GraphBuilder, BufferReadback.Get(), GraphBuilder.RegisterExternalBuffer(Source), NumBytes);
+				}
+				return BufferReadback;
+			};
 
-			// ★ Read only cached vertex count
-			const uint32 VertexCountToRead = FMath::Min(CachedVertexCount, AllocatedVertexCount);
-			const uint32 SizeToRead = VertexCountToRead * 4 * sizeof(float);
+			const FDeformedGeometrySources& Sources = Readback->Sources;
+			Readback->PositionReadback = EnqueueCopy(Sources.Positions, Sources.NumPositions * sizeof(FVector3f), TEXT("FleshRing.BakeReadback.Positions"));
+			Readback->NormalReadback = EnqueueCopy(Sources.Normals, Sources.NumNormals * sizeof(FVector3f), TEXT("FleshRing.BakeReadback.Normals"));
+			Readback->TangentReadback = EnqueueCopy(Sources.Tangents, Sources.NumTangents * sizeof(FVector4f), TEXT("FleshRing.BakeReadback.Tangents"));
 
-			TArray<float> TempTangents;
-			TempTangents.SetNumUninitialized(VertexCountToRead * 4);
+			GraphBuilder.Execute();
+		});
+
+	PendingReadback = Readback;
+	return true;
+}
+
+EFleshRingReadbackStatus UFleshRingDeformerInstance::PollDeformedGeometryReadback(
+	TArray<FVector3f>& OutPositions,
+	TArray<FVector3f>& OutNormals,
+	TArray<FVector4f>& OutTangents)
+{
+	if (!PendingReadback.IsValid())
+	{
+		return EFleshRingReadbackStatus::Failed;
+	}
+
+	if (PendingReadback->bComplete)
+	{
+		OutPositions = MoveTemp(PendingReadback->Positions);
+		OutNormals = MoveTemp(PendingReadback->Normals);
+		OutTangents = MoveTemp(PendingReadback->Tangents);
+		LogOptionalStreams(PendingReadback->Sources);
+		PendingReadback.Reset();
+		return EFleshRingReadbackStatus::Ready;
+	}
+
+	// Readback fences are checked on the render thread - game thread never waits
+	if (!PendingReadback->bPollInFlight.exchange(true))
+	{
+		ENQUEUE_RENDER_COMMAND(FleshRingPollGeometryReadback)(
+			[Readback = PendingReadback](FRHICommandListImmediate& RHICmdList)
+			{
+				auto IsDone = [](const TUniquePtr<FRHIGPUBufferReadback>& BufferReadback)
+				{
+					return !BufferReadback.IsValid() || BufferReadback->IsReady();
+				};
 
-			// UE5.7 synchronous Readback method
-			TArray<float>* DestPtr = &TempTangents;
-			uint32 ReadSize = SizeToRead;
-			ENQUEUE_RENDER_COMMAND(ReadbackTangents)(
-				[BufferRHI, ReadSize, DestPtr](FRHICommandListImmediate& RHICmdList)
+				if (IsDone(Readback->PositionReadback) && IsDone(Readback->NormalReadback) && IsDone(Readback->TangentReadback))
 				{
-					void* MappedData = RHICmdList.LockBuffer(BufferRHI, 0, ReadSize, RLM_ReadOnly);
-					if (MappedData)
+					auto CopyOut = [](TUniquePtr<FRHIGPUBufferReadback>& BufferReadback, auto& Dest, uint32 NumElements)
 					{
-						FMemory::Memcpy(DestPtr->GetData(), MappedData, ReadSize);
-						RHICmdList.UnlockBuffer(BufferRHI);
-					}
-				});
-			FlushRenderingCommands();
+						Dest.SetNumZeroed(BufferReadback.IsValid() ? NumElements : 0);
+						if (BufferReadback.IsValid())
+						{
+							const uint32 NumBytes = NumElements * Dest.GetTypeSize();
+							if (const void* MappedData = BufferReadback->Lock(NumBytes))
+							{
+								FMemory::Memcpy(Dest.GetData(), MappedData, NumBytes);
+								BufferReadback->Unlock();
+							}
+							BufferReadback.Reset();
+						}
+					};
 
-			OutTangents.SetNum(VertexCountToRead);
-			for (uint32 i = 0; i < VertexCountToRead; ++i)
-			{
-				OutTangents[i] = FVector4f(
-					TempTangents[i * 4 + 0],
-					TempTangents[i * 4 + 1],
-					TempTangents[i * 4 + 2],
-					TempTangents[i * 4 + 3]);
-			}
-			bTangentSuccess = true;
-		}
+					const FDeformedGeometrySources& Sources = Readback->Sources;
+					CopyOut(Readback->PositionReadback, Readback->Positions, Sources.NumPositions);
+					CopyOut(Readback->NormalReadback, Readback->Normals, Sources.NumNormals);
+					CopyOut(Readback->TangentReadback, Readback->Tangents, Sources.NumTangents);
+					Readback->bComplete = true;
+				}
+
+				Readback->bPollInFlight = false;
+			});
 	}
 
-	if (!bTangentSuccess)
+	return EFleshRingReadbackStatus::Pending;
+}
+
+void UFleshRingDeformerInstance::CancelDeformedGeometryReadback()
+{
+	if (PendingReadback.IsValid())
 	{
-		UE_LOG(LogFleshRing, Warning, TEXT("ReadbackDeformedGeometry: Tangent readback failed (may be disabled)"));
-		// Tangent is also optional, not an error, return empty array
-		OutTangents.Empty();
+		// Last reference released on the render thread (after any copy / poll command still queued)
+		ENQUEUE_RENDER_COMMAND(FleshRingReleaseGeometryReadback)(
+			[Readback = MoveTemp(PendingReadback)](FRHICommandListImmediate& RHICmdList) mutable
+			{
+				Readback.Reset();
+			});
 	}
-
-	return true;
 }
 #endif
 
@@ -1718,6 +1844,7 @@ void UFleshRingDeformerInstance::InvalidateTightnessCache(int32 DirtyRingIndex)
         // Points should be visible during drag, so clear only when AffectedCount == 0
         // in EnqueueWork Fallback
 
+#if WITH_EDITORONLY_DATA
         // 3. Also invalidate GPU Influence Readback cache
         // Use CPU fallback until new TightnessCS result is Readback
         if (Data.bDebugInfluenceReadbackComplete.IsValid())
@@ -1728,6 +1855,7 @@ void UFleshRingDeformerInstance::InvalidateTightnessCache(int32 DirtyRingIndex)
         {
             Data.DebugInfluenceReadbackResult->Empty();
         }
+#endif
     }
 
     // 4. Also invalidate CPU debug cache (synchronize with GPU recalculation)
@@ -0,0 +1,248 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingLODTransfer.cpp
+#include "FleshRingLODTransfer.h"
+#include "Async/ParallelFor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingLODTransfer, Log, All);
+
+namespace FleshRingLODTransfer
+{
+
+namespace
+{
+	// Shell search limit (cells) - bounds query cost when MaxDistance is large relative to edge length
+	constexpr int32 MaxSearchShells = 16;
+
+	/** Uniform grid of reference triangles (each triangle registered in every cell its AABB overlaps) */
+	struct FTriangleGrid
+	{
+		float CellSize = 1.0f;
+		TMap<FIntVector, TArray<int32>> Cells;
+
+		FIntVector ToCell(const FVector3f& Position) const
+		{
+			return FIntVector(
+				FMath::FloorToInt(Position.X / CellSize),
+				FMath::FloorToInt(Position.Y / CellSize),
+				FMath::FloorToInt(Position.Z / CellSize));
+		}
+	};
+}
+
+void BindToClosestSurface(
+	const TArray<FVector3f>& RefPositions,
+	const TArray<uint32>& RefIndices,
+	const TArray<FVector3f>& TargetPositions,
+	float MaxDistance,
+	TArray<FFleshRingSurfaceBinding>& OutBindings)
+{
+	OutBindings.Reset();
+	OutBindings.SetNum(TargetPositions.Num());
+
+	const int32 NumTriangles = RefIndices.Num() / 3;
+	if (NumTriangles == 0 || TargetPositions.Num() == 0)
+	{
+		return;
+	}
+
+	// Cell size from average reference edge length (keeps a few triangles per cell)
+	double EdgeLengthSum = 0.0;
+	TArray<bool> bValidTriangle;
+	bValidTriangle.SetNumZeroed(NumTriangles);
+	int32 NumValidTriangles = 0;
+
+	for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
+	{
+		const uint32 I0 = RefIndices[TriIdx * 3 + 0];
+		const uint32 I1 = RefIndices[TriIdx * 3 + 1];
+		const uint32 I2 = RefIndices[TriIdx * 3 + 2];
+		if (!RefPositions.IsValidIndex(I0) || !RefPositions.IsValidIndex(I1) || !RefPositions.IsValidIndex(I2))
+		{
+			continue;
+		}
+
+		const FVector3f& A = RefPositions[I0];
+		const FVector3f& B = RefPositions[I1];
+		const FVector3f& C = RefPositions[I2];
+
+		// Degenerate triangles have no stable barycentrics
+		if (FVector3f::CrossProduct(B - A, C - A).SizeSquared() <= UE_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		bValidTriangle[TriIdx] = true;
+		EdgeLengthSum += FVector3f::Dist(A, B) + FVector3f::Dist(B, C) + FVector3f::Dist(C, A);
+		++NumValidTriangles;
+	}
+
+	if (NumValidTriangles == 0)
+	{
+		UE_LOG(LogFleshRingLODTransfer, Warning, TEXT("BindToClosestSurface: Reference mesh has no valid triangles"));
+		return;
+	}
+
+	FTriangleGrid Grid;
+	Grid.CellSize = FMath::Max(static_cast<float>(EdgeLengthSum / (NumValidTriangles * 3)) * 2.0f, KINDA_SMALL_NUMBER);
+
+	for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
+	{
+		if (!bValidTriangle[TriIdx])
+		{
+			continue;
+		}
+
+		const FVector3f& A = RefPositions[RefIndices[TriIdx * 3 + 0]];
+		const FVector3f& B = RefPositions[RefIndices[TriIdx * 3 + 1]];
+		const FVector3f& C = RefPositions[RefIndices[TriIdx * 3 + 2]];
+
+		const FIntVector MinCell = Grid.ToCell(A.ComponentMin(B).ComponentMin(C));
+		const FIntVector MaxCell = Grid.ToCell(A.ComponentMax(B).ComponentMax(C));
+
+		for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+				{
+					Grid.Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(TriIdx);
+				}
+			}
+		}
+	}
+
+	const int32 NumShells = FMath::Clamp(FMath::CeilToInt(MaxDistance / Grid.CellSize), 1, MaxSearchShells);
+	const float MaxDistanceSq = FMath::Square(MaxDistance);
+
+	ParallelFor(TargetPositions.Num(), [&](int32 TargetIdx)
+	{
+		const FVector3f& Point = TargetPositions[TargetIdx];
+		const FIntVector Center = Grid.ToCell(Point);
+
+		int32 BestTriangle = INDEX_NONE;
+		float BestDistSq = MaxDistanceSq;
+		FVector BestClosest = FVector::ZeroVector;
+
+		for (int32 Shell = 0; Shell <= NumShells; ++Shell)
+		{
+			// Cells beyond this shell are at least Shell * CellSize away
+			if (BestTriangle != INDEX_NONE && FMath::Square((Shell - 1) * Grid.CellSize) > BestDistSq)
+			{
+				break;
+			}
+
+			for (int32 DZ = -Shell; DZ <= Shell; ++DZ)
+			{
+				for (int32 DY = -Shell; DY <= Shell; ++DY)
+				{
+					for (int32 DX = -Shell; DX <= Shell; ++DX)
+					{
+						// Shell surface only
+						if (FMath::Max3(FMath::Abs(DX), FMath::Abs(DY), FMath::Abs(DZ)) != Shell)
+						{
+							continue;
+						}
+
+						const TArray<int32>* CellTriangles = Grid.Cells.Find(Center + FIntVector(DX, DY, DZ));
+						if (!CellTriangles)
+						{
+							continue;
+						}
+
+						for (int32 TriIdx : *CellTriangles)
+						{
+							const FVector A(RefPositions[RefIndices[TriIdx * 3 + 0]]);
+							const FVector B(RefPositions[RefIndices[TriIdx * 3 + 1]]);
+							const FVector C(RefPositions[RefIndices[TriIdx * 3 + 2]]);
+
+							const FVector Closest = FMath::ClosestPointOnTriangleToPoint(FVector(Point), A, B, C);
+							const float DistSq = static_cast<float>(FVector::DistSquared(Closest, FVector(Point)));
+							if (DistSq < BestDistSq || (BestTriangle == INDEX_NONE && DistSq <= BestDistSq))
+							{
+								BestDistSq = DistSq;
+								BestTriangle = TriIdx;
+								BestClosest = Closest;
+							}
+						}
+					}
+				}
+			}
+		}
+
+		if (BestTriangle == INDEX_NONE)
+		{
+			return;
+		}
+
+		const FVector A(RefPositions[RefIndices[BestTriangle * 3 + 0]]);
+		const FVector B(RefPositions[RefIndices[BestTriangle * 3 + 1]]);
+		const FVector C(RefPositions[RefIndices[BestTriangle * 3 + 2]]);
+
+		FFleshRingSurfaceBinding& Binding = OutBindings[TargetIdx];
+		Binding.TriangleIndex = BestTriangle;
+		Binding.Barycentric = FVector3f(FMath::ComputeBaryCentric2D(BestClosest, A, B, C));
+		Binding.Distance = FMath::Sqrt(BestDistSq);
+	});
+}
+
+float EstimateSimplificationError(const TArray<FFleshRingSurfaceBinding>& Bindings, float Percentile)
+{
+	TArray<float> Distances;
+	Distances.Reserve(Bindings.Num());
+	for (const FFleshRingSurfaceBinding& Binding : Bindings)
+	{
+		if (Binding.IsValid())
+		{
+			Distances.Add(Binding.Distance);
+		}
+	}
+
+	if (Distances.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	Distances.Sort();
+	const int32 PercentileIndex = FMath::Clamp(FMath::FloorToInt(FMath::Clamp(Percentile, 0.0f, 1.0f) * (Distances.Num() - 1)), 0, Distances.Num() - 1);
+	return Distances[PercentileIndex];
+}
+
+float TransferOffsets(
+	const FFleshRingLODTransferSource& Source,
+	const TArray<FVector3f>& TargetPositions,
+	TArray<FVector3f>& OutPositionOffsets,
+	TArray<FVector3f>& OutNormalOffsets)
+{
+	OutPositionOffsets.Reset();
+	OutNormalOffsets.Reset();
+	OutPositionOffsets.SetNumZeroed(TargetPositions.Num());
+	OutNormalOffsets.SetNumZeroed(TargetPositions.Num());
+
+	if (!Source.HasDeformation())
+	{
+		return 0.0f;
+	}
+
+	TArray<FFleshRingSurfaceBinding> Bindings;
+	BindToClosestSurface(Source.RestPositions, Source.RestIndices, TargetPositions, Source.BindSearchDistance, Bindings);
+
+	// The LOD surface stays within its simplification error of LOD0; farther vertices keep their rest state
+	const float SimplificationError = EstimateSimplificationError(Bindings);
+	const float MaxTransferDistance = FMath::Max(SimplificationError * 2.0f, 0.1f);
+
+	for (int32 i = 0; i < TargetPositions.Num(); ++i)
+	{
+		if (!Bindings[i].IsValid() || Bindings[i].Distance > MaxTransferDistance)
+		{
+			continue;
+		}
+
+		OutPositionOffsets[i] = InterpolateAtBinding(Bindings[i], Source.RestIndices, Source.PositionOffsets);
+		OutNormalOffsets[i] = InterpolateAtBinding(Bindings[i], Source.RestIndices, Source.NormalOffsets);
+	}
+
+	return SimplificationError;
+}
+
+}
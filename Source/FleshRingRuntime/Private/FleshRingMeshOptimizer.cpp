@@ -0,0 +1,324 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingMeshOptimizer.cpp
+#include "FleshRingMeshOptimizer.h"
+#include "FleshRingSubdivisionProcessor.h"
+#include "Algo/StableSort.h"
+
+namespace FleshRingMeshOptimizer
+{
+
+namespace
+{
+	// Forsyth scoring constants (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation")
+	constexpr int32 ForsythCacheSize = 32;
+	constexpr float CacheDecayPower = 1.5f;
+	constexpr float LastTriScore = 0.75f;
+	constexpr float ValenceBoostScale = 2.0f;
+	constexpr float ValenceBoostPower = 0.5f;
+
+	float ScoreVertex(int32 CachePosition, int32 RemainingTriangles)
+	{
+		if (RemainingTriangles == 0)
+		{
+			return -1.0f;
+		}
+
+		float Score = 0.0f;
+		if (CachePosition >= 0)
+		{
+			if (CachePosition < 3)
+			{
+				// Vertices of the last triangle: fixed score so the next triangle doesn't just reuse them
+				Score = LastTriScore;
+			}
+			else
+			{
+				const float Scaler = 1.0f / (ForsythCacheSize - 3);
+				Score = FMath::Pow(1.0f - (CachePosition - 3) * Scaler, CacheDecayPower);
+			}
+		}
+
+		// Boost vertices with few remaining triangles (finish them off, avoid lone triangles later)
+		Score += ValenceBoostScale * FMath::Pow(static_cast<float>(RemainingTriangles), -ValenceBoostPower);
+		return Score;
+	}
+}
+
+float ComputeACMR(const TArray<uint32>& Indices, int32 CacheSize)
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles == 0)
+	{
+		return 0.0f;
+	}
+
+	TArray<uint32> Cache;
+	Cache.Init(MAX_uint32, CacheSize);
+	int32 CacheHead = 0;
+	int32 Misses = 0;
+
+	for (int32 i = 0; i < NumTriangles * 3; ++i)
+	{
+		const uint32 Vertex = Indices[i];
+		if (!Cache.Contains(Vertex))
+		{
+			Cache[CacheHead] = Vertex;
+			CacheHead = (CacheHead + 1) % CacheSize;
+			++Misses;
+		}
+	}
+
+	return static_cast<float>(Misses) / NumTriangles;
+}
+
+void OptimizeTriangleOrder(TArrayView<uint32> Indices, int32 NumVertices)
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles <= 1)
+	{
+		return;
+	}
+
+	// Vertex -> triangle adjacency (CSR); only vertices used by this range are touched
+	TArray<int32> VertexOffsets;
+	VertexOffsets.SetNumZeroed(NumVertices + 1);
+	for (int32 i = 0; i < NumTriangles * 3; ++i)
+	{
+		VertexOffsets[Indices[i] + 1]++;
+	}
+	for (int32 v = 0; v < NumVertices; ++v)
+	{
+		VertexOffsets[v + 1] += VertexOffsets[v];
+	}
+
+	TArray<int32> VertexTriangles;
+	VertexTriangles.SetNumUninitialized(NumTriangles * 3);
+	TArray<int32> RemainingTriangles;  // Per vertex: number of not-yet-emitted triangles (prefix of its adjacency list)
+	RemainingTriangles.SetNumZeroed(NumVertices);
+	for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const uint32 Vertex = Indices[Tri * 3 + Corner];
+			VertexTriangles[VertexOffsets[Vertex] + RemainingTriangles[Vertex]++] = Tri;
+		}
+	}
+
+	TArray<int32> CachePosition;
+	CachePosition.Init(INDEX_NONE, NumVertices);
+	TArray<float> VertexScore;
+	VertexScore.SetNumZeroed(NumVertices);
+	for (int32 v = 0; v < NumVertices; ++v)
+	{
+		if (RemainingTriangles[v] > 0)
+		{
+			VertexScore[v] = ScoreVertex(INDEX_NONE, RemainingTriangles[v]);
+		}
+	}
+
+	TArray<float> TriangleScore;
+	TriangleScore.SetNumUninitialized(NumTriangles);
+	for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+	{
+		TriangleScore[Tri] = VertexScore[Indices[Tri * 3]] + VertexScore[Indices[Tri * 3 + 1]] + VertexScore[Indices[Tri * 3 + 2]];
+	}
+
+	TBitArray<> TriangleEmitted(false, NumTriangles);
+	TArray<uint32> NewIndices;
+	NewIndices.Reserve(NumTriangles * 3);
+
+	// LRU cache (+3 slots for the triangle being pushed)
+	TArray<int32> Cache;
+	Cache.Reserve(ForsythCacheSize + 3);
+	TArray<int32> NewCache;
+	NewCache.Reserve(ForsythCacheSize + 3);
+
+	int32 BestTriangle = INDEX_NONE;
+	int32 ScanCursor = 0;
+
+	for (int32 Emitted = 0; Emitted < NumTriangles; ++Emitted)
+	{
+		if (BestTriangle == INDEX_NONE)
+		{
+			// Cache exhausted: restart from the best remaining triangle
+			float BestScore = -1.0f;
+			for (int32 Tri = ScanCursor; Tri < NumTriangles; ++Tri)
+			{
+				if (!TriangleEmitted[Tri] && TriangleScore[Tri] > BestScore)
+				{
+					BestScore = TriangleScore[Tri];
+					BestTriangle = Tri;
+				}
+			}
+			while (ScanCursor < NumTriangles && TriangleEmitted[ScanCursor])
+			{
+				++ScanCursor;
+			}
+		}
+
+		check(BestTriangle != INDEX_NONE);
+		TriangleEmitted[BestTriangle] = true;
+
+		// Emit + push to front of cache, remove triangle from its vertices' remaining lists
+		NewCache.Reset();
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			const int32 Vertex = Indices[BestTriangle * 3 + Corner];
+			NewIndices.Add(Vertex);
+			NewCache.Add(Vertex);
+
+			const int32 Begin = VertexOffsets[Vertex];
+			const int32 Count = RemainingTriangles[Vertex];
+			for (int32 Slot = Begin; Slot < Begin + Count; ++Slot)
+			{
+				if (VertexTriangles[Slot] == BestTriangle)
+				{
+					Swap(VertexTriangles[Slot], VertexTriangles[Begin + Count - 1]);
+					break;
+				}
+			}
+			RemainingTriangles[Vertex]--;
+		}
+		for (int32 Vertex : Cache)
+		{
+			if (NewCache.Num() >= ForsythCacheSize + 3)
+			{
+				break;
+			}
+			if (!NewCache.Contains(Vertex))
+			{
+				NewCache.Add(Vertex);
+			}
+		}
+
+		// Vertices pushed out of the cache
+		for (int32 Vertex : Cache)
+		{
+			if (!NewCache.Contains(Vertex))
+			{
+				CachePosition[Vertex] = INDEX_NONE;
+				VertexScore[Vertex] = ScoreVertex(INDEX_NONE, RemainingTriangles[Vertex]);
+			}
+		}
+		Swap(Cache, NewCache);
+
+		// Rescore cached vertices and their remaining triangles, pick the next best
+		for (int32 Position = 0; Position < Cache.Num(); ++Position)
+		{
+			const int32 Vertex = Cache[Position];
+			CachePosition[Vertex] = Position < ForsythCacheSize ? Position : INDEX_NONE;
+			VertexScore[Vertex] = ScoreVertex(CachePosition[Vertex], RemainingTriangles[Vertex]);
+		}
+
+		BestTriangle = INDEX_NONE;
+		float BestScore = -1.0f;
+		for (int32 Vertex : Cache)
+		{
+			const int32 Begin = VertexOffsets[Vertex];
+			for (int32 Slot = Begin; Slot < Begin + RemainingTriangles[Vertex]; ++Slot)
+			{
+				const int32 Tri = VertexTriangles[Slot];
+				const float Score = VertexScore[Indices[Tri * 3]] + VertexScore[Indices[Tri * 3 + 1]] + VertexScore[Indices[Tri * 3 + 2]];
+				TriangleScore[Tri] = Score;
+				if (Score > BestScore)
+				{
+					BestScore = Score;
+					BestTriangle = Tri;
+				}
+			}
+		}
+
+		// Trim overflow slots
+		if (Cache.Num() > ForsythCacheSize)
+		{
+			Cache.SetNum(ForsythCacheSize, EAllowShrinking::No);
+		}
+	}
+
+	FMemory::Memcpy(Indices.GetData(), NewIndices.GetData(), NewIndices.Num() * sizeof(uint32));
+}
+
+void OptimizeTopology(FSubdivisionTopologyResult& Result, float& OutACMRBefore, float& OutACMRAfter)
+{
+	OutACMRBefore = ComputeACMR(Result.Indices);
+	OutACMRAfter = OutACMRBefore;
+
+	const int32 NumTriangles = Result.Indices.Num() / 3;
+	const int32 NumVertices = Result.VertexData.Num();
+	if (NumTriangles == 0 || NumVertices == 0 || Result.TriangleMaterialIndices.Num() != NumTriangles)
+	{
+		return;
+	}
+
+	// 1. Group triangles by material (stable: sections keep their relative order)
+	TArray<int32> TriangleOrder;
+	TriangleOrder.SetNumUninitialized(NumTriangles);
+	for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+	{
+		TriangleOrder[Tri] = Tri;
+	}
+	Algo::StableSortBy(TriangleOrder, [&Result](int32 Tri) { return Result.TriangleMaterialIndices[Tri]; });
+
+	TArray<uint32> SortedIndices;
+	TArray<int32> SortedMaterials;
+	SortedIndices.SetNumUninitialized(NumTriangles * 3);
+	SortedMaterials.SetNumUninitialized(NumTriangles);
+	for (int32 NewTri = 0; NewTri < NumTriangles; ++NewTri)
+	{
+		const int32 OldTri = TriangleOrder[NewTri];
+		SortedIndices[NewTri * 3 + 0] = Result.Indices[OldTri * 3 + 0];
+		SortedIndices[NewTri * 3 + 1] = Result.Indices[OldTri * 3 + 1];
+		SortedIndices[NewTri * 3 + 2] = Result.Indices[OldTri * 3 + 2];
+		SortedMaterials[NewTri] = Result.TriangleMaterialIndices[OldTri];
+	}
+
+	// 2. Vertex cache optimization per material section
+	for (int32 SectionStart = 0; SectionStart < NumTriangles;)
+	{
+		int32 SectionEnd = SectionStart + 1;
+		while (SectionEnd < NumTriangles && SortedMaterials[SectionEnd] == SortedMaterials[SectionStart])
+		{
+			++SectionEnd;
+		}
+
+		OptimizeTriangleOrder(
+			TArrayView<uint32>(SortedIndices.GetData() + SectionStart * 3, (SectionEnd - SectionStart) * 3),
+			NumVertices);
+
+		SectionStart = SectionEnd;
+	}
+
+	// 3. Vertex fetch locality: renumber in first-use order (unreferenced vertices keep relative order at the end)
+	TArray<int32> OldToNew;
+	OldToNew.Init(INDEX_NONE, NumVertices);
+	TArray<FSubdivisionVertexData> NewVertexData;
+	NewVertexData.Reserve(NumVertices);
+
+	for (uint32& Index : SortedIndices)
+	{
+		if (OldToNew[Index] == INDEX_NONE)
+		{
+			OldToNew[Index] = NewVertexData.Num();
+			NewVertexData.Add(Result.VertexData[Index]);
+		}
+		Index = OldToNew[Index];
+	}
+	for (int32 OldVertex = 0; OldVertex < NumVertices; ++OldVertex)
+	{
+		if (OldToNew[OldVertex] == INDEX_NONE)
+		{
+			OldToNew[OldVertex] = NewVertexData.Num();
+			NewVertexData.Add(Result.VertexData[OldVertex]);
+		}
+	}
+
+	// Parents reference source mesh vertices (not result vertices), so VertexData moves as-is
+	Result.VertexData = MoveTemp(NewVertexData);
+	Result.Indices = MoveTemp(SortedIndices);
+	Result.TriangleMaterialIndices = MoveTemp(SortedMaterials);
+
+	OutACMRAfter = ComputeACMR(Result.Indices);
+}
+
+}
@@ -3,143 +3,508 @@
 #include "FleshRingModularLibrary.h"
 #include "FleshRingComponent.h"
 #include "FleshRingAsset.h"
+#include "FleshRingUtils.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/SkeletalMesh.h"
+#include "Rendering/SkeletalMeshRenderData.h"
 #include "Animation/Skeleton.h"
 #include "SkeletalMeshMerge.h"  // FSkeletalMeshMerge (Engine module)
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "UObject/GCObject.h"
+#include "UObject/ObjectKey.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogFleshRingModular, Log, All);
 
 //==========================================================================
-// Skeletal Merging API
+// Merged Mesh Cache
 //==========================================================================
 
-FFleshRingMergeOutput UFleshRingModularLibrary::RebuildMergedMesh(
-	USkeletalMeshComponent* TargetComponent,
-	const TArray<FFleshRingModularPart>& Parts){
-	FFleshRingMergeOutput Output;
+namespace
+{
+	/** Default number of cached part combinations */
+	constexpr int32 DefaultMergedMeshCacheCapacity = 8;
+
+	/**
+	 * Ordered (part mesh, ring asset) list of a merge + geometry hash of each part mesh
+	 * Re-baking creates a new BakedMesh object, reimporting / editing a mesh in place changes its content hash
+	 */
+	struct FMergeCacheKey
+	{
+		TArray<FObjectKey> Objects;
+		TArray<uint32> ContentHashes;
+		uint32 Hash = 0;
 
-	// 1. Validation
-	if (Parts.Num() == 0)
+		FMergeCacheKey() = default;
+
+		FMergeCacheKey(const TArray<FFleshRingModularPart>& Parts, const TArray<USkeletalMesh*>& Meshes)
+		{
+			// Meshes holds one entry per valid part, in part order
+			int32 MeshIndex = 0;
+			for (const FFleshRingModularPart& Part : Parts)
+			{
+				if (!Part.IsValid())
+				{
+					continue;
+				}
+				Objects.Add(FObjectKey(Meshes[MeshIndex++]));
+				Objects.Add(FObjectKey(Part.RingAsset));
+			}
+
+			for (const FObjectKey& Object : Objects)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Object));
+			}
+		}
+
+		/** Completes the key with the part meshes' content hashes (see FFleshRingMergedMeshCache::FindSourceHashes) */
+		void AddContentHashes(TArray<uint32>&& InContentHashes)
+		{
+			ContentHashes = MoveTemp(InContentHashes);
+			for (const uint32 ContentHash : ContentHashes)
+			{
+				Hash = HashCombineFast(Hash, ContentHash);
+			}
+		}
+
+		bool operator==(const FMergeCacheKey& Other) const
+		{
+			return Hash == Other.Hash && Objects == Other.Objects && ContentHashes == Other.ContentHashes;
+		}
+	};
+
+	/** Merge meshes into a new USkeletalMesh (game thread, FSkeletalMeshMerge creates and builds UObjects) */
+	USkeletalMesh* MergeMeshes(USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes)
 	{
-		Output.Result = EFleshRingMergeResult::NoValidParts;
-		Output.ErrorMessage = TEXT("No parts provided");
-		return Output;
+		check(IsInGameThread());
+
+		USkeletalMesh* MergedMesh = NewObject<USkeletalMesh>();
+		MergedMesh->SetSkeleton(Skeleton);
+
+		TArray<FSkelMeshMergeSectionMapping> SectionMappings;
+		FSkeletalMeshMerge Merger(MergedMesh, Meshes, SectionMappings, 0);
+		return Merger.DoMerge() ? MergedMesh : nullptr;
 	}
+}
 
-	// 2. Build mesh array and ring asset array, extract skeleton from first valid part
-	TArray<USkeletalMesh*> MeshesToMerge;
-	TArray<UFleshRingAsset*> RingAssets;
-	MeshesToMerge.Reserve(Parts.Num());
+/**
+ * LRU cache of merged meshes + in-flight async merges
+ * Part mesh content hashes are cached per mesh and only recomputed when its render data is rebuilt
+ * Async merges hash unknown part meshes on a worker, then look up / merge on the game thread
+ * Holds strong references (cached results, and meshes read by hash workers)
+ */
+class FFleshRingMergedMeshCache : public FGCObject
+{
+public:
+	static FFleshRingMergedMeshCache& Get()
+	{
+		static FFleshRingMergedMeshCache Instance;
+		return Instance;
+	}
+
+	/** Returns cached mesh and marks it most recently used */
+	USkeletalMesh* FindAndTouch(const FMergeCacheKey& Key)
+	{
+		const int32 Index = Entries.IndexOfByPredicate([&Key](const FEntry& Entry) { return Entry.Key == Key; });
+		if (Index == INDEX_NONE)
+		{
+			return nullptr;
+		}
 
-	USkeleton* Skeleton = nullptr;  // Extracted from first valid part
+		USkeletalMesh* Mesh = Entries[Index].Mesh;
+		if (Index > 0)
+		{
+			FEntry Entry = MoveTemp(Entries[Index]);
+			Entries.RemoveAt(Index);
+			Entries.Insert(MoveTemp(Entry), 0);
+		}
+		return Mesh;
+	}
 
-	for (int32 i = 0; i < Parts.Num(); ++i)
+	void Add(const FMergeCacheKey& Key, USkeletalMesh* Mesh)
 	{
-		const FFleshRingModularPart& Part = Parts[i];
+		if (Capacity <= 0 || FindAndTouch(Key))
+		{
+			return;
+		}
 
-		if (!Part.IsValid())
+		Entries.Insert(FEntry{ Key, Mesh }, 0);
+		if (Entries.Num() > Capacity)
 		{
-			Output.InvalidPartIndices.Add(i);
-			UE_LOG(LogFleshRingModular, Warning,
-				TEXT("RebuildMergedMesh: Part[%d] is invalid (BaseMesh is null), skipping"),
-				i);
-			continue;
+			Entries.SetNum(Capacity);
 		}
+	}
 
-		if (Part.RingAsset && Part.RingAsset->HasBakedMesh())
+	void SetCapacity(int32 InCapacity)
+	{
+		Capacity = FMath::Max(InCapacity, 0);
+		if (Entries.Num() > Capacity)
 		{
-			// Use BakedMesh (with ring deformation baked in)
-			USkeletalMesh* BakedMesh = Part.RingAsset->SubdivisionSettings.BakedMesh;
-			USkeleton* PartSkeleton = BakedMesh->GetSkeleton();
+			Entries.SetNum(Capacity);
+		}
+	}
+
+	void Empty()
+	{
+		Entries.Empty();
+		SourceHashes.Empty();
+	}
 
-			if (!Skeleton)
+	/**
+	 * Cached content hash of each mesh (cheap identity check: same object + same render data)
+	 * @param OutContentHashes - Output: one hash per mesh (0 where missing)
+	 * @param OutMissingHashes - Output: indices of meshes that still need hashing
+	 */
+	void FindSourceHashes(const TArray<USkeletalMesh*>& Meshes, TArray<uint32>& OutContentHashes, TArray<int32>& OutMissingHashes) const
+	{
+		OutContentHashes.SetNumZeroed(Meshes.Num());
+		OutMissingHashes.Reset();
+		for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); ++MeshIndex)
+		{
+			const FSourceHash* SourceHash = SourceHashes.Find(FObjectKey(Meshes[MeshIndex]));
+			if (SourceHash && SourceHash->RenderData == Meshes[MeshIndex]->GetResourceForRendering())
 			{
-				Skeleton = PartSkeleton;
+				OutContentHashes[MeshIndex] = SourceHash->ContentHash;
 			}
-			else if (PartSkeleton != Skeleton)
+			else
 			{
-				Output.Result = EFleshRingMergeResult::SkeletonMismatch;
-				Output.ErrorMessage = FString::Printf(
-					TEXT("Part[%d] BakedMesh skeleton '%s' does not match first part skeleton '%s'"),
-					i, *PartSkeleton->GetName(), *Skeleton->GetName());
-				Output.FailedPartIndex = i;
-				return Output;
+				OutMissingHashes.Add(MeshIndex);
 			}
+		}
+	}
 
-			MeshesToMerge.Add(BakedMesh);
-			RingAssets.Add(Part.RingAsset);
+	/** Content hash of each mesh, hashing (on this thread) only meshes not seen since their render data was built */
+	TArray<uint32> GetSourceHashes(const TArray<USkeletalMesh*>& Meshes)
+	{
+		TArray<uint32> ContentHashes;
+		TArray<int32> MissingHashes;
+		FindSourceHashes(Meshes, ContentHashes, MissingHashes);
+		for (const int32 MeshIndex : MissingHashes)
+		{
+			ContentHashes[MeshIndex] = FleshRingUtils::HashSkeletalMeshGeometry(Meshes[MeshIndex]);
+			AddSourceHash(Meshes[MeshIndex], Meshes[MeshIndex]->GetResourceForRendering(), ContentHashes[MeshIndex]);
 		}
-		else
+		return ContentHashes;
+	}
+
+	/** New async request id for TargetComponent (supersedes its previous rebuilds) */
+	uint64 BeginRequest(USkeletalMeshComponent* TargetComponent)
+	{
+		const uint64 RequestId = NextRequestId++;
+		if (TargetComponent)
 		{
-			// Use BaseMesh (no ring effect)
-			USkeleton* PartSkeleton = Part.BaseMesh->GetSkeleton();
+			LatestRequests.Add(FObjectKey(TargetComponent), RequestId);
+		}
+		return RequestId;
+	}
 
-			if (!Skeleton)
+	/** In-flight async rebuilds of TargetComponent are no longer applied to it */
+	void SupersedeRequests(USkeletalMeshComponent* TargetComponent)
+	{
+		if (TargetComponent)
+		{
+			LatestRequests.Remove(FObjectKey(TargetComponent));
+		}
+	}
+
+	/**
+	 * Queue an async merge (joins an in-flight merge of the same combination)
+	 * @param Key - Object part of the key, content hashes are added once the worker has computed them
+	 */
+	void LaunchMerge(const FMergeCacheKey& Key, USkeleton* Skeleton, const TArray<USkeletalMesh*>& Meshes,
+		const TArray<UFleshRingAsset*>& RingAssets, USkeletalMeshComponent* TargetComponent, uint64 RequestId,
+		FFleshRingMergeOutput&& Output, FFleshRingMergeCompleteDelegate OnComplete)
+	{
+		FPendingRequest Request{ TargetComponent, RequestId, MoveTemp(Output), MoveTemp(OnComplete) };
+
+		for (const TUniquePtr<FPendingMerge>& Pending : PendingMerges)
+		{
+			if (Pending->Key == Key)
 			{
-				Skeleton = PartSkeleton;
+				Pending->Requests.Add(MoveTemp(Request));
+				return;
 			}
-			else if (PartSkeleton != Skeleton)
+		}
+
+		TUniquePtr<FPendingMerge> Pending = MakeUnique<FPendingMerge>();
+		Pending->Key = Key;
+		Pending->Skeleton = Skeleton;
+		Pending->SourceMeshes = TArray<TObjectPtr<USkeletalMesh>>(Meshes);
+		Pending->RingAssets = TArray<TObjectPtr<UFleshRingAsset>>(RingAssets);
+		Pending->Requests.Add(MoveTemp(Request));
+
+		TArray<uint32> ContentHashes;
+		FindSourceHashes(Meshes, ContentHashes, Pending->MissingHashes);
+		for (const int32 MeshIndex : Pending->MissingHashes)
+		{
+			Pending->MissingRenderData.Add(Meshes[MeshIndex]->GetResourceForRendering());
+		}
+
+		// Only hashing of unknown meshes runs on the worker; DoMerge creates / builds UObjects and runs in TickPendingMerges
+		// (the meshes stay referenced by this cache until the task is collected)
+		Pending->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+			[Meshes, ContentHashes = MoveTemp(ContentHashes), MissingHashes = Pending->MissingHashes]() mutable
 			{
-				Output.Result = EFleshRingMergeResult::SkeletonMismatch;
-				Output.ErrorMessage = FString::Printf(
-					TEXT("Part[%d] BaseMesh skeleton '%s' does not match first part skeleton '%s'"),
-					i, *PartSkeleton->GetName(), *Skeleton->GetName());
-				Output.FailedPartIndex = i;
-				return Output;
+				for (const int32 MeshIndex : MissingHashes)
+				{
+					ContentHashes[MeshIndex] = FleshRingUtils::HashSkeletalMeshGeometry(Meshes[MeshIndex]);
+				}
+				return MoveTemp(ContentHashes);
+			});
+
+		PendingMerges.Add(MoveTemp(Pending));
+
+		if (!TickerHandle.IsValid())
+		{
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateRaw(this, &FFleshRingMergedMeshCache::TickPendingMerges));
+		}
+	}
+
+	//~ FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+	{
+		for (FEntry& Entry : Entries)
+		{
+			Collector.AddReferencedObject(Entry.Mesh);
+		}
+		for (TUniquePtr<FPendingMerge>& Pending : PendingMerges)
+		{
+			Collector.AddReferencedObject(Pending->Skeleton);
+			Collector.AddReferencedObjects(Pending->SourceMeshes);
+			Collector.AddReferencedObjects(Pending->RingAssets);
+		}
+	}
+
+	virtual FString GetReferencerName() const override
+	{
+		return TEXT("FFleshRingMergedMeshCache");
+	}
+
+private:
+	struct FEntry
+	{
+		FMergeCacheKey Key;
+		TObjectPtr<USkeletalMesh> Mesh;
+	};
+
+	struct FSourceHash
+	{
+		/** Render data the hash was computed from (rebuilding the mesh allocates new render data) */
+		const FSkeletalMeshRenderData* RenderData = nullptr;
+		uint32 ContentHash = 0;
+	};
+
+	struct FPendingRequest
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> TargetComponent;
+		uint64 RequestId = 0;
+		FFleshRingMergeOutput Output;
+		FFleshRingMergeCompleteDelegate OnComplete;
+	};
+
+	struct FPendingMerge
+	{
+		/** Object part only until Task completes */
+		FMergeCacheKey Key;
+		TObjectPtr<USkeleton> Skeleton;
+		TArray<TObjectPtr<USkeletalMesh>> SourceMeshes;
+		TArray<TObjectPtr<UFleshRingAsset>> RingAssets;
+
+		/** Content hashes of SourceMeshes (MissingHashes are computed by the task, the rest come from SourceHashes) */
+		UE::Tasks::TTask<TArray<uint32>> Task;
+		TArray<int32> MissingHashes;
+		TArray<const FSkeletalMeshRenderData*> MissingRenderData;
+		TArray<FPendingRequest> Requests;
+	};
+
+	void AddSourceHash(USkeletalMesh* Mesh, const FSkeletalMeshRenderData* RenderData, uint32 ContentHash)
+	{
+		// Drop entries of destroyed meshes before growing
+		for (auto It = SourceHashes.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
 			}
+		}
 
-			// Track parts with RingAsset but no BakedMesh (fallback case)
-			if (Part.RingAsset)
+		SourceHashes.Add(FObjectKey(Mesh), FSourceHash{ RenderData, ContentHash });
+	}
+
+	/** Looks up / merges hashed requests on the game thread */
+	bool TickPendingMerges(float DeltaTime)
+	{
+		// Detach first - completion delegates may start new merges
+		TArray<TUniquePtr<FPendingMerge>> Completed;
+		for (int32 i = PendingMerges.Num() - 1; i >= 0; --i)
+		{
+			if (PendingMerges[i]->Task.IsCompleted())
 			{
-				Output.UnbakedRingPartIndices.Add(i);
-				UE_LOG(LogFleshRingModular, Warning,
-					TEXT("RebuildMergedMesh: Part[%d] has RingAsset '%s' but no BakedMesh, using BaseMesh instead"),
-					i, *Part.RingAsset->GetName());
+				Completed.Add(MoveTemp(PendingMerges[i]));
+				PendingMerges.RemoveAt(i);
 			}
+		}
+
+		if (PendingMerges.Num() == 0)
+		{
+			TickerHandle.Reset();
+		}
 
-			MeshesToMerge.Add(Part.BaseMesh);
+		for (int32 i = Completed.Num() - 1; i >= 0; --i)
+		{
+			FPendingMerge& Merge = *Completed[i];
+			TArray<uint32>& ContentHashes = Merge.Task.GetResult();
+			for (int32 MissingIndex = 0; MissingIndex < Merge.MissingHashes.Num(); ++MissingIndex)
+			{
+				const int32 MeshIndex = Merge.MissingHashes[MissingIndex];
+				AddSourceHash(Merge.SourceMeshes[MeshIndex], Merge.MissingRenderData[MissingIndex], ContentHashes[MeshIndex]);
+			}
+			Merge.Key.AddContentHashes(MoveTemp(ContentHashes));
+
+			USkeletalMesh* MergedMesh = FindAndTouch(Merge.Key);
+			const bool bFromCache = MergedMesh != nullptr;
+			if (!MergedMesh)
+			{
+				MergedMesh = MergeMeshes(Merge.Skeleton, TArray<USkeletalMesh*>(Merge.SourceMeshes));
+				if (MergedMesh)
+				{
+					Add(Merge.Key, MergedMesh);
+				}
+			}
+			const bool bSuccess = MergedMesh != nullptr;
+
+			const TArray<UFleshRingAsset*> RingAssets(Merge.RingAssets);
+			for (FPendingRequest& Request : Merge.Requests)
+			{
+				FFleshRingMergeOutput& Output = Request.Output;
+				if (bSuccess)
+				{
+					Output.Result = EFleshRingMergeResult::Success;
+					Output.MergedMesh = MergedMesh;
+					Output.bFromCache = bFromCache;
+
+					const FObjectKey ComponentKey(Request.TargetComponent.Get());
+					const uint64* LatestRequestId = Request.TargetComponent.IsValid() ? LatestRequests.Find(ComponentKey) : nullptr;
+					if (LatestRequestId && *LatestRequestId == Request.RequestId)
+					{
+						LatestRequests.Remove(ComponentKey);
+						UFleshRingModularLibrary::ApplyMergedMesh(Request.TargetComponent.Get(), MergedMesh, RingAssets);
+					}
+				}
+				else
+				{
+					Output.Result = EFleshRingMergeResult::MergeFailed;
+					Output.ErrorMessage = TEXT("FSkeletalMeshMerge::DoMerge failed");
+					LatestRequests.Remove(FObjectKey(Request.TargetComponent.Get()));
+				}
+
+				Request.OnComplete.ExecuteIfBound(Output);
+			}
 		}
+
+		return TickerHandle.IsValid();
 	}
 
-	if (MeshesToMerge.Num() == 0)
+	/** Cached merges, most recently used first */
+	TArray<FEntry> Entries;
+	int32 Capacity = DefaultMergedMeshCacheCapacity;
+
+	TArray<TUniquePtr<FPendingMerge>> PendingMerges;
+
+	/** Content hash per part mesh */
+	TMap<FObjectKey, FSourceHash> SourceHashes;
+
+	/** Latest rebuild request per target component */
+	TMap<FObjectKey, uint64> LatestRequests;
+	uint64 NextRequestId = 1;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+
+//==========================================================================
+// Skeletal Merging API
+//==========================================================================
+
+FFleshRingMergeOutput UFleshRingModularLibrary::RebuildMergedMesh(
+	USkeletalMeshComponent* TargetComponent,
+	const TArray<FFleshRingModularPart>& Parts)
+{
+	FFleshRingMergeOutput Output;
+	FFleshRingMergedMeshCache& Cache = FFleshRingMergedMeshCache::Get();
+
+	// Supersedes any async rebuild still in flight for this component
+	Cache.SupersedeRequests(TargetComponent);
+
+	// 1-2. Validation, mesh/ring asset resolution
+	TArray<USkeletalMesh*> MeshesToMerge;
+	TArray<UFleshRingAsset*> RingAssets;
+	USkeleton* Skeleton = nullptr;
+	if (!ResolveMergeSources(Parts, Output, MeshesToMerge, RingAssets, Skeleton))
 	{
-		Output.Result = EFleshRingMergeResult::NoValidParts;
-		Output.ErrorMessage = TEXT("No valid meshes to merge");
 		return Output;
 	}
 
-	// 3. Merge meshes using FSkeletalMeshMerge
-	USkeletalMesh* MergedMesh = NewObject<USkeletalMesh>();
-	MergedMesh->SetSkeleton(Skeleton);
-
-	TArray<FSkelMeshMergeSectionMapping> SectionMappings;
-	FSkeletalMeshMerge Merger(MergedMesh, MeshesToMerge, SectionMappings, 0);
+	// 3. Reuse cached merge or merge meshes using FSkeletalMeshMerge
+	FMergeCacheKey Key(Parts, MeshesToMerge);
+	Key.AddContentHashes(Cache.GetSourceHashes(MeshesToMerge));
+	USkeletalMesh* MergedMesh = Cache.FindAndTouch(Key);
+	Output.bFromCache = MergedMesh != nullptr;
 
-	if (!Merger.DoMerge())
+	if (!MergedMesh)
 	{
-		Output.Result = EFleshRingMergeResult::MergeFailed;
-		Output.ErrorMessage = TEXT("FSkeletalMeshMerge::DoMerge failed");
-		return Output;
+		MergedMesh = MergeMeshes(Skeleton, MeshesToMerge);
+		if (!MergedMesh)
+		{
+			Output.Result = EFleshRingMergeResult::MergeFailed;
+			Output.ErrorMessage = TEXT("FSkeletalMeshMerge::DoMerge failed");
+			return Output;
+		}
+
+		Cache.Add(Key, MergedMesh);
 	}
 
 	Output.MergedMesh = MergedMesh;
 
 	// 4. Apply to TargetComponent + setup ring visuals
-	if (TargetComponent)
-	{
-		// Remove existing ring visuals
-		DetachAllRingVisuals(TargetComponent);
+	ApplyMergedMesh(TargetComponent, MergedMesh, RingAssets);
+
+	Output.Result = EFleshRingMergeResult::Success;
+	return Output;
+}
 
-		// Apply merged mesh
-		TargetComponent->SetSkeletalMeshAsset(MergedMesh);
+void UFleshRingModularLibrary::RebuildMergedMeshAsync(
+	USkeletalMeshComponent* TargetComponent,
+	const TArray<FFleshRingModularPart>& Parts,
+	FFleshRingMergeCompleteDelegate OnComplete)
+{
+	FFleshRingMergeOutput Output;
+	FFleshRingMergedMeshCache& Cache = FFleshRingMergedMeshCache::Get();
+	Cache.SupersedeRequests(TargetComponent);
 
-		// Create ring visuals (BeginPlay auto-detects merged mesh mode)
-		AttachRingVisuals(TargetComponent, RingAssets);
+	TArray<USkeletalMesh*> MeshesToMerge;
+	TArray<UFleshRingAsset*> RingAssets;
+	USkeleton* Skeleton = nullptr;
+	if (!ResolveMergeSources(Parts, Output, MeshesToMerge, RingAssets, Skeleton))
+	{
+		OnComplete.ExecuteIfBound(Output);
+		return;
 	}
 
-	Output.Result = EFleshRingMergeResult::Success;
-	return Output;
+	// Unknown part meshes are hashed on a worker, the cache lookup (and merge on a miss) follows on the game thread
+	const FMergeCacheKey Key(Parts, MeshesToMerge);
+	const uint64 RequestId = Cache.BeginRequest(TargetComponent);
+	Cache.LaunchMerge(Key, Skeleton, MeshesToMerge, RingAssets, TargetComponent, RequestId, MoveTemp(Output), MoveTemp(OnComplete));
+}
+
+void UFleshRingModularLibrary::SetMergedMeshCacheCapacity(int32 Capacity)
+{
+	FFleshRingMergedMeshCache::Get().SetCapacity(Capacity);
+}
+
+void UFleshRingModularLibrary::ClearMergedMeshCache()
+{
+	FFleshRingMergedMeshCache::Get().Empty();
 }
 
 //==========================================================================
@@ -316,3 +681,98 @@ int32 UFleshRingModularLibrary::DetachAllRingVisuals(
 
 	return RemovedCount;
 }
+
+bool UFleshRingModularLibrary::ResolveMergeSources(
+	const TArray<FFleshRingModularPart>& Parts,
+	FFleshRingMergeOutput& Output,
+	TArray<USkeletalMesh*>& OutMeshes,
+	TArray<UFleshRingAsset*>& OutRingAssets,
+	USkeleton*& OutSkeleton)
+{
+	if (Parts.Num() == 0)
+	{
+		Output.Result = EFleshRingMergeResult::NoValidParts;
+		Output.ErrorMessage = TEXT("No parts provided");
+		return false;
+	}
+
+	OutMeshes.Reserve(Parts.Num());
+	OutSkeleton = nullptr;  // Extracted from first valid part
+
+	for (int32 i = 0; i < Parts.Num(); ++i)
+	{
+		const FFleshRingModularPart& Part = Parts[i];
+
+		if (!Part.IsValid())
+		{
+			Output.InvalidPartIndices.Add(i);
+			UE_LOG(LogFleshRingModular, Warning,
+				TEXT("RebuildMergedMesh: Part[%d] is invalid (BaseMesh is null), skipping"),
+				i);
+			continue;
+		}
+
+		// Use BakedMesh (with ring deformation baked in), otherwise BaseMesh (no ring effect)
+		const bool bUseBakedMesh = Part.RingAsset && Part.RingAsset->HasBakedMesh();
+		USkeletalMesh* PartMesh = bUseBakedMesh ? Part.RingAsset->SubdivisionSettings.BakedMesh.Get() : Part.BaseMesh.Get();
+		USkeleton* PartSkeleton = PartMesh->GetSkeleton();
+
+		if (!OutSkeleton)
+		{
+			OutSkeleton = PartSkeleton;
+		}
+		else if (PartSkeleton != OutSkeleton)
+		{
+			Output.Result = EFleshRingMergeResult::SkeletonMismatch;
+			Output.ErrorMessage = FString::Printf(
+				TEXT("Part[%d] %s skeleton '%s' does not match first part skeleton '%s'"),
+				i, bUseBakedMesh ? TEXT("BakedMesh") : TEXT("BaseMesh"), *PartSkeleton->GetName(), *OutSkeleton->GetName());
+			Output.FailedPartIndex = i;
+			return false;
+		}
+
+		if (bUseBakedMesh)
+		{
+			OutRingAssets.Add(Part.RingAsset);
+		}
+		else if (Part.RingAsset)
+		{
+			// Track parts with RingAsset but no BakedMesh (fallback case)
+			Output.UnbakedRingPartIndices.Add(i);
+			UE_LOG(LogFleshRingModular, Warning,
+				TEXT("RebuildMergedMesh: Part[%d] has RingAsset '%s' but no BakedMesh, using BaseMesh instead"),
+				i, *Part.RingAsset->GetName());
+		}
+
+		OutMeshes.Add(PartMesh);
+	}
+
+	if (OutMeshes.Num() == 0)
+	{
+		Output.Result = EFleshRingMergeResult::NoValidParts;
+		Output.ErrorMessage = TEXT("No valid meshes to merge");
+		return false;
+	}
+
+	return true;
+}
+
+void UFleshRingModularLibrary::ApplyMergedMesh(
+	USkeletalMeshComponent* TargetComponent,
+	USkeletalMesh* MergedMesh,
+	const TArray<UFleshRingAsset*>& RingAssets)
+{
+	if (!TargetComponent)
+	{
+		return;
+	}
+
+	// Remove existing ring visuals
+	DetachAllRingVisuals(TargetComponent);
+
+	// Apply merged mesh
+	TargetComponent->SetSkeletalMeshAsset(MergedMesh);
+
+	// Create ring visuals (BeginPlay auto-detects merged mesh mode)
+	AttachRingVisuals(TargetComponent, RingAssets);
+}
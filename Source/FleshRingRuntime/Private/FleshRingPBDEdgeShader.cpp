@@ -32,7 +32,6 @@ void DispatchFleshRingPBDEdgeCS(
 	FRDGBufferRef AffectedIndicesBuffer,
 	FRDGBufferRef RepresentativeIndicesBuffer,
 	FRDGBufferRef IsAnchorFlagsBuffer,
-	FRDGBufferRef FullVertexAnchorFlagsBuffer,
 	FRDGBufferRef AdjacencyWithRestLengthsBuffer)
 {
 	// Early out if no vertices to process
@@ -42,7 +41,7 @@ void DispatchFleshRingPBDEdgeCS(
 	}
 
 	// Validate required buffers
-	if (!IsAnchorFlagsBuffer || !FullVertexAnchorFlagsBuffer)
+	if (!IsAnchorFlagsBuffer)
 	{
 		return;
 	}
@@ -71,7 +70,6 @@ void DispatchFleshRingPBDEdgeCS(
 
 	// Bind IsAnchor buffers (Tolerance-based weighting)
 	PassParameters->IsAnchorFlags = GraphBuilder.CreateSRV(IsAnchorFlagsBuffer);
-	PassParameters->FullVertexAnchorFlags = GraphBuilder.CreateSRV(FullVertexAnchorFlagsBuffer);
 
 	// Bind adjacency data
 	PassParameters->AdjacencyWithRestLengths = GraphBuilder.CreateSRV(AdjacencyWithRestLengthsBuffer);
@@ -81,6 +79,7 @@ void DispatchFleshRingPBDEdgeCS(
 	PassParameters->NumTotalVertices = Params.NumTotalVertices;
 	PassParameters->Stiffness = Params.Stiffness;
 	PassParameters->Tolerance = Params.Tolerance;
+	PassParameters->bAnchorNeighbors = Params.bAnchorNeighbors ? 1 : 0;
 
 	// Get shader
 	TShaderMapRef<FFleshRingPBDEdgeCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
@@ -110,7 +109,6 @@ void DispatchFleshRingPBDEdgeCS_MultiPass(
 	FRDGBufferRef AffectedIndicesBuffer,
 	FRDGBufferRef RepresentativeIndicesBuffer,
 	FRDGBufferRef IsAnchorFlagsBuffer,
-	FRDGBufferRef FullVertexAnchorFlagsBuffer,
 	FRDGBufferRef AdjacencyWithRestLengthsBuffer)
 {
 	if (Params.NumAffectedVertices == 0 || Params.NumIterations <= 0)
@@ -119,7 +117,7 @@ void DispatchFleshRingPBDEdgeCS_MultiPass(
 	}
 
 	// Validate required buffers
-	if (!IsAnchorFlagsBuffer || !FullVertexAnchorFlagsBuffer)
+	if (!IsAnchorFlagsBuffer)
 	{
 		return;
 	}
@@ -145,7 +143,6 @@ void DispatchFleshRingPBDEdgeCS_MultiPass(
 			AffectedIndicesBuffer,
 			RepresentativeIndicesBuffer,
 			IsAnchorFlagsBuffer,
-			FullVertexAnchorFlagsBuffer,
 			AdjacencyWithRestLengthsBuffer
 		);
 		return;
@@ -182,7 +179,6 @@ void DispatchFleshRingPBDEdgeCS_MultiPass(
 			AffectedIndicesBuffer,
 			RepresentativeIndicesBuffer,
 			IsAnchorFlagsBuffer,
-			FullVertexAnchorFlagsBuffer,
 			AdjacencyWithRestLengthsBuffer
 		);
 	}
@@ -2,6 +2,7 @@
 
 #include "FleshRingRuntime.h"
 #include "FleshRingComputeWorker.h"
+#include "FleshRingRuntimeSettings.h"
 
 #define LOCTEXT_NAMESPACE "FFleshRingRuntimeModule"
 
@@ -11,7 +12,11 @@ void FFleshRingRuntimeModule::StartupModule()
 
     // Register FleshRingComputeSystem
     // Ensures the renderer executes FleshRing tasks at the correct timing in EndOfFrameUpdate
-    FFleshRingComputeSystem::Register();
+    // Bake-only games never run the deformer (its shaders are not cooked)
+    if (UFleshRingRuntimeSettings::IsDeformerAvailable())
+    {
+        FFleshRingComputeSystem::Register();
+    }
 }
 
 void FFleshRingRuntimeModule::ShutdownModule()
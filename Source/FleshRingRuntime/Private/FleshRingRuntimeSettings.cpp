@@ -0,0 +1,78 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+#include "FleshRingRuntimeSettings.h"
+#include "GlobalShader.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/ScopeLock.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FleshRingRuntimeSettings)
+
+UFleshRingRuntimeSettings::UFleshRingRuntimeSettings()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("FleshRing");
+}
+
+bool UFleshRingRuntimeSettings::IsBakedMeshOnlyRuntime()
+{
+	bool bBakedMeshOnly = false;
+	if (GConfig)
+	{
+		GConfig->GetBool(TEXT("/Script/FleshRingRuntime.FleshRingRuntimeSettings"), TEXT("bBakedMeshOnlyRuntime"), bBakedMeshOnly, GEngineIni);
+	}
+	return bBakedMeshOnly;
+}
+
+bool UFleshRingRuntimeSettings::IsBakedMeshOnlyRuntime(EShaderPlatform Platform)
+{
+	// Shaders are gathered per target platform (cooking for another platform), whose config can differ
+	return IsBakedMeshOnlyRuntime(ShaderPlatformToPlatformName(Platform).ToString());
+}
+
+bool UFleshRingRuntimeSettings::IsBakedMeshOnlyRuntime(const FString& IniPlatformName)
+{
+	static FCriticalSection CacheLock;
+	static TMap<FName, bool> CachedValues;
+
+	const FName PlatformName(*IniPlatformName);
+
+	FScopeLock Lock(&CacheLock);
+	if (const bool* Cached = CachedValues.Find(PlatformName))
+	{
+		return *Cached;
+	}
+
+	bool bBakedMeshOnly = false;
+	FConfigFile PlatformEngineIni;
+	if (FConfigCacheIni::LoadLocalIniFile(PlatformEngineIni, TEXT("Engine"), true, *PlatformName.ToString()))
+	{
+		PlatformEngineIni.GetBool(TEXT("/Script/FleshRingRuntime.FleshRingRuntimeSettings"), TEXT("bBakedMeshOnlyRuntime"), bBakedMeshOnly);
+	}
+	CachedValues.Add(PlatformName, bBakedMeshOnly);
+	return bBakedMeshOnly;
+}
+
+bool UFleshRingRuntimeSettings::IsDeformerAvailable()
+{
+#if WITH_EDITOR
+	return true;
+#else
+	return !IsBakedMeshOnlyRuntime();
+#endif
+}
+
+bool UFleshRingRuntimeSettings::ShouldCompileDeformerShader(const FGlobalShaderPermutationParameters& Parameters)
+{
+	if (!IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5))
+	{
+		return false;
+	}
+
+	return ShouldCompileSDFShader(Parameters);
+}
+
+bool UFleshRingRuntimeSettings::ShouldCompileSDFShader(const FGlobalShaderPermutationParameters& Parameters)
+{
+	// Editor targets always keep the deformer (bake generation runs it)
+	return EnumHasAnyFlags(Parameters.Flags, EShaderPermutationFlags::HasEditorOnlyData) || !IsBakedMeshOnlyRuntime(Parameters.Platform);
+}
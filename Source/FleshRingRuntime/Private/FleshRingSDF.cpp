@@ -6,6 +6,11 @@
 #include "RenderGraphUtils.h"
 #include "ShaderParameterStruct.h"
 #include "RHIStaticStates.h"
+#include "Async/ParallelFor.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#include "HAL/IConsoleManager.h"
+#include "FleshRingSDFVolume.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSDF, Log, All);
 
@@ -27,16 +32,9 @@ IMPLEMENT_GLOBAL_SHADER(
 
 // Register 2D Slice Flood Fill shader
 IMPLEMENT_GLOBAL_SHADER(
-    F2DFloodInitializeCS,
+    F2DSliceFloodCS,
     "/Plugin/FleshRingPlugin/FleshRing2DSliceFlood.usf",
-    "Initialize2DFloodCS",
-    SF_Compute
-);
-
-IMPLEMENT_GLOBAL_SHADER(
-    F2DFloodPassCS,
-    "/Plugin/FleshRingPlugin/FleshRing2DSliceFlood.usf",
-    "Flood2DPassCS",
+    "Flood2DSliceCS",
     SF_Compute
 );
 
@@ -174,65 +172,41 @@ void Apply2DSliceFloodFill(
         FMath::DivideAndRoundUp(Resolution.Z, 8)
     );
 
-    // Create 2 flood mask textures (ping-pong buffers)
+    if (Resolution.X * Resolution.Y > F2DSliceFloodCS::MaxSliceVoxels)
+    {
+        UE_LOG(LogFleshRingSDF, Warning, TEXT("Apply2DSliceFloodFill: %dx%d slice exceeds %d voxels, donut hole correction skipped"),
+            Resolution.X, Resolution.Y, F2DSliceFloodCS::MaxSliceVoxels);
+        AddCopyTexturePass(GraphBuilder, InputSDF, OutputSDF);
+        return;
+    }
+
+    // Flood mask + Z-vote output
     FRDGTextureDesc MaskDesc = FRDGTextureDesc::Create3D(
         Resolution,
         PF_R32_UINT,
         FClearValueBinding::Black,
         TexCreate_ShaderResource | TexCreate_UAV
     );
-    FRDGTextureRef FloodMaskA = GraphBuilder.CreateTexture(MaskDesc, TEXT("2DFloodMaskA"));
-    FRDGTextureRef FloodMaskB = GraphBuilder.CreateTexture(MaskDesc, TEXT("2DFloodMaskB"));
+    FRDGTextureRef FloodResult = GraphBuilder.CreateTexture(MaskDesc, TEXT("2DFloodMask"));
+    FRDGTextureRef VoteOutput = GraphBuilder.CreateTexture(MaskDesc, TEXT("2DFloodVoteMask"));
 
-    // Pass 1: Initialize - mark XY boundaries as exterior seeds
+    // Pass 1: 2D Flood - one group per Z slice, connected-component labeling inside the dispatch
     {
-        TShaderMapRef<F2DFloodInitializeCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
-        F2DFloodInitializeCS::FParameters* Parameters = GraphBuilder.AllocParameters<F2DFloodInitializeCS::FParameters>();
+        TShaderMapRef<F2DSliceFloodCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+        F2DSliceFloodCS::FParameters* Parameters = GraphBuilder.AllocParameters<F2DSliceFloodCS::FParameters>();
         Parameters->InputSDF = GraphBuilder.CreateSRV(InputSDF);
-        Parameters->FloodMask = GraphBuilder.CreateUAV(FloodMaskA);
+        Parameters->FloodMask = GraphBuilder.CreateUAV(FloodResult);
         Parameters->GridResolution = Resolution;
 
         FComputeShaderUtils::AddPass(
             GraphBuilder,
-            RDG_EVENT_NAME("2DFlood Initialize"),
+            RDG_EVENT_NAME("2DFlood Slices"),
             ComputeShader,
             Parameters,
-            GroupCount
+            FIntVector(1, 1, Resolution.Z)
         );
     }
 
-    // Pass 2-N: 2D Flood propagation (iterate up to max resolution times)
-    // In 2D, propagate only 4 directions without diagonals, so iterate max(X,Y) times
-    TShaderMapRef<F2DFloodPassCS> FloodPassShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
-
-    int32 MaxIterations = FMath::Max(Resolution.X, Resolution.Y);
-    FRDGTextureRef CurrentInput = FloodMaskA;
-    FRDGTextureRef CurrentOutput = FloodMaskB;
-
-    for (int32 Iter = 0; Iter < MaxIterations; Iter++)
-    {
-        F2DFloodPassCS::FParameters* Parameters = GraphBuilder.AllocParameters<F2DFloodPassCS::FParameters>();
-        Parameters->FloodMaskInput = GraphBuilder.CreateSRV(CurrentInput);
-        Parameters->FloodMaskOutput = GraphBuilder.CreateUAV(CurrentOutput);
-        Parameters->SDFForFlood = GraphBuilder.CreateSRV(InputSDF);
-        Parameters->GridResolution = Resolution;
-
-        FComputeShaderUtils::AddPass(
-            GraphBuilder,
-            RDG_EVENT_NAME("2DFlood Pass %d", Iter),
-            FloodPassShader,
-            Parameters,
-            GroupCount
-        );
-
-        // Ping-pong swap
-        Swap(CurrentInput, CurrentOutput);
-    }
-
-    // Final result is in CurrentInput (after swap)
-    FRDGTextureRef FloodResult = CurrentInput;
-    FRDGTextureRef VoteOutput = CurrentOutput;  // Reuse ping-pong buffer
-
     // Pass Z-Vote: Propagate donut hole via Z-axis voting
     // If majority at each XY coordinate is "interior", set all Z to "interior"
     {
@@ -281,3 +255,319 @@ void Apply2DSliceFloodFill(
     }
 
 }
+
+// ===== CPU reference (mirrors FleshRing2DSliceFlood.usf) =====
+
+void Apply2DSliceFloodFillCPU(
+    const TArray<float>& InputSDF,
+    TArray<float>& OutputSDF,
+    FIntVector Resolution)
+{
+    const int32 SliceSize = Resolution.X * Resolution.Y;
+    const int32 TotalVoxels = SliceSize * Resolution.Z;
+    if (TotalVoxels <= 0 || InputSDF.Num() != TotalVoxels)
+    {
+        UE_LOG(LogFleshRingSDF, Warning, TEXT("Apply2DSliceFloodFillCPU: SDF size %d does not match resolution %dx%dx%d"),
+            InputSDF.Num(), Resolution.X, Resolution.Y, Resolution.Z);
+        OutputSDF = InputSDF;
+        return;
+    }
+
+    // Same limit as the GPU path (groupshared slice bitsets)
+    if (SliceSize > F2DSliceFloodCS::MaxSliceVoxels)
+    {
+        OutputSDF = InputSDF;
+        return;
+    }
+
+    auto ToIndex = [&Resolution, SliceSize](int32 X, int32 Y, int32 Z)
+    {
+        return X + Y * Resolution.X + Z * SliceSize;
+    };
+
+    // Pass 1: 2D Flood - breadth-first reachability from the XY boundary per slice (1 = outside)
+    TArray<uint8> FloodResult;
+    TArray<uint8> FinalMask;
+    FloodResult.SetNumZeroed(TotalVoxels);
+    FinalMask.SetNumUninitialized(TotalVoxels);
+
+    ParallelFor(Resolution.Z, [&](int32 Z)
+    {
+        TArray<int32> Queue;
+        Queue.Reserve(SliceSize);
+
+        auto TryVisit = [&](int32 X, int32 Y)
+        {
+            if (X < 0 || Y < 0 || X >= Resolution.X || Y >= Resolution.Y)
+            {
+                return;
+            }
+            const int32 Index = ToIndex(X, Y, Z);
+            if (FloodResult[Index] == 0 && InputSDF[Index] > 0.0f)
+            {
+                FloodResult[Index] = 1;
+                Queue.Add(Index);
+            }
+        };
+
+        for (int32 X = 0; X < Resolution.X; ++X)
+        {
+            TryVisit(X, 0);
+            TryVisit(X, Resolution.Y - 1);
+        }
+        for (int32 Y = 0; Y < Resolution.Y; ++Y)
+        {
+            TryVisit(0, Y);
+            TryVisit(Resolution.X - 1, Y);
+        }
+
+        for (int32 Head = 0; Head < Queue.Num(); ++Head)
+        {
+            const int32 InSlice = Queue[Head] - Z * SliceSize;
+            const int32 X = InSlice % Resolution.X;
+            const int32 Y = InSlice / Resolution.X;
+            TryVisit(X - 1, Y);
+            TryVisit(X + 1, Y);
+            TryVisit(X, Y - 1);
+            TryVisit(X, Y + 1);
+        }
+    });
+
+    // Pass Z-Vote: per-column majority vote (1 = outside, 0 = hole)
+
+    ParallelFor(SliceSize, [&](int32 ColumnIndex)
+    {
+        int32 InsideVotes = 0;
+        int32 OutsideVotes = 0;
+        for (int32 Z = 0; Z < Resolution.Z; ++Z)
+        {
+            const int32 Index = ColumnIndex + Z * SliceSize;
+            if (InputSDF[Index] > 0.0f)
+            {
+                if (FloodResult[Index] == 1)
+                {
+                    ++OutsideVotes;
+                }
+                else
+                {
+                    ++InsideVotes;
+                }
+            }
+        }
+
+        const bool bMajorityInside = (InsideVotes > OutsideVotes) && (InsideVotes > 0);
+        for (int32 Z = 0; Z < Resolution.Z; ++Z)
+        {
+            const int32 Index = ColumnIndex + Z * SliceSize;
+            if (bMajorityInside && InputSDF[Index] > 0.0f)
+            {
+                FinalMask[Index] = 0;
+            }
+            else
+            {
+                FinalMask[Index] = FloodResult[Index];
+            }
+        }
+    });
+
+    // Pass Final: Invert donut hole sign, flatten tube interior to surface
+    OutputSDF.SetNumUninitialized(TotalVoxels);
+    for (int32 Index = 0; Index < TotalVoxels; ++Index)
+    {
+        const float Sdf = InputSDF[Index];
+        if (FinalMask[Index] == 0 && Sdf > 0.0f)
+        {
+            OutputSDF[Index] = -Sdf;
+        }
+        else if (Sdf < 0.0f)
+        {
+            OutputSDF[Index] = 0.0f;
+        }
+        else
+        {
+            OutputSDF[Index] = Sdf;
+        }
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+// ============================================================================
+// FleshRing.SliceFloodTest - GPU vs CPU donut hole correction on concave fixtures
+//
+// Usage: Enter FleshRing.SliceFloodTest in console
+// Each fixture is a 2D cross-section extruded along Z (wall = -1, open = +1).
+// The open interior is walled in along all four axes yet may still be reachable
+// from the slice boundary around a hook/baffle, which direction tests get wrong.
+// ============================================================================
+namespace FleshRingSliceFloodTest
+{
+    struct FFixture
+    {
+        const TCHAR* Name;
+        TFunction<bool(int32, int32)> IsWall;
+        // Expected hole voxels per slice (INDEX_NONE = not checked)
+        int32 ExpectedHolesPerSlice;
+    };
+
+    constexpr int32 Size = 64;
+    constexpr int32 Depth = 8;
+
+    static bool IsFrame(int32 X, int32 Y, int32 Min, int32 Max, int32 Thickness)
+    {
+        const bool bInOuter = X >= Min && X <= Max && Y >= Min && Y <= Max;
+        const bool bInInner = X >= Min + Thickness && X <= Max - Thickness && Y >= Min + Thickness && Y <= Max - Thickness;
+        return bInOuter && !bInInner;
+    }
+
+    static bool IsBox(int32 X, int32 Y, int32 MinX, int32 MinY, int32 MaxX, int32 MaxY)
+    {
+        return X >= MinX && X <= MaxX && Y >= MinY && Y <= MaxY;
+    }
+
+    static void BuildFixtures(TArray<FFixture>& OutFixtures)
+    {
+        // G: frame with a gap in the right wall, a hook inside blocks every straight line to the gap
+        OutFixtures.Add({ TEXT("G"), [](int32 X, int32 Y)
+        {
+            const bool bGap = X >= 53 && Y >= 28 && Y <= 35;
+            return (IsFrame(X, Y, 8, 55, 3) && !bGap) || IsBox(X, Y, 40, 20, 42, 43);
+        }, 0 });
+
+        // Buckle: two closed windows split by a center bar with a tongue (holes everywhere inside)
+        int32 BuckleHoles = 0;
+        auto IsBuckleWall = [](int32 X, int32 Y)
+        {
+            return IsFrame(X, Y, 8, 55, 3) || IsBox(X, Y, 30, 8, 33, 55) || IsBox(X, Y, 34, 30, 46, 33);
+        };
+        for (int32 Y = 11; Y <= 52; ++Y)
+        {
+            for (int32 X = 11; X <= 52; ++X)
+            {
+                BuckleHoles += IsBuckleWall(X, Y) ? 0 : 1;
+            }
+        }
+        OutFixtures.Add({ TEXT("Buckle"), IsBuckleWall, BuckleHoles });
+
+        // Spiral: nested frames with alternating gaps (winding path longer than the slice width),
+        // innermost frame closed so only the core is a hole
+        OutFixtures.Add({ TEXT("Spiral"), [](int32 X, int32 Y)
+        {
+            if (IsFrame(X, Y, 2, 61, 2)) { return !(X >= 60 && Y >= 4 && Y <= 6); }
+            if (IsFrame(X, Y, 8, 55, 2)) { return !(X <= 9 && Y >= 49 && Y <= 51); }
+            if (IsFrame(X, Y, 14, 49, 2)) { return !(X >= 48 && Y >= 16 && Y <= 18); }
+            if (IsFrame(X, Y, 20, 43, 2)) { return !(X <= 21 && Y >= 37 && Y <= 39); }
+            return IsFrame(X, Y, 26, 37, 2);
+        }, (37 - 26 - 3) * (37 - 26 - 3) });
+    }
+}
+
+static FAutoConsoleCommand GFleshRingSliceFloodTestCommand(
+    TEXT("FleshRing.SliceFloodTest"),
+    TEXT("Compares GPU and CPU donut hole correction (Apply2DSliceFloodFill) on concave cross-section fixtures"),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        using namespace FleshRingSliceFloodTest;
+
+        if (!UFleshRingRuntimeSettings::IsDeformerAvailable())
+        {
+            UE_LOG(LogFleshRingSDF, Warning, TEXT("SliceFloodTest: SDF shaders are not available in bake-only mode"));
+            return;
+        }
+
+        TArray<FFixture> Fixtures;
+        BuildFixtures(Fixtures);
+
+        const FIntVector Resolution(Size, Size, Depth);
+        int32 NumFailed = 0;
+
+        for (const FFixture& Fixture : Fixtures)
+        {
+            TArray<float> RawSDF;
+            RawSDF.SetNumUninitialized(Size * Size * Depth);
+            for (int32 Z = 0; Z < Depth; ++Z)
+            {
+                for (int32 Y = 0; Y < Size; ++Y)
+                {
+                    for (int32 X = 0; X < Size; ++X)
+                    {
+                        RawSDF[X + Y * Size + Z * Size * Size] = Fixture.IsWall(X, Y) ? -1.0f : 1.0f;
+                    }
+                }
+            }
+
+            TSharedRef<FFleshRingSDFVolume, ESPMode::ThreadSafe> GPUResult = MakeShared<FFleshRingSDFVolume, ESPMode::ThreadSafe>();
+            GPUResult->Resolution = Resolution;
+
+            ENQUEUE_RENDER_COMMAND(FleshRingSliceFloodTest)(
+                [RawSDF, Resolution, GPUResult](FRHICommandListImmediate& RHICmdList)
+                {
+                    const FRDGTextureDesc SDFDesc = FRDGTextureDesc::Create3D(
+                        Resolution,
+                        PF_R32_FLOAT,
+                        FClearValueBinding::Black,
+                        TexCreate_ShaderResource | TexCreate_UAV);
+
+                    TRefCountPtr<IPooledRenderTarget> RawPooled;
+                    {
+                        FRDGBuilder GraphBuilder(RHICmdList);
+                        RawPooled = GraphBuilder.ConvertToExternalTexture(GraphBuilder.CreateTexture(SDFDesc, TEXT("FleshRingSliceFloodTest_Raw")));
+                        GraphBuilder.Execute();
+                    }
+
+                    const FUpdateTextureRegion3D Region(0, 0, 0, 0, 0, 0, Resolution.X, Resolution.Y, Resolution.Z);
+                    RHICmdList.UpdateTexture3D(
+                        RawPooled->GetRHI(),
+                        0,
+                        Region,
+                        Resolution.X * sizeof(float),
+                        Resolution.X * Resolution.Y * sizeof(float),
+                        reinterpret_cast<const uint8*>(RawSDF.GetData()));
+
+                    FRHIGPUTextureReadback Readback(TEXT("FleshRingSliceFloodTest_Readback"));
+                    {
+                        FRDGBuilder GraphBuilder(RHICmdList);
+                        FRDGTextureRef RawTexture = GraphBuilder.RegisterExternalTexture(RawPooled);
+                        FRDGTextureRef CorrectedTexture = GraphBuilder.CreateTexture(SDFDesc, TEXT("FleshRingSliceFloodTest_Corrected"));
+                        Apply2DSliceFloodFill(GraphBuilder, RawTexture, CorrectedTexture, Resolution);
+                        AddEnqueueCopyPass(GraphBuilder, &Readback, CorrectedTexture);
+                        GraphBuilder.Execute();
+                    }
+
+                    // Test only: wait for the readback in place
+                    RHICmdList.BlockUntilGPUIdle();
+                    GPUResult->CopyFromReadback(Readback);
+                });
+            FlushRenderingCommands();
+
+            TArray<float> CPUCorrected;
+            Apply2DSliceFloodFillCPU(RawSDF, CPUCorrected, Resolution);
+
+            if (!GPUResult->IsValid())
+            {
+                UE_LOG(LogFleshRingSDF, Warning, TEXT("SliceFloodTest [%s]: GPU readback failed"), Fixture.Name);
+                ++NumFailed;
+                continue;
+            }
+
+            int32 Mismatches = 0;
+            int32 CPUHoles = 0;
+            int32 GPUHoles = 0;
+            for (int32 Index = 0; Index < CPUCorrected.Num(); ++Index)
+            {
+                Mismatches += (CPUCorrected[Index] != GPUResult->Distances[Index]) ? 1 : 0;
+                CPUHoles += (CPUCorrected[Index] < 0.0f) ? 1 : 0;
+                GPUHoles += (GPUResult->Distances[Index] < 0.0f) ? 1 : 0;
+            }
+
+            const int32 ExpectedHoles = Fixture.ExpectedHolesPerSlice * Depth;
+            const bool bPassed = Mismatches == 0 && CPUHoles == ExpectedHoles;
+            NumFailed += bPassed ? 0 : 1;
+
+            UE_LOG(LogFleshRingSDF, Display, TEXT("SliceFloodTest [%s]: %s (mismatches %d, holes CPU %d / GPU %d / expected %d)"),
+                Fixture.Name, bPassed ? TEXT("PASS") : TEXT("FAIL"), Mismatches, CPUHoles, GPUHoles, ExpectedHoles);
+        }
+
+        UE_LOG(LogFleshRingSDF, Display, TEXT("SliceFloodTest: %d / %d fixtures passed"), Fixtures.Num() - NumFailed, Fixtures.Num());
+    })
+);
+#endif
@@ -0,0 +1,107 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingSDFVolume.cpp
+#include "FleshRingSDFVolume.h"
+#include "RHIGPUReadback.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSDFVolume, Log, All);
+
+float FFleshRingSDFVolume::GetMaxVoxelSize() const
+{
+	if (!IsValid())
+	{
+		return 0.0f;
+	}
+
+	const FVector3f BoundsSize = BoundsMax - BoundsMin;
+	return FMath::Max3(
+		BoundsSize.X / Resolution.X,
+		BoundsSize.Y / Resolution.Y,
+		BoundsSize.Z / Resolution.Z);
+}
+
+float FFleshRingSDFVolume::SampleTrilinear(const FVector3f& LocalPos) const
+{
+	if (!IsValid())
+	{
+		return 0.0f;
+	}
+
+	const FVector3f BoundsSize = BoundsMax - BoundsMin;
+
+	// UV -> continuous voxel coordinate (voxel centers at i + 0.5), clamped like AM_Clamp
+	auto ToVoxelCoord = [](float Pos, float Min, float Size, int32 Res)
+	{
+		const float UV = (Size > KINDA_SMALL_NUMBER) ? (Pos - Min) / Size : 0.5f;
+		return FMath::Clamp(UV * Res - 0.5f, 0.0f, static_cast<float>(Res - 1));
+	};
+
+	const float FX = ToVoxelCoord(LocalPos.X, BoundsMin.X, BoundsSize.X, Resolution.X);
+	const float FY = ToVoxelCoord(LocalPos.Y, BoundsMin.Y, BoundsSize.Y, Resolution.Y);
+	const float FZ = ToVoxelCoord(LocalPos.Z, BoundsMin.Z, BoundsSize.Z, Resolution.Z);
+
+	const int32 X0 = FMath::FloorToInt32(FX);
+	const int32 Y0 = FMath::FloorToInt32(FY);
+	const int32 Z0 = FMath::FloorToInt32(FZ);
+	const int32 X1 = FMath::Min(X0 + 1, Resolution.X - 1);
+	const int32 Y1 = FMath::Min(Y0 + 1, Resolution.Y - 1);
+	const int32 Z1 = FMath::Min(Z0 + 1, Resolution.Z - 1);
+
+	const float TX = FX - X0;
+	const float TY = FY - Y0;
+	const float TZ = FZ - Z0;
+
+	const int32 SliceSize = Resolution.X * Resolution.Y;
+	auto At = [this, SliceSize](int32 X, int32 Y, int32 Z)
+	{
+		return Distances[X + Y * Resolution.X + Z * SliceSize];
+	};
+
+	const float C00 = FMath::Lerp(At(X0, Y0, Z0), At(X1, Y0, Z0), TX);
+	const float C10 = FMath::Lerp(At(X0, Y1, Z0), At(X1, Y1, Z0), TX);
+	const float C01 = FMath::Lerp(At(X0, Y0, Z1), At(X1, Y0, Z1), TX);
+	const float C11 = FMath::Lerp(At(X0, Y1, Z1), At(X1, Y1, Z1), TX);
+
+	const float C0 = FMath::Lerp(C00, C10, TY);
+	const float C1 = FMath::Lerp(C01, C11, TY);
+
+	return FMath::Lerp(C0, C1, TZ);
+}
+
+bool FFleshRingSDFVolume::CopyFromReadback(FRHIGPUTextureReadback& Readback)
+{
+	Distances.Reset();
+
+	if (Resolution.X <= 0 || Resolution.Y <= 0 || Resolution.Z <= 0 || !Readback.IsReady())
+	{
+		return false;
+	}
+
+	int32 RowPitchInPixels = 0;
+	int32 BufferHeight = 0;
+	const float* SrcData = static_cast<const float*>(Readback.Lock(RowPitchInPixels, &BufferHeight));
+	if (!SrcData)
+	{
+		Readback.Unlock();
+		UE_LOG(LogFleshRingSDFVolume, Warning, TEXT("FleshRingSDFVolume: Readback returned no data"));
+		return false;
+	}
+
+	// Staging rows/slices may be padded
+	const int32 RowPitch = FMath::Max(RowPitchInPixels, Resolution.X);
+	const int32 SliceHeight = FMath::Max(BufferHeight, Resolution.Y);
+
+	Distances.SetNumUninitialized(Resolution.X * Resolution.Y * Resolution.Z);
+	for (int32 Z = 0; Z < Resolution.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < Resolution.Y; ++Y)
+		{
+			const float* SrcRow = SrcData + (static_cast<SIZE_T>(Z) * SliceHeight + Y) * RowPitch;
+			float* DstRow = Distances.GetData() + (Z * Resolution.Y + Y) * Resolution.X;
+			FMemory::Memcpy(DstRow, SrcRow, Resolution.X * sizeof(float));
+		}
+	}
+
+	Readback.Unlock();
+	return true;
+}
@@ -12,9 +12,27 @@
 #include "SkeletalMeshAttributes.h"
 #include "BoneWeights.h"
 #include "ReferenceSkeleton.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSkinnedMesh, Log, All);
 
+/** Per-worker buffers reused across the ring vertices of one ParallelFor chunk */
+struct FFleshRingSkinnedMeshGenerator::FBoneWeightSampleScratch
+{
+	TArray<int32> NearbyVertices;
+	TArray<uint16> CandidateBones;
+	TArray<float> CandidateWeights;
+};
+
+namespace
+{
+	/** Ring vertices per ParallelFor task */
+	constexpr int32 SampleChunkSize = 256;
+
+	/** Lower bound for the spatial hash cell size (tiny sampling radii would explode the cell count) */
+	constexpr float MinHashCellSize = 0.5f;
+}
+
 USkeletalMesh* FFleshRingSkinnedMeshGenerator::GenerateSkinnedRingMesh(
 	UStaticMesh* RingStaticMesh,
 	USkeletalMesh* SourceSkeletalMesh,
@@ -60,39 +78,65 @@ USkeletalMesh* FFleshRingSkinnedMeshGenerator::GenerateSkinnedRingMesh(
 		return nullptr;
 	}
 
-	// 3. Build spatial hash for fast nearest neighbor lookup
+	// 3. Build spatial hash for radius queries and nearest neighbor fallback
 	FVertexSpatialHash SpatialHash;
-	SpatialHash.Build(SkinVertices, SamplingRadius);
+	SpatialHash.Build(SkinVertices, FMath::Max(SamplingRadius, MinHashCellSize));
 
 	// 4. Build bone chain filter (attach bone + ancestors + descendants)
 	// This prevents sampling weights from unrelated bones (e.g., wing when ring is on thigh)
 	const FReferenceSkeleton& RefSkeleton = SourceSkeletalMesh->GetRefSkeleton();
-	TSet<int32> AllowedBoneIndices = BuildBoneChainSet(RefSkeleton, AttachBoneIndex);
+	const TSet<int32> AllowedBoneIndices = BuildBoneChainSet(RefSkeleton, AttachBoneIndex);
 
-	// 5. Transform ring vertices to component space and sample bone weights
-	TArray<TArray<uint16>> RingBoneIndices;
-	TArray<TArray<uint8>> RingBoneWeights;
-	RingBoneIndices.SetNum(RingVertexCount);
-	RingBoneWeights.SetNum(RingVertexCount);
-
-	for (int32 i = 0; i < RingVertexCount; ++i)
+	// Flattened for lock-free lookups from worker threads (empty = allow all)
+	TBitArray<> AllowedBones;
+	if (AllowedBoneIndices.Num() > 0)
 	{
-		// Transform ring vertex from mesh local to component space
-		FVector WorldPos = RingTransform.TransformPosition(RingPositions[i]);
-
-		// Sample bone weights from nearby skin vertices (filtered by bone chain)
-		SampleBoneWeightsAtPosition(
-			WorldPos,
-			SkinVertices,
-			SkinBoneInfluences,
-			SpatialHash,
-			SamplingRadius,
-			AllowedBoneIndices,
-			RingBoneIndices[i],
-			RingBoneWeights[i]
-		);
+		AllowedBones.Init(false, MAX_uint16 + 1);
+		for (int32 BoneIndex : AllowedBoneIndices)
+		{
+			AllowedBones[BoneIndex] = true;
+		}
 	}
 
+	// 5. Transform ring vertices to component space and sample bone weights
+	// Chunked ParallelFor, one scratch per chunk, outputs written in place (MaxInfluences per vertex)
+	const int32 MaxBoneInfluences = FVertexBoneInfluence::MAX_INFLUENCES;
+	TArray<uint16> RingBoneIndices;
+	TArray<uint8> RingBoneWeights;
+	RingBoneIndices.SetNumZeroed(RingVertexCount * MaxBoneInfluences);
+	RingBoneWeights.SetNumZeroed(RingVertexCount * MaxBoneInfluences);
+
+	const double SampleStartTime = FPlatformTime::Seconds();
+	const int32 NumChunks = FMath::DivideAndRoundUp(RingVertexCount, SampleChunkSize);
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		FBoneWeightSampleScratch Scratch;
+		const int32 Begin = ChunkIndex * SampleChunkSize;
+		const int32 End = FMath::Min(Begin + SampleChunkSize, RingVertexCount);
+
+		for (int32 i = Begin; i < End; ++i)
+		{
+			// Transform ring vertex from mesh local to component space
+			const FVector WorldPos = RingTransform.TransformPosition(RingPositions[i]);
+
+			// Sample bone weights from nearby skin vertices (filtered by bone chain)
+			SampleBoneWeightsAtPosition(
+				WorldPos,
+				SkinVertices,
+				SkinBoneInfluences,
+				SpatialHash,
+				SamplingRadius,
+				AllowedBones,
+				Scratch,
+				&RingBoneIndices[i * MaxBoneInfluences],
+				&RingBoneWeights[i * MaxBoneInfluences]
+			);
+		}
+	});
+
+	UE_LOG(LogFleshRingSkinnedMesh, Verbose, TEXT("GenerateSkinnedRingMesh: Sampled %d ring vertices against %d skin vertices in %.2f ms"),
+		RingVertexCount, SkinVertices.Num(), (FPlatformTime::Seconds() - SampleStartTime) * 1000.0);
+
 	// 6. Create SkeletalMesh by duplicating source (to copy skeleton and ImportedModel structure)
 	USkeletalMesh* SkinnedRingMesh = DuplicateObject<USkeletalMesh>(
 		SourceSkeletalMesh,
@@ -154,7 +198,6 @@ USkeletalMesh* FFleshRingSkinnedMeshGenerator::GenerateSkinnedRingMesh(
 
 	// 8. Build ring geometry for ALL LODs (prevents material index collision)
 	// Ring mesh is small, so we use the same geometry for all LODs
-	const int32 MaxBoneInfluences = FVertexBoneInfluence::MAX_INFLUENCES;
 	const int32 NumIndices = RingIndices.Num();
 	const int32 NumFaces = NumIndices / 3;
 
@@ -230,11 +273,12 @@ USkeletalMesh* FFleshRingSkinnedMeshGenerator::GenerateSkinnedRingMesh(
 
 			for (int32 j = 0; j < MaxBoneInfluences; ++j)
 			{
-				if (RingBoneWeights[i].IsValidIndex(j) && RingBoneWeights[i][j] > 0)
+				const int32 InfluenceIndex = i * MaxBoneInfluences + j;
+				if (RingBoneWeights[InfluenceIndex] > 0)
 				{
 					UE::AnimationCore::FBoneWeight BW;
-					BW.SetBoneIndex(RingBoneIndices[i][j]);
-					BW.SetWeight(RingBoneWeights[i][j] / 255.0f);
+					BW.SetBoneIndex(RingBoneIndices[InfluenceIndex]);
+					BW.SetWeight(RingBoneWeights[InfluenceIndex] / 255.0f);
 					BoneWeightArray.Add(BW);
 				}
 			}
@@ -287,48 +331,35 @@ void FFleshRingSkinnedMeshGenerator::SampleBoneWeightsAtPosition(
 	const TArray<FVertexBoneInfluence>& SkinBoneInfluences,
 	const FVertexSpatialHash& SpatialHash,
 	float SamplingRadius,
-	const TSet<int32>& AllowedBoneIndices,
-	TArray<uint16>& OutBoneIndices,
-	TArray<uint8>& OutBoneWeights)
+	const TBitArray<>& AllowedBones,
+	FBoneWeightSampleScratch& Scratch,
+	uint16* OutBoneIndices,
+	uint8* OutBoneWeights)
 {
 	const int32 MaxInfluences = FVertexBoneInfluence::MAX_INFLUENCES;
-	const bool bUseBoneFilter = AllowedBoneIndices.Num() > 0;
-
-	OutBoneIndices.SetNum(MaxInfluences);
-	OutBoneWeights.SetNum(MaxInfluences);
+	const bool bUseBoneFilter = AllowedBones.Num() > 0;
 
 	// Initialize to zero
-	for (int32 i = 0; i < MaxInfluences; ++i)
-	{
-		OutBoneIndices[i] = 0;
-		OutBoneWeights[i] = 0;
-	}
+	FMemory::Memzero(OutBoneIndices, MaxInfluences * sizeof(uint16));
+	FMemory::Memzero(OutBoneWeights, MaxInfluences * sizeof(uint8));
 
 	// Query nearby vertices using spatial hash
-	TArray<int32> NearbyVertices;
-	FVector Min = RingVertexPosition - FVector(SamplingRadius);
-	FVector Max = RingVertexPosition + FVector(SamplingRadius);
-	SpatialHash.QueryAABB(Min, Max, NearbyVertices);
-
-	if (NearbyVertices.Num() == 0)
+	Scratch.NearbyVertices.Reset();
+	if (SamplingRadius > 0.0f)
 	{
-		// Fallback: find closest vertex using brute force
-		float MinDistance = FLT_MAX;
-		int32 ClosestVertex = INDEX_NONE;
+		const FVector Min = RingVertexPosition - FVector(SamplingRadius);
+		const FVector Max = RingVertexPosition + FVector(SamplingRadius);
+		SpatialHash.QueryAABB(Min, Max, Scratch.NearbyVertices);
+	}
 
-		for (int32 i = 0; i < SkinVertices.Num(); ++i)
-		{
-			float Distance = FVector::Dist(RingVertexPosition, FVector(SkinVertices[i]));
-			if (Distance < MinDistance)
-			{
-				MinDistance = Distance;
-				ClosestVertex = i;
-			}
-		}
+	if (Scratch.NearbyVertices.Num() == 0)
+	{
+		// Fallback: copy weights from the closest vertex (with bone filter)
+		float ClosestDistanceSquared = 0.0f;
+		const int32 ClosestVertex = SpatialHash.FindNearest(RingVertexPosition, ClosestDistanceSquared);
 
-		if (ClosestVertex != INDEX_NONE)
+		if (SkinBoneInfluences.IsValidIndex(ClosestVertex))
 		{
-			// Copy weights from closest vertex (with bone filter)
 			const FVertexBoneInfluence& Influence = SkinBoneInfluences[ClosestVertex];
 			int32 OutIdx = 0;
 			for (int32 i = 0; i < MaxInfluences && OutIdx < MaxInfluences; ++i)
@@ -336,7 +367,7 @@ void FFleshRingSkinnedMeshGenerator::SampleBoneWeightsAtPosition(
 				if (Influence.BoneWeights[i] > 0)
 				{
 					// Apply bone filter if enabled
-					if (bUseBoneFilter && !AllowedBoneIndices.Contains(Influence.BoneIndices[i]))
+					if (bUseBoneFilter && !AllowedBones[Influence.BoneIndices[i]])
 					{
 						continue;
 					}
@@ -349,86 +380,98 @@ void FFleshRingSkinnedMeshGenerator::SampleBoneWeightsAtPosition(
 		return;
 	}
 
-	// Accumulate weights with distance-based weighting
-	TMap<uint16, float> AccumulatedWeights;
+	// Accumulate weights with distance-based weighting (few distinct bones - linear search beats a map)
+	TArray<uint16>& CandidateBones = Scratch.CandidateBones;
+	TArray<float>& CandidateWeights = Scratch.CandidateWeights;
+	CandidateBones.Reset();
+	CandidateWeights.Reset();
 	float TotalDistanceWeight = 0.0f;
 
-	for (int32 VertexIdx : NearbyVertices)
+	const FVector3f SamplePosition(RingVertexPosition);
+	const float SamplingRadiusSquared = FMath::Square(SamplingRadius);
+
+	for (int32 VertexIdx : Scratch.NearbyVertices)
 	{
 		if (!SkinVertices.IsValidIndex(VertexIdx) || !SkinBoneInfluences.IsValidIndex(VertexIdx))
 		{
 			continue;
 		}
 
-		FVector SkinPos = FVector(SkinVertices[VertexIdx]);
-		float Distance = FVector::Dist(RingVertexPosition, SkinPos);
-
-		if (Distance > SamplingRadius)
+		const float DistanceSquared = FVector3f::DistSquared(SamplePosition, SkinVertices[VertexIdx]);
+		if (DistanceSquared > SamplingRadiusSquared)
 		{
 			continue;
 		}
 
 		// Distance-based weight (closer = higher weight)
-		float NormalizedDistance = Distance / SamplingRadius;
-		float DistanceWeight = FMath::Square(1.0f - NormalizedDistance);  // Quadratic falloff
+		const float NormalizedDistance = FMath::Sqrt(DistanceSquared) / SamplingRadius;
+		const float DistanceWeight = FMath::Square(1.0f - NormalizedDistance);  // Quadratic falloff
 		TotalDistanceWeight += DistanceWeight;
 
 		// Accumulate bone weights (with bone filter)
 		const FVertexBoneInfluence& Influence = SkinBoneInfluences[VertexIdx];
 		for (int32 i = 0; i < MaxInfluences; ++i)
 		{
-			if (Influence.BoneWeights[i] > 0)
+			if (Influence.BoneWeights[i] == 0)
 			{
-				// Apply bone filter if enabled
-				if (bUseBoneFilter && !AllowedBoneIndices.Contains(Influence.BoneIndices[i]))
-				{
-					continue;
-				}
-				float NormalizedBoneWeight = Influence.BoneWeights[i] / 255.0f;
-				AccumulatedWeights.FindOrAdd(Influence.BoneIndices[i]) += NormalizedBoneWeight * DistanceWeight;
+				continue;
 			}
+
+			// Apply bone filter if enabled
+			const uint16 Bone = Influence.BoneIndices[i];
+			if (bUseBoneFilter && !AllowedBones[Bone])
+			{
+				continue;
+			}
+
+			int32 Slot = CandidateBones.Find(Bone);
+			if (Slot == INDEX_NONE)
+			{
+				Slot = CandidateBones.Add(Bone);
+				CandidateWeights.Add(0.0f);
+			}
+			CandidateWeights[Slot] += (Influence.BoneWeights[i] / 255.0f) * DistanceWeight;
 		}
 	}
 
-	if (TotalDistanceWeight <= 0.0f || AccumulatedWeights.Num() == 0)
+	if (TotalDistanceWeight <= 0.0f || CandidateBones.Num() == 0)
 	{
 		return;
 	}
 
-	// Sort by weight
-	TArray<TPair<uint16, float>> SortedWeights;
-	for (const auto& Pair : AccumulatedWeights)
+	// Top-N selection (descending weight, lower bone index wins ties - deterministic across thread counts)
+	const int32 NumCandidates = CandidateBones.Num();
+	const int32 NumKept = FMath::Min(NumCandidates, MaxInfluences);
+	float TotalWeight = 0.0f;
+	for (int32 k = 0; k < NumKept; ++k)
 	{
-		SortedWeights.Add(TPair<uint16, float>(Pair.Key, Pair.Value / TotalDistanceWeight));
+		int32 Best = k;
+		for (int32 c = k + 1; c < NumCandidates; ++c)
+		{
+			if (CandidateWeights[c] > CandidateWeights[Best] ||
+				(CandidateWeights[c] == CandidateWeights[Best] && CandidateBones[c] < CandidateBones[Best]))
+			{
+				Best = c;
+			}
+		}
+		CandidateBones.Swap(k, Best);
+		CandidateWeights.Swap(k, Best);
+		TotalWeight += CandidateWeights[k];
 	}
-	SortedWeights.Sort([](const TPair<uint16, float>& A, const TPair<uint16, float>& B)
-	{
-		return A.Value > B.Value;
-	});
 
-	// Normalize top weights
-	float TotalWeight = 0.0f;
-	for (int32 i = 0; i < FMath::Min(SortedWeights.Num(), MaxInfluences); ++i)
+	if (TotalWeight <= 0.0f)
 	{
-		TotalWeight += SortedWeights[i].Value;
+		return;
 	}
 
-	// Output top influences
-	for (int32 i = 0; i < MaxInfluences; ++i)
+	// Output top influences (normalized over the kept set)
+	for (int32 i = 0; i < NumKept; ++i)
 	{
-		if (i < SortedWeights.Num() && TotalWeight > 0.0f)
-		{
-			OutBoneIndices[i] = SortedWeights[i].Key;
-			OutBoneWeights[i] = FMath::Clamp<uint8>(
-				FMath::RoundToInt((SortedWeights[i].Value / TotalWeight) * 255.0f),
-				0, 255
-			);
-		}
-		else
-		{
-			OutBoneIndices[i] = 0;
-			OutBoneWeights[i] = 0;
-		}
+		OutBoneIndices[i] = CandidateBones[i];
+		OutBoneWeights[i] = static_cast<uint8>(FMath::Clamp(
+			FMath::RoundToInt((CandidateWeights[i] / TotalWeight) * 255.0f),
+			0, 255
+		));
 	}
 }
 
@@ -0,0 +1,161 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+#include "FleshRingSkinnedRingLibrary.h"
+#include "Engine/SkeletalMesh.h"
+
+#if WITH_EDITOR
+#include "Engine/StaticMesh.h"
+#include "Animation/Skeleton.h"
+#include "FleshRingAsset.h"
+#include "FleshRingSkinnedMeshGenerator.h"
+#include "FleshRingUtils.h"
+#include "Misc/Crc.h"
+#endif
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FleshRingSkinnedRingLibrary)
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSkinnedRingLibrary, Log, All);
+
+#if WITH_EDITOR
+FString UFleshRingSkinnedRingLibrary::MakeKey(
+	const UStaticMesh* RingMesh,
+	const USkeletalMesh* SampleMesh,
+	FName BoneName,
+	const FTransform& RingTransform,
+	float SamplingRadius)
+{
+	// Quantize so float noise between bakes of identical placements still matches
+	const FVector Location = RingTransform.GetLocation();
+	const FQuat Rotation = RingTransform.GetRotation().GetNormalized();
+	const FVector Scale = RingTransform.GetScale3D();
+	const int32 Quantized[] =
+	{
+		FMath::RoundToInt(Location.X * 100.0), FMath::RoundToInt(Location.Y * 100.0), FMath::RoundToInt(Location.Z * 100.0),
+		FMath::RoundToInt(Rotation.X * 10000.0), FMath::RoundToInt(Rotation.Y * 10000.0),
+		FMath::RoundToInt(Rotation.Z * 10000.0), FMath::RoundToInt(Rotation.W * 10000.0),
+		FMath::RoundToInt(Scale.X * 10000.0), FMath::RoundToInt(Scale.Y * 10000.0), FMath::RoundToInt(Scale.Z * 10000.0)
+	};
+	const uint32 TransformHash = FCrc::MemCrc32(Quantized, sizeof(Quantized));
+
+	// The sampled mesh is identified by content: a transient SubdividedMesh has no stable path,
+	// and an in-place reimport of either mesh must not match the old entry
+	const USkeleton* Skeleton = SampleMesh ? SampleMesh->GetSkeleton() : nullptr;
+	return FString::Printf(TEXT("%s|%08x|%08x|%s|%s|%d|%08x"),
+		RingMesh ? *RingMesh->GetPathName() : TEXT("None"),
+		FleshRingUtils::HashStaticMeshGeometry(RingMesh),
+		FleshRingUtils::HashSkeletalMeshGeometry(SampleMesh),
+		Skeleton ? *Skeleton->GetPathName() : TEXT("None"),
+		*BoneName.ToString(),
+		FMath::RoundToInt(SamplingRadius * 100.0f),
+		TransformHash);
+}
+
+USkeletalMesh* UFleshRingSkinnedRingLibrary::FindOrGenerate(
+	UFleshRingAsset* User,
+	UStaticMesh* RingMesh,
+	USkeletalMesh* SampleMesh,
+	FName BoneName,
+	int32 BoneIndex,
+	const FTransform& RingTransform,
+	float SamplingRadius,
+	bool& bOutGenerated)
+{
+	bOutGenerated = false;
+	if (!RingMesh || !SampleMesh)
+	{
+		return nullptr;
+	}
+
+	const FString Key = MakeKey(RingMesh, SampleMesh, BoneName, RingTransform, SamplingRadius);
+
+	FFleshRingSkinnedRingEntry* Entry = Entries.FindByPredicate([&Key](const FFleshRingSkinnedRingEntry& Candidate)
+	{
+		return Candidate.Key == Key && Candidate.Mesh;
+	});
+
+	if (!Entry)
+	{
+		// Named after the key CRC (MakeUniqueObjectName resolves collisions)
+		const FString MeshName = FString::Printf(TEXT("SkinnedRing_%08x"), FCrc::StrCrc32(*Key));
+		USkeletalMesh* NewMesh = FFleshRingSkinnedMeshGenerator::GenerateSkinnedRingMesh(
+			RingMesh,
+			SampleMesh,
+			RingTransform,
+			SamplingRadius,
+			BoneIndex,
+			this,
+			MakeUniqueObjectName(this, USkeletalMesh::StaticClass(), FName(*MeshName)).ToString());
+
+		if (!NewMesh)
+		{
+			return nullptr;
+		}
+
+		// Referenced from other packages (FleshRing Assets)
+		NewMesh->ClearFlags(RF_Transactional);
+		NewMesh->SetFlags(RF_Public);
+
+		Modify();
+		Entry = &Entries.AddDefaulted_GetRef();
+		Entry->Key = Key;
+		Entry->Mesh = NewMesh;
+		bOutGenerated = true;
+
+		UE_LOG(LogFleshRingSkinnedRingLibrary, Log, TEXT("%s: Generated shared skinned ring mesh '%s' (%d entries)"),
+			*GetName(), *NewMesh->GetName(), Entries.Num());
+	}
+
+	const TSoftObjectPtr<UFleshRingAsset> UserPtr(User);
+	if (User && !Entry->Users.Contains(UserPtr))
+	{
+		Modify();
+		Entry->Users.Add(UserPtr);
+	}
+
+	MarkPackageDirty();
+	return Entry->Mesh;
+}
+
+void UFleshRingSkinnedRingLibrary::ReleaseUser(UFleshRingAsset* User, const TArray<USkeletalMesh*>& KeepMeshes)
+{
+	if (!User)
+	{
+		return;
+	}
+
+	const TSoftObjectPtr<UFleshRingAsset> UserPtr(User);
+	bool bChanged = false;
+
+	for (int32 EntryIndex = Entries.Num() - 1; EntryIndex >= 0; --EntryIndex)
+	{
+		FFleshRingSkinnedRingEntry& Entry = Entries[EntryIndex];
+		if (KeepMeshes.Contains(Entry.Mesh) || Entry.Users.Remove(UserPtr) == 0)
+		{
+			continue;
+		}
+		bChanged = true;
+
+		if (Entry.Users.Num() > 0)
+		{
+			continue;
+		}
+
+		// Last user gone - discard the shared mesh
+		if (USkeletalMesh* OldMesh = Entry.Mesh)
+		{
+			OldMesh->ReleaseResources();
+			OldMesh->ReleaseResourcesFence.Wait();
+			OldMesh->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+			OldMesh->ClearFlags(RF_Public | RF_Standalone | RF_Transactional);
+			OldMesh->SetFlags(RF_Transient);
+			OldMesh->MarkAsGarbage();
+		}
+		Entries.RemoveAt(EntryIndex);
+	}
+
+	if (bChanged)
+	{
+		MarkPackageDirty();
+	}
+}
+#endif
@@ -0,0 +1,318 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingSparseBake.cpp
+#include "FleshRingSparseBake.h"
+#include "FleshRingTypes.h"
+#include "Animation/MorphTarget.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Rendering/MorphTargetVertexInfoBuffers.h"
+#include "Rendering/SkeletalMeshRenderData.h"
+#include "RenderingThread.h"
+#include "Algo/BinarySearch.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSparseBake, Log, All);
+
+namespace FleshRingSparseBake
+{
+
+namespace
+{
+	constexpr float QuantizationRange = 65535.0f;
+
+	/** Per axis 16-bit fixed point within the bounding box of Deltas */
+	void QuantizeDeltas(const TArray<FVector3f>& Deltas, FVector3f& OutMin, FVector3f& OutStep, TArray<uint16>& OutQuantized, float& OutMaxError)
+	{
+		FBox3f DeltaBounds(ForceInit);
+		for (const FVector3f& Delta : Deltas)
+		{
+			DeltaBounds += Delta;
+		}
+
+		OutMin = DeltaBounds.Min;
+		OutStep = DeltaBounds.GetSize() / QuantizationRange;
+		OutQuantized.SetNumUninitialized(Deltas.Num() * 3);
+		OutMaxError = 0.0f;
+
+		for (int32 i = 0; i < Deltas.Num(); ++i)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float Normalized = OutStep[Axis] > 0.0f ? (Deltas[i][Axis] - OutMin[Axis]) / OutStep[Axis] : 0.0f;
+				const uint16 Quantized = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Normalized), 0, 65535));
+				OutQuantized[i * 3 + Axis] = Quantized;
+
+				const float Decoded = OutMin[Axis] + Quantized * OutStep[Axis];
+				OutMaxError = FMath::Max(OutMaxError, FMath::Abs(Decoded - Deltas[i][Axis]));
+			}
+		}
+	}
+
+	FVector3f DecodeDelta(const TArray<uint16>& Quantized, int32 Index, const FVector3f& Min, const FVector3f& Step)
+	{
+		return Min + FVector3f(Quantized[Index * 3 + 0], Quantized[Index * 3 + 1], Quantized[Index * 3 + 2]) * Step;
+	}
+}
+
+bool ExtractDeltas(
+	const FSkeletalMeshLODRenderData& RestLOD,
+	const TArray<FVector3f>& DeformedPositions,
+	const TArray<FVector3f>& DeformedNormals,
+	float PositionThreshold,
+	FFleshRingSparseBakeData& OutData)
+{
+	OutData.Reset();
+
+	const FPositionVertexBuffer& PositionBuffer = RestLOD.StaticVertexBuffers.PositionVertexBuffer;
+	const FStaticMeshVertexBuffer& TangentBuffer = RestLOD.StaticVertexBuffers.StaticMeshVertexBuffer;
+	const int32 NumVertices = static_cast<int32>(PositionBuffer.GetNumVertices());
+
+	if (NumVertices == 0 || DeformedPositions.Num() != NumVertices)
+	{
+		UE_LOG(LogFleshRingSparseBake, Warning, TEXT("ExtractDeltas: Vertex count mismatch - Readback=%d, Rest=%d"),
+			DeformedPositions.Num(), NumVertices);
+		return false;
+	}
+
+	// Missing readback normals are treated as unchanged
+	const bool bHasNormals = DeformedNormals.Num() == NumVertices;
+
+	const float PositionThresholdSq = FMath::Square(PositionThreshold);
+	const float DirectionThresholdSq = FMath::Square(DirectionThreshold);
+
+	for (int32 i = 0; i < NumVertices; ++i)
+	{
+		const FVector3f PositionDelta = DeformedPositions[i] - PositionBuffer.VertexPosition(i);
+		const FVector3f NormalDelta = bHasNormals && !DeformedNormals[i].IsNearlyZero()
+			? DeformedNormals[i].GetSafeNormal() - FVector3f(TangentBuffer.VertexTangentZ(i))
+			: FVector3f::ZeroVector;
+
+		if (PositionDelta.SizeSquared() <= PositionThresholdSq &&
+			NormalDelta.SizeSquared() <= DirectionThresholdSq)
+		{
+			continue;
+		}
+
+		OutData.VertexIndices.Add(static_cast<uint32>(i));
+		OutData.PositionDeltas.Add(PositionDelta);
+		OutData.NormalDeltas.Add(NormalDelta);
+	}
+
+	OutData.SourceVertexCount = NumVertices;
+	return true;
+}
+
+bool Quantize(
+	float PositionErrorBound,
+	FFleshRingSparseBakeData& InOutData,
+	FQuantizeStats& OutStats)
+{
+	OutStats = FQuantizeStats();
+	OutStats.FloatSize = InOutData.GetDataSize();
+	OutStats.QuantizedSize = OutStats.FloatSize;
+
+	if (InOutData.bQuantized || !InOutData.IsValid())
+	{
+		return InOutData.bQuantized;
+	}
+
+	// Fixed point range: delta bounding box (rounding error = half a step)
+	FBox3f PositionBounds(ForceInit);
+	for (const FVector3f& Delta : InOutData.PositionDeltas)
+	{
+		PositionBounds += Delta;
+	}
+	const float PositionStep = PositionBounds.GetSize().GetMax() / QuantizationRange;
+	if (PositionStep * 0.5f > PositionErrorBound)
+	{
+		UE_LOG(LogFleshRingSparseBake, Warning, TEXT("Quantize: Delta range %s needs step %.5f cm, error bound %.5f cm not reachable - keeping float deltas"),
+			*PositionBounds.GetSize().ToString(), PositionStep, PositionErrorBound);
+		return false;
+	}
+
+	// Normal deltas of unit vectors span at most [-2, 2] per axis (step <= 6.1e-5)
+	QuantizeDeltas(InOutData.PositionDeltas, InOutData.PositionDeltaMin, InOutData.PositionDeltaStep,
+		InOutData.QuantizedPositionDeltas, OutStats.MaxPositionError);
+	QuantizeDeltas(InOutData.NormalDeltas, InOutData.NormalDeltaMin, InOutData.NormalDeltaStep,
+		InOutData.QuantizedNormalDeltas, OutStats.MaxNormalError);
+
+	// Quantized arrays are authoritative from here on
+	InOutData.PositionDeltas.Empty();
+	InOutData.NormalDeltas.Empty();
+	InOutData.bQuantized = true;
+
+	OutStats.QuantizedSize = InOutData.GetDataSize();
+	return true;
+}
+
+bool Decode(
+	const FFleshRingSparseBakeData& Data,
+	TArray<FVector3f>& OutPositionDeltas,
+	TArray<FVector3f>& OutNormalDeltas)
+{
+	if (!Data.IsValid())
+	{
+		return false;
+	}
+
+	if (!Data.bQuantized)
+	{
+		OutPositionDeltas = Data.PositionDeltas;
+		OutNormalDeltas = Data.NormalDeltas;
+		return true;
+	}
+
+	const int32 NumVertices = Data.Num();
+	OutPositionDeltas.SetNumUninitialized(NumVertices);
+	OutNormalDeltas.SetNumUninitialized(NumVertices);
+
+	for (int32 i = 0; i < NumVertices; ++i)
+	{
+		OutPositionDeltas[i] = DecodeDelta(Data.QuantizedPositionDeltas, i, Data.PositionDeltaMin, Data.PositionDeltaStep);
+		OutNormalDeltas[i] = DecodeDelta(Data.QuantizedNormalDeltas, i, Data.NormalDeltaMin, Data.NormalDeltaStep);
+	}
+
+	return true;
+}
+
+TSharedPtr<FExternalMorphSet> CreateMorphSet(const USkeletalMesh* BaseMesh, int32 LODIndex, const FFleshRingSparseBakeData& Data, FName Name)
+{
+	if (!BaseMesh || !Data.IsValid())
+	{
+		return nullptr;
+	}
+
+	const FSkeletalMeshRenderData* RenderData = BaseMesh->GetResourceForRendering();
+	if (!RenderData || !RenderData->LODRenderData.IsValidIndex(LODIndex))
+	{
+		UE_LOG(LogFleshRingSparseBake, Warning, TEXT("CreateMorphSet: '%s' has no render data for LOD%d"), *BaseMesh->GetName(), LODIndex);
+		return nullptr;
+	}
+
+	const FSkeletalMeshLODRenderData& LODData = RenderData->LODRenderData[LODIndex];
+	const int32 NumVertices = static_cast<int32>(LODData.GetNumVertices());
+	if (NumVertices != Data.SourceVertexCount)
+	{
+		UE_LOG(LogFleshRingSparseBake, Warning, TEXT("CreateMorphSet: '%s' LOD%d has %d vertices, sparse bake expects %d (rebake required)"),
+			*BaseMesh->GetName(), LODIndex, NumVertices, Data.SourceVertexCount);
+		return nullptr;
+	}
+
+	// Decode on load (quantized assets keep only the compact form in memory until here)
+	TArray<FVector3f> PositionDeltas;
+	TArray<FVector3f> NormalDeltas;
+	if (!Decode(Data, PositionDeltas, NormalDeltas))
+	{
+		UE_LOG(LogFleshRingSparseBake, Warning, TEXT("CreateMorphSet: Failed to decode sparse bake for '%s' LOD%d"), *BaseMesh->GetName(), LODIndex);
+		return nullptr;
+	}
+
+	// Transient morph target, only used as input of the GPU buffer compression below
+	UMorphTarget* MorphTarget = NewObject<UMorphTarget>(GetTransientPackage(), NAME_None, RF_Transient);
+	FMorphTargetLODModel& MorphLODModel = MorphTarget->GetMorphLODModels().AddDefaulted_GetRef();
+	MorphLODModel.NumBaseMeshVerts = NumVertices;
+	MorphLODModel.bGeneratedByEngine = true;
+	MorphLODModel.Vertices.SetNumUninitialized(Data.Num());
+	for (int32 i = 0; i < Data.Num(); ++i)
+	{
+		// Tangent X is re-orthogonalized against the morphed normal by GPU skinning
+		FMorphTargetDelta& Delta = MorphLODModel.Vertices[i];
+		Delta.PositionDelta = PositionDeltas[i];
+		Delta.TangentZDelta = NormalDeltas[i];
+		Delta.SourceIdx = Data.VertexIndices[i];
+	}
+	MorphLODModel.NumVertices = Data.Num();
+
+	// Sections containing at least one delta (VertexIndices is sorted)
+	for (int32 SectionIndex = 0; SectionIndex < LODData.RenderSections.Num(); ++SectionIndex)
+	{
+		const FSkelMeshRenderSection& Section = LODData.RenderSections[SectionIndex];
+		const int32 First = Algo::LowerBound(Data.VertexIndices, Section.BaseVertexIndex);
+		if (Data.VertexIndices.IsValidIndex(First) && Data.VertexIndices[First] < Section.BaseVertexIndex + Section.NumVertices)
+		{
+			MorphLODModel.SectionIndices.Add(SectionIndex);
+		}
+	}
+
+	// Shared by every component using the asset: the last reference releases the buffers after pending render commands
+	TSharedPtr<FExternalMorphSet> MorphSet(new FExternalMorphSet(), [](FExternalMorphSet* ReleasedSet)
+	{
+		ENQUEUE_RENDER_COMMAND(ReleaseFleshRingSparseMorphSet)(
+			[ReleasedSet](FRHICommandListImmediate& RHICmdList)
+			{
+				ReleasedSet->MorphBuffers.ReleaseResource();
+				delete ReleasedSet;
+			});
+	});
+	MorphSet->Name = Name;
+
+	const TArray<UMorphTarget*> MorphTargets = { MorphTarget };
+	MorphSet->MorphBuffers.InitMorphResources(GMaxRHIShaderPlatform, LODData.RenderSections, MorphTargets, NumVertices, 0, MorphPositionTolerance);
+	BeginInitResource(&MorphSet->MorphBuffers);
+
+	MorphTarget->MarkAsGarbage();
+	return MorphSet;
+}
+
+void AddToComponent(USkinnedMeshComponent* Component, int32 MorphSetID, const TArray<TSharedPtr<FExternalMorphSet>>& MorphSets)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	for (int32 LODIndex = 0; LODIndex < MorphSets.Num(); ++LODIndex)
+	{
+		if (MorphSets[LODIndex].IsValid())
+		{
+			Component->AddExternalMorphSet(LODIndex, MorphSetID, MorphSets[LODIndex]);
+		}
+	}
+	Component->RefreshExternalMorphTargetWeights();
+
+	// Baked deformation is always fully applied
+	for (int32 LODIndex = 0; LODIndex < MorphSets.Num(); ++LODIndex)
+	{
+		if (!MorphSets[LODIndex].IsValid())
+		{
+			continue;
+		}
+
+		FExternalMorphWeightData& WeightData = Component->GetExternalMorphWeights(LODIndex);
+		if (FExternalMorphSetWeights* SetWeights = WeightData.MorphSets.Find(MorphSetID))
+		{
+			for (float& Weight : SetWeights->Weights)
+			{
+				Weight = 1.0f;
+			}
+			SetWeights->UpdateNumActiveMorphTargets();
+		}
+		WeightData.UpdateNumActiveMorphTargets();
+	}
+}
+
+void RemoveFromComponent(USkinnedMeshComponent* Component, int32 MorphSetID, TArray<TSharedPtr<FExternalMorphSet>>& MorphSets)
+{
+	if (Component)
+	{
+		for (int32 LODIndex = 0; LODIndex < MorphSets.Num(); ++LODIndex)
+		{
+			if (MorphSets[LODIndex].IsValid())
+			{
+				Component->RemoveExternalMorphSet(LODIndex, MorphSetID);
+			}
+		}
+		Component->RefreshExternalMorphTargetWeights();
+
+		// Mesh object release is enqueued before a possible buffer release below
+		if (Component->IsRenderStateCreated())
+		{
+			Component->RecreateRenderState_Concurrent();
+		}
+	}
+
+	// Buffers are released by the deleter once no other component shares the set
+	MorphSets.Empty();
+}
+
+}
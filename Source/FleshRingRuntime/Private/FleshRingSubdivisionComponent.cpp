@@ -8,14 +8,19 @@
 #include "FleshRingAsset.h"
 #include "FleshRingTypes.h"
 #include "FleshRingSubdivisionProcessor.h"
+#include "FleshRingUtils.h"
 #include "FleshRingSubdivisionShader.h"
+#include "FleshRingBarycentricInterpolation.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/SkeletalMesh.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/GameViewportClient.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
+#include "RenderingThread.h"
 #include "DrawDebugHelpers.h"
 #include "Rendering/SkeletalMeshRenderData.h"
 #include "Rendering/SkeletalMeshLODRenderData.h"
@@ -77,6 +82,13 @@ void UFleshRingSubdivisionComponent::PostEditChangeProperty(FPropertyChangedEven
 	{
 		InvalidateCache();
 	}
+
+	// Screen-space error mode toggled: re-evaluate Ring levels from scratch
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UFleshRingSubdivisionComponent, bUseScreenSpaceError))
+	{
+		RingErrorLevels.Reset();
+		bNeedsRecompute = true;
+	}
 }
 #endif
 
@@ -89,8 +101,19 @@ void UFleshRingSubdivisionComponent::TickComponent(float DeltaTime, ELevelTick T
 		return;
 	}
 
-	// Update distance scale
-	if (bEnableDistanceFalloff)
+	// Update distance scale / screen-space error levels
+	if (bUseScreenSpaceError)
+	{
+		// Per-Ring levels drive refinement; distance gating is off
+		CurrentDistanceScale = 1.0f;
+		if (UpdateScreenSpaceErrorLevels())
+		{
+			// Per-Ring caps changed: vertex counts measured per level no longer apply
+			AddedVerticesPerLevel.Reset();
+			bNeedsRecompute = true;
+		}
+	}
+	else if (bEnableDistanceFalloff)
 	{
 		UpdateDistanceScale();
 	}
@@ -99,22 +122,37 @@ void UFleshRingSubdivisionComponent::TickComponent(float DeltaTime, ELevelTick T
 		CurrentDistanceScale = 1.0f;
 	}
 
-	// Execute subdivision if needed
-	if (CurrentDistanceScale > 0.0f && bNeedsRecompute)
+	// Swap in finished async refinement
+	if (PendingSubdivision.IsValid() && PendingSubdivision.IsCompleted())
+	{
+		CompletePendingSubdivision(true);
+	}
+
+	// Distance band changed: refine again at the new level
+	if (!bUseScreenSpaceError && bEnableDistanceFalloff && CurrentDistanceScale > 0.0f &&
+		RequestedSubdivisionLevel != 0 && GetDistanceSubdivisionLevel() != RequestedSubdivisionLevel)
+	{
+		bNeedsRecompute = true;
+	}
+
+	// Execute subdivision if needed (one refinement in flight at a time)
+	// Deferred while Ring SDFs are still generating (SDF bounds drive the subdivision region)
+	const bool bSDFPending = FleshRingComp.IsValid() && FleshRingComp->HasAnyPendingSDFCaches();
+	if (CurrentDistanceScale > 0.0f && bNeedsRecompute && !bSDFPending && !PendingSubdivision.IsValid())
 	{
 		ComputeSubdivision();
 		bNeedsRecompute = false;
 	}
 
 #if WITH_EDITORONLY_DATA
-	// Debug: Visualize subdivided vertices
-	if (bShowSubdividedVertices && Processor.IsValid() && Processor->IsCacheValid())
+	// Debug: Visualize subdivided vertices (snapshot of the applied result, also drawn while a refinement is in flight)
+	if (bShowSubdividedVertices)
 	{
 		DrawSubdividedVerticesDebug();
 	}
 
 	// Debug: Visualize subdivided wireframe
-	if (bShowSubdividedWireframe && Processor.IsValid() && Processor->IsCacheValid())
+	if (bShowSubdividedWireframe)
 	{
 		DrawSubdividedWireframeDebug();
 	}
@@ -123,55 +161,77 @@ void UFleshRingSubdivisionComponent::TickComponent(float DeltaTime, ELevelTick T
 
 void UFleshRingSubdivisionComponent::ForceRecompute()
 {
+	// In-flight result is stale: reclaim the processor without applying it
+	CompletePendingSubdivision(false);
+
 	// Wait for GPU work completion and release resources (prevent memory leak)
 	FlushRenderingCommands();
 
 	if (Processor.IsValid())
 	{
-		Processor->InvalidateCache();
+		Processor->InvalidateIslandCache();
 	}
-	ResultCache.Reset();
+	ResetAppliedResult();
+	AddedVerticesPerLevel.Reset();
 	bNeedsRecompute = true;
 }
 
 void UFleshRingSubdivisionComponent::InvalidateCache()
 {
+	// In-flight result is stale: reclaim the processor without applying it
+	CompletePendingSubdivision(false);
+
 	// Wait for GPU work completion and release resources (prevent memory leak)
 	FlushRenderingCommands();
 
-	if (Processor.IsValid())
-	{
-		Processor->InvalidateCache();
-	}
-	ResultCache.Reset();
+	ResetAppliedResult();
+	AddedVerticesPerLevel.Reset();
 	bNeedsRecompute = true;
 }
 
 int32 UFleshRingSubdivisionComponent::GetOriginalVertexCount() const
 {
-	if (Processor.IsValid() && Processor->IsCacheValid())
-	{
-		return Processor->GetCachedResult().OriginalVertexCount;
-	}
-	return 0;
+	return AppliedOriginalVertexCount;
 }
 
 int32 UFleshRingSubdivisionComponent::GetSubdividedVertexCount() const
 {
-	if (Processor.IsValid() && Processor->IsCacheValid())
-	{
-		return Processor->GetCachedResult().SubdividedVertexCount;
-	}
-	return 0;
+	return AppliedSubdividedVertexCount;
 }
 
 int32 UFleshRingSubdivisionComponent::GetSubdividedTriangleCount() const
 {
-	if (Processor.IsValid() && Processor->IsCacheValid())
+	return AppliedSubdividedTriangleCount;
+}
+
+void UFleshRingSubdivisionComponent::ResetAppliedResult(bool bReleaseOnRenderThread)
+{
+	if (Processor.IsValid())
 	{
-		return Processor->GetCachedResult().SubdividedTriangleCount;
+		Processor->InvalidateCache();
 	}
-	return 0;
+
+	if (bReleaseOnRenderThread)
+	{
+		// Queued behind any interpolation still extracting into the cache, so no flush is needed
+		FSubdivisionResultCache* ResultCachePtr = &ResultCache;
+		ENQUEUE_RENDER_COMMAND(FleshRingReleaseSubdivisionResult)(
+			[ResultCachePtr](FRHICommandListImmediate& RHICmdList)
+			{
+				ResultCachePtr->Reset();
+			});
+	}
+	else
+	{
+		ResultCache.Reset();
+	}
+	AppliedSubdivisionLevel = 0;
+	AppliedOriginalVertexCount = 0;
+	AppliedSubdividedVertexCount = 0;
+	AppliedSubdividedTriangleCount = 0;
+#if WITH_EDITORONLY_DATA
+	DebugSnapshot = FSubdivisionDebugSnapshot();
+#endif
 }
 
 void UFleshRingSubdivisionComponent::FindDependencies()
@@ -233,6 +293,19 @@ void UFleshRingSubdivisionComponent::Initialize()
 	{
 		bIsInitialized = true;
 		bNeedsRecompute = true;
+
+		// Level 0 reference edge length for screen-space error
+		const TArray<FVector>& Positions = Processor->GetSourcePositions();
+		const TArray<uint32>& Indices = Processor->GetSourceIndices();
+		double EdgeLengthSum = 0.0;
+		for (int32 i = 0; i + 2 < Indices.Num(); i += 3)
+		{
+			EdgeLengthSum += FVector::Dist(Positions[Indices[i]], Positions[Indices[i + 1]]);
+			EdgeLengthSum += FVector::Dist(Positions[Indices[i + 1]], Positions[Indices[i + 2]]);
+			EdgeLengthSum += FVector::Dist(Positions[Indices[i + 2]], Positions[Indices[i]]);
+		}
+		SourceAverageEdgeLength = Indices.Num() > 0 ? static_cast<float>(EdgeLengthSum / Indices.Num()) : 0.0f;
+		RingErrorLevels.Reset();
 	}
 	else
 	{
@@ -244,11 +317,17 @@ void UFleshRingSubdivisionComponent::Initialize()
 
 void UFleshRingSubdivisionComponent::Cleanup()
 {
+	// Worker owns its processor; wait so it is released here rather than on a worker thread
+	CompletePendingSubdivision(false);
+
 	// Wait for GPU work completion and release resources (prevent memory leak)
 	FlushRenderingCommands();
 
-	ResultCache.Reset();
+	ResetAppliedResult();
 	Processor.Reset();
+	RequestedSubdivisionLevel = 0;
+	AddedVerticesPerLevel.Reset();
+	RingErrorLevels.Reset();
 	FleshRingComp.Reset();
 	TargetMeshComp.Reset();
 	bIsInitialized = false;
@@ -295,9 +374,140 @@ void UFleshRingSubdivisionComponent::UpdateDistanceScale()
 	}
 }
 
+int32 UFleshRingSubdivisionComponent::GetDistanceSubdivisionLevel() const
+{
+	// Full level near the camera, down to level 1 at the fade distance
+	const float IdealLevel = MaxSubdivisionLevel * CurrentDistanceScale;
+	const int32 BandLevel = FMath::Clamp(FMath::CeilToInt(IdealLevel), 1, MaxSubdivisionLevel);
+
+	// Hysteresis: keep the current level until the ideal level is clearly outside its band (Level - 1, Level]
+	const int32 CurrentLevel = RequestedSubdivisionLevel;
+	if (CurrentLevel >= 1 && CurrentLevel <= MaxSubdivisionLevel &&
+		IdealLevel > CurrentLevel - 1 - DistanceLevelHysteresis &&
+		IdealLevel <= CurrentLevel + DistanceLevelHysteresis)
+	{
+		return CurrentLevel;
+	}
+
+	return BandLevel;
+}
+
+int32 UFleshRingSubdivisionComponent::GetBudgetedUpdateLevel(int32 TargetLevel) const
+{
+	// Coarsening only removes vertices; unlimited budget jumps straight to the target
+	if (MaxAddedVerticesPerUpdate <= 0 || TargetLevel <= AppliedSubdivisionLevel + 1)
+	{
+		return TargetLevel;
+	}
+
+	const int64 AppliedAddedVertices = AppliedSubdividedVertexCount - AppliedOriginalVertexCount;
+
+	// Highest level whose added vertices fit the budget on top of the applied result
+	// Unmeasured levels extrapolate from the closest measured level below (LEB roughly doubles the refined region per level)
+	for (int32 Level = TargetLevel; Level > AppliedSubdivisionLevel + 1; --Level)
+	{
+		for (int32 MeasuredLevel = Level; MeasuredLevel >= 1; --MeasuredLevel)
+		{
+			if (AddedVerticesPerLevel.IsValidIndex(MeasuredLevel) && AddedVerticesPerLevel[MeasuredLevel] != INDEX_NONE)
+			{
+				const int64 EstimatedAddedVertices = static_cast<int64>(AddedVerticesPerLevel[MeasuredLevel]) << (Level - MeasuredLevel);
+				if (EstimatedAddedVertices - AppliedAddedVertices <= MaxAddedVerticesPerUpdate)
+				{
+					return Level;
+				}
+				break;
+			}
+		}
+	}
+
+	// One level per update at minimum so the ramp always progresses
+	return AppliedSubdivisionLevel + 1;
+}
+
+bool UFleshRingSubdivisionComponent::UpdateScreenSpaceErrorLevels()
+{
+	const UFleshRingAsset* Asset = FleshRingComp.IsValid() ? FleshRingComp->FleshRingAsset.Get() : nullptr;
+	if (!Asset || !TargetMeshComp.IsValid() || SourceAverageEdgeLength <= 0.0f)
+	{
+		return false;
+	}
+
+	// No viewer yet (editor without player, server): keep the current levels rather than measuring from the origin
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PC)
+	{
+		return false;
+	}
+
+	// View parameters (no camera manager / viewport falls back to 90 deg, 1920 px)
+	FVector CameraLocation;
+	FRotator CameraRotation;
+	PC->GetPlayerViewPoint(CameraLocation, CameraRotation);
+
+	float FOVDegrees = 90.0f;
+	float ViewportWidth = 1920.0f;
+	if (PC->PlayerCameraManager)
+	{
+		FOVDegrees = PC->PlayerCameraManager->GetFOVAngle();
+	}
+
+	if (GEngine && GEngine->GameViewport)
+	{
+		FVector2D ViewportSize;
+		GEngine->GameViewport->GetViewportSize(ViewportSize);
+		if (ViewportSize.X > 0.0)
+		{
+			ViewportWidth = static_cast<float>(ViewportSize.X);
+		}
+	}
+
+	// World size of one pixel at unit distance; source edges scaled to world space
+	const float PixelSizeAtUnitDistance = 2.0f * FMath::Tan(FMath::DegreesToRadians(FOVDegrees * 0.5f)) / ViewportWidth;
+	const float WorldSourceEdgeLength = SourceAverageEdgeLength * static_cast<float>(TargetMeshComp->GetComponentScale().GetAbsMax());
+
+	const int32 NumRings = Asset->Rings.Num();
+	if (RingErrorLevels.Num() != NumRings)
+	{
+		RingErrorLevels.Init(INDEX_NONE, NumRings);
+	}
+
+	bool bChanged = false;
+	for (int32 RingIndex = 0; RingIndex < NumRings; ++RingIndex)
+	{
+		const FFleshRingSettings& Ring = Asset->Rings[RingIndex];
+		const FVector RingLocation = TargetMeshComp->GetBoneLocation(Ring.BoneName);
+		const float Distance = FMath::Max(static_cast<float>(FVector::Dist(RingLocation, CameraLocation)), 1.0f);
+
+		// Edge length that projects to MaxScreenSpaceError pixels, tightened where compression curves the skin
+		const float CompressionScale = 1.0f + CompressionErrorScale * FMath::Max(Ring.TightnessStrength, 0.0f);
+		const float TargetEdgeLength = MaxScreenSpaceError * PixelSizeAtUnitDistance * Distance / CompressionScale;
+
+		// Longest-edge bisection halves edge length every two levels
+		const float IdealLevel = FMath::Clamp(2.0f * FMath::Log2(WorldSourceEdgeLength / TargetEdgeLength),
+			0.0f, static_cast<float>(MaxSubdivisionLevel));
+
+		// Hysteresis: switch only once the ideal level is clearly inside another level's band
+		int32& Level = RingErrorLevels[RingIndex];
+		if (Level != INDEX_NONE && FMath::Abs(IdealLevel - Level) <= 0.5f + ScreenSpaceErrorHysteresis)
+		{
+			continue;
+		}
+
+		const int32 NewLevel = FMath::Clamp(FMath::RoundToInt(IdealLevel), 0, MaxSubdivisionLevel);
+		if (NewLevel != Level)
+		{
+			Level = NewLevel;
+			bChanged = true;
+		}
+	}
+
+	return bChanged;
+}
+
 void UFleshRingSubdivisionComponent::ComputeSubdivision()
 {
-	if (!Processor.IsValid() || !FleshRingComp.IsValid())
+	if (!Processor.IsValid() || !FleshRingComp.IsValid() || PendingSubdivision.IsValid())
 	{
 		return;
 	}
@@ -310,19 +520,47 @@ void UFleshRingSubdivisionComponent::ComputeSubdivision()
 		return;
 	}
 
-	// Use the first Ring (TODO: Support multiple Rings)
-	const FFleshRingSettings& Ring = Asset->Rings[0];
+	// Gather Ring parameters on the game thread (SDF caches / asset are not touched by the worker)
+	// One entry per asset Ring so RingParamsArray indices (processor island cache) stay aligned with Asset->Rings
+	TArray<FSubdivisionRingParams> RingParamsArray;
+	RingParamsArray.Reserve(Asset->Rings.Num());
+
+	// Bind pose bone transforms for Rings without an SDF cache (same selection volume as the bake)
+	const USkeletalMesh* SkelMesh = TargetMeshComp.IsValid() ? TargetMeshComp->GetSkeletalMeshAsset() : nullptr;
 
-	// Set Ring parameters
-	FSubdivisionRingParams RingParams;
+	int32 MaxRingErrorLevel = 0;
+	bool bAnyRingRefined = false;
 
-	// Determine SDF mode or VirtualRing mode based on InfluenceMode
-	if (Ring.InfluenceMode == EFleshRingInfluenceMode::Auto)
+	for (int32 RingIndex = 0; RingIndex < Asset->Rings.Num(); ++RingIndex)
 	{
-		// Auto mode: Use bounds information from SDF cache
-		const FRingSDFCache* SDFCache = FleshRingComp->GetRingSDFCache(0);
+		FSubdivisionRingParams& RingParams = RingParamsArray.AddDefaulted_GetRef();
+
+		// Screen-space error: Rings too small on screen are not refined (level 0 placeholder)
+		int32 RingLevel = INDEX_NONE;
+		if (bUseScreenSpaceError)
+		{
+			RingLevel = RingErrorLevels.IsValidIndex(RingIndex) && RingErrorLevels[RingIndex] != INDEX_NONE
+				? RingErrorLevels[RingIndex] : MaxSubdivisionLevel;
+			if (RingLevel <= 0)
+			{
+				RingParams.MaxSubdivisionLevel = 0;
+				continue;
+			}
+			MaxRingErrorLevel = FMath::Max(MaxRingErrorLevel, RingLevel);
+		}
+
+		const FFleshRingSettings& Ring = Asset->Rings[RingIndex];
+		RingParams.MaxSubdivisionLevel = RingLevel;
+		bAnyRingRefined = true;
+
+		// Determine SDF mode or VirtualRing mode based on InfluenceMode
+		const FRingSDFCache* SDFCache = (Ring.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::MeshBased)
+			? FleshRingComp->GetRingSDFCache(RingIndex)
+			: nullptr;
+
 		if (SDFCache && SDFCache->IsValid())
 		{
+			// MeshBased mode: Use bounds information from SDF cache
 			RingParams.bUseSDFBounds = true;
 			RingParams.SDFBoundsMin = FVector(SDFCache->BoundsMin);
 			RingParams.SDFBoundsMax = FVector(SDFCache->BoundsMax);
@@ -330,31 +568,37 @@ void UFleshRingSubdivisionComponent::ComputeSubdivision()
 		}
 		else
 		{
-			// Fall back to VirtualRing mode if SDF cache is not available
-			UE_LOG(LogFleshRingSubdivision, Warning,
-				TEXT("SDF cache not available, falling back to VirtualRing mode"));
-			RingParams.bUseSDFBounds = false;
-			RingParams.Center = Ring.RingOffset;
-			RingParams.Axis = FVector::UpVector;
-			RingParams.Radius = Ring.RingRadius;
-			RingParams.Width = Ring.RingHeight;
+			if (Ring.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::MeshBased)
+			{
+				// Fall back to RingMesh bounds if SDF cache is not available
+				UE_LOG(LogFleshRingSubdivision, Warning,
+					TEXT("Ring[%d] SDF cache not available, falling back to RingMesh bounds"), RingIndex);
+			}
+
+			// VirtualBand: band bounds, VirtualRing: torus in the Ring frame (bone transform applied)
+			FTransform BoneTransform = FTransform::Identity;
+			if (SkelMesh)
+			{
+				const FReferenceSkeleton& RefSkeleton = SkelMesh->GetRefSkeleton();
+				BoneTransform = FleshRingUtils::CalculateBoneTransform(
+					RefSkeleton.FindBoneIndex(Ring.BoneName), RefSkeleton, RefSkeleton.GetRefBonePose());
+			}
+
+			FleshRingUtils::MakeSubdivisionRingParams(
+				FleshRingUtils::ResolveRingSelectionVolume(Ring, BoneTransform), RingParams);
 		}
 	}
-	else
+
+	// Every Ring below its error threshold: drop the refined result, nothing to compute
+	if (!bAnyRingRefined)
 	{
-		// VirtualRing mode: existing geometric approach
-		RingParams.bUseSDFBounds = false;
-		RingParams.Center = Ring.RingOffset;
-		RingParams.Axis = FVector::UpVector; // TODO: Calculate from bone direction
-		RingParams.Radius = Ring.RingRadius;
-		RingParams.Width = Ring.RingHeight;
+		ResetAppliedResult(true);
+		RequestedSubdivisionLevel = 0;
+		return;
 	}
 
-	Processor->SetRingParams(RingParams);
-
 	// Configure Processor settings
 	FSubdivisionProcessorSettings Settings;
-	Settings.MaxSubdivisionLevel = MaxSubdivisionLevel;
 	Settings.MinEdgeLength = MinEdgeLength;
 
 	switch (SubdivisionMode)
@@ -371,37 +615,115 @@ void UFleshRingSubdivisionComponent::ComputeSubdivision()
 		break;
 	}
 
-	Processor->SetSettings(Settings);
+	// Distance-driven level (re-requested by TickComponent when it changes); per-Ring levels cap it in screen-space error mode
+	const int32 TargetLevel = bUseScreenSpaceError ? MaxRingErrorLevel
+		: (bEnableDistanceFalloff ? GetDistanceSubdivisionLevel() : MaxSubdivisionLevel);
+	RequestedSubdivisionLevel = TargetLevel;
 
-	// Execute CPU Subdivision
-	FSubdivisionTopologyResult TopologyResult;
-	if (Processor->Process(TopologyResult))
+	// Vertex budget: step toward the target over successive updates (CompletePendingSubdivision requests the next step)
+	if (AddedVerticesPerLevel.Num() != MaxSubdivisionLevel + 1)
 	{
-		// Warn if no subdivision occurred
-		const bool bWasSubdivided =
-			(TopologyResult.SubdividedVertexCount > TopologyResult.OriginalVertexCount) ||
-			(TopologyResult.SubdividedTriangleCount > TopologyResult.OriginalTriangleCount);
+		AddedVerticesPerLevel.Init(INDEX_NONE, MaxSubdivisionLevel + 1);
+	}
+	Settings.MaxSubdivisionLevel = GetBudgetedUpdateLevel(TargetLevel);
 
-		if (!bWasSubdivided)
+	// Execute CPU Subdivision on a worker
+	// The processor travels with the task (keeps its per-Ring island cache) and is swapped back in on completion;
+	// the previous GPU result stays in use until then
+	PendingSubdivision = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[WorkerProcessor = MoveTemp(Processor), RingParamsArray = MoveTemp(RingParamsArray), Settings]() mutable
 		{
-			const FString ModeStr = RingParams.bUseSDFBounds ? TEXT("SDF") : TEXT("VirtualRing");
-			UE_LOG(LogFleshRingSubdivision, Warning,
-				TEXT("[%s] Subdivision NO CHANGE - Mode: %s | Vertices: %d | Triangles: %d (no triangles in affected region?)"),
-				*GetOwner()->GetName(),
-				*ModeStr,
-				TopologyResult.OriginalVertexCount,
-				TopologyResult.OriginalTriangleCount);
-		}
+			FAsyncSubdivisionResult Result;
+			WorkerProcessor->SetRingParamsArray(RingParamsArray);
+			WorkerProcessor->SetSettings(Settings);
+
+			FSubdivisionTopologyResult TopologyResult;
+			Result.bSuccess = WorkerProcessor->Process(TopologyResult);
+			Result.SubdivisionLevel = Settings.MaxSubdivisionLevel;
+			Result.AddedVertices =
+				static_cast<int32>(TopologyResult.SubdividedVertexCount) - static_cast<int32>(TopologyResult.OriginalVertexCount);
+
+			Result.Processor = MoveTemp(WorkerProcessor);
+			return Result;
+		});
+}
 
-		// Execute GPU interpolation
-		ExecuteGPUInterpolation();
+void UFleshRingSubdivisionComponent::CompletePendingSubdivision(bool bApplyResult)
+{
+	if (!PendingSubdivision.IsValid())
+	{
+		return;
 	}
-	else
+
+	PendingSubdivision.Wait();
+	FAsyncSubdivisionResult Result = MoveTemp(PendingSubdivision.GetResult());
+	PendingSubdivision = {};
+
+	Processor = MoveTemp(Result.Processor);
+
+	if (!bApplyResult || !Processor.IsValid())
+	{
+		return;
+	}
+
+	if (!Result.bSuccess)
 	{
 		UE_LOG(LogFleshRingSubdivision, Warning,
 			TEXT("[%s] Subdivision FAILED - CPU subdivision failed"),
-			*GetOwner()->GetName());
+			*GetNameSafe(GetOwner()));
+		return;
+	}
+
+	const FSubdivisionTopologyResult& TopologyResult = Processor->GetCachedResult();
+
+	AppliedSubdivisionLevel = Result.SubdivisionLevel;
+	AppliedOriginalVertexCount = TopologyResult.OriginalVertexCount;
+	AppliedSubdividedVertexCount = TopologyResult.SubdividedVertexCount;
+	AppliedSubdividedTriangleCount = TopologyResult.SubdividedTriangleCount;
+	if (AddedVerticesPerLevel.IsValidIndex(Result.SubdivisionLevel))
+	{
+		AddedVerticesPerLevel[Result.SubdivisionLevel] = Result.AddedVertices;
+	}
+
+#if WITH_EDITORONLY_DATA
+	if (bShowSubdividedVertices || bShowSubdividedWireframe)
+	{
+		UpdateDebugSnapshot();
+	}
+	else
+	{
+		DebugSnapshot = FSubdivisionDebugSnapshot();
 	}
+#endif
+
+	// Warn if no subdivision occurred
+	const bool bWasSubdivided =
+		(TopologyResult.SubdividedVertexCount > TopologyResult.OriginalVertexCount) ||
+		(TopologyResult.SubdividedTriangleCount > TopologyResult.OriginalTriangleCount);
+
+	if (!bWasSubdivided)
+	{
+		UE_LOG(LogFleshRingSubdivision, Warning,
+			TEXT("[%s] Subdivision NO CHANGE - Level: %d | Vertices: %d | Triangles: %d (no triangles in affected region?)"),
+			*GetNameSafe(GetOwner()),
+			Result.SubdivisionLevel,
+			TopologyResult.OriginalVertexCount,
+			TopologyResult.OriginalTriangleCount);
+	}
+	else if (Result.SubdivisionLevel < RequestedSubdivisionLevel)
+	{
+		// Budgeted ramp: next step is launched by the following tick
+		bNeedsRecompute = true;
+		UE_LOG(LogFleshRingSubdivision, Verbose,
+			TEXT("[%s] Subdivision level %d of %d (vertex budget %d, continuing next update)"),
+			*GetNameSafe(GetOwner()),
+			Result.SubdivisionLevel,
+			RequestedSubdivisionLevel,
+			MaxAddedVerticesPerUpdate);
+	}
+
+	// Execute GPU interpolation
+	ExecuteGPUInterpolation();
 }
 
 void UFleshRingSubdivisionComponent::ExecuteGPUInterpolation()
@@ -690,8 +1012,9 @@ void UFleshRingSubdivisionComponent::BakeSubdividedMesh()
 		// Compute subdivision first
 		ForceRecompute();
 
-		// Manually call Tick to complete computation
+		// Manually call Tick to launch computation, then wait for the worker
 		TickComponent(0.0f, ELevelTick::LEVELTICK_All, nullptr);
+		CompletePendingSubdivision(true);
 
 		if (!Processor.IsValid() || !Processor->IsCacheValid())
 		{
@@ -736,28 +1059,40 @@ void UFleshRingSubdivisionComponent::BakeSubdividedMesh()
 
 #if WITH_EDITORONLY_DATA
 
-void UFleshRingSubdivisionComponent::DrawSubdividedVerticesDebug()
+void UFleshRingSubdivisionComponent::UpdateDebugSnapshot()
 {
-	if (!Processor.IsValid() || !Processor->IsCacheValid())
+	DebugSnapshot = FSubdivisionDebugSnapshot();
+
+	// Component-space positions (same kernel as bake)
+	if (!InterpolateSubdividedPositions(DebugSnapshot.Positions))
 	{
 		return;
 	}
 
-	if (!TargetMeshComp.IsValid())
+	const FSubdivisionTopologyResult& Result = Processor->GetCachedResult();
+	DebugSnapshot.Indices = Result.Indices;
+	DebugSnapshot.NewVertexMask.Init(false, Result.VertexData.Num());
+	for (int32 i = 0; i < Result.VertexData.Num(); ++i)
 	{
-		return;
+		DebugSnapshot.NewVertexMask[i] = !Result.VertexData[i].IsOriginalVertex();
 	}
+}
 
-	UWorld* World = GetWorld();
-	if (!World)
+void UFleshRingSubdivisionComponent::DrawSubdividedVerticesDebug()
+{
+	// Debug draw enabled after the last swap: build the snapshot once the processor is back
+	if (DebugSnapshot.Positions.Num() == 0)
 	{
-		return;
+		UpdateDebugSnapshot();
 	}
 
-	const FSubdivisionTopologyResult& Result = Processor->GetCachedResult();
-	const TArray<FVector>& SourcePositions = Processor->GetSourcePositions();
+	if (DebugSnapshot.Positions.Num() == 0 || !TargetMeshComp.IsValid())
+	{
+		return;
+	}
 
-	if (SourcePositions.Num() == 0)
+	UWorld* World = GetWorld();
+	if (!World)
 	{
 		return;
 	}
@@ -766,37 +1101,16 @@ void UFleshRingSubdivisionComponent::DrawSubdividedVerticesDebug()
 	const FTransform& MeshTransform = TargetMeshComp->GetComponentTransform();
 
 	// Visualize only newly added vertices (exclude original vertices)
-	for (int32 i = 0; i < Result.VertexData.Num(); ++i)
+	for (int32 i = 0; i < DebugSnapshot.Positions.Num(); ++i)
 	{
-		const FSubdivisionVertexData& VertexData = Result.VertexData[i];
-
 		// Skip original vertices
-		if (VertexData.IsOriginalVertex())
+		if (!DebugSnapshot.NewVertexMask[i])
 		{
 			continue;
 		}
 
-		// Validate parent vertex indices
-		const uint32 P0 = VertexData.ParentV0;
-		const uint32 P1 = VertexData.ParentV1;
-		const uint32 P2 = VertexData.ParentV2;
-
-		if (P0 >= (uint32)SourcePositions.Num() ||
-			P1 >= (uint32)SourcePositions.Num() ||
-			P2 >= (uint32)SourcePositions.Num())
-		{
-			continue;
-		}
-
-		// Calculate position using barycentric interpolation (component space)
-		const FVector3f& Bary = VertexData.BarycentricCoords;
-		FVector LocalPosition =
-			SourcePositions[P0] * Bary.X +
-			SourcePositions[P1] * Bary.Y +
-			SourcePositions[P2] * Bary.Z;
-
 		// Transform to world space
-		FVector WorldPosition = MeshTransform.TransformPosition(LocalPosition);
+		FVector WorldPosition = MeshTransform.TransformPosition(FVector(DebugSnapshot.Positions[i]));
 
 		// Draw as white point
 		DrawDebugPoint(
@@ -812,12 +1126,13 @@ void UFleshRingSubdivisionComponent::DrawSubdividedVerticesDebug()
 
 void UFleshRingSubdivisionComponent::DrawSubdividedWireframeDebug()
 {
-	if (!Processor.IsValid() || !Processor->IsCacheValid())
+	// Debug draw enabled after the last swap: build the snapshot once the processor is back
+	if (DebugSnapshot.Positions.Num() == 0)
 	{
-		return;
+		UpdateDebugSnapshot();
 	}
 
-	if (!TargetMeshComp.IsValid())
+	if (DebugSnapshot.Indices.Num() < 3 || !TargetMeshComp.IsValid())
 	{
 		return;
 	}
@@ -828,60 +1143,24 @@ void UFleshRingSubdivisionComponent::DrawSubdividedWireframeDebug()
 		return;
 	}
 
-	const FSubdivisionTopologyResult& Result = Processor->GetCachedResult();
-	const TArray<FVector>& SourcePositions = Processor->GetSourcePositions();
-
-	if (SourcePositions.Num() == 0 || Result.Indices.Num() < 3)
-	{
-		return;
-	}
-
 	// World transform (component space -> world space)
 	const FTransform& MeshTransform = TargetMeshComp->GetComponentTransform();
 
-	// Pre-calculate all vertex positions (original + new vertices)
 	TArray<FVector> AllPositions;
-	AllPositions.SetNum(Result.VertexData.Num());
-
-	for (int32 i = 0; i < Result.VertexData.Num(); ++i)
+	AllPositions.SetNum(DebugSnapshot.Positions.Num());
+	for (int32 i = 0; i < DebugSnapshot.Positions.Num(); ++i)
 	{
-		const FSubdivisionVertexData& VertexData = Result.VertexData[i];
-
-		const uint32 P0 = VertexData.ParentV0;
-		const uint32 P1 = VertexData.ParentV1;
-		const uint32 P2 = VertexData.ParentV2;
-
-		// Validation check
-		if (P0 >= (uint32)SourcePositions.Num() ||
-			P1 >= (uint32)SourcePositions.Num() ||
-			P2 >= (uint32)SourcePositions.Num())
-		{
-			AllPositions[i] = FVector::ZeroVector;
-			continue;
-		}
-
-		// Calculate position using barycentric interpolation
-		const FVector3f& Bary = VertexData.BarycentricCoords;
-		FVector LocalPosition =
-			SourcePositions[P0] * Bary.X +
-			SourcePositions[P1] * Bary.Y +
-			SourcePositions[P2] * Bary.Z;
-
-		// Transform to world space
-		AllPositions[i] = MeshTransform.TransformPosition(LocalPosition);
+		AllPositions[i] = MeshTransform.TransformPosition(FVector(DebugSnapshot.Positions[i]));
 	}
 
 	// Draw edges of all triangles as red lines
-	const int32 NumTriangles = Result.Indices.Num() / 3;
-
-	// Draw only new triangles (after original triangle count)
-	const int32 OriginalTriCount = Result.OriginalTriangleCount;
+	const int32 NumTriangles = DebugSnapshot.Indices.Num() / 3;
 
 	for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
 	{
-		const uint32 I0 = Result.Indices[TriIdx * 3 + 0];
-		const uint32 I1 = Result.Indices[TriIdx * 3 + 1];
-		const uint32 I2 = Result.Indices[TriIdx * 3 + 2];
+		const uint32 I0 = DebugSnapshot.Indices[TriIdx * 3 + 0];
+		const uint32 I1 = DebugSnapshot.Indices[TriIdx * 3 + 1];
+		const uint32 I2 = DebugSnapshot.Indices[TriIdx * 3 + 2];
 
 		if (I0 >= (uint32)AllPositions.Num() ||
 			I1 >= (uint32)AllPositions.Num() ||
@@ -898,9 +1177,9 @@ void UFleshRingSubdivisionComponent::DrawSubdividedWireframeDebug()
 		// Since it's difficult to distinguish original and new triangles,
 		// we determine by checking if the triangle contains new vertices
 		const bool bHasNewVertex =
-			!Result.VertexData[I0].IsOriginalVertex() ||
-			!Result.VertexData[I1].IsOriginalVertex() ||
-			!Result.VertexData[I2].IsOriginalVertex();
+			DebugSnapshot.NewVertexMask[I0] ||
+			DebugSnapshot.NewVertexMask[I1] ||
+			DebugSnapshot.NewVertexMask[I2];
 
 		FColor LineColor = bHasNewVertex ? FColor::Red : FColor::Green;
 
@@ -910,4 +1189,36 @@ void UFleshRingSubdivisionComponent::DrawSubdividedWireframeDebug()
 		DrawDebugLine(World, V2, V0, LineColor, false, -1.0f, 0, 1.0f);
 	}
 }
+
+bool UFleshRingSubdivisionComponent::InterpolateSubdividedPositions(TArray<FVector3f>& OutPositions) const
+{
+	OutPositions.Reset();
+
+	if (!Processor.IsValid() || !Processor->IsCacheValid())
+	{
+		return false;
+	}
+
+	const TArray<FVector>& SourcePositions = Processor->GetSourcePositions();
+	if (SourcePositions.Num() == 0)
+	{
+		return false;
+	}
+
+	FFleshRingVertexStreams SourceStreams;
+	SourceStreams.Positions.SetNumUninitialized(SourcePositions.Num());
+	for (int32 i = 0; i < SourcePositions.Num(); ++i)
+	{
+		SourceStreams.Positions[i] = FVector3f(SourcePositions[i]);
+	}
+
+	FFleshRingBarycentricParents Parents;
+	Parents.Build(Processor->GetCachedResult().VertexData, SourcePositions.Num());
+
+	FFleshRingVertexStreams SubdividedStreams;
+	FleshRingBarycentricInterpolation::Interpolate(SourceStreams, Parents, SubdividedStreams);
+
+	OutPositions = MoveTemp(SubdividedStreams.Positions);
+	return true;
+}
 #endif
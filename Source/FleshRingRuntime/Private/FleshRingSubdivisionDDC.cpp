@@ -0,0 +1,91 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingSubdivisionDDC.cpp
+#include "FleshRingSubdivisionDDC.h"
+
+#if WITH_EDITOR
+#include "FleshRingSubdivisionProcessor.h"
+#include "Engine/SkeletalMesh.h"
+#include "Rendering/SkeletalMeshModel.h"
+#include "DerivedDataCacheInterface.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSubdivisionDDC, Log, All);
+
+namespace FleshRingSubdivisionDDC
+{
+
+namespace
+{
+	// Change when FSubdivisionTopologyResult layout or subdivision algorithm output changes
+	const TCHAR* TopologyDDCVersion = TEXT("3A3E9ACC6D5B440BBA54B132D50703F4");
+}
+
+FString BuildKey(const USkeletalMesh* SourceMesh, uint32 SubdivisionParamsHash)
+{
+	if (!SourceMesh)
+	{
+		return FString();
+	}
+
+	const FSkeletalMeshModel* ImportedModel = const_cast<USkeletalMesh*>(SourceMesh)->GetImportedModel();
+	if (!ImportedModel)
+	{
+		return FString();
+	}
+
+	const FString KeySuffix = FString::Printf(TEXT("%s_%08X"),
+		*ImportedModel->GetIdString(),
+		SubdivisionParamsHash);
+
+	return FDerivedDataCacheInterface::BuildCacheKey(TEXT("FLESHRING_SUBDIV"), TopologyDDCVersion, *KeySuffix);
+}
+
+bool Get(const FString& Key, int32 ExpectedVertexCount, FSubdivisionTopologyResult& OutResult)
+{
+	if (Key.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<uint8> Data;
+	if (!GetDerivedDataCacheRef().GetSynchronous(*Key, Data, TEXT("FleshRingSubdivisionTopology")))
+	{
+		return false;
+	}
+
+	FSubdivisionTopologyResult Result;
+	FMemoryReader Reader(Data, /*bIsPersistent=*/ true);
+	Reader << Result;
+
+	if (Reader.IsError() ||
+		!Result.IsValid() ||
+		Result.OriginalVertexCount != static_cast<uint32>(ExpectedVertexCount) ||
+		Result.TriangleMaterialIndices.Num() * 3 != Result.Indices.Num())
+	{
+		UE_LOG(LogFleshRingSubdivisionDDC, Warning, TEXT("Discarding invalid cached topology (%s)"), *Key);
+		return false;
+	}
+
+	OutResult = MoveTemp(Result);
+	return true;
+}
+
+void Put(const FString& Key, const FSubdivisionTopologyResult& Result)
+{
+	if (Key.IsEmpty() || !Result.IsValid())
+	{
+		return;
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data, /*bIsPersistent=*/ true);
+	Writer << const_cast<FSubdivisionTopologyResult&>(Result);
+
+	GetDerivedDataCacheRef().Put(*Key, Data, TEXT("FleshRingSubdivisionTopology"));
+}
+
+}
+
+#endif
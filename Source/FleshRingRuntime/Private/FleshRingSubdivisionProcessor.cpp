@@ -8,9 +8,110 @@
 #include "Engine/SkeletalMesh.h"
 #include "Rendering/SkeletalMeshRenderData.h"
 #include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Async/ParallelFor.h"
+#include "Algo/BinarySearch.h"
+#include <atomic>
 
 DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSubdivisionProcessor, Log, All);
 
+namespace
+{
+	// Exact region match (incremental island / region reuse; NeedsRecomputation uses a coarse threshold instead)
+	bool AreRingParamsIdentical(const FSubdivisionRingParams& RingA, const FSubdivisionRingParams& RingB)
+	{
+		if (RingA.bUseSDFBounds != RingB.bUseSDFBounds || RingA.MaxSubdivisionLevel != RingB.MaxSubdivisionLevel)
+		{
+			return false;
+		}
+
+		return RingA.bUseSDFBounds
+			? (RingA.SDFBoundsMin.Equals(RingB.SDFBoundsMin) &&
+				RingA.SDFBoundsMax.Equals(RingB.SDFBoundsMax) &&
+				RingA.SDFLocalToComponent.Equals(RingB.SDFLocalToComponent) &&
+				FMath::IsNearlyEqual(RingA.SDFInfluenceMultiplier, RingB.SDFInfluenceMultiplier))
+			: (RingA.Center.Equals(RingB.Center) &&
+				RingA.Axis.Equals(RingB.Axis) &&
+				FMath::IsNearlyEqual(RingA.Radius, RingB.Radius) &&
+				FMath::IsNearlyEqual(RingA.Width, RingB.Width) &&
+				FMath::IsNearlyEqual(RingA.InfluenceMultiplier, RingB.InfluenceMultiplier));
+	}
+
+	bool AreRingParamsIdentical(const TArray<FSubdivisionRingParams>& A, const TArray<FSubdivisionRingParams>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			if (!AreRingParamsIdentical(A[Index], B[Index]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// Top 3 contributing original vertices, renormalized (warns when 4+ contributors get truncated)
+	FSubdivisionVertexData MakeVertexDataFromContributions(const TMap<uint32, float>& Contribs, int32 VertexIndex)
+	{
+		// Sort by contribution
+		TArray<TPair<uint32, float>> SortedContribs;
+		for (const auto& C : Contribs)
+		{
+			SortedContribs.Add(TPair<uint32, float>(C.Key, C.Value));
+		}
+		SortedContribs.Sort([](const TPair<uint32, float>& A, const TPair<uint32, float>& B)
+		{
+			return A.Value > B.Value;
+		});
+
+		// Use top 3 (warn if 4 or more contributors)
+		if (SortedContribs.Num() > 3)
+		{
+			// Calculate total dropped contribution weight
+			float DroppedWeight = 0.0f;
+			for (int32 j = 3; j < SortedContribs.Num(); ++j)
+			{
+				DroppedWeight += SortedContribs[j].Value;
+			}
+
+			// Islands resolve their vertices concurrently
+			static std::atomic<int32> TruncationWarningCount = 0;
+			if (TruncationWarningCount.fetch_add(1) < 10)
+			{
+				UE_LOG(LogFleshRingSubdivisionProcessor, Warning,
+					TEXT("Vertex %d has %d contributors (truncating to 3). Dropped weight: %.4f"),
+					VertexIndex, SortedContribs.Num(), DroppedWeight);
+			}
+		}
+
+		uint32 P0 = 0, P1 = 0, P2 = 0;
+		float W0 = 0, W1 = 0, W2 = 0;
+
+		if (SortedContribs.Num() >= 1) { P0 = SortedContribs[0].Key; W0 = SortedContribs[0].Value; }
+		if (SortedContribs.Num() >= 2) { P1 = SortedContribs[1].Key; W1 = SortedContribs[1].Value; }
+		if (SortedContribs.Num() >= 3) { P2 = SortedContribs[2].Key; W2 = SortedContribs[2].Value; }
+
+		// Normalize
+		float TotalWeight = W0 + W1 + W2;
+		if (TotalWeight > 0.0f)
+		{
+			W0 /= TotalWeight;
+			W1 /= TotalWeight;
+			W2 /= TotalWeight;
+		}
+		else
+		{
+			W0 = 1.0f;
+		}
+
+		return FSubdivisionVertexData::CreateBarycentric(P0, P1, P2, FVector3f(W0, W1, W2));
+	}
+}
+
 FFleshRingSubdivisionProcessor::FFleshRingSubdivisionProcessor()
 {
 }
@@ -31,6 +132,21 @@ bool FFleshRingSubdivisionProcessor::SetSourceMesh(
 		return false;
 	}
 
+	// Same source data (persistent processor re-fed by a new bake / preview): keep base mesh + result and island caches
+	// (missing UVs / material indices are stored zero-filled, see below)
+	const bool bSameSource = SourcePositions.Num() > 0 &&
+		SourcePositions == InPositions && SourceIndices == InIndices &&
+		(InUVs.Num() == InPositions.Num()
+			? SourceUVs == InUVs
+			: !SourceUVs.ContainsByPredicate([](const FVector2D& UV) { return !UV.IsZero(); })) &&
+		(InMaterialIndices.Num() == InIndices.Num() / 3
+			? SourceMaterialIndices == InMaterialIndices
+			: !SourceMaterialIndices.ContainsByPredicate([](int32 MaterialIndex) { return MaterialIndex != 0; }));
+	if (bSameSource)
+	{
+		return true;
+	}
+
 	SourcePositions = InPositions;
 	SourceIndices = InIndices;
 	SourceUVs = InUVs;
@@ -50,6 +166,11 @@ bool FFleshRingSubdivisionProcessor::SetSourceMesh(
 	}
 
 	InvalidateCache();
+	InvalidateIslandCache();
+	BaseHalfEdgeMesh.Clear();
+	BaseVertexFaceOffsets.Empty();
+	BaseVertexFaces.Empty();
+	bBaseMeshValid = false;
 
 	return true;
 }
@@ -200,6 +321,8 @@ void FFleshRingSubdivisionProcessor::SetSettings(const FSubdivisionProcessorSett
 		CurrentSettings.MinEdgeLength != Settings.MinEdgeLength)
 	{
 		InvalidateCache();
+		InvalidateIslandCache();
+		InvalidateBoneRegionCache();  // Bone region params hash doesn't cover MinEdgeLength
 	}
 
 	CurrentSettings = Settings;
@@ -218,6 +341,12 @@ void FFleshRingSubdivisionProcessor::InvalidateCache()
 	EdgeMidpointCache.Empty();
 }
 
+void FFleshRingSubdivisionProcessor::InvalidateIslandCache()
+{
+	CachedIslands.Empty();
+	CachedRingRegions.Empty();
+}
+
 bool FFleshRingSubdivisionProcessor::Process(FSubdivisionTopologyResult& OutResult)
 {
 	// Return cached result if cache is valid
@@ -238,37 +367,26 @@ bool FFleshRingSubdivisionProcessor::Process(FSubdivisionTopologyResult& OutResu
 	OutResult.OriginalVertexCount = SourcePositions.Num();
 	OutResult.OriginalTriangleCount = SourceIndices.Num() / 3;
 
-	// 1. Build Half-Edge mesh
-	// Convert to int32 array (FHalfEdgeMesh uses int32)
-	TArray<int32> IndicesInt32;
-	IndicesInt32.SetNum(SourceIndices.Num());
-	for (int32 i = 0; i < SourceIndices.Num(); ++i)
-	{
-		IndicesInt32[i] = static_cast<int32>(SourceIndices[i]);
-	}
-
-	if (!HalfEdgeMesh.BuildFromTriangles(SourcePositions, IndicesInt32, SourceUVs, SourceMaterialIndices))
+	// 1. Base Half-Edge mesh (built once per source mesh, islands read it without copying)
+	if (!BuildBaseMesh())
 	{
 		UE_LOG(LogFleshRingSubdivisionProcessor, Warning, TEXT("Failed to build Half-Edge mesh"));
 		return false;
 	}
 
 	// 2. Perform LEB/Red-Green Refinement
-	int32 TotalFacesAdded = 0;
+	// Disjoint regions are refined concurrently as islands, which also emit the topology result
+	int32 TotalFacesAdded = INDEX_NONE;
+	TArray<int32> TargetTrianglesLocal;
 
 	if (bUseTriangleBasedMode && TargetTriangleIndices.Num() > 0)
 	{
 		// ========================================
 		// Triangle-based mode: Directly use triangle set extracted from DI
 		// ========================================
-
-		// Subdivide only target triangles (passed directly)
-		TotalFacesAdded = FLEBSubdivision::SubdivideSelectedFaces(
-			HalfEdgeMesh,
-			TargetTriangleIndices,
-			CurrentSettings.MaxSubdivisionLevel,
-			CurrentSettings.MinEdgeLength
-		);
+		TargetTrianglesLocal = TargetTriangleIndices.Array();
+		TargetTrianglesLocal.Sort();
+		TotalFacesAdded = SubdivideIslands(&TargetTrianglesLocal, OutResult);
 	}
 	else if (bUseVertexBasedMode && TargetVertexIndices.Num() > 0)
 	{
@@ -276,8 +394,7 @@ bool FFleshRingSubdivisionProcessor::Process(FSubdivisionTopologyResult& OutResu
 		// Vertex-based mode: Subdivide triangles containing specified vertices
 		// ========================================
 
-		// Collect triangles containing target vertices
-		TSet<int32> TargetTrianglesLocal;
+		// Collect triangles containing target vertices (ascending)
 		const int32 NumTriangles = SourceIndices.Num() / 3;
 
 		for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
@@ -295,76 +412,564 @@ bool FFleshRingSubdivisionProcessor::Process(FSubdivisionTopologyResult& OutResu
 			}
 		}
 
-		// Subdivide only target triangles
-		TotalFacesAdded = FLEBSubdivision::SubdivideSelectedFaces(
-			HalfEdgeMesh,
-			TargetTrianglesLocal,
-			CurrentSettings.MaxSubdivisionLevel,
-			CurrentSettings.MinEdgeLength
-		);
+		TotalFacesAdded = SubdivideIslands(&TargetTrianglesLocal, OutResult);
 	}
-	else
+	else if (RingParamsArray.Num() > 1)
 	{
 		// ========================================
 		// Ring parameter-based mode (legacy approach)
 		// ========================================
-		for (int32 RingIdx = 0; RingIdx < RingParamsArray.Num(); ++RingIdx)
+		TotalFacesAdded = SubdivideIslands(nullptr, OutResult);
+	}
+
+	if (TotalFacesAdded == INDEX_NONE)
+	{
+		// Single island: refine a copy of the base mesh in place
+		HalfEdgeMesh = BaseHalfEdgeMesh;
+
+		if (TargetTrianglesLocal.Num() > 0)
+		{
+			// Subdivide only target triangles
+			FLEBSubdivision::SubdivideSelectedFaces(
+				HalfEdgeMesh,
+				TSet<int32>(TargetTrianglesLocal),
+				CurrentSettings.MaxSubdivisionLevel,
+				CurrentSettings.MinEdgeLength
+			);
+		}
+		else if (!bUseTriangleBasedMode && !bUseVertexBasedMode)
+		{
+			for (int32 RingIdx = 0; RingIdx < RingParamsArray.Num(); ++RingIdx)
+			{
+				SubdivideRingRegion(HalfEdgeMesh, RingParamsArray[RingIdx]);
+			}
+		}
+
+		// 3. Extract topology result
+		if (!ExtractTopologyResult(OutResult))
+		{
+			UE_LOG(LogFleshRingSubdivisionProcessor, Warning, TEXT("Failed to extract topology result"));
+			return false;
+		}
+	}
+
+	// Save to cache
+	CachedResult = OutResult;
+	CachedRingParamsArray = RingParamsArray;
+	bCacheValid = true;
+
+	return true;
+}
+
+bool FFleshRingSubdivisionProcessor::BuildBaseMesh()
+{
+	if (bBaseMeshValid)
+	{
+		return true;
+	}
+
+	// Convert to int32 array (FHalfEdgeMesh uses int32)
+	TArray<int32> IndicesInt32;
+	IndicesInt32.SetNum(SourceIndices.Num());
+	for (int32 i = 0; i < SourceIndices.Num(); ++i)
+	{
+		IndicesInt32[i] = static_cast<int32>(SourceIndices[i]);
+	}
+
+	if (!BaseHalfEdgeMesh.BuildFromTriangles(SourcePositions, IndicesInt32, SourceUVs, SourceMaterialIndices))
+	{
+		return false;
+	}
+
+	// Vertex -> face adjacency (CSR) for the island one-ring halo
+	const int32 NumFaces = BaseHalfEdgeMesh.GetFaceCount();
+	const int32 NumVertices = BaseHalfEdgeMesh.GetVertexCount();
+	BaseVertexFaceOffsets.Reset();
+	BaseVertexFaceOffsets.SetNumZeroed(NumVertices + 1);
+	for (int32 FaceIdx = 0; FaceIdx < NumFaces; ++FaceIdx)
+	{
+		int32 V[3];
+		BaseHalfEdgeMesh.GetFaceVertices(FaceIdx, V[0], V[1], V[2]);
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			BaseVertexFaceOffsets[V[Corner] + 1]++;
+		}
+	}
+	for (int32 VertIdx = 0; VertIdx < NumVertices; ++VertIdx)
+	{
+		BaseVertexFaceOffsets[VertIdx + 1] += BaseVertexFaceOffsets[VertIdx];
+	}
+	BaseVertexFaces.SetNumUninitialized(BaseVertexFaceOffsets[NumVertices]);
+	{
+		TArray<int32> WriteOffsets = BaseVertexFaceOffsets;
+		for (int32 FaceIdx = 0; FaceIdx < NumFaces; ++FaceIdx)
+		{
+			int32 V[3];
+			BaseHalfEdgeMesh.GetFaceVertices(FaceIdx, V[0], V[1], V[2]);
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				BaseVertexFaces[WriteOffsets[V[Corner]]++] = FaceIdx;
+			}
+		}
+	}
+
+	bBaseMeshValid = true;
+	return true;
+}
+
+int32 FFleshRingSubdivisionProcessor::SubdivideRingRegion(FHalfEdgeMesh& Mesh, const FSubdivisionRingParams& RingParams) const
+{
+	if (GetRingMaxSubdivisionLevel(RingParams) <= 0)
+	{
+		return 0;
+	}
+
+	if (RingParams.bUseSDFBounds)
+	{
+		// SDF mode: OBB-based region checking (accurate method)
+		FSubdivisionOBB OBB = FSubdivisionOBB::CreateFromSDFBounds(
+			RingParams.SDFBoundsMin,
+			RingParams.SDFBoundsMax,
+			RingParams.SDFLocalToComponent,
+			RingParams.SDFInfluenceMultiplier
+		);
+
+		return FLEBSubdivision::SubdivideRegion(
+			Mesh,
+			OBB,
+			GetRingMaxSubdivisionLevel(RingParams),
+			CurrentSettings.MinEdgeLength
+		);
+	}
+
+	// VirtualRing mode: Torus approach
+	FTorusParams TorusParams;
+	TorusParams.Center = RingParams.Center;
+	TorusParams.Axis = RingParams.Axis.GetSafeNormal();
+	TorusParams.MajorRadius = RingParams.Radius;
+	TorusParams.MinorRadius = RingParams.Width * 0.5f;
+	TorusParams.InfluenceMargin = RingParams.GetInfluenceRadius();
+
+	return FLEBSubdivision::SubdivideRegion(
+		Mesh,
+		TorusParams,
+		GetRingMaxSubdivisionLevel(RingParams),
+		CurrentSettings.MinEdgeLength
+	);
+}
+
+int32 FFleshRingSubdivisionProcessor::GetRingMaxSubdivisionLevel(const FSubdivisionRingParams& RingParams) const
+{
+	return RingParams.MaxSubdivisionLevel == INDEX_NONE
+		? CurrentSettings.MaxSubdivisionLevel
+		: FMath::Min(RingParams.MaxSubdivisionLevel, CurrentSettings.MaxSubdivisionLevel);
+}
+
+int32 FFleshRingSubdivisionProcessor::SubdivideIslands(const TArray<int32>* TargetFaces, FSubdivisionTopologyResult& OutResult)
+{
+	const bool bTargetFaceMode = TargetFaces != nullptr;
+	const FHalfEdgeMesh& BaseMesh = BaseHalfEdgeMesh;
+	const int32 NumFaces = BaseMesh.GetFaceCount();
+	const int32 NumVertices = BaseMesh.GetVertexCount();
+
+	// ========================================================================
+	// 1. Seed faces per group (CSR)
+	//    Ring mode: one group per Ring (region faces, same first-level test as SubdivideRegion;
+	//    a Ring with unchanged parameters keeps its faces from the previous Process())
+	//    Target face mode: one group per selected face
+	// ========================================================================
+	TArray<int32> GroupSeedOffsets;
+	TArray<int32> SeedFaces;
+
+	if (bTargetFaceMode)
+	{
+		SeedFaces.Reserve(TargetFaces->Num());
+		for (int32 FaceIdx : *TargetFaces)
+		{
+			if (FaceIdx >= 0 && FaceIdx < NumFaces)
+			{
+				SeedFaces.Add(FaceIdx);
+			}
+		}
+
+		GroupSeedOffsets.SetNumUninitialized(SeedFaces.Num() + 1);
+		for (int32 GroupIdx = 0; GroupIdx <= SeedFaces.Num(); ++GroupIdx)
+		{
+			GroupSeedOffsets[GroupIdx] = GroupIdx;
+		}
+	}
+	else
+	{
+		const int32 NumRings = RingParamsArray.Num();
+		CachedRingRegions.SetNum(NumRings);
+		ParallelFor(NumRings, [&](int32 RingIdx)
 		{
-			const FSubdivisionRingParams& CurrentRingParams = RingParamsArray[RingIdx];
-			int32 FacesAdded = 0;
+			const FSubdivisionRingParams& RingParams = RingParamsArray[RingIdx];
+			FRingRegion& Region = CachedRingRegions[RingIdx];
+			if (Region.bValid && AreRingParamsIdentical(Region.RingParams, RingParams))
+			{
+				return;
+			}
+
+			Region.RingParams = RingParams;
+			Region.Faces.Reset();
+			Region.bValid = true;
 
-			if (CurrentRingParams.bUseSDFBounds)
+			if (GetRingMaxSubdivisionLevel(RingParams) <= 0)
 			{
-				// SDF mode: OBB-based region checking (accurate method)
-				FSubdivisionOBB OBB = FSubdivisionOBB::CreateFromSDFBounds(
-					CurrentRingParams.SDFBoundsMin,
-					CurrentRingParams.SDFBoundsMax,
-					CurrentRingParams.SDFLocalToComponent,
-					CurrentRingParams.SDFInfluenceMultiplier
-				);
-
-				FacesAdded = FLEBSubdivision::SubdivideRegion(
-					HalfEdgeMesh,
-					OBB,
-					CurrentSettings.MaxSubdivisionLevel,
-					CurrentSettings.MinEdgeLength
-				);
+				// Placeholder Ring: no region, joins no island
+				return;
+			}
+			if (RingParams.bUseSDFBounds)
+			{
+				const FSubdivisionOBB OBB = FSubdivisionOBB::CreateFromSDFBounds(
+					RingParams.SDFBoundsMin, RingParams.SDFBoundsMax, RingParams.SDFLocalToComponent, RingParams.SDFInfluenceMultiplier);
+				FLEBSubdivision::CollectRegionFaces(BaseMesh, OBB, Region.Faces);
 			}
 			else
 			{
-				// VirtualRing mode: Torus approach
 				FTorusParams TorusParams;
-				TorusParams.Center = CurrentRingParams.Center;
-				TorusParams.Axis = CurrentRingParams.Axis.GetSafeNormal();
-				TorusParams.MajorRadius = CurrentRingParams.Radius;
-				TorusParams.MinorRadius = CurrentRingParams.Width * 0.5f;
-				TorusParams.InfluenceMargin = CurrentRingParams.GetInfluenceRadius();
-
-				FacesAdded = FLEBSubdivision::SubdivideRegion(
-					HalfEdgeMesh,
-					TorusParams,
-					CurrentSettings.MaxSubdivisionLevel,
-					CurrentSettings.MinEdgeLength
-				);
+				TorusParams.Center = RingParams.Center;
+				TorusParams.Axis = RingParams.Axis.GetSafeNormal();
+				TorusParams.MajorRadius = RingParams.Radius;
+				TorusParams.MinorRadius = RingParams.Width * 0.5f;
+				TorusParams.InfluenceMargin = RingParams.GetInfluenceRadius();
+				FLEBSubdivision::CollectRegionFaces(BaseMesh, TorusParams, Region.Faces);
 			}
+		});
 
-			TotalFacesAdded += FacesAdded;
+		GroupSeedOffsets.SetNumUninitialized(NumRings + 1);
+		GroupSeedOffsets[0] = 0;
+		for (int32 RingIdx = 0; RingIdx < NumRings; ++RingIdx)
+		{
+			SeedFaces.Append(CachedRingRegions[RingIdx].Faces);
+			GroupSeedOffsets[RingIdx + 1] = SeedFaces.Num();
 		}
 	}
 
-	// 3. Extract topology result
-	if (!ExtractTopologyResult(OutResult))
+	const int32 NumGroups = GroupSeedOffsets.Num() - 1;
+
+	// ========================================================================
+	// 2. Group seeds into islands (union-find over shared seed/halo faces, base mesh CSR adjacency)
+	// ========================================================================
+	TArray<int32> GroupParent;
+	GroupParent.SetNumUninitialized(NumGroups);
+	for (int32 GroupIdx = 0; GroupIdx < NumGroups; ++GroupIdx)
 	{
-		UE_LOG(LogFleshRingSubdivisionProcessor, Warning, TEXT("Failed to extract topology result"));
-		return false;
+		GroupParent[GroupIdx] = GroupIdx;
 	}
 
-	// Save to cache
-	CachedResult = OutResult;
-	CachedRingParamsArray = RingParamsArray;
-	bCacheValid = true;
+	auto FindRoot = [&GroupParent](int32 GroupIdx)
+	{
+		while (GroupParent[GroupIdx] != GroupIdx)
+		{
+			GroupParent[GroupIdx] = GroupParent[GroupParent[GroupIdx]];
+			GroupIdx = GroupParent[GroupIdx];
+		}
+		return GroupIdx;
+	};
 
-	return true;
+	TArray<int32> FaceOwnerGroup;
+	FaceOwnerGroup.Init(INDEX_NONE, NumFaces);
+	for (int32 GroupIdx = 0; GroupIdx < NumGroups; ++GroupIdx)
+	{
+		for (int32 SeedSlot = GroupSeedOffsets[GroupIdx]; SeedSlot < GroupSeedOffsets[GroupIdx + 1]; ++SeedSlot)
+		{
+			int32 V[3];
+			BaseMesh.GetFaceVertices(SeedFaces[SeedSlot], V[0], V[1], V[2]);
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				// Seed face + every face sharing one of its vertices (one-ring halo)
+				for (int32 Slot = BaseVertexFaceOffsets[V[Corner]]; Slot < BaseVertexFaceOffsets[V[Corner] + 1]; ++Slot)
+				{
+					const int32 PatchFace = BaseVertexFaces[Slot];
+					const int32 Owner = FaceOwnerGroup[PatchFace];
+					if (Owner == INDEX_NONE)
+					{
+						FaceOwnerGroup[PatchFace] = GroupIdx;
+					}
+					else
+					{
+						const int32 RootA = FindRoot(Owner);
+						const int32 RootB = FindRoot(GroupIdx);
+						if (RootA != RootB)
+						{
+							// Lower group index becomes root (deterministic island order)
+							GroupParent[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Island per root group (ascending root order)
+	TArray<FSubdivisionIsland> Islands;
+	TArray<int32> RootToIsland;
+	RootToIsland.Init(INDEX_NONE, NumGroups);
+	for (int32 GroupIdx = 0; GroupIdx < NumGroups; ++GroupIdx)
+	{
+		if (GroupSeedOffsets[GroupIdx] == GroupSeedOffsets[GroupIdx + 1])
+		{
+			continue;
+		}
+		const int32 Root = FindRoot(GroupIdx);
+		if (RootToIsland[Root] == INDEX_NONE)
+		{
+			RootToIsland[Root] = Islands.AddDefaulted();
+		}
+		FSubdivisionIsland& Island = Islands[RootToIsland[Root]];
+		if (bTargetFaceMode)
+		{
+			Island.TargetFaces.Add(SeedFaces[GroupSeedOffsets[GroupIdx]]);
+		}
+		else
+		{
+			Island.RingIndices.Add(GroupIdx);
+			Island.RingParams.Add(RingParamsArray[GroupIdx]);
+		}
+	}
+
+	if (Islands.Num() <= 1)
+	{
+		CachedIslands.Empty();
+		return INDEX_NONE;
+	}
+
+	for (int32 FaceIdx = 0; FaceIdx < NumFaces; ++FaceIdx)
+	{
+		if (FaceOwnerGroup[FaceIdx] != INDEX_NONE)
+		{
+			Islands[RootToIsland[FindRoot(FaceOwnerGroup[FaceIdx])]].Faces.Add(FaceIdx);
+		}
+	}
+
+	// ========================================================================
+	// 3. Reuse unchanged islands from the previous Process()
+	// ========================================================================
+	int32 NumReused = 0;
+	for (FSubdivisionIsland& Island : Islands)
+	{
+		for (FSubdivisionIsland& Cached : CachedIslands)
+		{
+			if (Cached.RingIndices == Island.RingIndices &&
+				Cached.TargetFaces == Island.TargetFaces &&
+				Cached.Faces == Island.Faces &&
+				AreRingParamsIdentical(Cached.RingParams, Island.RingParams))
+			{
+				Island.LocalToGlobalVertex = MoveTemp(Cached.LocalToGlobalVertex);
+				Island.PatchTriangles = MoveTemp(Cached.PatchTriangles);
+				Island.PatchMaterialIndices = MoveTemp(Cached.PatchMaterialIndices);
+				Island.NewVertexData = MoveTemp(Cached.NewVertexData);
+				Island.FacesAdded = Cached.FacesAdded;
+				Island.bReused = true;
+				Cached.Faces.Empty();  // Consumed
+				++NumReused;
+				break;
+			}
+		}
+	}
+	CachedIslands.Empty();
+
+	// ========================================================================
+	// 4. Extract + refine changed patches concurrently
+	// ========================================================================
+	ParallelFor(Islands.Num(), [&](int32 IslandIdx)
+	{
+		FSubdivisionIsland& Island = Islands[IslandIdx];
+		if (Island.bReused)
+		{
+			return;
+		}
+
+		TMap<int32, int32> GlobalToLocal;
+		GlobalToLocal.Reserve(Island.Faces.Num());
+
+		TArray<FVector> Positions;
+		TArray<FVector2D> UVs;
+		TArray<int32> Triangles;
+		TArray<int32> MaterialIndices;
+		Triangles.Reserve(Island.Faces.Num() * 3);
+		MaterialIndices.Reserve(Island.Faces.Num());
+
+		for (int32 FaceIdx : Island.Faces)
+		{
+			int32 V[3];
+			BaseMesh.GetFaceVertices(FaceIdx, V[0], V[1], V[2]);
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				int32* LocalIdx = GlobalToLocal.Find(V[Corner]);
+				if (!LocalIdx)
+				{
+					const FHalfEdgeVertex& Vert = BaseMesh.Vertices[V[Corner]];
+					LocalIdx = &GlobalToLocal.Add(V[Corner], Positions.Num());
+					Positions.Add(Vert.Position);
+					UVs.Add(Vert.UV);
+					Island.LocalToGlobalVertex.Add(V[Corner]);
+				}
+				Triangles.Add(*LocalIdx);
+			}
+			MaterialIndices.Add(BaseMesh.Faces[FaceIdx].MaterialIndex);
+		}
+
+		const int32 NumBaseVertices = Positions.Num();
+		FHalfEdgeMesh Patch;
+		Patch.BuildFromTriangles(Positions, Triangles, UVs, MaterialIndices);
+
+		// Lock patch borders that continue into the rest of the mesh (keeps the stitch crack-free)
+		Patch.LockedHalfEdges.Init(false, Patch.GetHalfEdgeCount());
+		for (int32 LocalFace = 0; LocalFace < Island.Faces.Num(); ++LocalFace)
+		{
+			int32 LocalHE[3];
+			int32 GlobalHE[3];
+			Patch.GetFaceHalfEdges(LocalFace, LocalHE[0], LocalHE[1], LocalHE[2]);
+			BaseMesh.GetFaceHalfEdges(Island.Faces[LocalFace], GlobalHE[0], GlobalHE[1], GlobalHE[2]);
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const bool bPatchBorder =
+					Patch.GetValidTwin(LocalHE[Corner]) == -1 &&
+					Patch.GetValidSeamTwin(LocalHE[Corner]) == -1;
+				const bool bMeshInterior =
+					BaseMesh.GetValidTwin(GlobalHE[Corner]) != -1 ||
+					BaseMesh.GetValidSeamTwin(GlobalHE[Corner]) != -1;
+
+				if (bPatchBorder && bMeshInterior)
+				{
+					Patch.LockedHalfEdges[LocalHE[Corner]] = true;
+				}
+			}
+		}
+
+		if (bTargetFaceMode)
+		{
+			// Patch faces keep base mesh order, so a selected face's local index is its slot in Faces
+			TSet<int32> LocalTargetFaces;
+			LocalTargetFaces.Reserve(Island.TargetFaces.Num());
+			for (int32 FaceIdx : Island.TargetFaces)
+			{
+				LocalTargetFaces.Add(Algo::BinarySearch(Island.Faces, FaceIdx));
+			}
+
+			Island.FacesAdded = FLEBSubdivision::SubdivideSelectedFaces(
+				Patch,
+				LocalTargetFaces,
+				CurrentSettings.MaxSubdivisionLevel,
+				CurrentSettings.MinEdgeLength
+			);
+		}
+		else
+		{
+			// Rings inside an island keep their sequential order
+			for (const FSubdivisionRingParams& RingParams : Island.RingParams)
+			{
+				Island.FacesAdded += SubdivideRingRegion(Patch, RingParams);
+			}
+		}
+
+		// Resolve new patch vertices to source vertex parents here (the stitch only concatenates,
+		// so a reused island costs no half-edge rebuild or contribution tracing)
+		const int32 NumPatchVertices = Patch.GetVertexCount();
+		TArray<TMap<uint32, float>> Contributions;
+		Contributions.SetNum(NumPatchVertices);
+		for (int32 LocalVert = 0; LocalVert < NumBaseVertices; ++LocalVert)
+		{
+			Contributions[LocalVert].Add(static_cast<uint32>(Island.LocalToGlobalVertex[LocalVert]), 1.0f);
+		}
+
+		Island.NewVertexData.Reserve(NumPatchVertices - NumBaseVertices);
+		for (int32 LocalVert = NumBaseVertices; LocalVert < NumPatchVertices; ++LocalVert)
+		{
+			// Parents always precede children (midpoints are appended)
+			const FHalfEdgeVertex& Vert = Patch.Vertices[LocalVert];
+			for (const int32 Parent : { Vert.ParentIndex0, Vert.ParentIndex1 })
+			{
+				if (Parent < 0 || Parent >= LocalVert)
+				{
+					continue;
+				}
+				for (const TPair<uint32, float>& Contrib : Contributions[Parent])
+				{
+					Contributions[LocalVert].FindOrAdd(Contrib.Key) += Contrib.Value * 0.5f;
+				}
+			}
+			Island.NewVertexData.Add(MakeVertexDataFromContributions(Contributions[LocalVert], LocalVert));
+		}
+
+		Island.PatchTriangles.Reserve(Patch.GetFaceCount() * 3);
+		Island.PatchMaterialIndices.Reserve(Patch.GetFaceCount());
+		for (int32 LocalFace = 0; LocalFace < Patch.GetFaceCount(); ++LocalFace)
+		{
+			int32 V0, V1, V2;
+			Patch.GetFaceVertices(LocalFace, V0, V1, V2);
+			Island.PatchTriangles.Add(V0);
+			Island.PatchTriangles.Add(V1);
+			Island.PatchTriangles.Add(V2);
+			Island.PatchMaterialIndices.Add(Patch.Faces[LocalFace].MaterialIndex);
+		}
+	});
+
+	// ========================================================================
+	// 5. Stitch into the topology result: untouched faces + refined patches (island order)
+	// ========================================================================
+	int32 TotalNewVertices = 0;
+	int32 TotalPatchFaces = 0;
+	for (const FSubdivisionIsland& Island : Islands)
+	{
+		TotalNewVertices += Island.NewVertexData.Num();
+		TotalPatchFaces += Island.PatchMaterialIndices.Num();
+	}
+
+	OutResult.VertexData.Reserve(NumVertices + TotalNewVertices);
+	for (int32 VertIdx = 0; VertIdx < NumVertices; ++VertIdx)
+	{
+		OutResult.VertexData.Add(FSubdivisionVertexData::CreateOriginal(VertIdx));
+	}
+
+	OutResult.Indices.Reserve((NumFaces + TotalPatchFaces) * 3);
+	OutResult.TriangleMaterialIndices.Reserve(NumFaces + TotalPatchFaces);
+	for (int32 FaceIdx = 0; FaceIdx < NumFaces; ++FaceIdx)
+	{
+		if (FaceOwnerGroup[FaceIdx] == INDEX_NONE)
+		{
+			int32 V0, V1, V2;
+			BaseMesh.GetFaceVertices(FaceIdx, V0, V1, V2);
+			OutResult.Indices.Add(static_cast<uint32>(V0));
+			OutResult.Indices.Add(static_cast<uint32>(V1));
+			OutResult.Indices.Add(static_cast<uint32>(V2));
+			OutResult.TriangleMaterialIndices.Add(BaseMesh.Faces[FaceIdx].MaterialIndex);
+		}
+	}
+
+	int32 TotalFacesAdded = 0;
+	for (const FSubdivisionIsland& Island : Islands)
+	{
+		// New patch vertices -> appended in patch order
+		const int32 NumBaseVertices = Island.LocalToGlobalVertex.Num();
+		const int32 NewVertexBase = OutResult.VertexData.Num() - NumBaseVertices;
+		OutResult.VertexData.Append(Island.NewVertexData);
+
+		for (const int32 LocalVert : Island.PatchTriangles)
+		{
+			OutResult.Indices.Add(static_cast<uint32>(
+				LocalVert < NumBaseVertices ? Island.LocalToGlobalVertex[LocalVert] : NewVertexBase + LocalVert));
+		}
+		OutResult.TriangleMaterialIndices.Append(Island.PatchMaterialIndices);
+
+		TotalFacesAdded += Island.FacesAdded;
+	}
+
+	OutResult.SubdividedVertexCount = OutResult.VertexData.Num();
+	OutResult.SubdividedTriangleCount = OutResult.Indices.Num() / 3;
+
+	UE_LOG(LogFleshRingSubdivisionProcessor, Log,
+		TEXT("Subdivision islands: %d %s -> %d islands (%d reused), %d faces added"),
+		NumGroups, bTargetFaceMode ? TEXT("target faces") : TEXT("Rings"), Islands.Num(), NumReused, TotalFacesAdded);
+
+	// Keep refined patches for the next Process() (only changed islands get re-subdivided)
+	CachedIslands = MoveTemp(Islands);
+
+	return TotalFacesAdded;
 }
 
 bool FFleshRingSubdivisionProcessor::ExtractTopologyResult(FSubdivisionTopologyResult& OutResult)
@@ -562,62 +1167,7 @@ bool FFleshRingSubdivisionProcessor::ExtractTopologyResult(FSubdivisionTopologyR
 		}
 		else
 		{
-			const TMap<uint32, float>& Contribs = OriginalContributions[i];
-
-			// Sort by contribution
-			TArray<TPair<uint32, float>> SortedContribs;
-			for (const auto& C : Contribs)
-			{
-				SortedContribs.Add(TPair<uint32, float>(C.Key, C.Value));
-			}
-			SortedContribs.Sort([](const TPair<uint32, float>& A, const TPair<uint32, float>& B)
-			{
-				return A.Value > B.Value;
-			});
-
-			// Use top 3 (warn if 4 or more contributors)
-			if (SortedContribs.Num() > 3)
-			{
-				// Calculate total dropped contribution weight
-				float DroppedWeight = 0.0f;
-				for (int32 j = 3; j < SortedContribs.Num(); ++j)
-				{
-					DroppedWeight += SortedContribs[j].Value;
-				}
-
-				static int32 TruncationWarningCount = 0;
-				if (TruncationWarningCount < 10)
-				{
-					UE_LOG(LogFleshRingSubdivisionProcessor, Warning,
-						TEXT("Vertex %d has %d contributors (truncating to 3). Dropped weight: %.4f"),
-						i, SortedContribs.Num(), DroppedWeight);
-					TruncationWarningCount++;
-				}
-			}
-
-			uint32 P0 = 0, P1 = 0, P2 = 0;
-			float W0 = 0, W1 = 0, W2 = 0;
-
-			if (SortedContribs.Num() >= 1) { P0 = SortedContribs[0].Key; W0 = SortedContribs[0].Value; }
-			if (SortedContribs.Num() >= 2) { P1 = SortedContribs[1].Key; W1 = SortedContribs[1].Value; }
-			if (SortedContribs.Num() >= 3) { P2 = SortedContribs[2].Key; W2 = SortedContribs[2].Value; }
-
-			// Normalize
-			float TotalWeight = W0 + W1 + W2;
-			if (TotalWeight > 0.0f)
-			{
-				W0 /= TotalWeight;
-				W1 /= TotalWeight;
-				W2 /= TotalWeight;
-			}
-			else
-			{
-				W0 = 1.0f;
-			}
-
-			FSubdivisionVertexData Data = FSubdivisionVertexData::CreateBarycentric(
-				P0, P1, P2, FVector3f(W0, W1, W2));
-			OutResult.VertexData.Add(Data);
+			OutResult.VertexData.Add(MakeVertexDataFromContributions(OriginalContributions[i], i));
 		}
 	}
 
@@ -655,8 +1205,9 @@ bool FFleshRingSubdivisionProcessor::NeedsRecomputation(const FSubdivisionRingPa
 	// (Used for index-order comparison in SetRingParamsArray)
 	for (const FSubdivisionRingParams& CachedRingParams : CachedRingParamsArray)
 	{
-		// Skip if mode is different
-		if (CachedRingParams.bUseSDFBounds != NewRingParams.bUseSDFBounds)
+		// Skip if mode or refinement depth is different
+		if (CachedRingParams.bUseSDFBounds != NewRingParams.bUseSDFBounds ||
+			CachedRingParams.MaxSubdivisionLevel != NewRingParams.MaxSubdivisionLevel)
 		{
 			continue;
 		}
@@ -893,6 +1444,12 @@ bool FFleshRingSubdivisionProcessor::SetSourceMeshWithBoneInfo(USkeletalMesh* Sk
 
 void FFleshRingSubdivisionProcessor::SetVertexBoneInfluences(const TArray<FVertexBoneInfluence>& InInfluences)
 {
+	if (VertexBoneInfluences.Num() == InInfluences.Num() &&
+		FMemory::Memcmp(VertexBoneInfluences.GetData(), InInfluences.GetData(), InInfluences.Num() * sizeof(FVertexBoneInfluence)) == 0)
+	{
+		return;
+	}
+
 	VertexBoneInfluences = InInfluences;
 	InvalidateBoneRegionCache();
 }
@@ -9,6 +9,14 @@
 #include "ShaderParameterStruct.h"
 #include "GlobalShader.h"
 
+#if !UE_BUILD_SHIPPING
+#include "FleshRingBarycentricInterpolation.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#endif
+
 DEFINE_LOG_CATEGORY_STATIC(LogFleshRingSubdivisionShader, Log, All);
 
 // ============================================================================
@@ -435,3 +443,196 @@ bool ExecuteSubdivisionInterpolation(
 
 	return true;
 }
+
+#if !UE_BUILD_SHIPPING
+// ============================================================================
+// FleshRing.SubdivisionWeightTest - GPU vs CPU bone influence interpolation
+//
+// Usage: Enter FleshRing.SubdivisionWeightTest in console
+// Random parents share part of their bone sets in different slots, so slot-wise
+// blending or dominant-parent indices show up as mismatches against the CPU
+// kernel used by the bake (FleshRingBarycentricInterpolation::Interpolate).
+// ============================================================================
+namespace FleshRingSubdivisionWeightTest
+{
+	constexpr int32 NumSourceVertices = 64;
+	constexpr int32 NumOutputVertices = 4096;
+	constexpr int32 NumBones = 12;
+
+	static void BuildSource(FRandomStream& Random, int32 NumInfluences, FFleshRingVertexStreams& OutSource)
+	{
+		OutSource.NumBoneInfluences = NumInfluences;
+		OutSource.Positions.SetNumZeroed(NumSourceVertices);
+		OutSource.BoneIndices.SetNumZeroed(NumSourceVertices * NumInfluences);
+		OutSource.BoneWeights.SetNumZeroed(NumSourceVertices * NumInfluences);
+
+		TArray<uint16> Bones;
+		for (int32 Bone = 0; Bone < NumBones; ++Bone)
+		{
+			Bones.Add(static_cast<uint16>(Bone));
+		}
+
+		for (int32 V = 0; V < NumSourceVertices; ++V)
+		{
+			// Unique bones per vertex in shuffled slot order, trailing slots may stay empty
+			for (int32 i = Bones.Num() - 1; i > 0; --i)
+			{
+				Bones.Swap(i, Random.RandRange(0, i));
+			}
+
+			const int32 NumUsed = Random.RandRange(1, NumInfluences);
+			int32 Remaining = 255;
+			for (int32 j = 0; j < NumUsed; ++j)
+			{
+				const int32 Weight = (j == NumUsed - 1) ? Remaining : Random.RandRange(0, Remaining);
+				OutSource.BoneIndices[V * NumInfluences + j] = Bones[j];
+				OutSource.BoneWeights[V * NumInfluences + j] = static_cast<uint8>(Weight);
+				Remaining -= Weight;
+			}
+		}
+	}
+
+	static void BuildTopology(FRandomStream& Random, FSubdivisionTopologyResult& OutTopology)
+	{
+		OutTopology.VertexData.SetNum(NumOutputVertices);
+		for (int32 i = 0; i < NumOutputVertices; ++i)
+		{
+			FSubdivisionVertexData& Data = OutTopology.VertexData[i];
+			Data.ParentV0 = Random.RandRange(0, NumSourceVertices - 1);
+			Data.ParentV1 = Random.RandRange(0, NumSourceVertices - 1);
+
+			if (i % 2 == 0)
+			{
+				// Edge midpoint (V2 == V0, zero weight)
+				Data.ParentV2 = Data.ParentV0;
+				Data.BarycentricCoords = FVector3f(0.5f, 0.5f, 0.0f);
+			}
+			else
+			{
+				Data.ParentV2 = Random.RandRange(0, NumSourceVertices - 1);
+				const float U = Random.FRand();
+				const float V = Random.FRand() * (1.0f - U);
+				Data.BarycentricCoords = FVector3f(U, V, 1.0f - U - V);
+			}
+		}
+
+		OutTopology.Indices = { 0, 1, 2 };
+		OutTopology.SubdividedVertexCount = NumOutputVertices;
+		OutTopology.SubdividedTriangleCount = 1;
+	}
+}
+
+static FAutoConsoleCommand GFleshRingSubdivisionWeightTestCommand(
+	TEXT("FleshRing.SubdivisionWeightTest"),
+	TEXT("Compares GPU and CPU bone influence interpolation of subdivided vertices (per-bone merge, top-N, renormalize)"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		using namespace FleshRingSubdivisionWeightTest;
+
+		const int32 InfluenceCounts[] = { 4, 8 };
+		int32 NumFailed = 0;
+
+		for (const int32 NumInfluences : InfluenceCounts)
+		{
+			FRandomStream Random(1234 + NumInfluences);
+
+			FFleshRingVertexStreams Source;
+			BuildSource(Random, NumInfluences, Source);
+
+			FSubdivisionTopologyResult Topology;
+			BuildTopology(Random, Topology);
+
+			// CPU reference
+			FFleshRingBarycentricParents Parents;
+			Parents.Build(Topology.VertexData, NumSourceVertices);
+			FFleshRingVertexStreams CPUResult;
+			FleshRingBarycentricInterpolation::Interpolate(Source, Parents, CPUResult);
+
+			// GPU input (same layout as UFleshRingSubdivisionComponent: 0-1 float weights)
+			TArray<FVector> SourcePositions;
+			SourcePositions.SetNumZeroed(NumSourceVertices);
+			TArray<float> SourceWeights;
+			TArray<uint32> SourceIndices;
+			for (int32 i = 0; i < Source.BoneWeights.Num(); ++i)
+			{
+				SourceWeights.Add(Source.BoneWeights[i] / 255.0f);
+				SourceIndices.Add(Source.BoneIndices[i]);
+			}
+
+			const int32 NumValues = NumOutputVertices * NumInfluences;
+			TArray<float> GPUWeights;
+			TArray<uint32> GPUIndices;
+
+			ENQUEUE_RENDER_COMMAND(FleshRingSubdivisionWeightTest)(
+				[&Topology, &SourcePositions, &SourceWeights, &SourceIndices, &GPUWeights, &GPUIndices, NumInfluences, NumValues](FRHICommandListImmediate& RHICmdList)
+				{
+					FRHIGPUBufferReadback WeightReadback(TEXT("FleshRingSubdivisionWeightTest_Weights"));
+					FRHIGPUBufferReadback IndexReadback(TEXT("FleshRingSubdivisionWeightTest_Indices"));
+					{
+						FRDGBuilder GraphBuilder(RHICmdList);
+
+						FSubdivisionInterpolationParams Params;
+						Params.NumSourceVertices = NumSourceVertices;
+						Params.NumBoneInfluences = NumInfluences;
+
+						FSubdivisionGPUBuffers Buffers;
+						CreateSubdivisionGPUBuffersFromTopology(GraphBuilder, Topology, Params, Buffers);
+						UploadSourceMeshToGPU(GraphBuilder, SourcePositions, TArray<FVector>(), TArray<FVector4>(), TArray<FVector2D>(),
+							SourceWeights, SourceIndices, NumInfluences, Buffers);
+						DispatchFleshRingBarycentricInterpolationCS(GraphBuilder, Params, Buffers);
+
+						AddEnqueueCopyPass(GraphBuilder, &WeightReadback, Buffers.OutputBoneWeights, NumValues * sizeof(float));
+						AddEnqueueCopyPass(GraphBuilder, &IndexReadback, Buffers.OutputBoneIndices, NumValues * sizeof(uint32));
+						GraphBuilder.Execute();
+					}
+
+					// Test only: wait for the readback in place
+					RHICmdList.BlockUntilGPUIdle();
+
+					GPUWeights.SetNumUninitialized(NumValues);
+					GPUIndices.SetNumUninitialized(NumValues);
+					FMemory::Memcpy(GPUWeights.GetData(), WeightReadback.Lock(NumValues * sizeof(float)), NumValues * sizeof(float));
+					WeightReadback.Unlock();
+					FMemory::Memcpy(GPUIndices.GetData(), IndexReadback.Lock(NumValues * sizeof(uint32)), NumValues * sizeof(uint32));
+					IndexReadback.Unlock();
+				});
+			FlushRenderingCommands();
+
+			if (GPUWeights.Num() != NumValues || CPUResult.BoneWeights.Num() != NumValues)
+			{
+				UE_LOG(LogFleshRingSubdivisionShader, Warning, TEXT("SubdivisionWeightTest [%d influences]: readback failed"), NumInfluences);
+				++NumFailed;
+				continue;
+			}
+
+			// Slot-exact comparison: CPU and GPU must agree on bone order and quantized weight
+			int32 MismatchedVertices = 0;
+			int32 MaxWeightError = 0;
+			for (int32 V = 0; V < NumOutputVertices; ++V)
+			{
+				bool bMismatch = false;
+				for (int32 j = 0; j < NumInfluences; ++j)
+				{
+					const int32 Index = V * NumInfluences + j;
+					const int32 GPUWeight = FMath::RoundToInt(GPUWeights[Index] * 255.0f);
+					const int32 WeightError = FMath::Abs(GPUWeight - static_cast<int32>(CPUResult.BoneWeights[Index]));
+					MaxWeightError = FMath::Max(MaxWeightError, WeightError);
+
+					const bool bBoneDiffers = CPUResult.BoneWeights[Index] > 0 && GPUIndices[Index] != CPUResult.BoneIndices[Index];
+					bMismatch |= bBoneDiffers || WeightError > 0;
+				}
+				MismatchedVertices += bMismatch ? 1 : 0;
+			}
+
+			const bool bPassed = MismatchedVertices == 0;
+			NumFailed += bPassed ? 0 : 1;
+
+			UE_LOG(LogFleshRingSubdivisionShader, Display, TEXT("SubdivisionWeightTest [%d influences]: %s (mismatched vertices %d / %d, max weight error %d/255)"),
+				NumInfluences, bPassed ? TEXT("PASS") : TEXT("FAIL"), MismatchedVertices, NumOutputVertices, MaxWeightError);
+		}
+
+		const int32 NumCases = UE_ARRAY_COUNT(InfluenceCounts);
+		UE_LOG(LogFleshRingSubdivisionShader, Display, TEXT("SubdivisionWeightTest: %d / %d cases passed"), NumCases - NumFailed, NumCases);
+	})
+);
+#endif
@@ -19,6 +19,7 @@
 // Includes for asset-based testing
 #include "FleshRingComponent.h"
 #include "FleshRingAsset.h"
+#include "FleshRingRuntimeSettings.h"
 #include "EngineUtils.h"
 #include "Engine/World.h"
 #include "Engine/SkeletalMesh.h"
@@ -301,6 +302,12 @@ static FAutoConsoleCommand GFleshRingTightnessTestCommand(
     TEXT("Tests TightnessCS GPU computation using FleshRingAsset"),
     FConsoleCommandDelegate::CreateLambda([]()
     {
+        // TightnessCS is not compiled for bake-only game targets
+        if (!UFleshRingRuntimeSettings::IsDeformerAvailable())
+        {
+            return;
+        }
+
         // ============================================================
         // Step 1: Search for FleshRingComponent in World
         // ============================================================
@@ -1,9 +1,16 @@
 ﻿// Copyright 2026 LgThx. All Rights Reserved.
 
 #include "FleshRingUtils.h"
+#include "FleshRingSubdivisionProcessor.h"
+#include "ReferenceSkeleton.h"
 #include "Engine/SkeletalMesh.h"
 #include "Rendering/SkeletalMeshRenderData.h"
 #include "Rendering/SkeletalMeshLODRenderData.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#if WITH_EDITOR
+#include "Rendering/SkeletalMeshModel.h"
+#endif
 
 DEFINE_LOG_CATEGORY_STATIC(LogFleshRingUtils, Log, All);
 
@@ -101,4 +108,163 @@ namespace FleshRingUtils
 
 		return true;
 	}
+
+	uint32 HashStaticMeshGeometry(const UStaticMesh* Mesh)
+	{
+		if (!Mesh)
+		{
+			return 0;
+		}
+
+		const FBox Bounds = Mesh->GetBoundingBox();
+		const double BoundsValues[] = { Bounds.Min.X, Bounds.Min.Y, Bounds.Min.Z, Bounds.Max.X, Bounds.Max.Y, Bounds.Max.Z };
+		uint32 Hash = FCrc::MemCrc32(BoundsValues, sizeof(BoundsValues));
+
+		const FStaticMeshRenderData* RenderData = Mesh->GetRenderData();
+		if (!RenderData || RenderData->LODResources.Num() == 0)
+		{
+			return Hash;
+		}
+
+		const FStaticMeshLODResources& LODResource = RenderData->LODResources[0];
+		const FPositionVertexBuffer& PositionBuffer = LODResource.VertexBuffers.PositionVertexBuffer;
+		if (const void* PositionData = PositionBuffer.GetVertexData())
+		{
+			Hash = FCrc::MemCrc32(PositionData, PositionBuffer.GetNumVertices() * PositionBuffer.GetStride(), Hash);
+		}
+
+		TArray<uint32> Indices;
+		LODResource.IndexBuffer.GetCopy(Indices);
+		Hash = FCrc::MemCrc32(Indices.GetData(), Indices.Num() * sizeof(uint32), Hash);
+
+		return Hash;
+	}
+
+	uint32 HashSkeletalMeshGeometry(const USkeletalMesh* Mesh)
+	{
+		if (!Mesh)
+		{
+			return 0;
+		}
+
+#if WITH_EDITOR
+		if (const FSkeletalMeshModel* ImportedModel = Mesh->GetImportedModel())
+		{
+			return GetTypeHash(ImportedModel->GetIdString());
+		}
+#endif
+
+		const FBox Bounds = Mesh->GetImportedBounds().GetBox();
+		const double BoundsValues[] = { Bounds.Min.X, Bounds.Min.Y, Bounds.Min.Z, Bounds.Max.X, Bounds.Max.Y, Bounds.Max.Z };
+		uint32 Hash = FCrc::MemCrc32(BoundsValues, sizeof(BoundsValues));
+
+		const FSkeletalMeshRenderData* RenderData = Mesh->GetResourceForRendering();
+		if (!RenderData || RenderData->LODRenderData.Num() == 0)
+		{
+			return Hash;
+		}
+
+		const FSkeletalMeshLODRenderData& LODData = RenderData->LODRenderData[0];
+		const FPositionVertexBuffer& PositionBuffer = LODData.StaticVertexBuffers.PositionVertexBuffer;
+		if (const void* PositionData = PositionBuffer.GetVertexData())
+		{
+			Hash = FCrc::MemCrc32(PositionData, PositionBuffer.GetNumVertices() * PositionBuffer.GetStride(), Hash);
+		}
+
+		TArray<uint32> Indices;
+		LODData.MultiSizeIndexContainer.GetIndexBuffer(Indices);
+		Hash = FCrc::MemCrc32(Indices.GetData(), Indices.Num() * sizeof(uint32), Hash);
+
+		return Hash;
+	}
+
+	FTransform CalculateBoneTransform(
+		int32 BoneIndex,
+		const FReferenceSkeleton& RefSkeleton,
+		const TArray<FTransform>& RefBonePose)
+	{
+		if (BoneIndex == INDEX_NONE || !RefBonePose.IsValidIndex(BoneIndex))
+		{
+			return FTransform::Identity;
+		}
+
+		FTransform BoneTransform = RefBonePose[BoneIndex];
+		int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
+
+		while (ParentIndex != INDEX_NONE)
+		{
+			BoneTransform = BoneTransform * RefBonePose[ParentIndex];
+			ParentIndex = RefSkeleton.GetParentIndex(ParentIndex);
+		}
+
+		return BoneTransform;
+	}
+
+	bool GetRingSelectionBounds(
+		const FFleshRingSettings& Ring,
+		const FTransform& BoneTransform,
+		FBox& OutLocalBounds,
+		FTransform& OutLocalToComponent)
+	{
+		if (Ring.GetEffectiveInfluenceMode() == EFleshRingInfluenceMode::VirtualBand)
+		{
+			const FVirtualBandSettings Band = Ring.GetEffectiveVirtualBand();
+			const float MaxRadius = Band.GetMaxRadius() + Band.BandThickness;
+			const float HalfBand = Band.BandHeight * 0.5f;
+			OutLocalBounds = FBox(
+				FVector(-MaxRadius, -MaxRadius, -(HalfBand + Band.Lower.Height)),
+				FVector(MaxRadius, MaxRadius, HalfBand + Band.Upper.Height));
+			OutLocalToComponent = FTransform(Band.BandRotation, Band.BandOffset) * BoneTransform;
+			return true;
+		}
+
+		if (Ring.InfluenceMode != EFleshRingInfluenceMode::MeshBased || Ring.RingMesh.IsNull())
+		{
+			return false;
+		}
+
+		UStaticMesh* RingMesh = Ring.RingMesh.LoadSynchronous();
+		if (!RingMesh)
+		{
+			return false;
+		}
+
+		OutLocalBounds = RingMesh->GetBoundingBox();
+
+		FTransform MeshTransform(Ring.MeshRotation, Ring.MeshOffset);
+		MeshTransform.SetScale3D(Ring.MeshScale);
+		OutLocalToComponent = MeshTransform * BoneTransform;
+		return true;
+	}
+
+	FRingSelectionVolume ResolveRingSelectionVolume(const FFleshRingSettings& Ring, const FTransform& BoneTransform)
+	{
+		FRingSelectionVolume Volume;
+		Volume.Ring = Ring;
+		Volume.BoneTransform = BoneTransform;
+		Volume.bBoundsBased = GetRingSelectionBounds(Ring, BoneTransform, Volume.LocalBounds, Volume.LocalToComponent);
+		return Volume;
+	}
+
+	void MakeSubdivisionRingParams(const FRingSelectionVolume& Volume, FSubdivisionRingParams& OutRingParams)
+	{
+		if (Volume.bBoundsBased)
+		{
+			OutRingParams.bUseSDFBounds = true;
+			OutRingParams.SDFBoundsMin = FVector(Volume.LocalBounds.Min);
+			OutRingParams.SDFBoundsMax = FVector(Volume.LocalBounds.Max);
+			OutRingParams.SDFLocalToComponent = Volume.LocalToComponent;
+			return;
+		}
+
+		// VirtualRing: torus in the Ring frame (same frame SelectAffectedVertices uses for the bake)
+		const FFleshRingSettings& Ring = Volume.Ring;
+		const FTransform RingTransform = FTransform(Ring.RingRotation, Ring.RingRotation.RotateVector(Ring.RingOffset)) * Volume.BoneTransform;
+
+		OutRingParams.bUseSDFBounds = false;
+		OutRingParams.Center = RingTransform.GetLocation();
+		OutRingParams.Axis = RingTransform.GetRotation().RotateVector(FVector::UpVector);
+		OutRingParams.Radius = Ring.RingRadius;
+		OutRingParams.Width = Ring.RingHeight;
+	}
 }
@@ -91,4 +91,69 @@ void GenerateWireframeLines(
 	}
 }
 
+void GenerateBandTriangles(
+	const FVirtualBandSettings& Settings,
+	TArray<FVector3f>& OutVertices,
+	TArray<uint32>& OutIndices,
+	int32 NumSegments,
+	int32 NumHeightSteps)
+{
+	OutVertices.Reset();
+	OutIndices.Reset();
+
+	NumSegments = FMath::Max(NumSegments, 3);
+	NumHeightSteps = FMath::Max(NumHeightSteps, 1);
+
+	// Coordinate system: Z=0 is the center of the Mid Band
+	const float MidOffset = Settings.GetMidOffset();
+	const float TotalHeight = Settings.GetTotalHeight();
+	const float Thickness = FMath::Max(Settings.BandThickness, KINDA_SMALL_NUMBER);
+
+	// Vertex layout: [Ring][Segment], inner surface rings first, then outer surface rings
+	const int32 NumRings = NumHeightSteps + 1;
+	OutVertices.Reserve(NumRings * NumSegments * 2);
+
+	for (int32 Surface = 0; Surface < 2; Surface++)
+	{
+		for (int32 h = 0; h < NumRings; h++)
+		{
+			const float Z = TotalHeight * h / NumHeightSteps - MidOffset;
+			const float Radius = Settings.GetRadiusAtHeight(Z) + (Surface == 1 ? Thickness : 0.0f);
+
+			for (int32 i = 0; i < NumSegments; i++)
+			{
+				const float Angle = 2.0f * PI * i / NumSegments;
+				OutVertices.Add(FVector3f(Radius * FMath::Cos(Angle), Radius * FMath::Sin(Angle), Z));
+			}
+		}
+	}
+
+	auto VertexIndex = [NumRings, NumSegments](int32 Surface, int32 Ring, int32 Segment)
+	{
+		return static_cast<uint32>((Surface * NumRings + Ring) * NumSegments + (Segment % NumSegments));
+	};
+
+	auto AddQuad = [&OutIndices](uint32 A, uint32 B, uint32 C, uint32 D)
+	{
+		OutIndices.Append({ A, B, C, A, C, D });
+	};
+
+	// Inner and outer walls (inner wall wound inward, outer wall outward)
+	for (int32 h = 0; h < NumHeightSteps; h++)
+	{
+		for (int32 i = 0; i < NumSegments; i++)
+		{
+			AddQuad(VertexIndex(0, h, i), VertexIndex(0, h + 1, i), VertexIndex(0, h + 1, i + 1), VertexIndex(0, h, i + 1));
+			AddQuad(VertexIndex(1, h, i), VertexIndex(1, h, i + 1), VertexIndex(1, h + 1, i + 1), VertexIndex(1, h + 1, i));
+		}
+	}
+
+	// Annular caps (bottom faces -Z, top faces +Z)
+	for (int32 i = 0; i < NumSegments; i++)
+	{
+		AddQuad(VertexIndex(0, 0, i), VertexIndex(0, 0, i + 1), VertexIndex(1, 0, i + 1), VertexIndex(1, 0, i));
+		AddQuad(VertexIndex(0, NumHeightSteps, i), VertexIndex(1, NumHeightSteps, i), VertexIndex(1, NumHeightSteps, i + 1), VertexIndex(0, NumHeightSteps, i + 1));
+	}
+}
+
 } // namespace FleshRingVirtualBandMesh
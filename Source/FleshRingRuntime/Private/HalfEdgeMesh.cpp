@@ -1,9 +1,10 @@
 ﻿// Copyright 2026 LgThx. All Rights Reserved.
 
 // HalfEdgeMesh.cpp
-// Implementation of Half-Edge mesh and Red-Green adaptive subdivision
+// Implementation of Half-Edge mesh and in-place LEB adaptive subdivision
 
 #include "HalfEdgeMesh.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHalfEdgeMesh, Log, All);
 
@@ -11,6 +12,58 @@ DEFINE_LOG_CATEGORY_STATIC(LogHalfEdgeMesh, Log, All);
 // FHalfEdgeMesh Implementation
 //=============================================================================
 
+namespace
+{
+	// Faces per ParallelFor task during construction
+	constexpr int32 BuildFaceChunkSize = 4096;
+
+	/**
+	 * Stable LSD radix sort of (edge key, half-edge index) pairs
+	 * Only the bits actually used by the keys are processed
+	 */
+	void RadixSortEdgeKeys(TArray<uint64>& Keys, TArray<int32>& Values, int32 KeyBits)
+	{
+		constexpr int32 DigitBits = 11;
+		constexpr int32 NumBuckets = 1 << DigitBits;
+		const int32 Num = Keys.Num();
+
+		TArray<uint64> TempKeys;
+		TArray<int32> TempValues;
+		TempKeys.SetNumUninitialized(Num);
+		TempValues.SetNumUninitialized(Num);
+
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumBuckets);
+
+		for (int32 Shift = 0; Shift < KeyBits; Shift += DigitBits)
+		{
+			FMemory::Memzero(Offsets.GetData(), NumBuckets * sizeof(int32));
+			for (int32 i = 0; i < Num; i++)
+			{
+				Offsets[(Keys[i] >> Shift) & (NumBuckets - 1)]++;
+			}
+
+			int32 Sum = 0;
+			for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+			{
+				const int32 Count = Offsets[Bucket];
+				Offsets[Bucket] = Sum;
+				Sum += Count;
+			}
+
+			for (int32 i = 0; i < Num; i++)
+			{
+				const int32 Dst = Offsets[(Keys[i] >> Shift) & (NumBuckets - 1)]++;
+				TempKeys[Dst] = Keys[i];
+				TempValues[Dst] = Values[i];
+			}
+
+			Swap(Keys, TempKeys);
+			Swap(Values, TempValues);
+		}
+	}
+}
+
 bool FHalfEdgeMesh::BuildFromTriangles(
 	const TArray<FVector>& InVertices,
 	const TArray<int32>& InTriangles,
@@ -27,10 +80,11 @@ bool FHalfEdgeMesh::BuildFromTriangles(
 	}
 
 	// Copy vertices with optional parent info
-	Vertices.Reserve(InVertices.Num());
-	for (int32 i = 0; i < InVertices.Num(); i++)
+	const int32 NumVertices = InVertices.Num();
+	Vertices.SetNum(NumVertices);
+	ParallelFor(NumVertices, [&](int32 i)
 	{
-		FHalfEdgeVertex Vert;
+		FHalfEdgeVertex& Vert = Vertices[i];
 		Vert.Position = InVertices[i];
 		Vert.UV = InUVs.IsValidIndex(i) ? InUVs[i] : FVector2D::ZeroVector;
 		Vert.HalfEdgeIndex = -1;
@@ -41,109 +95,173 @@ bool FHalfEdgeMesh::BuildFromTriangles(
 			Vert.ParentIndex0 = (*InParentIndices)[i].Key;
 			Vert.ParentIndex1 = (*InParentIndices)[i].Value;
 		}
+	}, NumVertices < BuildFaceChunkSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-		Vertices.Add(Vert);
-	}
-
-	int32 NumFaces = InTriangles.Num() / 3;
-	Faces.Reserve(NumFaces);
-	HalfEdges.Reserve(NumFaces * 3);
-	EdgeToHalfEdge.Reserve(NumFaces * 3);
+	// 1. Validate faces and compact (invalid faces are skipped, output face index = prefix sum)
+	const int32 NumInputFaces = InTriangles.Num() / 3;
+	TArray<int32> OutputFaceIndex;
+	OutputFaceIndex.SetNumUninitialized(NumInputFaces);
 
-	// Create faces and half-edges
-	for (int32 FaceIdx = 0; FaceIdx < NumFaces; FaceIdx++)
+	int32 NumFaces = 0;
+	for (int32 FaceIdx = 0; FaceIdx < NumInputFaces; FaceIdx++)
 	{
-		int32 BaseIdx = FaceIdx * 3;
-		int32 V0 = InTriangles[BaseIdx];
-		int32 V1 = InTriangles[BaseIdx + 1];
-		int32 V2 = InTriangles[BaseIdx + 2];
-
-		if (V0 < 0 || V0 >= Vertices.Num() ||
-			V1 < 0 || V1 >= Vertices.Num() ||
-			V2 < 0 || V2 >= Vertices.Num())
+		const int32 BaseIdx = FaceIdx * 3;
+		const int32 V0 = InTriangles[BaseIdx];
+		const int32 V1 = InTriangles[BaseIdx + 1];
+		const int32 V2 = InTriangles[BaseIdx + 2];
+
+		if (V0 < 0 || V0 >= NumVertices ||
+			V1 < 0 || V1 >= NumVertices ||
+			V2 < 0 || V2 >= NumVertices)
 		{
 			UE_LOG(LogHalfEdgeMesh, Error, TEXT("HalfEdgeMesh: Invalid vertex index in face %d"), FaceIdx);
+			OutputFaceIndex[FaceIdx] = -1;
 			continue;
 		}
 
-		FHalfEdgeFace Face;
-		Face.HalfEdgeIndex = HalfEdges.Num();
-		Face.SubdivisionLevel = 0;
-		Face.MaterialIndex = InMaterialIndices.IsValidIndex(FaceIdx) ? InMaterialIndices[FaceIdx] : 0;
-		int32 NewFaceIdx = Faces.Add(Face);
-
-		int32 HE0 = HalfEdges.Num();
-		int32 HE1 = HE0 + 1;
-		int32 HE2 = HE0 + 2;
-
-		FHalfEdge Edge0, Edge1, Edge2;
-
-		Edge0.VertexIndex = V1;
-		Edge0.NextIndex = HE1;
-		Edge0.PrevIndex = HE2;
-		Edge0.FaceIndex = NewFaceIdx;
-		Edge0.TwinIndex = -1;
-
-		Edge1.VertexIndex = V2;
-		Edge1.NextIndex = HE2;
-		Edge1.PrevIndex = HE0;
-		Edge1.FaceIndex = NewFaceIdx;
-		Edge1.TwinIndex = -1;
-
-		Edge2.VertexIndex = V0;
-		Edge2.NextIndex = HE0;
-		Edge2.PrevIndex = HE1;
-		Edge2.FaceIndex = NewFaceIdx;
-		Edge2.TwinIndex = -1;
-
-		HalfEdges.Add(Edge0);
-		HalfEdges.Add(Edge1);
-		HalfEdges.Add(Edge2);
-
-		if (Vertices[V0].HalfEdgeIndex == -1) Vertices[V0].HalfEdgeIndex = HE0;
-		if (Vertices[V1].HalfEdgeIndex == -1) Vertices[V1].HalfEdgeIndex = HE1;
-		if (Vertices[V2].HalfEdgeIndex == -1) Vertices[V2].HalfEdgeIndex = HE2;
-
-		auto MakeEdgeKey = [](int32 A, int32 B) -> TPair<int32, int32>
+		OutputFaceIndex[FaceIdx] = NumFaces++;
+	}
+
+	Faces.SetNum(NumFaces);
+	HalfEdges.SetNum(NumFaces * 3);
+
+	// 2. Create faces, half-edges and undirected edge keys (parallel over face chunks)
+	// Key = min * NumVertices + max, so twins share a key regardless of direction
+	TArray<uint64> EdgeKeys;
+	TArray<int32> EdgeHalfEdges;
+	EdgeKeys.SetNumUninitialized(NumFaces * 3);
+	EdgeHalfEdges.SetNumUninitialized(NumFaces * 3);
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumInputFaces, BuildFaceChunkSize);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 ChunkStart = ChunkIdx * BuildFaceChunkSize;
+		const int32 ChunkEnd = FMath::Min(ChunkStart + BuildFaceChunkSize, NumInputFaces);
+
+		for (int32 FaceIdx = ChunkStart; FaceIdx < ChunkEnd; FaceIdx++)
 		{
-			return A < B ? TPair<int32, int32>(A, B) : TPair<int32, int32>(B, A);
-		};
+			const int32 NewFaceIdx = OutputFaceIndex[FaceIdx];
+			if (NewFaceIdx < 0)
+			{
+				continue;
+			}
+
+			const int32 FaceVerts[3] = { InTriangles[FaceIdx * 3], InTriangles[FaceIdx * 3 + 1], InTriangles[FaceIdx * 3 + 2] };
+			const int32 HE0 = NewFaceIdx * 3;
+
+			FHalfEdgeFace& Face = Faces[NewFaceIdx];
+			Face.HalfEdgeIndex = HE0;
+			Face.SubdivisionLevel = 0;
+			Face.MaterialIndex = InMaterialIndices.IsValidIndex(FaceIdx) ? InMaterialIndices[FaceIdx] : 0;
+
+			// HE(i): FaceVerts[i] -> FaceVerts[(i+1)%3]
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const int32 HEIdx = HE0 + Corner;
+				const int32 From = FaceVerts[Corner];
+				const int32 To = FaceVerts[(Corner + 1) % 3];
+
+				FHalfEdge& Edge = HalfEdges[HEIdx];
+				Edge.VertexIndex = To;
+				Edge.NextIndex = HE0 + (Corner + 1) % 3;
+				Edge.PrevIndex = HE0 + (Corner + 2) % 3;
+				Edge.FaceIndex = NewFaceIdx;
+				Edge.TwinIndex = -1;
 
-		TPair<int32, int32> Key01 = MakeEdgeKey(V0, V1);
-		if (int32* ExistingHE = EdgeToHalfEdge.Find(Key01))
+				EdgeKeys[HEIdx] = static_cast<uint64>(FMath::Min(From, To)) * NumVertices + FMath::Max(From, To);
+				EdgeHalfEdges[HEIdx] = HEIdx;
+			}
+		}
+	});
+
+	// Outgoing half-edge per vertex (first face wins, same as sequential construction)
+	for (int32 HEIdx = 0; HEIdx < HalfEdges.Num(); HEIdx++)
+	{
+		const int32 FromVertex = HalfEdges[HalfEdges[HEIdx].PrevIndex].VertexIndex;
+		if (Vertices[FromVertex].HalfEdgeIndex == -1)
 		{
-			HalfEdges[HE0].TwinIndex = *ExistingHE;
-			HalfEdges[*ExistingHE].TwinIndex = HE0;
+			Vertices[FromVertex].HalfEdgeIndex = HEIdx;
 		}
-		else
+	}
+
+	// 3. Sort by edge key (stable, so equal keys stay in face order)
+	const uint64 MaxKey = static_cast<uint64>(NumVertices) * NumVertices;
+	int32 KeyBits = 1;
+	while (KeyBits < 64 && (MaxKey >> KeyBits) != 0)
+	{
+		KeyBits++;
+	}
+	RadixSortEdgeKeys(EdgeKeys, EdgeHalfEdges, KeyBits);
+
+	// 4. Pair twins in one linear pass: each run of equal keys is handled by its first element
+	// Non-manifold edges (3+ half-edges) pair the first two, the rest stay boundary
+	const int32 NumEdgeKeys = EdgeKeys.Num();
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 ChunkStart = FMath::Min(ChunkIdx * BuildFaceChunkSize * 3, NumEdgeKeys);
+		const int32 ChunkEnd = FMath::Min(ChunkStart + BuildFaceChunkSize * 3, NumEdgeKeys);
+
+		for (int32 i = ChunkStart; i < ChunkEnd; i++)
 		{
-			EdgeToHalfEdge.Add(Key01, HE0);
+			const bool bRunStart = (i == 0) || (EdgeKeys[i - 1] != EdgeKeys[i]);
+			if (bRunStart && i + 1 < NumEdgeKeys && EdgeKeys[i + 1] == EdgeKeys[i])
+			{
+				const int32 HEA = EdgeHalfEdges[i];
+				const int32 HEB = EdgeHalfEdges[i + 1];
+				HalfEdges[HEA].TwinIndex = HEB;
+				HalfEdges[HEB].TwinIndex = HEA;
+			}
 		}
+	});
+
+	LinkSeamTwins();
+
+	return true;
+}
 
-		TPair<int32, int32> Key12 = MakeEdgeKey(V1, V2);
-		if (int32* ExistingHE = EdgeToHalfEdge.Find(Key12))
+void FHalfEdgeMesh::LinkSeamTwins()
+{
+	// Same weld precision as the former position-based midpoint detection
+	constexpr float SeamWeldPrecision = 0.1f;
+
+	auto PositionToKey = [SeamWeldPrecision](const FVector& Pos) -> FIntVector
+	{
+		return FIntVector(
+			FMath::RoundToInt(Pos.X / SeamWeldPrecision),
+			FMath::RoundToInt(Pos.Y / SeamWeldPrecision),
+			FMath::RoundToInt(Pos.Z / SeamWeldPrecision)
+		);
+	};
+
+	// Directed (start, end) position key -> boundary half-edge
+	// Only boundary half-edges are hashed (UV seams + open borders, small compared to the mesh)
+	TMap<TPair<FIntVector, FIntVector>, int32> BoundaryEdges;
+	for (int32 HEIdx = 0; HEIdx < HalfEdges.Num(); HEIdx++)
+	{
+		const FHalfEdge& HE = HalfEdges[HEIdx];
+		if (!HE.IsBoundary())
 		{
-			HalfEdges[HE1].TwinIndex = *ExistingHE;
-			HalfEdges[*ExistingHE].TwinIndex = HE1;
+			continue;
 		}
-		else
+
+		const FIntVector StartKey = PositionToKey(Vertices[HalfEdges[HE.PrevIndex].VertexIndex].Position);
+		const FIntVector EndKey = PositionToKey(Vertices[HE.VertexIndex].Position);
+		if (StartKey == EndKey)
 		{
-			EdgeToHalfEdge.Add(Key12, HE1);
+			continue;
 		}
 
-		TPair<int32, int32> Key20 = MakeEdgeKey(V2, V0);
-		if (int32* ExistingHE = EdgeToHalfEdge.Find(Key20))
+		if (int32* Opposite = BoundaryEdges.Find(TPair<FIntVector, FIntVector>(EndKey, StartKey)))
 		{
-			HalfEdges[HE2].TwinIndex = *ExistingHE;
-			HalfEdges[*ExistingHE].TwinIndex = HE2;
+			HalfEdges[HEIdx].SeamTwinIndex = *Opposite;
+			HalfEdges[*Opposite].SeamTwinIndex = HEIdx;
+			BoundaryEdges.Remove(TPair<FIntVector, FIntVector>(EndKey, StartKey));
 		}
 		else
 		{
-			EdgeToHalfEdge.Add(Key20, HE2);
+			BoundaryEdges.Add(TPair<FIntVector, FIntVector>(StartKey, EndKey), HEIdx);
 		}
 	}
-
-	return true;
 }
 
 void FHalfEdgeMesh::ExportToTriangles(TArray<FVector>& OutVertices, TArray<int32>& OutTriangles, TArray<FVector2D>& OutUVs, TArray<FVector>& OutNormals, TArray<int32>& OutMaterialIndices) const
@@ -355,1639 +473,488 @@ void FHalfEdgeMesh::Clear()
 	Vertices.Empty();
 	HalfEdges.Empty();
 	Faces.Empty();
-	EdgeToHalfEdge.Empty();
+	LockedHalfEdges.Empty();
 }
 
 //=============================================================================
-// FLEBSubdivision - Red-Green Refinement Implementation
+// FLEBSubdivision - In-place Longest Edge Bisection
 //=============================================================================
 
-int32 FLEBSubdivision::SubdivideRegion(
-	FHalfEdgeMesh& Mesh,
-	const FTorusParams& Torus,
-	int32 MaxLevel,
-	float MinEdgeLength)
+namespace
 {
-	// Extract torus parameters
-	const FVector& TorusCenter = Torus.Center;
-	FVector TorusAxis = Torus.Axis.GetSafeNormal();
-	if (TorusAxis.IsNearlyZero()) TorusAxis = FVector(0, 1, 0);
-
-	float TorusMajorRadius = Torus.MajorRadius;
-	float TorusMinorRadius = Torus.MinorRadius;
-	float InfluenceMargin = Torus.InfluenceMargin;
-
-	// Step 1: Export current mesh to simple triangle format
-	TArray<FVector> Positions;
-	TArray<FVector2D> UVs;
-	TArray<int32> Triangles;
-	TArray<int32> MaterialIndices;  // Per-triangle material index
-	TArray<TPair<int32, int32>> ParentIndices;  // Per-vertex parent info
-
-	Positions.Reserve(Mesh.Vertices.Num());
-	UVs.Reserve(Mesh.Vertices.Num());
-	ParentIndices.Reserve(Mesh.Vertices.Num());
-	for (const FHalfEdgeVertex& V : Mesh.Vertices)
-	{
-		Positions.Add(V.Position);
-		UVs.Add(V.UV);
-		// Preserve parent info (for multi-level Subdivision)
-		// Original vertex: INDEX_NONE, previous level generated vertex: preserve parent indices
-		ParentIndices.Add(TPair<int32, int32>(V.ParentIndex0, V.ParentIndex1));
-	}
+	// Bisections per marked face per level (two bisections ~ one 1-to-4 split)
+	constexpr int32 BisectionsPerLevel = 2;
 
-	for (int32 FaceIdx = 0; FaceIdx < Mesh.Faces.Num(); FaceIdx++)
+	// Neighbor edge within this ratio of the neighbor's longest edge counts as its longest (tie tolerance)
+	constexpr float LongestEdgeTolerance = 1.0001f;
+
+	// LEPP chain depth guard (chain lengths strictly increase, so this only trips on degenerate input)
+	constexpr int32 MaxLEPPDepth = 64;
+
+	// Face region test: vertices, edge midpoints, centroid (same sampling as before in-place refinement)
+	template<typename PointPredicateType>
+	bool IsFaceInRegion(const FHalfEdgeMesh& Mesh, int32 FaceIndex, const PointPredicateType& IsPointInRegion)
 	{
 		int32 V0, V1, V2;
-		Mesh.GetFaceVertices(FaceIdx, V0, V1, V2);
-		if (V0 >= 0 && V1 >= 0 && V2 >= 0)
+		Mesh.GetFaceVertices(FaceIndex, V0, V1, V2);
+		if (V0 < 0 || V1 < 0 || V2 < 0)
 		{
-			Triangles.Add(V0);
-			Triangles.Add(V1);
-			Triangles.Add(V2);
-			MaterialIndices.Add(Mesh.Faces[FaceIdx].MaterialIndex);
+			return false;
 		}
-	}
-
-	int32 InitialTriCount = Triangles.Num() / 3;
-
-	// ============================================================================
-	// Dual Midpoint Map System - Torus Version
-	// ============================================================================
-	constexpr float MidpointWeldPrecision = 0.1f;
 
-	auto PositionToKey = [MidpointWeldPrecision](const FVector& Pos) -> FIntVector
-	{
-		return FIntVector(
-			FMath::RoundToInt(Pos.X / MidpointWeldPrecision),
-			FMath::RoundToInt(Pos.Y / MidpointWeldPrecision),
-			FMath::RoundToInt(Pos.Z / MidpointWeldPrecision)
-		);
-	};
-
-	auto IntVectorLess = [](const FIntVector& A, const FIntVector& B) -> bool
-	{
-		if (A.X != B.X) return A.X < B.X;
-		if (A.Y != B.Y) return A.Y < B.Y;
-		return A.Z < B.Z;
-	};
+		const FVector& P0 = Mesh.Vertices[V0].Position;
+		const FVector& P1 = Mesh.Vertices[V1].Position;
+		const FVector& P2 = Mesh.Vertices[V2].Position;
 
-	// 1. Position-based: For GREEN split detection
-	TSet<TPair<FIntVector, FIntVector>> PositionMidpointSet;
-
-	auto MakePositionKey = [&](int32 VA, int32 VB) -> TPair<FIntVector, FIntVector>
-	{
-		FIntVector KeyA = PositionToKey(Positions[VA]);
-		FIntVector KeyB = PositionToKey(Positions[VB]);
-		if (IntVectorLess(KeyA, KeyB))
-			return TPair<FIntVector, FIntVector>(KeyA, KeyB);
-		else
-			return TPair<FIntVector, FIntVector>(KeyB, KeyA);
-	};
-
-	// 2. Index-based: For vertex reuse (UV preservation)
-	TMap<TPair<int32, int32>, int32> IndexMidpointMap;
-
-	auto MakeIndexKey = [](int32 A, int32 B) -> TPair<int32, int32>
-	{
-		return A < B ? TPair<int32, int32>(A, B) : TPair<int32, int32>(B, A);
-	};
+		return IsPointInRegion(P0) || IsPointInRegion(P1) || IsPointInRegion(P2) ||
+			IsPointInRegion((P0 + P1) * 0.5f) || IsPointInRegion((P1 + P2) * 0.5f) || IsPointInRegion((P2 + P0) * 0.5f) ||
+			IsPointInRegion((P0 + P1 + P2) / 3.0f);
+	}
 
-	auto GetOrCreateMidpoint = [&](int32 VA, int32 VB) -> int32
+	float GetMaxEdgeLength(const FHalfEdgeMesh& Mesh, int32 FaceIndex)
 	{
-		TPair<int32, int32> IndexKey = MakeIndexKey(VA, VB);
-		if (int32* Existing = IndexMidpointMap.Find(IndexKey))
+		int32 HE0, HE1, HE2;
+		Mesh.GetFaceHalfEdges(FaceIndex, HE0, HE1, HE2);
+		if (HE0 < 0 || HE1 < 0 || HE2 < 0)
 		{
-			return *Existing;
+			return 0.0f;
 		}
+		return FMath::Max3(Mesh.GetEdgeLength(HE0), Mesh.GetEdgeLength(HE1), Mesh.GetEdgeLength(HE2));
+	}
 
-		int32 NewIdx = Positions.Num();
-		Positions.Add((Positions[VA] + Positions[VB]) * 0.5f);
-		UVs.Add((UVs[VA] + UVs[VB]) * 0.5f);
-		ParentIndices.Add(TPair<int32, int32>(VA, VB));
-
-		IndexMidpointMap.Add(IndexKey, NewIdx);
-		PositionMidpointSet.Add(MakePositionKey(VA, VB));
-		return NewIdx;
-	};
-
-	auto HasMidpointAtEdge = [&](int32 VA, int32 VB) -> bool
-	{
-		return PositionMidpointSet.Contains(MakePositionKey(VA, VB));
-	};
-
-	// Torus SDF helper - returns signed distance to torus surface
-	// Uses arbitrary axis direction
-	auto TorusSDF = [&](const FVector& P) -> float
-	{
-		FVector ToP = P - TorusCenter;
-		// Project onto axis to get axial distance
-		float AxisDist = FVector::DotProduct(ToP, TorusAxis);
-		// Get radial vector (perpendicular to axis)
-		FVector RadialVec = ToP - (AxisDist * TorusAxis);
-		float RadialDist = RadialVec.Size();
-
-		// 2D distance to tube center line
-		FVector2D Q(RadialDist - TorusMajorRadius, AxisDist);
-		return Q.Size() - TorusMinorRadius;
-	};
-
-	// Check if point is in influence region (near torus surface)
-	auto IsInInfluenceRegion = [&](const FVector& P) -> bool
-	{
-		float SDF = TorusSDF(P);
-		return SDF <= InfluenceMargin;
-	};
-
-	// Perform multiple levels of subdivision
-	for (int32 Level = 0; Level < MaxLevel; Level++)
+	// Longest half-edge of a face that refinement may split (-1 if all are locked)
+	int32 GetLongestUnlockedEdge(const FHalfEdgeMesh& Mesh, int32 FaceIndex)
 	{
-		TArray<int32> NewTriangles;
-		TArray<int32> NewMaterialIndices;
-		NewTriangles.Reserve(Triangles.Num() * 4);
-		NewMaterialIndices.Reserve(MaterialIndices.Num() * 4);
-
-		int32 NumTris = Triangles.Num() / 3;
-		TArray<bool> TriNeedsRedSplit;
-		TriNeedsRedSplit.SetNumZeroed(NumTris);
-
-		// ========================================================================
-		// Optimization: Per-vertex region check caching (Torus)
-		// Even if the same vertex is shared by multiple triangles, check only once
-		// ========================================================================
-		const int32 NumPositions = Positions.Num();
-		TArray<int8> VertexInRegionCache;  // -1: unchecked, 0: outside, 1: inside
-		VertexInRegionCache.SetNumUninitialized(NumPositions);
-		FMemory::Memset(VertexInRegionCache.GetData(), -1, NumPositions);
-
-		// Cached vertex region check lambda
-		auto IsVertexInRegionCached = [&](int32 VertexIndex) -> bool
+		if (Mesh.LockedHalfEdges.Num() == 0)
 		{
-			if (VertexInRegionCache[VertexIndex] == -1)
-			{
-				VertexInRegionCache[VertexIndex] = IsInInfluenceRegion(Positions[VertexIndex]) ? 1 : 0;
-			}
-			return VertexInRegionCache[VertexIndex] == 1;
-		};
-
-		// Phase 1: Mark triangles that need RED split (4-way, in region)
-		for (int32 i = 0; i < NumTris; i++)
-		{
-			int32 V0 = Triangles[i * 3];
-			int32 V1 = Triangles[i * 3 + 1];
-			int32 V2 = Triangles[i * 3 + 2];
-
-			// Optimization: Use cached vertex checks
-			bool bInRegion = false;
-			if (IsVertexInRegionCached(V0)) bInRegion = true;
-			else if (IsVertexInRegionCached(V1)) bInRegion = true;
-			else if (IsVertexInRegionCached(V2)) bInRegion = true;
-			else
-			{
-				// Edge midpoints check (cannot cache - new positions each time)
-				const FVector& P0 = Positions[V0];
-				const FVector& P1 = Positions[V1];
-				const FVector& P2 = Positions[V2];
-
-				FVector Mid01 = (P0 + P1) * 0.5f;
-				FVector Mid12 = (P1 + P2) * 0.5f;
-				FVector Mid20 = (P2 + P0) * 0.5f;
-
-				if (IsInInfluenceRegion(Mid01)) bInRegion = true;
-				else if (IsInInfluenceRegion(Mid12)) bInRegion = true;
-				else if (IsInInfluenceRegion(Mid20)) bInRegion = true;
-				else
-				{
-					// Centroid check
-					FVector Center = (P0 + P1 + P2) / 3.0f;
-					if (IsInInfluenceRegion(Center)) bInRegion = true;
-				}
-			}
-
-			if (!bInRegion) continue;
-
-			// Check minimum edge length
-			const FVector& P0 = Positions[V0];
-			const FVector& P1 = Positions[V1];
-			const FVector& P2 = Positions[V2];
-
-			float MaxEdgeLen = FMath::Max3(
-				FVector::Dist(P0, P1),
-				FVector::Dist(P1, P2),
-				FVector::Dist(P2, P0)
-			);
-
-			if (MaxEdgeLen >= MinEdgeLength)
-			{
-				TriNeedsRedSplit[i] = true;
-			}
+			return Mesh.GetLongestEdge(FaceIndex);
 		}
 
-		// Phase 2: Do RED splits (creates midpoints)
-		for (int32 i = 0; i < NumTris; i++)
-		{
-			int32 V0 = Triangles[i * 3];
-			int32 V1 = Triangles[i * 3 + 1];
-			int32 V2 = Triangles[i * 3 + 2];
-			int32 MatIdx = MaterialIndices.IsValidIndex(i) ? MaterialIndices[i] : 0;
+		int32 FaceHalfEdges[3];
+		Mesh.GetFaceHalfEdges(FaceIndex, FaceHalfEdges[0], FaceHalfEdges[1], FaceHalfEdges[2]);
 
-			if (TriNeedsRedSplit[i])
+		int32 Longest = -1;
+		float LongestLength = -1.0f;
+		for (int32 HalfEdge : FaceHalfEdges)
+		{
+			if (HalfEdge < 0 || Mesh.IsHalfEdgeLocked(HalfEdge))
 			{
-				// RED: Split into 4 triangles (all inherit parent's material)
-				int32 M01 = GetOrCreateMidpoint(V0, V1);
-				int32 M12 = GetOrCreateMidpoint(V1, V2);
-				int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-				// Triangle 1: V0, M01, M20
-				NewTriangles.Add(V0); NewTriangles.Add(M01); NewTriangles.Add(M20);
-				NewMaterialIndices.Add(MatIdx);
-
-				// Triangle 2: M01, V1, M12
-				NewTriangles.Add(M01); NewTriangles.Add(V1); NewTriangles.Add(M12);
-				NewMaterialIndices.Add(MatIdx);
-
-				// Triangle 3: M20, M12, V2
-				NewTriangles.Add(M20); NewTriangles.Add(M12); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
-
-				// Triangle 4: M01, M12, M20 (center)
-				NewTriangles.Add(M01); NewTriangles.Add(M12); NewTriangles.Add(M20);
-				NewMaterialIndices.Add(MatIdx);
+				continue;
 			}
-			else
+			const float Length = Mesh.GetEdgeLength(HalfEdge);
+			if (Length > LongestLength)
 			{
-				// Keep original triangle for now (may be GREEN split later)
-				NewTriangles.Add(V0); NewTriangles.Add(V1); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
+				Longest = HalfEdge;
+				LongestLength = Length;
 			}
 		}
+		return Longest;
+	}
 
-		// Phase 3: GREEN splits - fix T-junctions (Dual Map System)
-		TArray<int32> FinalTriangles;
-		TArray<int32> FinalMaterialIndices;
-		FinalTriangles.Reserve(NewTriangles.Num() * 2);
-		FinalMaterialIndices.Reserve(NewMaterialIndices.Num() * 2);
-
-		NumTris = NewTriangles.Num() / 3;
-		for (int32 i = 0; i < NumTris; i++)
+	template<typename PointPredicateType>
+	void CollectFacesInRegion(const FHalfEdgeMesh& Mesh, const PointPredicateType& IsPointInRegion, TArray<int32>& OutFaces)
+	{
+		const int32 NumFaces = Mesh.Faces.Num();
+		TArray<uint8> FaceInRegion;
+		FaceInRegion.SetNumZeroed(NumFaces);
+		ParallelFor(NumFaces, [&](int32 FaceIdx)
 		{
-			int32 V0 = NewTriangles[i * 3];
-			int32 V1 = NewTriangles[i * 3 + 1];
-			int32 V2 = NewTriangles[i * 3 + 2];
-			int32 MatIdx = NewMaterialIndices.IsValidIndex(i) ? NewMaterialIndices[i] : 0;
-
-			// Detect midpoint existence based on position
-			bool bHas01 = HasMidpointAtEdge(V0, V1);
-			bool bHas12 = HasMidpointAtEdge(V1, V2);
-			bool bHas20 = HasMidpointAtEdge(V2, V0);
-
-			int32 NumMidpoints = (bHas01 ? 1 : 0) + (bHas12 ? 1 : 0) + (bHas20 ? 1 : 0);
+			FaceInRegion[FaceIdx] = IsFaceInRegion(Mesh, FaceIdx, IsPointInRegion) ? 1 : 0;
+		}, NumFaces < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-			if (NumMidpoints == 0)
-			{
-				FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-				FinalMaterialIndices.Add(MatIdx);
-			}
-			else if (NumMidpoints == 3)
-			{
-				// GREEN-3: All neighbors RED split -> force 4-way split
-				int32 M01 = GetOrCreateMidpoint(V0, V1);
-				int32 M12 = GetOrCreateMidpoint(V1, V2);
-				int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-				FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M20);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalTriangles.Add(M20); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalTriangles.Add(M01); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-				FinalMaterialIndices.Add(MatIdx);
-			}
-			else if (NumMidpoints == 1)
+		OutFaces.Reset();
+		for (int32 FaceIdx = 0; FaceIdx < NumFaces; FaceIdx++)
+		{
+			if (FaceInRegion[FaceIdx])
 			{
-				if (bHas01)
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-				else if (bHas12)
-				{
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-					FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-				else // bHas20
-				{
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-					FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(M20); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-			}
-			else // NumMidpoints == 2
-			{
-				if (bHas01 && bHas12)
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-
-					FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-					FinalMaterialIndices.Add(MatIdx);
-
-					float DiagA = FVector::DistSquared(Positions[M01], Positions[V2]);
-					float DiagB = FVector::DistSquared(Positions[V0], Positions[M12]);
-					if (DiagA <= DiagB)
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M01); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M12);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-				}
-				else if (bHas12 && bHas20)
-				{
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-					FinalTriangles.Add(M20); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-
-					float DiagA = FVector::DistSquared(Positions[V0], Positions[M12]);
-					float DiagB = FVector::DistSquared(Positions[V1], Positions[M20]);
-					if (DiagA <= DiagB)
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V1); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-				}
-				else // bHas01 && bHas20
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-					FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M20);
-					FinalMaterialIndices.Add(MatIdx);
-
-					float DiagA = FVector::DistSquared(Positions[V1], Positions[M20]);
-					float DiagB = FVector::DistSquared(Positions[M01], Positions[V2]);
-					if (DiagA <= DiagB)
-					{
-						FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M20); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M01); FinalTriangles.Add(V2); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-				}
+				OutFaces.Add(FaceIdx);
 			}
 		}
-
-		Triangles = MoveTemp(FinalTriangles);
-		MaterialIndices = MoveTemp(FinalMaterialIndices);
-
-		int32 CurrentTriCount = Triangles.Num() / 3;
-
-		// If no change, stop
-		if (CurrentTriCount == NumTris)
-		{
-			break;
-		}
 	}
-
-	// Rebuild half-edge mesh from result with parent info
-	Mesh.Clear();
-	Mesh.BuildFromTriangles(Positions, Triangles, UVs, MaterialIndices, &ParentIndices);
-
-	int32 FinalTriCount = Triangles.Num() / 3;
-	return FinalTriCount - InitialTriCount;
 }
 
 int32 FLEBSubdivision::SubdivideRegion(
 	FHalfEdgeMesh& Mesh,
-	const FSubdivisionOBB& OBB,
+	const FTorusParams& Torus,
 	int32 MaxLevel,
 	float MinEdgeLength)
 {
-	// Step 1: Export current mesh to simple triangle format
-	TArray<FVector> Positions;
-	TArray<FVector2D> UVs;
-	TArray<int32> Triangles;
-	TArray<int32> MaterialIndices;  // Per-triangle material index
-	TArray<TPair<int32, int32>> ParentIndices;  // Per-vertex parent info (recorded at Subdivision creation time)
-
-	Positions.Reserve(Mesh.Vertices.Num());
-	UVs.Reserve(Mesh.Vertices.Num());
-	ParentIndices.Reserve(Mesh.Vertices.Num());
-	for (const FHalfEdgeVertex& V : Mesh.Vertices)
-	{
-		Positions.Add(V.Position);
-		UVs.Add(V.UV);
-		// Preserve parent info (for multi-level Subdivision)
-		// Original vertex: INDEX_NONE, previous level generated vertex: preserve parent indices
-		ParentIndices.Add(TPair<int32, int32>(V.ParentIndex0, V.ParentIndex1));
-	}
-
-	for (int32 FaceIdx = 0; FaceIdx < Mesh.Faces.Num(); FaceIdx++)
-	{
-		int32 V0, V1, V2;
-		Mesh.GetFaceVertices(FaceIdx, V0, V1, V2);
-		if (V0 >= 0 && V1 >= 0 && V2 >= 0)
-		{
-			Triangles.Add(V0);
-			Triangles.Add(V1);
-			Triangles.Add(V2);
-			MaterialIndices.Add(Mesh.Faces[FaceIdx].MaterialIndex);
-		}
-	}
-
-	int32 InitialTriCount = Triangles.Num() / 3;
-
-	// ============================================================================
-	// Dual Midpoint Map System (Position + Index)
-	// ============================================================================
-	// Problem 1: At material section/UV seam boundaries, vertices at same position have different indices
-	//            -> GREEN split cannot detect midpoint existence
-	// Problem 2: Sharing vertices by position only mixes UVs
-	//            -> Rendering artifacts at UV seams
-	//
-	// Solution: Use two maps
-	//   1. PositionMidpointMap: For GREEN split detection (position-based) - "Is there a midpoint on this edge?"
-	//   2. IndexMidpointMap: For vertex reuse (index-based) - "Reuse if same UV"
-	// ============================================================================
-
-	constexpr float MidpointWeldPrecision = 0.1f;
-
-	// Position -> quantized integer coordinate conversion
-	auto PositionToKey = [MidpointWeldPrecision](const FVector& Pos) -> FIntVector
-	{
-		return FIntVector(
-			FMath::RoundToInt(Pos.X / MidpointWeldPrecision),
-			FMath::RoundToInt(Pos.Y / MidpointWeldPrecision),
-			FMath::RoundToInt(Pos.Z / MidpointWeldPrecision)
-		);
-	};
-
-	auto IntVectorLess = [](const FIntVector& A, const FIntVector& B) -> bool
+	// Near torus surface: signed distance within influence margin
+	auto IsInInfluenceRegion = [&Torus](const FVector& P) -> bool
 	{
-		if (A.X != B.X) return A.X < B.X;
-		if (A.Y != B.Y) return A.Y < B.Y;
-		return A.Z < B.Z;
+		return Torus.IsPointInInfluence(P);
 	};
 
-	// 1. Position-based map: For GREEN split detection (whether midpoint exists at this edge position)
-	TSet<TPair<FIntVector, FIntVector>> PositionMidpointSet;
-
-	auto MakePositionKey = [&](int32 VA, int32 VB) -> TPair<FIntVector, FIntVector>
-	{
-		FIntVector KeyA = PositionToKey(Positions[VA]);
-		FIntVector KeyB = PositionToKey(Positions[VB]);
-		if (IntVectorLess(KeyA, KeyB))
-			return TPair<FIntVector, FIntVector>(KeyA, KeyB);
-		else
-			return TPair<FIntVector, FIntVector>(KeyB, KeyA);
-	};
-
-	// 2. Index-based map: For vertex reuse (same index = same UV)
-	TMap<TPair<int32, int32>, int32> IndexMidpointMap;
-
-	auto MakeIndexKey = [](int32 A, int32 B) -> TPair<int32, int32>
-	{
-		return A < B ? TPair<int32, int32>(A, B) : TPair<int32, int32>(B, A);
-	};
-
-	// GetOrCreateMidpoint: Reuse based on index, register existence based on position
-	auto GetOrCreateMidpoint = [&](int32 VA, int32 VB) -> int32
-	{
-		TPair<int32, int32> IndexKey = MakeIndexKey(VA, VB);
-
-		// Reuse if same index (= same UV)
-		if (int32* Existing = IndexMidpointMap.Find(IndexKey))
+	return RefineFaces(Mesh, nullptr, MaxLevel, MinEdgeLength,
+		[&IsInInfluenceRegion](const FHalfEdgeMesh& InMesh, int32 FaceIndex)
 		{
-			return *Existing;
-		}
-
-		// Create new vertex (with its own UV)
-		int32 NewIdx = Positions.Num();
-		Positions.Add((Positions[VA] + Positions[VB]) * 0.5f);
-		UVs.Add((UVs[VA] + UVs[VB]) * 0.5f);  // Interpolate with its own triangle's UV
-		ParentIndices.Add(TPair<int32, int32>(VA, VB));
-
-		// Register in both maps
-		IndexMidpointMap.Add(IndexKey, NewIdx);
-		PositionMidpointSet.Add(MakePositionKey(VA, VB));  // For GREEN split detection
-
-		return NewIdx;
-	};
-
-	// For GREEN split: Check if midpoint exists at this edge (position-based)
-	auto HasMidpointAtEdge = [&](int32 VA, int32 VB) -> bool
-	{
-		return PositionMidpointSet.Contains(MakePositionKey(VA, VB));
-	};
+			return IsFaceInRegion(InMesh, FaceIndex, IsInInfluenceRegion);
+		});
+}
 
+int32 FLEBSubdivision::SubdivideRegion(
+	FHalfEdgeMesh& Mesh,
+	const FSubdivisionOBB& OBB,
+	int32 MaxLevel,
+	float MinEdgeLength)
+{
 	// OBB influence check - Same method as DrawSdfVolume
-	auto IsInInfluenceRegion = [&](const FVector& P) -> bool
+	auto IsInInfluenceRegion = [&OBB](const FVector& P) -> bool
 	{
-		// Vector from point to OBB center
-		FVector D = P - OBB.Center;
-
-		// Project onto each OBB axis
-		float ProjX = FMath::Abs(FVector::DotProduct(D, OBB.AxisX));
-		float ProjY = FMath::Abs(FVector::DotProduct(D, OBB.AxisY));
-		float ProjZ = FMath::Abs(FVector::DotProduct(D, OBB.AxisZ));
-
-		// Range check including margin
-		bool bInX = ProjX <= OBB.HalfExtents.X + OBB.InfluenceMargin;
-		bool bInY = ProjY <= OBB.HalfExtents.Y + OBB.InfluenceMargin;
-		bool bInZ = ProjZ <= OBB.HalfExtents.Z + OBB.InfluenceMargin;
-
-		return bInX && bInY && bInZ;
+		return OBB.IsPointInInfluence(P);
 	};
 
-	// Perform multiple levels of subdivision
-	for (int32 Level = 0; Level < MaxLevel; Level++)
-	{
-		TArray<int32> NewTriangles;
-		TArray<int32> NewMaterialIndices;
-		NewTriangles.Reserve(Triangles.Num() * 4);
-		NewMaterialIndices.Reserve(MaterialIndices.Num() * 4);
-
-		int32 NumTris = Triangles.Num() / 3;
-		TArray<bool> TriNeedsRedSplit;
-		TriNeedsRedSplit.SetNumZeroed(NumTris);
-
-		// ========================================================================
-		// Optimization: Per-vertex region check caching
-		// Even if the same vertex is shared by multiple triangles, check only once
-		// ========================================================================
-		const int32 NumPositions = Positions.Num();
-		TArray<int8> VertexInRegionCache;  // -1: unchecked, 0: outside, 1: inside
-		VertexInRegionCache.SetNumUninitialized(NumPositions);
-		FMemory::Memset(VertexInRegionCache.GetData(), -1, NumPositions);
-
-		// Cached vertex region check lambda
-		auto IsVertexInRegionCached = [&](int32 VertexIndex) -> bool
-		{
-			if (VertexInRegionCache[VertexIndex] == -1)
-			{
-				// First check - cache the result
-				VertexInRegionCache[VertexIndex] = IsInInfluenceRegion(Positions[VertexIndex]) ? 1 : 0;
-			}
-			return VertexInRegionCache[VertexIndex] == 1;
-		};
-
-		// Phase 1: Mark triangles that need RED split (4-way, in region)
-		for (int32 i = 0; i < NumTris; i++)
+	return RefineFaces(Mesh, nullptr, MaxLevel, MinEdgeLength,
+		[&IsInInfluenceRegion](const FHalfEdgeMesh& InMesh, int32 FaceIndex)
 		{
-			int32 V0 = Triangles[i * 3];
-			int32 V1 = Triangles[i * 3 + 1];
-			int32 V2 = Triangles[i * 3 + 2];
-
-			// Optimization: Use cached vertex checks
-			bool bInRegion = false;
-			if (IsVertexInRegionCached(V0)) bInRegion = true;
-			else if (IsVertexInRegionCached(V1)) bInRegion = true;
-			else if (IsVertexInRegionCached(V2)) bInRegion = true;
-			else
-			{
-				// Edge midpoints check (cannot cache - new positions each time)
-				const FVector& P0 = Positions[V0];
-				const FVector& P1 = Positions[V1];
-				const FVector& P2 = Positions[V2];
-
-				FVector Mid01 = (P0 + P1) * 0.5f;
-				FVector Mid12 = (P1 + P2) * 0.5f;
-				FVector Mid20 = (P2 + P0) * 0.5f;
-
-				if (IsInInfluenceRegion(Mid01)) bInRegion = true;
-				else if (IsInInfluenceRegion(Mid12)) bInRegion = true;
-				else if (IsInInfluenceRegion(Mid20)) bInRegion = true;
-				else
-				{
-					// Centroid check
-					FVector Center = (P0 + P1 + P2) / 3.0f;
-					if (IsInInfluenceRegion(Center)) bInRegion = true;
-				}
-			}
-
-			if (!bInRegion) continue;
-
-			// Check minimum edge length
-			const FVector& P0 = Positions[V0];
-			const FVector& P1 = Positions[V1];
-			const FVector& P2 = Positions[V2];
-
-			float MaxEdgeLen = FMath::Max3(
-				FVector::Dist(P0, P1),
-				FVector::Dist(P1, P2),
-				FVector::Dist(P2, P0)
-			);
-
-			if (MaxEdgeLen >= MinEdgeLength)
-			{
-				TriNeedsRedSplit[i] = true;
-			}
-		}
-
-		// Phase 2: Do RED splits (creates midpoints)
-		for (int32 i = 0; i < NumTris; i++)
-		{
-			int32 V0 = Triangles[i * 3];
-			int32 V1 = Triangles[i * 3 + 1];
-			int32 V2 = Triangles[i * 3 + 2];
-			int32 MatIdx = MaterialIndices.IsValidIndex(i) ? MaterialIndices[i] : 0;
-
-			if (TriNeedsRedSplit[i])
-			{
-				// RED: Split into 4 triangles (all inherit parent's material)
-				int32 M01 = GetOrCreateMidpoint(V0, V1);
-				int32 M12 = GetOrCreateMidpoint(V1, V2);
-				int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-				NewTriangles.Add(V0); NewTriangles.Add(M01); NewTriangles.Add(M20);
-				NewMaterialIndices.Add(MatIdx);
-
-				NewTriangles.Add(M01); NewTriangles.Add(V1); NewTriangles.Add(M12);
-				NewMaterialIndices.Add(MatIdx);
-
-				NewTriangles.Add(M20); NewTriangles.Add(M12); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
-
-				NewTriangles.Add(M01); NewTriangles.Add(M12); NewTriangles.Add(M20);
-				NewMaterialIndices.Add(MatIdx);
-			}
-			else
-			{
-				NewTriangles.Add(V0); NewTriangles.Add(V1); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
-			}
-		}
-
-		// Phase 3: GREEN splits - fix T-junctions
-		// ============================================================================
-		// Key change: Detection is position-based (HasMidpointAtEdge), vertices are index-based (GetOrCreateMidpoint)
-		// -> Each triangle creates midpoint with its own UV at UV seam, but GREEN split is detected accurately
-		// ============================================================================
-		TArray<int32> FinalTriangles;
-		TArray<int32> FinalMaterialIndices;
-		FinalTriangles.Reserve(NewTriangles.Num() * 2);
-		FinalMaterialIndices.Reserve(NewMaterialIndices.Num() * 2);
-
-		NumTris = NewTriangles.Num() / 3;
-		for (int32 i = 0; i < NumTris; i++)
-		{
-			int32 V0 = NewTriangles[i * 3];
-			int32 V1 = NewTriangles[i * 3 + 1];
-			int32 V2 = NewTriangles[i * 3 + 2];
-			int32 MatIdx = NewMaterialIndices.IsValidIndex(i) ? NewMaterialIndices[i] : 0;
-
-			// Detect midpoint existence based on position (also detects UV seam boundaries)
-			bool bHas01 = HasMidpointAtEdge(V0, V1);
-			bool bHas12 = HasMidpointAtEdge(V1, V2);
-			bool bHas20 = HasMidpointAtEdge(V2, V0);
-
-			int32 NumMidpoints = (bHas01 ? 1 : 0) + (bHas12 ? 1 : 0) + (bHas20 ? 1 : 0);
-
-			if (NumMidpoints == 0)
-			{
-				FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-				FinalMaterialIndices.Add(MatIdx);
-			}
-			else if (NumMidpoints == 3)
-			{
-				// GREEN-3: All neighbors RED split -> force 4-way split
-				int32 M01 = GetOrCreateMidpoint(V0, V1);
-				int32 M12 = GetOrCreateMidpoint(V1, V2);
-				int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-				FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M20);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalTriangles.Add(M20); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalTriangles.Add(M01); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-				FinalMaterialIndices.Add(MatIdx);
-			}
-			else if (NumMidpoints == 1)
-			{
-				if (bHas01)
-				{
-					// Create/retrieve midpoint with its own UV
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-				else if (bHas12)
-				{
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-					FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-				else // bHas20
-				{
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-					FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(M20); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-			}
-			else // NumMidpoints == 2
-			{
-				// GREEN-2: Corner triangle + quadrilateral split by shorter diagonal
-				if (bHas01 && bHas12)
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-
-					// Corner at V1: (M01, V1, M12)
-					FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-					FinalMaterialIndices.Add(MatIdx);
-
-					// Quad V0-M01-M12-V2: compare diagonals M01-V2 vs V0-M12
-					float DiagA = FVector::DistSquared(Positions[M01], Positions[V2]);
-					float DiagB = FVector::DistSquared(Positions[V0], Positions[M12]);
-					if (DiagA <= DiagB)
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M01); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M12);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-				}
-				else if (bHas12 && bHas20)
-				{
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-					// Corner at V2: (M20, M12, V2)
-					FinalTriangles.Add(M20); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-
-					// Quad V0-V1-M12-M20
-					float DiagA = FVector::DistSquared(Positions[V0], Positions[M12]);
-					float DiagB = FVector::DistSquared(Positions[V1], Positions[M20]);
-					if (DiagA <= DiagB)
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V1); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-				}
-				else // bHas01 && bHas20
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-					// Corner at V0: (V0, M01, M20)
-					FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M20);
-					FinalMaterialIndices.Add(MatIdx);
-
-					// Quad M01-V1-V2-M20
-					float DiagA = FVector::DistSquared(Positions[V1], Positions[M20]);
-					float DiagB = FVector::DistSquared(Positions[M01], Positions[V2]);
-					if (DiagA <= DiagB)
-					{
-						FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M20); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M01); FinalTriangles.Add(V2); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-				}
-			}
-		}
-
-		Triangles = MoveTemp(FinalTriangles);
-		MaterialIndices = MoveTemp(FinalMaterialIndices);
-
-		int32 CurrentTriCount = Triangles.Num() / 3;
-
-		// If no change, stop
-		if (CurrentTriCount == NumTris)
-		{
-			break;
-		}
-	}
-
-	// Rebuild half-edge mesh from result with parent info
-	Mesh.Clear();
-	Mesh.BuildFromTriangles(Positions, Triangles, UVs, MaterialIndices, &ParentIndices);
-
-	int32 FinalTriCount = Triangles.Num() / 3;
-	return FinalTriCount - InitialTriCount;
-}
-
-void FLEBSubdivision::SubdivideFace4(FHalfEdgeMesh& Mesh, int32 FaceIndex)
-{
-	// Not used in Red-Green implementation
+			return IsFaceInRegion(InMesh, FaceIndex, IsInInfluenceRegion);
+		});
 }
 
-int32 FLEBSubdivision::SplitEdge(FHalfEdgeMesh& Mesh, int32 HalfEdgeIndex)
+void FLEBSubdivision::CollectRegionFaces(const FHalfEdgeMesh& Mesh, const FTorusParams& TorusParams, TArray<int32>& OutFaces)
 {
-	// Not used in Red-Green implementation
-	return -1;
+	CollectFacesInRegion(Mesh, [&TorusParams](const FVector& P) { return TorusParams.IsPointInInfluence(P); }, OutFaces);
 }
 
-void FLEBSubdivision::EnsureLongestEdge(FHalfEdgeMesh& Mesh, int32 HalfEdgeIndex, TSet<int32>& ProcessedFaces)
+void FLEBSubdivision::CollectRegionFaces(const FHalfEdgeMesh& Mesh, const FSubdivisionOBB& OBB, TArray<int32>& OutFaces)
 {
-	// Not used in Red-Green implementation
+	CollectFacesInRegion(Mesh, [&OBB](const FVector& P) { return OBB.IsPointInInfluence(P); }, OutFaces);
 }
 
-void FLEBSubdivision::SplitFaceByEdge(FHalfEdgeMesh& Mesh, int32 FaceIndex, int32 MidpointVertex)
+int32 FLEBSubdivision::SubdivideUniform(
+	FHalfEdgeMesh& Mesh,
+	int32 MaxLevel,
+	float MinEdgeLength)
 {
-	// Not used in Red-Green implementation
+	return RefineFaces(Mesh, nullptr, MaxLevel, MinEdgeLength,
+		[](const FHalfEdgeMesh& InMesh, int32 FaceIndex)
+		{
+			return true;
+		});
 }
 
-int32 FLEBSubdivision::SubdivideUniform(
+int32 FLEBSubdivision::SubdivideSelectedFaces(
 	FHalfEdgeMesh& Mesh,
+	const TSet<int32>& TargetFaces,
 	int32 MaxLevel,
 	float MinEdgeLength)
 {
-	// Step 1: Export current mesh to simple triangle format
-	TArray<FVector> Positions;
-	TArray<FVector2D> UVs;
-	TArray<int32> Triangles;
-	TArray<int32> MaterialIndices;
-	TArray<TPair<int32, int32>> ParentIndices;
-
-	Positions.Reserve(Mesh.Vertices.Num());
-	UVs.Reserve(Mesh.Vertices.Num());
-	ParentIndices.Reserve(Mesh.Vertices.Num());
-	for (const FHalfEdgeVertex& V : Mesh.Vertices)
+	// Target flag is inherited by child faces on every bisection (propagation-only splits stay untargeted)
+	for (FHalfEdgeFace& Face : Mesh.Faces)
 	{
-		Positions.Add(V.Position);
-		UVs.Add(V.UV);
-		ParentIndices.Add(TPair<int32, int32>(V.ParentIndex0, V.ParentIndex1));
+		Face.bMarkedForSubdivision = false;
 	}
 
-	for (int32 FaceIdx = 0; FaceIdx < Mesh.Faces.Num(); FaceIdx++)
+	TArray<int32> InitialCandidates;
+	InitialCandidates.Reserve(TargetFaces.Num());
+	for (int32 FaceIdx : TargetFaces)
 	{
-		int32 V0, V1, V2;
-		Mesh.GetFaceVertices(FaceIdx, V0, V1, V2);
-		if (V0 >= 0 && V1 >= 0 && V2 >= 0)
+		if (Mesh.Faces.IsValidIndex(FaceIdx))
 		{
-			Triangles.Add(V0);
-			Triangles.Add(V1);
-			Triangles.Add(V2);
-			MaterialIndices.Add(Mesh.Faces[FaceIdx].MaterialIndex);
+			Mesh.Faces[FaceIdx].bMarkedForSubdivision = true;
+			InitialCandidates.Add(FaceIdx);
 		}
 	}
 
-	int32 InitialTriCount = Triangles.Num() / 3;
-
-	// ============================================================================
-	// Dual Midpoint Map System (Position + Index) - GREEN split support
-	// ============================================================================
-	// 1. PositionMidpointSet: For GREEN split detection (position-based) - "Is there a midpoint on this edge?"
-	// 2. IndexMidpointMap: For vertex reuse (index-based) - "Reuse if same UV"
-	// ============================================================================
-	constexpr float MidpointWeldPrecision = 0.1f;
-
-	auto PositionToKey = [MidpointWeldPrecision](const FVector& Pos) -> FIntVector
-	{
-		return FIntVector(
-			FMath::RoundToInt(Pos.X / MidpointWeldPrecision),
-			FMath::RoundToInt(Pos.Y / MidpointWeldPrecision),
-			FMath::RoundToInt(Pos.Z / MidpointWeldPrecision)
-		);
-	};
-
-	auto IntVectorLess = [](const FIntVector& A, const FIntVector& B) -> bool
-	{
-		if (A.X != B.X) return A.X < B.X;
-		if (A.Y != B.Y) return A.Y < B.Y;
-		return A.Z < B.Z;
-	};
-
-	// 1. Position-based set: For GREEN split detection
-	TSet<TPair<FIntVector, FIntVector>> PositionMidpointSet;
-
-	auto MakePositionKey = [&](int32 VA, int32 VB) -> TPair<FIntVector, FIntVector>
-	{
-		FIntVector KeyA = PositionToKey(Positions[VA]);
-		FIntVector KeyB = PositionToKey(Positions[VB]);
-		if (IntVectorLess(KeyA, KeyB))
-			return TPair<FIntVector, FIntVector>(KeyA, KeyB);
-		else
-			return TPair<FIntVector, FIntVector>(KeyB, KeyA);
-	};
+	return RefineFaces(Mesh, &InitialCandidates, MaxLevel, MinEdgeLength,
+		[](const FHalfEdgeMesh& InMesh, int32 FaceIndex)
+		{
+			return InMesh.Faces[FaceIndex].bMarkedForSubdivision;
+		});
+}
 
-	// 2. Index-based map: For vertex reuse (same index = same UV)
-	TMap<TPair<int32, int32>, int32> IndexMidpointMap;
+int32 FLEBSubdivision::RefineFaces(
+	FHalfEdgeMesh& Mesh,
+	const TArray<int32>* InitialCandidates,
+	int32 MaxLevel,
+	float MinEdgeLength,
+	TFunctionRef<bool(const FHalfEdgeMesh&, int32)> ShouldRefineFace)
+{
+	const int32 InitialFaceCount = Mesh.Faces.Num();
 
-	auto MakeIndexKey = [](int32 A, int32 B) -> TPair<int32, int32>
+	// Level 0 candidates: given set or every face
+	TArray<int32> Candidates;
+	if (InitialCandidates)
 	{
-		return A < B ? TPair<int32, int32>(A, B) : TPair<int32, int32>(B, A);
-	};
-
-	// GetOrCreateMidpoint: Reuse based on index, register existence based on position
-	auto GetOrCreateMidpoint = [&](int32 VA, int32 VB) -> int32
+		Candidates = *InitialCandidates;
+	}
+	else
 	{
-		TPair<int32, int32> IndexKey = MakeIndexKey(VA, VB);
-		if (int32* Existing = IndexMidpointMap.Find(IndexKey))
+		Candidates.SetNumUninitialized(InitialFaceCount);
+		for (int32 FaceIdx = 0; FaceIdx < InitialFaceCount; FaceIdx++)
 		{
-			return *Existing;
+			Candidates[FaceIdx] = FaceIdx;
 		}
+	}
 
-		int32 NewIdx = Positions.Num();
-		Positions.Add((Positions[VA] + Positions[VB]) * 0.5f);
-		UVs.Add((UVs[VA] + UVs[VB]) * 0.5f);
-		ParentIndices.Add(TPair<int32, int32>(VA, VB));
-
-		IndexMidpointMap.Add(IndexKey, NewIdx);
-		PositionMidpointSet.Add(MakePositionKey(VA, VB));  // For GREEN split detection
-		return NewIdx;
-	};
+	TArray<int8> RemainingBisections;
+	TArray<int32> WorkList;
+	TArray<TPair<int32, int32>> SplitFaces;  // (parent face, new child face)
+	TBitArray<> TouchedFaces;
 
-	// For GREEN split: Check if midpoint exists at this edge (position-based)
-	auto HasMidpointAtEdge = [&](int32 VA, int32 VB) -> bool
+	for (int32 Level = 0; Level < MaxLevel && Candidates.Num() > 0; Level++)
 	{
-		return PositionMidpointSet.Contains(MakePositionKey(VA, VB));
-	};
-
-	// Perform multiple levels of subdivision
-	for (int32 Level = 0; Level < MaxLevel; Level++)
-	{
-		TArray<int32> NewTriangles;
-		TArray<int32> NewMaterialIndices;
-		NewTriangles.Reserve(Triangles.Num() * 4);
-		NewMaterialIndices.Reserve(MaterialIndices.Num() * 4);
-
-		int32 NumTris = Triangles.Num() / 3;
-		int32 SplitCount = 0;
-
-		// Phase 1: RED splits - 4-way split based on MinEdgeLength condition
-		for (int32 i = 0; i < NumTris; i++)
+		// Phase 1: Mark faces in region with edges above MinEdgeLength (read-only, parallel)
+		TArray<uint8> CandidateMarked;
+		CandidateMarked.SetNumZeroed(Candidates.Num());
+		ParallelFor(Candidates.Num(), [&](int32 i)
 		{
-			int32 V0 = Triangles[i * 3];
-			int32 V1 = Triangles[i * 3 + 1];
-			int32 V2 = Triangles[i * 3 + 2];
-			int32 MatIdx = MaterialIndices.IsValidIndex(i) ? MaterialIndices[i] : 0;
-
-			const FVector& P0 = Positions[V0];
-			const FVector& P1 = Positions[V1];
-			const FVector& P2 = Positions[V2];
-
-			// Check MinEdgeLength condition
-			float MaxEdgeLen = FMath::Max3(
-				FVector::Dist(P0, P1),
-				FVector::Dist(P1, P2),
-				FVector::Dist(P2, P0)
-			);
-
-			if (MaxEdgeLen >= MinEdgeLength)
-			{
-				// RED: Split into 4 triangles
-				int32 M01 = GetOrCreateMidpoint(V0, V1);
-				int32 M12 = GetOrCreateMidpoint(V1, V2);
-				int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-				NewTriangles.Add(V0); NewTriangles.Add(M01); NewTriangles.Add(M20);
-				NewMaterialIndices.Add(MatIdx);
-
-				NewTriangles.Add(M01); NewTriangles.Add(V1); NewTriangles.Add(M12);
-				NewMaterialIndices.Add(MatIdx);
+			const int32 FaceIdx = Candidates[i];
+			CandidateMarked[i] = (ShouldRefineFace(Mesh, FaceIdx) && GetMaxEdgeLength(Mesh, FaceIdx) >= MinEdgeLength) ? 1 : 0;
+		}, Candidates.Num() < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-				NewTriangles.Add(M20); NewTriangles.Add(M12); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
-
-				NewTriangles.Add(M01); NewTriangles.Add(M12); NewTriangles.Add(M20);
-				NewMaterialIndices.Add(MatIdx);
-
-				SplitCount++;
-			}
-			else
+		RemainingBisections.Reset();
+		RemainingBisections.SetNumZeroed(Mesh.Faces.Num());
+		WorkList.Reset();
+		for (int32 i = 0; i < Candidates.Num(); i++)
+		{
+			if (CandidateMarked[i])
 			{
-				// Keep original triangle (may be GREEN split later)
-				NewTriangles.Add(V0); NewTriangles.Add(V1); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
+				RemainingBisections[Candidates[i]] = BisectionsPerLevel;
+				WorkList.Add(Candidates[i]);
 			}
 		}
 
-		// Phase 2: GREEN splits - T-junction fix
-		TArray<int32> FinalTriangles;
-		TArray<int32> FinalMaterialIndices;
-		FinalTriangles.Reserve(NewTriangles.Num() * 2);
-		FinalMaterialIndices.Reserve(NewMaterialIndices.Num() * 2);
-
-		int32 GreenSplit1 = 0, GreenSplit2 = 0, GreenSplit3 = 0;
-
-		NumTris = NewTriangles.Num() / 3;
-		for (int32 i = 0; i < NumTris; i++)
+		if (WorkList.Num() == 0)
 		{
-			int32 V0 = NewTriangles[i * 3];
-			int32 V1 = NewTriangles[i * 3 + 1];
-			int32 V2 = NewTriangles[i * 3 + 2];
-			int32 MatIdx = NewMaterialIndices.IsValidIndex(i) ? NewMaterialIndices[i] : 0;
-
-			// Detect midpoint existence based on position
-			bool bHas01 = HasMidpointAtEdge(V0, V1);
-			bool bHas12 = HasMidpointAtEdge(V1, V2);
-			bool bHas20 = HasMidpointAtEdge(V2, V0);
-
-			int32 NumMidpoints = (bHas01 ? 1 : 0) + (bHas12 ? 1 : 0) + (bHas20 ? 1 : 0);
+			break;
+		}
 
-			if (NumMidpoints == 0)
+		// Phase 2: Conforming bisection (only marked faces and their LEPP neighbors are touched)
+		TouchedFaces.Init(false, Mesh.Faces.Num());
+		while (WorkList.Num() > 0)
+		{
+			const int32 FaceIdx = WorkList.Pop(EAllowShrinking::No);
+			if (RemainingBisections[FaceIdx] <= 0)
 			{
-				// No split needed
-				FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-				FinalMaterialIndices.Add(MatIdx);
+				continue;
 			}
-			else if (NumMidpoints == 3)
+			if (GetMaxEdgeLength(Mesh, FaceIdx) < MinEdgeLength)
 			{
-				// GREEN-3: All neighbors RED split -> force 4-way split
-				// (Self was not RED split but needs to resolve 3 T-junctions)
-				GreenSplit3++;
-				int32 M01 = GetOrCreateMidpoint(V0, V1);
-				int32 M12 = GetOrCreateMidpoint(V1, V2);
-				int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-				FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M20);
-				FinalMaterialIndices.Add(MatIdx);
-
-				FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-				FinalMaterialIndices.Add(MatIdx);
+				RemainingBisections[FaceIdx] = 0;
+				continue;
+			}
 
-				FinalTriangles.Add(M20); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-				FinalMaterialIndices.Add(MatIdx);
+			SplitFaces.Reset();
+			RefineFaceLEPP(Mesh, FaceIdx, SplitFaces);
 
-				FinalTriangles.Add(M01); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-				FinalMaterialIndices.Add(MatIdx);
-			}
-			else if (NumMidpoints == 1)
+			RemainingBisections.SetNumZeroed(Mesh.Faces.Num());
+			TouchedFaces.SetNum(Mesh.Faces.Num(), false);
+			for (const TPair<int32, int32>& Split : SplitFaces)
 			{
-				// GREEN split: 1 midpoint -> 2 triangles
-				GreenSplit1++;
-				if (bHas01)
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-				else if (bHas12)
-				{
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-					FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-				else // bHas20
-				{
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-					FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalTriangles.Add(M20); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-				}
-			}
-			else // NumMidpoints == 2
-			{
-				// GREEN split: 2 midpoints -> 3 triangles
-				GreenSplit2++;
-				if (!bHas20) // bHas01 && bHas12
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-
-					FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-					FinalMaterialIndices.Add(MatIdx);
-
-					float DiagA = FVector::DistSquared(Positions[M01], Positions[V2]);
-					float DiagB = FVector::DistSquared(Positions[V0], Positions[M12]);
-					if (DiagA < DiagB)
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M01); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M12);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-				}
-				else if (!bHas01) // bHas12 && bHas20
-				{
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-					FinalTriangles.Add(M20); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-
-					float DiagA = FVector::DistSquared(Positions[V0], Positions[M12]);
-					float DiagB = FVector::DistSquared(Positions[V1], Positions[M20]);
-					if (DiagA < DiagB)
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(V1); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-				}
-				else // bHas01 && bHas20
+				// Both halves inherit the parent's remaining budget minus this bisection
+				const int8 Remaining = static_cast<int8>(FMath::Max(RemainingBisections[Split.Key] - 1, 0));
+				RemainingBisections[Split.Key] = Remaining;
+				RemainingBisections[Split.Value] = Remaining;
+				TouchedFaces[Split.Key] = true;
+				TouchedFaces[Split.Value] = true;
+
+				if (Remaining > 0)
 				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-					FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M20);
-					FinalMaterialIndices.Add(MatIdx);
-
-					float DiagA = FVector::DistSquared(Positions[V1], Positions[M20]);
-					float DiagB = FVector::DistSquared(Positions[M01], Positions[V2]);
-					if (DiagA < DiagB)
-					{
-						FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M20); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-					}
-					else
-					{
-						FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalTriangles.Add(M01); FinalTriangles.Add(V2); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-					}
+					WorkList.Add(Split.Key);
+					WorkList.Add(Split.Value);
 				}
 			}
 		}
 
-		Triangles = MoveTemp(FinalTriangles);
-		MaterialIndices = MoveTemp(FinalMaterialIndices);
-
-		// If no split occurred, stop early
-		if (SplitCount == 0 && GreenSplit1 == 0 && GreenSplit2 == 0 && GreenSplit3 == 0)
+		// Untouched faces were either outside the region or already below MinEdgeLength,
+		// so only faces split in this level can qualify in the next one
+		Candidates.Reset();
+		for (TConstSetBitIterator<> It(TouchedFaces); It; ++It)
 		{
-			break;
+			Candidates.Add(It.GetIndex());
 		}
 	}
 
-	// Rebuild half-edge mesh from result with parent info
-	Mesh.Clear();
-	Mesh.BuildFromTriangles(Positions, Triangles, UVs, MaterialIndices, &ParentIndices);
-
-	int32 FinalTriCount = Triangles.Num() / 3;
-	return FinalTriCount - InitialTriCount;
+	return Mesh.Faces.Num() - InitialFaceCount;
 }
 
-int32 FLEBSubdivision::SubdivideSelectedFaces(
-	FHalfEdgeMesh& Mesh,
-	const TSet<int32>& TargetFaces,
-	int32 MaxLevel,
-	float MinEdgeLength)
+void FLEBSubdivision::SubdivideFace4(FHalfEdgeMesh& Mesh, int32 FaceIndex)
 {
-	// Step 1: Export current mesh to simple triangle format
-	TArray<FVector> Positions;
-	TArray<FVector2D> UVs;
-	TArray<int32> Triangles;
-	TArray<int32> MaterialIndices;
-	TArray<TPair<int32, int32>> ParentIndices;
-
-	Positions.Reserve(Mesh.Vertices.Num());
-	UVs.Reserve(Mesh.Vertices.Num());
-	ParentIndices.Reserve(Mesh.Vertices.Num());
-	for (const FHalfEdgeVertex& V : Mesh.Vertices)
-	{
-		Positions.Add(V.Position);
-		UVs.Add(V.UV);
-		ParentIndices.Add(TPair<int32, int32>(V.ParentIndex0, V.ParentIndex1));
-	}
+	// Not used (LEB bisection only)
+}
 
-	// Triangle index + target tracking
-	TArray<bool> IsTargetTriangle;
-	for (int32 FaceIdx = 0; FaceIdx < Mesh.Faces.Num(); FaceIdx++)
+int32 FLEBSubdivision::SplitEdge(FHalfEdgeMesh& Mesh, int32 HalfEdgeIndex, TArray<TPair<int32, int32>>* OutSplitFaces)
+{
+	if (!Mesh.HalfEdges.IsValidIndex(HalfEdgeIndex))
 	{
-		int32 V0, V1, V2;
-		Mesh.GetFaceVertices(FaceIdx, V0, V1, V2);
-		if (V0 >= 0 && V1 >= 0 && V2 >= 0)
-		{
-			Triangles.Add(V0);
-			Triangles.Add(V1);
-			Triangles.Add(V2);
-			MaterialIndices.Add(Mesh.Faces[FaceIdx].MaterialIndex);
-			IsTargetTriangle.Add(TargetFaces.Contains(FaceIdx));
-		}
+		return -1;
 	}
 
-	int32 InitialTriCount = Triangles.Num() / 3;
-
-	// ============================================================================
-	// Dual Midpoint Map System (Position + Index) - GREEN split support
-	// ============================================================================
-	constexpr float MidpointWeldPrecision = 0.1f;
-
-	auto PositionToKey = [MidpointWeldPrecision](const FVector& Pos) -> FIntVector
+	auto AddMidpoint = [&Mesh](int32 HalfEdge) -> int32
 	{
-		return FIntVector(
-			FMath::RoundToInt(Pos.X / MidpointWeldPrecision),
-			FMath::RoundToInt(Pos.Y / MidpointWeldPrecision),
-			FMath::RoundToInt(Pos.Z / MidpointWeldPrecision)
-		);
+		const int32 VA = Mesh.HalfEdges[Mesh.HalfEdges[HalfEdge].PrevIndex].VertexIndex;
+		const int32 VB = Mesh.HalfEdges[HalfEdge].VertexIndex;
+		const FHalfEdgeVertex& A = Mesh.Vertices[VA];
+		const FHalfEdgeVertex& B = Mesh.Vertices[VB];
+		return Mesh.Vertices.Add(FHalfEdgeVertex((A.Position + B.Position) * 0.5f, (A.UV + B.UV) * 0.5f, VA, VB));
 	};
 
-	auto IntVectorLess = [](const FIntVector& A, const FIntVector& B) -> bool
+	auto SplitSide = [&](int32 HalfEdge, int32 Midpoint) -> int32
 	{
-		if (A.X != B.X) return A.X < B.X;
-		if (A.Y != B.Y) return A.Y < B.Y;
-		return A.Z < B.Z;
+		const int32 ParentFace = Mesh.HalfEdges[HalfEdge].FaceIndex;
+		const int32 NewFace = SplitFaceByEdge(Mesh, HalfEdge, Midpoint);
+		if (OutSplitFaces)
+		{
+			OutSplitFaces->Add(TPair<int32, int32>(ParentFace, NewFace));
+		}
+		// Second half of the split edge (Midpoint -> original end)
+		return Mesh.Faces[NewFace].HalfEdgeIndex;
 	};
 
-	// 1. Position-based set: For GREEN split detection
-	TSet<TPair<FIntVector, FIntVector>> PositionMidpointSet;
-
-	auto MakePositionKey = [&](int32 VA, int32 VB) -> TPair<FIntVector, FIntVector>
+	// Index twin (same vertices) or seam twin (same positions, split vertices across a UV seam)
+	int32 OtherSide = Mesh.GetValidTwin(HalfEdgeIndex);
+	const bool bSeam = (OtherSide == -1);
+	if (bSeam)
 	{
-		FIntVector KeyA = PositionToKey(Positions[VA]);
-		FIntVector KeyB = PositionToKey(Positions[VB]);
-		if (IntVectorLess(KeyA, KeyB))
-			return TPair<FIntVector, FIntVector>(KeyA, KeyB);
-		else
-			return TPair<FIntVector, FIntVector>(KeyB, KeyA);
-	};
+		OtherSide = Mesh.GetValidSeamTwin(HalfEdgeIndex);
+	}
 
-	// 2. Index-based map: For vertex reuse (same index = same UV)
-	TMap<TPair<int32, int32>, int32> IndexMidpointMap;
+	// This side: E (a->b) becomes a->M, E2 = M->b
+	const int32 Midpoint = AddMidpoint(HalfEdgeIndex);
+	const int32 SecondHalf = SplitSide(HalfEdgeIndex, Midpoint);
 
-	auto MakeIndexKey = [](int32 A, int32 B) -> TPair<int32, int32>
+	if (OtherSide == -1)
 	{
-		return A < B ? TPair<int32, int32>(A, B) : TPair<int32, int32>(B, A);
-	};
+		return Midpoint;
+	}
+
+	// Other side: T (b->a) becomes b->M', T2 = M'->a (M' == M unless across a UV seam)
+	const int32 OtherMidpoint = bSeam ? AddMidpoint(OtherSide) : Midpoint;
+	const int32 OtherSecondHalf = SplitSide(OtherSide, OtherMidpoint);
 
-	// GetOrCreateMidpoint: Reuse based on index, register existence based on position
-	auto GetOrCreateMidpoint = [&](int32 VA, int32 VB) -> int32
+	auto Link = [&Mesh, bSeam](int32 A, int32 B)
 	{
-		TPair<int32, int32> IndexKey = MakeIndexKey(VA, VB);
-		if (int32* Existing = IndexMidpointMap.Find(IndexKey))
+		if (bSeam)
+		{
+			Mesh.HalfEdges[A].SeamTwinIndex = B;
+			Mesh.HalfEdges[B].SeamTwinIndex = A;
+		}
+		else
 		{
-			return *Existing;
+			Mesh.HalfEdges[A].TwinIndex = B;
+			Mesh.HalfEdges[B].TwinIndex = A;
 		}
+	};
 
-		int32 NewIdx = Positions.Num();
-		Positions.Add((Positions[VA] + Positions[VB]) * 0.5f);
-		UVs.Add((UVs[VA] + UVs[VB]) * 0.5f);
-		ParentIndices.Add(TPair<int32, int32>(VA, VB));
+	Link(HalfEdgeIndex, OtherSecondHalf);  // a->M  <-> M'->a
+	Link(SecondHalf, OtherSide);           // M->b  <-> b->M'
 
-		IndexMidpointMap.Add(IndexKey, NewIdx);
-		PositionMidpointSet.Add(MakePositionKey(VA, VB));  // For GREEN split detection
-		return NewIdx;
-	};
+	return Midpoint;
+}
 
-	// For GREEN split: Check if midpoint exists at this edge (position-based)
-	auto HasMidpointAtEdge = [&](int32 VA, int32 VB) -> bool
-	{
-		return PositionMidpointSet.Contains(MakePositionKey(VA, VB));
-	};
+void FLEBSubdivision::RefineFaceLEPP(FHalfEdgeMesh& Mesh, int32 FaceIndex, TArray<TPair<int32, int32>>& OutSplitFaces)
+{
+	// Rivara LEPP: walk to the terminal edge (longest edge of both adjacent faces), split it, repeat
+	// until FaceIndex itself has been bisected. Every split is two-sided, so the mesh stays conforming.
+	TArray<int32, TInlineAllocator<16>> Stack;
+	Stack.Push(FaceIndex);
 
-	// Perform multiple levels of subdivision
-	for (int32 Level = 0; Level < MaxLevel; Level++)
+	while (Stack.Num() > 0)
 	{
-		TArray<int32> NewTriangles;
-		TArray<int32> NewMaterialIndices;
-		TArray<bool> NewIsTarget;
-		NewTriangles.Reserve(Triangles.Num() * 4);
-		NewMaterialIndices.Reserve(MaterialIndices.Num() * 4);
-		NewIsTarget.Reserve(IsTargetTriangle.Num() * 4);
-
-		int32 NumTris = Triangles.Num() / 3;
-		int32 SplitCount = 0;
-
-		// Phase 1: RED splits - Target triangles only + 4-way split based on MinEdgeLength condition
-		for (int32 i = 0; i < NumTris; i++)
+		const int32 TopFace = Stack.Last();
+		const int32 LongestEdge = GetLongestUnlockedEdge(Mesh, TopFace);
+		if (LongestEdge < 0)
 		{
-			int32 V0 = Triangles[i * 3];
-			int32 V1 = Triangles[i * 3 + 1];
-			int32 V2 = Triangles[i * 3 + 2];
-			int32 MatIdx = MaterialIndices.IsValidIndex(i) ? MaterialIndices[i] : 0;
-			bool bIsTarget = IsTargetTriangle.IsValidIndex(i) ? IsTargetTriangle[i] : false;
-
-			// Check if this is a target triangle
-			if (!bIsTarget)
-			{
-				// Not a target, keep as-is (GREEN split can be applied later)
-				NewTriangles.Add(V0); NewTriangles.Add(V1); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
-				NewIsTarget.Add(false);
-				continue;
-			}
-
-			const FVector& P0 = Positions[V0];
-			const FVector& P1 = Positions[V1];
-			const FVector& P2 = Positions[V2];
-
-			// Check MinEdgeLength condition
-			float MaxEdgeLen = FMath::Max3(
-				FVector::Dist(P0, P1),
-				FVector::Dist(P1, P2),
-				FVector::Dist(P2, P0)
-			);
-
-			if (MaxEdgeLen >= MinEdgeLength)
-			{
-				// RED: Split into 4 triangles
-				int32 M01 = GetOrCreateMidpoint(V0, V1);
-				int32 M12 = GetOrCreateMidpoint(V1, V2);
-				int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-				NewTriangles.Add(V0); NewTriangles.Add(M01); NewTriangles.Add(M20);
-				NewMaterialIndices.Add(MatIdx);
-				NewIsTarget.Add(true);
-
-				NewTriangles.Add(M01); NewTriangles.Add(V1); NewTriangles.Add(M12);
-				NewMaterialIndices.Add(MatIdx);
-				NewIsTarget.Add(true);
-
-				NewTriangles.Add(M20); NewTriangles.Add(M12); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
-				NewIsTarget.Add(true);
-
-				NewTriangles.Add(M01); NewTriangles.Add(M12); NewTriangles.Add(M20);
-				NewMaterialIndices.Add(MatIdx);
-				NewIsTarget.Add(true);
-
-				SplitCount++;
-			}
-			else
-			{
-				// Already small enough
-				NewTriangles.Add(V0); NewTriangles.Add(V1); NewTriangles.Add(V2);
-				NewMaterialIndices.Add(MatIdx);
-				NewIsTarget.Add(true);
-			}
+			Stack.Pop(EAllowShrinking::No);
+			continue;
 		}
 
-		// Phase 2: GREEN splits - T-junction fix
-		TArray<int32> FinalTriangles;
-		TArray<int32> FinalMaterialIndices;
-		TArray<bool> FinalIsTarget;
-		FinalTriangles.Reserve(NewTriangles.Num() * 2);
-		FinalMaterialIndices.Reserve(NewMaterialIndices.Num() * 2);
-		FinalIsTarget.Reserve(NewIsTarget.Num() * 2);
-
-		int32 GreenSplit1 = 0, GreenSplit2 = 0, GreenSplit3 = 0;
-
-		NumTris = NewTriangles.Num() / 3;
-		for (int32 i = 0; i < NumTris; i++)
+		int32 Neighbor = Mesh.GetValidTwin(LongestEdge);
+		if (Neighbor == -1)
 		{
-			int32 V0 = NewTriangles[i * 3];
-			int32 V1 = NewTriangles[i * 3 + 1];
-			int32 V2 = NewTriangles[i * 3 + 2];
-			int32 MatIdx = NewMaterialIndices.IsValidIndex(i) ? NewMaterialIndices[i] : 0;
-			bool bIsTarget = NewIsTarget.IsValidIndex(i) ? NewIsTarget[i] : false;
-
-			// Detect midpoint existence based on position
-			bool bHas01 = HasMidpointAtEdge(V0, V1);
-			bool bHas12 = HasMidpointAtEdge(V1, V2);
-			bool bHas20 = HasMidpointAtEdge(V2, V0);
-
-			int32 NumMidpoints = (bHas01 ? 1 : 0) + (bHas12 ? 1 : 0) + (bHas20 ? 1 : 0);
+			Neighbor = Mesh.GetValidSeamTwin(LongestEdge);
+		}
 
-			if (NumMidpoints == 0)
-			{
-				// No split needed
-				FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalIsTarget.Add(bIsTarget);
-			}
-			else if (NumMidpoints == 3)
-			{
-				// GREEN-3: All neighbors RED split -> force 4-way split
-				GreenSplit3++;
-				int32 M01 = GetOrCreateMidpoint(V0, V1);
-				int32 M12 = GetOrCreateMidpoint(V1, V2);
-				int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-				FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M20);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalIsTarget.Add(bIsTarget);
-
-				FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalIsTarget.Add(bIsTarget);
-
-				FinalTriangles.Add(M20); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalIsTarget.Add(bIsTarget);
-
-				FinalTriangles.Add(M01); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-				FinalMaterialIndices.Add(MatIdx);
-				FinalIsTarget.Add(bIsTarget);
-			}
-			else if (NumMidpoints == 1)
-			{
-				// GREEN split: 1 midpoint -> 2 triangles
-				GreenSplit1++;
-				if (bHas01)
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-					FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-				}
-				else if (bHas12)
-				{
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-					FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-					FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-				}
-				else // bHas20
-				{
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-					FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-					FinalTriangles.Add(M20); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-				}
-			}
-			else // NumMidpoints == 2
+		if (Neighbor != -1 && Stack.Num() < MaxLEPPDepth)
+		{
+			const int32 NeighborFace = Mesh.HalfEdges[Neighbor].FaceIndex;
+			const int32 NeighborLongest = GetLongestUnlockedEdge(Mesh, NeighborFace);
+			if (NeighborLongest != Neighbor &&
+				Mesh.GetEdgeLength(NeighborLongest) > Mesh.GetEdgeLength(Neighbor) * LongestEdgeTolerance)
 			{
-				// GREEN split: 2 midpoints -> 3 triangles
-				GreenSplit2++;
-				if (!bHas20) // bHas01 && bHas12
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-
-					FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-
-					float DiagA = FVector::DistSquared(Positions[M01], Positions[V2]);
-					float DiagB = FVector::DistSquared(Positions[V0], Positions[M12]);
-					if (DiagA < DiagB)
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-						FinalTriangles.Add(M01); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-					}
-					else
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M12);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-						FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-					}
-				}
-				else if (!bHas01) // bHas12 && bHas20
-				{
-					int32 M12 = GetOrCreateMidpoint(V1, V2);
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-					FinalTriangles.Add(M20); FinalTriangles.Add(M12); FinalTriangles.Add(V2);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-
-					float DiagA = FVector::DistSquared(Positions[V0], Positions[M12]);
-					float DiagB = FVector::DistSquared(Positions[V1], Positions[M20]);
-					if (DiagA < DiagB)
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M12);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-						FinalTriangles.Add(V0); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-					}
-					else
-					{
-						FinalTriangles.Add(V0); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-						FinalTriangles.Add(V1); FinalTriangles.Add(M12); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-					}
-				}
-				else // bHas01 && bHas20
-				{
-					int32 M01 = GetOrCreateMidpoint(V0, V1);
-					int32 M20 = GetOrCreateMidpoint(V2, V0);
-
-					FinalTriangles.Add(V0); FinalTriangles.Add(M01); FinalTriangles.Add(M20);
-					FinalMaterialIndices.Add(MatIdx);
-					FinalIsTarget.Add(bIsTarget);
-
-					float DiagA = FVector::DistSquared(Positions[V1], Positions[M20]);
-					float DiagB = FVector::DistSquared(Positions[M01], Positions[V2]);
-					if (DiagA < DiagB)
-					{
-						FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-						FinalTriangles.Add(M20); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-					}
-					else
-					{
-						FinalTriangles.Add(M01); FinalTriangles.Add(V1); FinalTriangles.Add(V2);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-						FinalTriangles.Add(M01); FinalTriangles.Add(V2); FinalTriangles.Add(M20);
-						FinalMaterialIndices.Add(MatIdx);
-						FinalIsTarget.Add(bIsTarget);
-					}
-				}
+				// Neighbor has a longer edge: bisect it first
+				Stack.Push(NeighborFace);
+				continue;
 			}
 		}
 
-		Triangles = MoveTemp(FinalTriangles);
-		MaterialIndices = MoveTemp(FinalMaterialIndices);
-		IsTargetTriangle = MoveTemp(FinalIsTarget);
-
-		// If no split occurred, stop early
-		if (SplitCount == 0 && GreenSplit1 == 0 && GreenSplit2 == 0 && GreenSplit3 == 0)
-		{
-			break;
-		}
+		// Terminal edge (or boundary): split both sides
+		SplitEdge(Mesh, LongestEdge, &OutSplitFaces);
+		Stack.Pop(EAllowShrinking::No);
 	}
+}
 
-	// Rebuild half-edge mesh from result with parent info
-	Mesh.Clear();
-	Mesh.BuildFromTriangles(Positions, Triangles, UVs, MaterialIndices, &ParentIndices);
+int32 FLEBSubdivision::SplitFaceByEdge(FHalfEdgeMesh& Mesh, int32 HalfEdgeIndex, int32 MidpointVertex)
+{
+	// Face F: E (a->b), E1 (b->c), E2 (c->a)
+	//   -> F: E (a->M), H1 (M->c), E2 (c->a)
+	//   -> G: H2 (M->b), E1 (b->c), H3 (c->M)
+	// Twins of E and H2 are linked by the caller
+	const int32 E = HalfEdgeIndex;
+	const int32 E1 = Mesh.HalfEdges[E].NextIndex;
+	const int32 E2 = Mesh.HalfEdges[E].PrevIndex;
+	const int32 F = Mesh.HalfEdges[E].FaceIndex;
+	const int32 VB = Mesh.HalfEdges[E].VertexIndex;
+	const int32 VC = Mesh.HalfEdges[E1].VertexIndex;
+
+	const int32 G = Mesh.Faces.Num();
+	const int32 H1 = Mesh.HalfEdges.Num();
+	const int32 H2 = H1 + 1;
+	const int32 H3 = H1 + 2;
+
+	FHalfEdge NewH1;
+	NewH1.VertexIndex = VC;
+	NewH1.NextIndex = E2;
+	NewH1.PrevIndex = E;
+	NewH1.FaceIndex = F;
+	NewH1.TwinIndex = H3;
+
+	FHalfEdge NewH2;
+	NewH2.VertexIndex = VB;
+	NewH2.NextIndex = E1;
+	NewH2.PrevIndex = H3;
+	NewH2.FaceIndex = G;
+	NewH2.TwinIndex = -1;
+
+	FHalfEdge NewH3;
+	NewH3.VertexIndex = MidpointVertex;
+	NewH3.NextIndex = H2;
+	NewH3.PrevIndex = E1;
+	NewH3.FaceIndex = G;
+	NewH3.TwinIndex = H1;
+
+	Mesh.HalfEdges.Add(NewH1);
+	Mesh.HalfEdges.Add(NewH2);
+	Mesh.HalfEdges.Add(NewH3);
+
+	FHalfEdge& EdgeE = Mesh.HalfEdges[E];
+	EdgeE.VertexIndex = MidpointVertex;
+	EdgeE.NextIndex = H1;
+	EdgeE.TwinIndex = -1;
+	EdgeE.SeamTwinIndex = -1;
+
+	Mesh.HalfEdges[E2].PrevIndex = H1;
+
+	FHalfEdge& EdgeE1 = Mesh.HalfEdges[E1];
+	EdgeE1.FaceIndex = G;
+	EdgeE1.PrevIndex = H2;
+	EdgeE1.NextIndex = H3;
+
+	FHalfEdgeFace NewFace = Mesh.Faces[F];
+	NewFace.HalfEdgeIndex = H2;
+	NewFace.SubdivisionLevel++;
+
+	FHalfEdgeFace& ParentFace = Mesh.Faces[F];
+	ParentFace.HalfEdgeIndex = E;
+	ParentFace.SubdivisionLevel++;
+
+	Mesh.Faces.Add(NewFace);
+
+	if (Mesh.Vertices[MidpointVertex].HalfEdgeIndex == -1)
+	{
+		Mesh.Vertices[MidpointVertex].HalfEdgeIndex = H1;
+	}
 
-	int32 FinalTriCount = Triangles.Num() / 3;
-	return FinalTriCount - InitialTriCount;
+	return G;
 }
@@ -55,6 +55,12 @@ struct FAffectedVertex
         , LayerType(InLayerType)
     {
     }
+
+    friend FArchive& operator<<(FArchive& Ar, FAffectedVertex& Vertex)
+    {
+        Ar << Vertex.VertexIndex << Vertex.RadialDistance << Vertex.Influence << Vertex.LayerType;
+        return Ar;
+    }
 };
 
 /**
@@ -113,6 +119,8 @@ struct FRingAffectedData
 
     /**
      * List of affected vertices with influence weights
+     * Only kept in editor builds (debug drawing, cooking); released after registration otherwise,
+     * the GPU passes use the Packed* arrays
      */
     TArray<FAffectedVertex> Vertices;
 
@@ -211,6 +219,7 @@ struct FRingAffectedData
     /**
      * GPU buffer: PBD adjacency data for smoothing region
      * Format: [Count, N0, RL0, N1, RL1, ...] per vertex (1 + MAX_NEIGHBORS*2 uints)
+     * Neighbors carry PBD_NEIGHBOR_ANCHOR_BIT when they are affected vertices
      */
     TArray<uint32> SmoothingRegionPBDAdjacency;
 
@@ -324,34 +333,11 @@ struct FRingAffectedData
     static constexpr int32 PBD_MAX_NEIGHBORS = 12;
     /** Packed size per vertex: [Count, (Neighbor, RestLen)*12] = 1 + 24 = 25 uints */
     static constexpr int32 PBD_ADJACENCY_PACKED_SIZE = 1 + PBD_MAX_NEIGHBORS * 2;
-
-    /**
-     * GPU buffer: Packed adjacency data with rest lengths for PBD
-     * Format: [NeighborCount, Neighbor0, RestLen0, Neighbor1, RestLen1, ...] per affected vertex
-     * RestLength is stored as bit-cast uint (use asfloat in shader)
-     */
-    TArray<uint32> PBDAdjacencyWithRestLengths;
-
-    /**
-     * GPU buffer: Full mesh influence map (for neighbor weight lookup)
-     * Index: absolute vertex index, Value: influence
-     * Vertices not in affected set have 0 influence
-     */
-    TArray<float> FullInfluenceMap;
-
-    /**
-     * GPU buffer: Full mesh deform amount map (for neighbor weight lookup)
-     * Index: absolute vertex index, Value: deform amount
-     * Used when bPBDUseDeformAmountWeight is true
-     */
-    TArray<float> FullDeformAmountMap;
-
     /**
-     * GPU buffer: Full mesh IsAnchor map (for PBD neighbor weight lookup)
-     * Index: absolute vertex index, Value: 1 = Affected/Anchor, 0 = Non-Affected/Free
-     * Used by Tolerance-based PBD to determine neighbor's anchor status for weight distribution
+     * Set on a PBD neighbor entry when the neighbor is an affected (anchor) vertex (must match shader)
+     * Replaces a full mesh size anchor map, so PBD data stays in affected index space
      */
-    TArray<uint32> FullVertexAnchorFlags;
+    static constexpr uint32 PBD_NEIGHBOR_ANCHOR_BIT = 0x80000000u;
 
     // =========== Hop-Based Smoothing Data ===========
 
@@ -377,6 +363,17 @@ struct FRingAffectedData
 
     // Note: Extended~ variables are unified into SmoothingRegion~ (see above)
 
+    // =========== Cooked Data Validation ===========
+
+    /**
+     * Key of the inputs this data was built from (Ring settings, bind pose bone, layer types)
+     * 0 = not cookable (Ring skipped or deferred)
+     */
+    uint32 CookKey = 0;
+
+    /** Whether vertices were selected with the Ring's SDF (Auto mode) */
+    bool bSelectedWithSDF = false;
+
     FRingAffectedData()
         : BoneName(NAME_None)
         , RingCenter(FVector::ZeroVector)
@@ -403,6 +400,15 @@ struct FRingAffectedData
             PackedLayerTypes.Add(static_cast<uint32>(Vert.LayerType));
         }
     }
+
+    /** Heap memory held by this Ring's data (bytes) */
+    SIZE_T GetAllocatedSize() const;
+
+    /**
+     * Cooked data serialization (FFleshRingCookedRingAffectedData::Payload)
+     * Packed buffers are not stored, they are rebuilt on load
+     */
+    friend FArchive& operator<<(FArchive& Ar, FRingAffectedData& Data);
 };
 
 // ============================================================================
@@ -440,6 +446,15 @@ public:
      */
     void QueryOBB(const FTransform& LocalToWorld, const FVector& LocalMin, const FVector& LocalMax, TArray<int32>& OutIndices) const;
 
+    /**
+     * Find the vertex closest to Position (no distance limit)
+     * Searches cell shells outward from Position's cell, stops once no closer vertex can exist
+     * @param Position - Query position
+     * @param OutDistanceSquared - Squared distance to the returned vertex
+     * @return Vertex index, INDEX_NONE if the hash is empty
+     */
+    int32 FindNearest(const FVector& Position, float& OutDistanceSquared) const;
+
     /** Check if hash is built */
     bool IsBuilt() const { return CellMap.Num() > 0; }
 
@@ -468,6 +483,8 @@ private:
 
     float CellSize;
     float InvCellSize;
+    FIntVector MinCellKey = FIntVector::ZeroValue;  // Occupied cell range (bounds FindNearest shells)
+    FIntVector MaxCellKey = FIntVector::ZeroValue;
     TMap<uint64, TArray<int32>> CellMap;  // Cell hash -> vertex indices
     TArray<FVector3f> CachedVertices;     // Cached vertex positions
 };
@@ -608,10 +625,12 @@ protected:
 // ============================================================================
 // FSDFBoundsBasedVertexSelector - SDF Bounds-based selection
 // ============================================================================
-// Uses: Context.SDFCache (BoundsMin, BoundsMax), Context.AllVertices
+// Uses: Context.SDFCache (BoundsMin, BoundsMax, CPUVolume), Context.AllVertices
 // Ignores: Context.RingSettings geometry, Context.BoneTransform
 //
 // Design: Select all vertices within SDF bounding box.
+// If CPUVolume is available, vertices deeper than 1 voxel inside the donut hole are rejected
+// (TightnessCS never moves them).
 // GPU shader determines actual influence via SDF sampling.
 // If SDFCache is nullptr or invalid, selects nothing.
 
@@ -731,6 +750,18 @@ public:
         const USkeletalMeshComponent* SkeletalMesh,
         int32 LODIndex = 0);
 
+    /**
+     * Export per-Ring data as cooked payloads (FSubdivisionSettings::CookedAffectedData)
+     * Fails while any Ring is dirty (e.g. waiting for its SDF)
+     *
+     * @param OutCooked - Output: mesh hash and serialized Ring data
+     * @return true if every Ring was exported
+     */
+    bool ExportCookedData(FFleshRingCookedLODAffectedData& OutCooked) const;
+
+    /** Version of the cooked payload layout (bump when FRingAffectedData serialization changes) */
+    static constexpr int32 CookedDataVersion = 3;
+
     /**
      * Get affected data for a specific Ring by index
      */
@@ -757,6 +788,11 @@ public:
      */
     int32 GetTotalAffectedCount() const;
 
+    /**
+     * Heap memory held by registered Ring data and mesh caches (bytes)
+     */
+    SIZE_T GetAllocatedSize() const;
+
     // ===== Per-Ring Dirty Flag System (prevents unnecessary rebuilds) =====
 
     /**
@@ -876,6 +912,16 @@ private:
      */
     FVertexSpatialHash VertexSpatialHash;
 
+    /**
+     * CRC of cached mesh vertices + indices (identifies the LOD geometry for cooked data)
+     */
+    uint32 MeshDataHash = 0;
+
+    /**
+     * CRC of cached vertex layer types (part of every Ring's CookKey)
+     */
+    uint32 LayerTypesHash = 0;
+
     /**
      * Per-Ring dirty flags (true = needs rebuild)
      */
@@ -933,6 +979,29 @@ private:
      */
     TMap<FIntVector, uint32> CachedPositionToRepresentative;
 
+    /**
+     * Key of the inputs a Ring's data is built from (never 0)
+     * Ring settings, bind pose bone transform and vertex layer types
+     */
+    uint32 CalculateRingCookKey(const FFleshRingSettings& RingSettings, const FTransform& BoneTransform) const;
+
+    /**
+     * Load a Ring's data from the asset's cooked payload
+     *
+     * @param Cooked - Cooked data of this LOD (MeshDataHash already matched)
+     * @param RingIndex - Ring index
+     * @param CookKey - Expected key (CalculateRingCookKey)
+     * @param bSelectWithSDF - Whether a fresh build would select with the SDF
+     * @param OutRingData - Output: deserialized Ring data
+     * @return true if the payload matched and was loaded
+     */
+    bool LoadCookedRingData(
+        const FFleshRingCookedLODAffectedData& Cooked,
+        int32 RingIndex,
+        uint32 CookKey,
+        bool bSelectWithSDF,
+        FRingAffectedData& OutRingData) const;
+
     /**
      * Extract vertices from skeletal mesh at specific LOD (bind pose component space)
      */
@@ -1014,33 +1083,12 @@ private:
         const TArray<FVector3f>& AllVertices,
         float BucketSize = 1.0f);
 
-    /**
-     * Build PBD adjacency data with rest lengths for edge constraint
-     *
-     * Builds per-vertex neighbor lists with rest lengths from mesh indices.
-     * Rest length = bind pose distance between vertices.
-     * Also builds full mesh influence/deform maps for neighbor weight lookup.
-     *
-     * Output:
-     * - RingData.PBDAdjacencyWithRestLengths: [Count, N0, RL0, N1, RL1, ...] per vertex
-     * - RingData.FullInfluenceMap: influence for all mesh vertices
-     * - RingData.FullDeformAmountMap: deform amount for all mesh vertices
-     *
-     * @param RingData - Ring data with Vertices already populated
-     * @param MeshIndices - Mesh index buffer (3 indices per triangle)
-     * @param AllVertices - All mesh vertices in bind pose component space
-     * @param TotalVertexCount - Total number of vertices in mesh
-     */
-    void BuildPBDAdjacencyData(
-        FRingAffectedData& RingData,
-        const TArray<uint32>& MeshIndices,
-        const TArray<FVector3f>& AllVertices,
-        int32 TotalVertexCount);
-
     /**
      * Build PBD adjacency data for Smoothing Region vertices
      *
-     * Same as BuildPBDAdjacencyData but for SmoothingRegionIndices range.
+     * Builds per-vertex neighbor lists with rest lengths (bind pose distance) for the
+     * SmoothingRegionIndices range. Neighbors that are affected vertices are tagged
+     * with PBD_NEIGHBOR_ANCHOR_BIT.
      *
      * Output:
      * - RingData.SmoothingRegionPBDAdjacency: [Count, N0, RL0, N1, RL1, ...] per vertex
@@ -1071,6 +1119,12 @@ private:
         FRingAffectedData& RingData,
         const TArray<FVector3f>& AllVertices);
 
+    /**
+     * Membership mask of RingData.Vertices (affected = PBD anchor), for tagging PBD neighbor entries
+     * Temporary, only lives while PBD adjacency is packed
+     */
+    static TBitArray<> BuildAffectedVertexMask(const FRingAffectedData& RingData, int32 TotalVertexCount);
+
     /**
      * Build adjacency data for Smoothing Region vertices (Normal recomputation)
      *
@@ -0,0 +1,55 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingAnalyticProxy.h
+// Fits a Virtual Band (closed-form influence) to a Ring mesh so near-band/torus meshes can skip SDF
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FleshRingTypes.h"
+
+class UStaticMesh;
+
+/**
+ * Analytic proxy fit result
+ */
+struct FLESHRINGRUNTIME_API FFleshRingAnalyticProxyFit
+{
+	/**
+	 * Fitted band in Ring mesh local space (MeshScale applied, MeshOffset/MeshRotation not applied)
+	 * Band axis = mesh local Z (same convention as the Ring SDF)
+	 */
+	FVirtualBandSettings Band;
+
+	/** RMS distance between mesh vertices and fitted band surfaces (cm) */
+	float RMSError = 0.0f;
+
+	/** Max distance between a mesh vertex and fitted band surfaces (cm) */
+	float MaxError = 0.0f;
+
+	/** Number of vertices evaluated */
+	int32 NumSamples = 0;
+
+	bool bValid = false;
+};
+
+/**
+ * Offline Ring mesh -> Virtual Band fitter
+ *
+ * Model: inner surface radius follows FVirtualBandSettings::GetRadiusAtHeight() around mesh local Z,
+ * outer surface = inner + BandThickness. Band section placement/height is searched over height bins,
+ * radii are taken from the measured inner profile.
+ */
+namespace FleshRingAnalyticProxy
+{
+	/** Fit to raw vertices (already in Ring mesh local space) */
+	FLESHRINGRUNTIME_API bool FitBand(
+		const TArray<FVector3f>& Vertices,
+		const FVector3f& MeshScale,
+		FFleshRingAnalyticProxyFit& OutFit);
+
+	/** Fit to a Ring static mesh (LOD 0) */
+	FLESHRINGRUNTIME_API bool FitBandToMesh(
+		UStaticMesh* RingMesh,
+		const FVector& MeshScale,
+		FFleshRingAnalyticProxyFit& OutFit);
+}
@@ -9,6 +9,12 @@
 
 class UFleshRingComponent;
 struct FSkeletalMaterial;
+class FSkeletalMeshLODRenderData;
+struct FFleshRingLODTransferSource;
+struct FExternalMorphSet;
+struct FFleshRingSubdivisionJob;
+struct FFleshRingSubdivisionLODJob;
+class FFleshRingSubdivisionProcessor;
 
 /** Delegate broadcast when asset changes (full refresh on structural changes) */
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnFleshRingAssetChanged, UFleshRingAsset*);
@@ -201,12 +207,40 @@ private:
 	/** Auto-detect layer type from material name */
 	static EFleshRingLayerType DetectLayerTypeFromMaterialName(const FSkeletalMaterial& Material);
 
+#if WITH_EDITOR
+	/**
+	 * Write one computed LOD of a subdivision job into TargetMesh's MeshDescription (FinishSubdivision helper)
+	 * @param SourceMesh - Mesh the job was gathered from (materials, morph targets)
+	 * @param OutBounds - Bounds of the subdivided LOD vertices
+	 */
+	bool BuildSubdividedLOD(USkeletalMesh* SourceMesh, USkeletalMesh* TargetMesh,
+		const FFleshRingSubdivisionLODJob& LODJob, FBox& OutBounds);
+
+	/** Release the current SubdividedMesh and switch world components back to the original mesh */
+	void DiscardSubdividedMeshForRebuild();
+
+	/**
+	 * Apply LOD0 deformation to every lower LOD MeshDescription of BakedMesh (closest-surface mapping)
+	 * @param TransferSource - Undeformed LOD0 render surface of the bake source mesh with its deformation
+	 */
+	void TransferDeformationToLowerLODs(USkeletalMesh* BakedMesh, const FFleshRingLODTransferSource& TransferSource);
+
+	/** Save current Ring mesh transforms into BakedRingTransforms (bone-relative) */
+	void StoreBakedRingTransforms();
+
+	/** Per-LOD subdivision processors kept between bakes (base mesh + per-Ring island caches, see BeginSubdivision) */
+	TMap<int32, TSharedPtr<FFleshRingSubdivisionProcessor>> SubdivisionProcessors;
+#endif
+
 	/**
 	 * For detecting Ring count changes during Undo/Redo (not included in transaction)
 	 * Not a UPROPERTY, so not restored on Undo, enabling change detection
 	 */
 	int32 LastKnownRingCount = 0;
 
+	/** Sparse morph sets per base mesh (weak: GPU buffers are released once the last component drops them) */
+	TMap<TObjectKey<USkeletalMesh>, TArray<TWeakPtr<FExternalMorphSet>>> SparseMorphSets;
+
 public:
 
 	/** Check if subdivided mesh exists */
@@ -216,6 +250,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "FleshRing|Baked")
 	bool HasBakedMesh() const;
 
+	/** Check if sparse delta bake exists (applied on the original mesh, no BakedMesh) */
+	UFUNCTION(BlueprintPure, Category = "FleshRing|Baked")
+	bool HasSparseBake() const;
+
+	/**
+	 * GPU morph sets of the sparse bake for BaseMesh, one per LOD (nullptr where a LOD has no deltas)
+	 * Shared by every component applying this asset to BaseMesh; buffers are built on the first request
+	 * @return Empty if BaseMesh doesn't match the bake
+	 */
+	TArray<TSharedPtr<FExternalMorphSet>> GetSparseMorphSets(const USkeletalMesh* BaseMesh);
+
 	/** Check if subdivision regeneration needed due to parameter changes */
 	bool NeedsSubdivisionRegeneration() const;
 
@@ -235,6 +280,27 @@ public:
 	 */
 	void GenerateSubdividedMesh(UFleshRingComponent* SourceComponent = nullptr);
 
+	/**
+	 * Staged GenerateSubdividedMesh, step 1 (game thread): copy the source LODs and resolve Ring selection volumes
+	 * Steps can be split so the CPU work of several assets runs concurrently (bake commandlet)
+	 *
+	 * @param SourceComponent - Same as GenerateSubdividedMesh
+	 * @return nullptr if subdivision can't run (disabled, missing mesh / Rings)
+	 */
+	TSharedPtr<FFleshRingSubdivisionJob> BeginSubdivision(UFleshRingComponent* SourceComponent = nullptr);
+
+	/** Staged GenerateSubdividedMesh, step 2 (any thread): region selection, topology (DDC cached), weight / attribute interpolation */
+	static void ComputeSubdivision(FFleshRingSubdivisionJob& Job);
+
+	/** Staged GenerateSubdividedMesh, final step (game thread): replace SubdividedMesh with a mesh built from the computed job */
+	void FinishSubdivision(FFleshRingSubdivisionJob& Job);
+
+	/** Stop a job's ComputeSubdivision before its next LOD (any thread, the job must not be finished afterwards) */
+	static void CancelSubdivision(FFleshRingSubdivisionJob& Job);
+
+	/** Full-mesh bake with subdivision whose SubdividedMesh is missing or stale (PrepareBakeSourceMesh regenerates it) */
+	bool NeedsBakeSubdivision() const;
+
 	/** Clear subdivided mesh (called via button in DetailCustomization) */
 	void ClearSubdividedMesh();
 
@@ -246,15 +312,46 @@ public:
 	 * Generate baked mesh (editor only)
 	 * Generate final mesh with deformations (Tightness, Bulge, Smoothing) applied
 	 * At runtime, uses this mesh to operate without Deformer
+	 * BakeOutput == Sparse Deltas: stores displaced vertices of the original mesh instead (SparseBakeLODs)
 	 *
 	 * @param SourceComponent - FleshRingComponent providing GPU deformation results
 	 * @return Success status
 	 */
 	bool GenerateBakedMesh(UFleshRingComponent* SourceComponent);
 
+	/**
+	 * Staged bake, step 1: resolve the bake source mesh (SubdividedMesh / original) and swap it onto SourceComponent
+	 * After a swap the Deformer must recompute before its cache can be read back
+	 * Regenerates a stale SubdividedMesh synchronously (see NeedsBakeSubdivision); non-blocking callers
+	 * run BeginSubdivision / ComputeSubdivision (worker) / FinishSubdivision first
+	 *
+	 * @param bOutSwapped - true if the component's mesh was changed by this call
+	 * @return Bake source mesh, nullptr on failure
+	 */
+	USkeletalMesh* PrepareBakeSourceMesh(UFleshRingComponent* SourceComponent, bool& bOutSwapped);
+
+	/**
+	 * Staged bake, final step (game thread): build BakedMesh / SparseBakeLODs from deformed geometry read back from SourceMesh
+	 * Geometry arrays are modified in place (missing Normals / Tangents are filled with defaults)
+	 *
+	 * @param SourceMesh - Mesh returned by PrepareBakeSourceMesh
+	 * @return Success status
+	 */
+	bool CommitBakedGeometry(USkeletalMesh* SourceMesh,
+		TArray<FVector3f>& DeformedPositions, TArray<FVector3f>& DeformedNormals, TArray<FVector4f>& DeformedTangents);
+
 	/** Clear baked mesh */
 	void ClearBakedMesh();
 
+	/**
+	 * Cook SourceComponent's registered affected vertex data into SubdivisionSettings.CookedAffectedData
+	 * Called by the bake before committing geometry (clears cooked data when bCookAffectedVertexData is off)
+	 * Deformer registration then reuses it per Ring instead of re-running vertex selection and adjacency builds
+	 *
+	 * @param SourceComponent - FleshRingComponent whose Deformer produced the bake
+	 */
+	void CookAffectedData(UFleshRingComponent* SourceComponent);
+
 	/**
 	 * Generate skinned ring meshes for runtime deformation
 	 * Ring meshes are converted to SkeletalMesh with bone weights sampled from nearby skin vertices
@@ -264,6 +361,14 @@ public:
 	 */
 	void GenerateSkinnedRingMeshes(USkeletalMesh* SourceMesh);
 
+	/**
+	 * Fit analytic band proxies for MeshBased Rings with bUseAnalyticProxy (editor only, offline)
+	 * Stores FittedBandProxy / AnalyticProxyFitError per Ring; Rings within their error budget skip SDF at runtime
+	 *
+	 * @param RingIndex - Ring to fit (INDEX_NONE = all Rings)
+	 */
+	void FitAnalyticProxies(int32 RingIndex = INDEX_NONE);
+
 	/** Check if bake regeneration needed due to parameter changes */
 	bool NeedsBakeRegeneration() const;
 
@@ -0,0 +1,86 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingBarycentricInterpolation.h
+// CPU barycentric attribute interpolation for subdivided vertices (bake + component)
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSubdivisionVertexData;
+
+/**
+ * Parent indices and barycentric weights in SoA layout
+ * One entry per subdivided vertex, built from FSubdivisionVertexData
+ */
+struct FLESHRINGRUNTIME_API FFleshRingBarycentricParents
+{
+	TArray<uint32> Parent0;
+	TArray<uint32> Parent1;
+	TArray<uint32> Parent2;
+
+	TArray<float> Weight0;
+	TArray<float> Weight1;
+	TArray<float> Weight2;
+
+	int32 Num() const { return Parent0.Num(); }
+
+	/** Parent indices are clamped to SourceVertexCount - 1 */
+	void Build(const TArray<FSubdivisionVertexData>& VertexData, int32 SourceVertexCount);
+};
+
+/**
+ * Per-vertex attribute streams (SoA)
+ * Empty streams are skipped by the interpolation kernel
+ */
+struct FLESHRINGRUNTIME_API FFleshRingVertexStreams
+{
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Normals;
+
+	/** xyz = TangentX, w = binormal sign */
+	TArray<FVector4f> Tangents;
+
+	TArray<FVector2f> UVs;
+
+	/** Influences per vertex in BoneIndices / BoneWeights */
+	int32 NumBoneInfluences = 0;
+
+	/** Skeleton bone indices (NumBoneInfluences per vertex) */
+	TArray<uint16> BoneIndices;
+
+	/** 0-255 weights (NumBoneInfluences per vertex) */
+	TArray<uint8> BoneWeights;
+
+	int32 NumVertices() const { return Positions.Num(); }
+	bool HasBoneWeights() const { return NumBoneInfluences > 0 && BoneWeights.Num() == Positions.Num() * NumBoneInfluences; }
+};
+
+/**
+ * Subdivided vertex attribute generation
+ *
+ * Same kernel for bake (UFleshRingAsset) and runtime preview (UFleshRingSubdivisionComponent):
+ * chunked ParallelFor + VectorRegister math, fixed per-vertex operation order,
+ * so the output is bit-identical regardless of caller or thread count.
+ *
+ * - Position / UV: barycentric blend
+ * - Normal: blend + normalize
+ * - Tangent: xyz blend + normalize, w from Parent0
+ * - Bone weights: merged per bone, top NumBoneInfluences kept, renormalized to sum 255
+ */
+namespace FleshRingBarycentricInterpolation
+{
+	/** Vertices per ParallelFor task */
+	constexpr int32 ChunkSize = 1024;
+
+	/**
+	 * Interpolate all non-empty Source streams at Parents
+	 *
+	 * @param Source - Source mesh streams (indexed by parent)
+	 * @param Parents - Parents / weights of each output vertex
+	 * @param Out - Output streams (resized to Parents.Num(), NumBoneInfluences copied from Source)
+	 */
+	FLESHRINGRUNTIME_API void Interpolate(
+		const FFleshRingVertexStreams& Source,
+		const FFleshRingBarycentricParents& Parents,
+		FFleshRingVertexStreams& Out);
+}
@@ -19,6 +19,7 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphResources.h"
 #include "RenderGraphUtils.h"
+#include "FleshRingRuntimeSettings.h"
 
 // Maximum vertices per slice (must match shader)
 #define FLESHRING_MAX_SLICE_VERTICES 32
@@ -72,7 +73,7 @@ public:
 
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
     {
-        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+        return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
     }
 
     static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -8,6 +8,7 @@
 #include "RenderGraphResources.h"
 #include "RenderGraphUtils.h"
 #include "FleshRingDebugTypes.h"
+#include "FleshRingRuntimeSettings.h"
 
 /**
  * Bulge Compute Shader
@@ -63,7 +64,7 @@ public:
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
-		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+		return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
 	}
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
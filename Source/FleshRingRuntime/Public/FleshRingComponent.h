@@ -13,6 +13,8 @@
 #include "FleshRingDebugPointComponent.h"
 #include "FleshRingModularTypes.h"
 #include "RenderGraphResources.h"
+#include "RenderCommandFence.h"
+#include "FleshRingSDFVolume.h"
 #include "FleshRingComponent.generated.h"
 
 class UStaticMesh;
@@ -20,6 +22,7 @@ class UVolumeTexture;
 class UFleshRingAsset;
 class UFleshRingMeshComponent;
 struct IPooledRenderTarget;
+struct FRingSDFPendingReadback;
 
 // =====================================
 // SDF Cache Struct (Persistent per-Ring storage)
@@ -70,10 +73,41 @@ struct FRingSDFCache
 	/** Caching complete flag */
 	bool bCached = false;
 
-	/** Reset cache */
+	/**
+	 * CPU copy of the SDF (read back once after generation, published together with PooledTexture)
+	 * Used by FSDFBoundsBasedVertexSelector to skip vertices TightnessCS never moves.
+	 * nullptr if readback failed (selector falls back to bounds-only selection)
+	 */
+	TSharedPtr<const FFleshRingSDFVolume, ESPMode::ThreadSafe> CPUVolume;
+
+	/**
+	 * Async generation result slot (written on render thread, published on game thread)
+	 * Valid only while generation is in flight. Shared so that resetting the cache
+	 * while the render command is still queued never leaves a dangling write target.
+	 */
+	TSharedPtr<TRefCountPtr<IPooledRenderTarget>, ESPMode::ThreadSafe> PendingTexture;
+
+	/** Async readback target for CPUVolume (filled on render thread, same lifetime rules as PendingTexture) */
+	TSharedPtr<FFleshRingSDFVolume, ESPMode::ThreadSafe> PendingVolume;
+
+	/** GPU -> CPU copy of the corrected SDF, polled from tick until the GPU has finished it */
+	TSharedPtr<FRingSDFPendingReadback, ESPMode::ThreadSafe> PendingReadback;
+
+	/** Completion fence for the in-flight generation command (texture usable once signaled) */
+	FRenderCommandFence GenerationFence;
+
+	/**
+	 * Reset cache
+	 * The published texture is released on the render thread, after any queued
+	 * deformer dispatch that still references it (no rendering flush needed)
+	 */
 	void Reset()
 	{
-		PooledTexture.SafeRelease();
+		ReleasePooledTexture();
+		PendingTexture.Reset();
+		PendingVolume.Reset();
+		PendingReadback.Reset();
+		CPUVolume.Reset();
 		BoundsMin = FVector3f::ZeroVector;
 		BoundsMax = FVector3f::ZeroVector;
 		Resolution = FIntVector(64, 64, 64);
@@ -87,6 +121,15 @@ struct FRingSDFCache
 	{
 		return bCached && PooledTexture.IsValid();
 	}
+
+	/** Move PooledTexture into a render command that drops the reference */
+	void ReleasePooledTexture();
+
+	/** True while SDF generation is queued on the GPU and not yet published */
+	bool IsPending() const
+	{
+		return PendingTexture.IsValid();
+	}
 };
 
 // =====================================
@@ -380,9 +423,28 @@ public:
 		return false;
 	}
 
+	/** Check if any Ring SDF is still being generated on the GPU */
+	bool HasAnyPendingSDFCaches() const
+	{
+		for (const FRingSDFCache& Cache : RingSDFCaches)
+		{
+			if (Cache.IsPending())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
 	/** Check if any Rings operate without SDF (VirtualRing/VirtualBand - distance-based logic) */
 	bool HasAnyNonSDFRings() const;
 
+	/**
+	 * Block until all pending SDF generations complete and publish them.
+	 * Only for callers that need SDF synchronously (e.g. bake); normal flow publishes from TickComponent.
+	 */
+	void FinishPendingSDFGeneration();
+
 	/** Regenerate SDF (for real-time VirtualBand updates in editor) */
 	void RefreshSDF() { GenerateSDF(); }
 
@@ -393,6 +455,12 @@ private:
 	/** True when using BakedMesh at runtime (Deformer disabled) */
 	bool bUsingBakedMesh = false;
 
+	/** Sparse bake morph sets (index = LOD, shared with the asset) registered on SparseBakeTarget (original mesh kept, bUsingBakedMesh also true) */
+	TArray<TSharedPtr<FExternalMorphSet>> SparseMorphSets;
+
+	/** Target SparseMorphSets were registered on (target may change before removal) */
+	TWeakObjectPtr<USkeletalMeshComponent> SparseBakeTarget;
+
 	/**
 	 * True when using FleshRing with Skeletal Merging system.
 	 * In this mode, BakedMesh is already merged into the character mesh,
@@ -471,9 +539,16 @@ private:
 	 */
 	bool RefreshWithDeformerReuse();
 
-	/** Generate SDF (based on each Ring's RingMesh) */
+	/** Generate SDF (based on each Ring's RingMesh), asynchronous - published in PollPendingSDFGeneration() */
 	void GenerateSDF();
 
+	/**
+	 * Publish SDF caches whose generation fence has completed
+	 * Re-triggers affected vertex registration for each Ring that became ready
+	 * @param bWaitForCompletion - Block on pending fences instead of skipping them
+	 */
+	void PollPendingSDFGeneration(bool bWaitForCompletion = false);
+
 	/** Create Ring mesh components and attach to bone */
 	void SetupRingMeshes();
 
@@ -487,9 +562,12 @@ private:
 	 */
 	void CleanupOrphanedRingMeshComponents();
 
-	/** Apply baked mesh (BakedMesh + BakedRingTransforms) */
+	/** Apply baked mesh (BakedMesh or SparseBakeLODs + BakedRingTransforms) */
 	void ApplyBakedMesh();
 
+	/** Unregister SparseMorphSets and drop this component's references (no-op if not applied) */
+	void RemoveSparseBake();
+
 	/** Apply baked Ring transforms (restore Ring mesh positions) */
 	void ApplyBakedRingTransforms();
 
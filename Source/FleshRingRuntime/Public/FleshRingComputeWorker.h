@@ -204,28 +204,12 @@ struct FFleshRingWorkItem
 		float PBDTolerance = 0.2f;  // Tolerance ratio (0.2 = allow 80%~120%)
 		bool bPBDAnchorAffectedVertices = true;  // true: Affected Vertices fixed, false: all vertices free
 
-		// PBD adjacency data (includes rest length)
-		// Packed format: [NeighborCount, Neighbor0, RestLen0(as uint), Neighbor1, RestLen1, ...] per affected vertex
-		// RestLength is stored as float bit-cast to uint
-		TArray<uint32> PBDAdjacencyWithRestLengths;
-
-		// Influence map for all vertices (for neighbor weight lookup)
-		// Index: full vertex index, Value: influence
-		TArray<float> FullInfluenceMap;
-
-		// DeformAmount map for all vertices (for neighbor weight lookup)
-		// Index: full vertex index, Value: deform amount
-		TArray<float> FullDeformAmountMap;
-
-		// IsAnchor map for all vertices (for Tolerance-based PBD)
-		// Index: full vertex index, Value: 1=Affected/anchor, 0=Non-Affected/free
-		// Used to query neighbor's anchor status for PBD weight distribution
-		TArray<uint32> FullVertexAnchorFlags;
-
-		// ===== Cached Zero arrays (used when bPBDAnchorAffectedVertices=false) =====
-		// Pre-created Zero-filled arrays to avoid per-tick allocation
+		// PBD adjacency comes from SmoothingRegionPBDAdjacency
+		// Neighbor anchor status is packed into its neighbor entries (FRingAffectedData::PBD_NEIGHBOR_ANCHOR_BIT)
+
+		// ===== Cached Zero array (used when bPBDAnchorAffectedVertices=false) =====
+		// Pre-created Zero-filled array to avoid per-tick allocation
 		TArray<uint32> CachedZeroIsAnchorFlags;   // Size of PBD target vertex count
-		TArray<uint32> CachedZeroFullVertexAnchorFlags;   // Size of total vertex count
 	};
 	TSharedPtr<TArray<FRingDispatchData>> RingDispatchDataPtr;
 
@@ -286,6 +270,9 @@ struct FFleshRingWorkItem
 	// Caches TangentRecomputeCS results to use correct tangents on cached frames
 	TSharedPtr<TRefCountPtr<FRDGPooledBuffer>> CachedTangentsBufferSharedPtr;
 
+#if WITH_EDITORONLY_DATA
+	// Debug outputs below are only requested by editor visualization
+
 	// ===== Debug Influence cache buffer =====
 	// Caches Influence values output from TightnessCS
 	// For visualizing GPU-computed Influence in DrawDebugPoint
@@ -325,6 +312,7 @@ struct FFleshRingWorkItem
 
 	// Number of vertices to Readback
 	uint32 DebugInfluenceCount = 0;
+#endif
 
 	// Fallback delegate
 	FSimpleDelegate FallbackDelegate;
@@ -11,6 +11,7 @@
 #include "RenderGraphResources.h"
 #include "RenderGraphUtils.h"
 #include "FleshRingDebugTypes.h"
+#include "FleshRingRuntimeSettings.h"
 
 /**
  * Debug Point Output Compute Shader
@@ -42,7 +43,7 @@ public:
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
-		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+		return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
 	}
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -7,6 +7,7 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphResources.h"
 #include "FleshRingDebugTypes.h"
+#include "FleshRingRuntimeSettings.h"
 
 /**
  * FFleshRingDebugPointVS - Debug Point Vertex Shader
@@ -44,8 +45,7 @@ public:
 
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
     {
-        // Require SM5 for structured buffer support
-        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+        return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
     }
 };
 
@@ -81,7 +81,6 @@ public:
 
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
     {
-        // Require SM5 for consistent rendering
-        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+        return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
     }
 };
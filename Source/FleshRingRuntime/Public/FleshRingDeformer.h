@@ -8,6 +8,7 @@
 
 class UFleshRingDeformerInstance;
 class UFleshRingComponent;
+class ITargetPlatform;
 
 UCLASS(Blueprintable, BlueprintType, Meta = (DisplayName = "Flesh Ring Deformer"))
 class FLESHRINGRUNTIME_API UFleshRingDeformer : public UMeshDeformer
@@ -24,6 +25,12 @@ public:
 	virtual UMeshDeformerInstanceSettings* CreateSettingsInstance(UMeshComponent* InMeshComponent) override;
 	virtual UMeshDeformerInstance* CreateInstance(UMeshComponent* InMeshComponent, UMeshDeformerInstanceSettings* InSettings) override;
 
+	// UObject interface
+#if WITH_EDITOR
+	/** Stripped from cooked game content of platforms in bake-only mode (UFleshRingRuntimeSettings::bBakedMeshOnlyRuntime) */
+	virtual bool NeedsLoadForTargetPlatform(const ITargetPlatform* TargetPlatform) const override;
+#endif
+
 private:
 	/** Cache created DeformerInstance (access via GetActiveInstance()) */
 	UPROPERTY(Transient)
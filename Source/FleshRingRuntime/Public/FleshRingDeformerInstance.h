@@ -16,6 +16,20 @@ class UFleshRingDeformer;
 class UMeshComponent;
 class FMeshDeformerGeometry;
 class UFleshRingComponent;
+#if WITH_EDITORONLY_DATA
+struct FFleshRingGeometryReadback;
+
+/** Status of a non-blocking deformed geometry readback */
+enum class EFleshRingReadbackStatus : uint8
+{
+	/** GPU copy or CPU copy still in flight */
+	Pending,
+	/** Result returned, readback finished */
+	Ready,
+	/** Nothing to read back (no readback started or cache invalidated) */
+	Failed
+};
+#endif
 
 UCLASS()
 class FLESHRINGRUNTIME_API UFleshRingDeformerInstance : public UMeshDeformerInstance
@@ -74,6 +88,7 @@ public:
 		return nullptr;
 	}
 
+#if WITH_EDITORONLY_DATA
 	/**
 	 * Check if GPU Influence Readback is complete
 	 * @param LODIndex - LOD index
@@ -161,6 +176,7 @@ public:
 		}
 		return nullptr;
 	}
+#endif
 
 	/**
 	 * Get Affected debug point count (value used for actual deformation)
@@ -176,6 +192,20 @@ public:
 		return 0;
 	}
 
+	/**
+	 * CPU memory held by registered AffectedVertices data across all LODs (bytes)
+	 * Excludes per-frame dispatch copies and GPU buffers
+	 */
+	SIZE_T GetAffectedDataAllocatedSize() const
+	{
+		SIZE_T Size = 0;
+		for (const FLODDeformationData& Data : LODData)
+		{
+			Size += Data.AffectedVerticesManager.GetAllocatedSize();
+		}
+		return Size;
+	}
+
 #if WITH_EDITORONLY_DATA
 	virtual bool RequestReadbackDeformerGeometry(TUniquePtr<FMeshDeformerGeometryReadbackRequest> InRequest) override { return false; }
 
@@ -195,12 +225,48 @@ public:
 		TArray<FVector4f>& OutTangents,
 		int32 LODIndex = 0);
 
+	/**
+	 * Starts a non-blocking readback of the cached deformed geometry (no render thread flush)
+	 * GPU copies go through FRHIGPUBufferReadback, result is collected with PollDeformedGeometryReadback
+	 * Replaces any readback still in flight
+	 *
+	 * @param LODIndex - LOD index
+	 * @return false if nothing is cached for LODIndex
+	 */
+	bool BeginDeformedGeometryReadback(int32 LODIndex = 0);
+
+	/**
+	 * Polls the readback started by BeginDeformedGeometryReadback (call once per frame from the game thread)
+	 * Output layout matches ReadbackDeformedGeometry (Normals / Tangents empty if unavailable)
+	 *
+	 * @return Ready once the outputs are filled, Pending while GPU / render thread work is in flight
+	 */
+	EFleshRingReadbackStatus PollDeformedGeometryReadback(
+		TArray<FVector3f>& OutPositions,
+		TArray<FVector3f>& OutNormals,
+		TArray<FVector4f>& OutTangents);
+
+	/** Drops the readback in flight (staging buffers are released with the last render command using them) */
+	void CancelDeformedGeometryReadback();
+
+	/** Whether a readback started by BeginDeformedGeometryReadback is still in flight */
+	bool IsDeformedGeometryReadbackPending() const { return PendingReadback.IsValid(); }
+
 	/**
 	 * Check if TightenedBindPose is cached
 	 * @param LODIndex - LOD index
 	 * @return true if cached
 	 */
 	bool HasCachedDeformedGeometry(int32 LODIndex = 0) const;
+
+	/**
+	 * Export affected vertex data of every registered LOD for cooking into the asset
+	 * LODs not registered yet (never rendered) or with Rings still dirty are skipped
+	 *
+	 * @param OutLODs - Cooked data, one entry per exported LOD (matched by mesh hash on load)
+	 * @return true if at least one LOD was exported
+	 */
+	bool ExportCookedAffectedData(TArray<FFleshRingCookedLODAffectedData>& OutLODs) const;
 #endif
 
 private:
@@ -221,6 +287,11 @@ private:
 	// Track last LOD index for invalidating previous position on LOD change
 	int32 LastLodIndex = INDEX_NONE;
 
+#if WITH_EDITORONLY_DATA
+	// Non-blocking bake readback in flight (shared with render commands)
+	TSharedPtr<FFleshRingGeometryReadback, ESPMode::ThreadSafe> PendingReadback;
+#endif
+
 	// ===== Per-LOD Tightness Deformation Data =====
 	// Per-LOD Tightness Deformation Data
 	struct FLODDeformationData
@@ -249,6 +320,7 @@ private:
 		// Caches Gram-Schmidt orthonormalized tangents
 		TSharedPtr<TRefCountPtr<FRDGPooledBuffer>> CachedTangentsShared;
 
+#if WITH_EDITORONLY_DATA
 		// Debug Influence caching (output from TightnessCS)
 		// For visualizing GPU-computed Influence in DrawAffectedVertices
 		TSharedPtr<TRefCountPtr<FRDGPooledBuffer>> CachedDebugInfluencesShared;
@@ -269,6 +341,7 @@ private:
 
 		// Number of vertices to Readback
 		uint32 DebugInfluenceCount = 0;
+#endif
 	};
 
 	// Per-LOD data array (index = LOD number)
@@ -17,6 +17,7 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphResources.h"
 #include "RenderGraphUtils.h"
+#include "FleshRingRuntimeSettings.h"
 
 // ============================================================================
 // FFleshRingHeatPropagationCS - Heat Propagation Compute Shader
@@ -60,7 +61,7 @@ public:
 
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
     {
-        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+        return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
     }
 
     static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -0,0 +1,113 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingLODTransfer.h
+// Transfers LOD0 deformation to lower LODs by closest-surface mapping (bake time)
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Binding of a target vertex to the closest point on a reference triangle mesh
+ */
+struct FLESHRINGRUNTIME_API FFleshRingSurfaceBinding
+{
+	/** Reference triangle index (INDEX_NONE = no surface within search range) */
+	int32 TriangleIndex = INDEX_NONE;
+
+	/** Barycentric coordinates of the closest point on the triangle */
+	FVector3f Barycentric = FVector3f(1.0f, 0.0f, 0.0f);
+
+	/** Distance from the target position to the closest point */
+	float Distance = 0.0f;
+
+	bool IsValid() const { return TriangleIndex != INDEX_NONE; }
+};
+
+/**
+ * Rest LOD0 surface with its deformation, bound against once per lower LOD
+ */
+struct FLESHRINGRUNTIME_API FFleshRingLODTransferSource
+{
+	TArray<FVector3f> RestPositions;
+	TArray<uint32> RestIndices;
+
+	/** Deformed - rest position per rest vertex */
+	TArray<FVector3f> PositionOffsets;
+
+	/** Deformed - rest unit normal per rest vertex (zero where no deformed normal) */
+	TArray<FVector3f> NormalOffsets;
+
+	/** Binding search range (simplified surfaces deviate from LOD0 by a small fraction of the mesh extent) */
+	float BindSearchDistance = 1.0f;
+
+	/** Largest position offset */
+	float MaxOffset = 0.0f;
+
+	bool HasDeformation() const { return MaxOffset > KINDA_SMALL_NUMBER; }
+};
+
+/**
+ * LOD0 -> lower LOD deformation transfer
+ *
+ * Lower LOD vertices are bound to the closest point on the rest LOD0 surface,
+ * then displaced by the barycentric blend of LOD0 (deformed - rest) offsets.
+ * Lower LODs keep their native vertex count while following the LOD0 silhouette.
+ */
+namespace FleshRingLODTransfer
+{
+	/**
+	 * Bind target positions to the closest reference triangle (uniform grid search, parallel)
+	 *
+	 * @param RefPositions - Reference (rest LOD0) vertex positions
+	 * @param RefIndices - Reference triangle indices
+	 * @param TargetPositions - Positions to bind (same space as reference)
+	 * @param MaxDistance - Bindings farther than this are left invalid
+	 * @param OutBindings - One binding per target position
+	 */
+	FLESHRINGRUNTIME_API void BindToClosestSurface(
+		const TArray<FVector3f>& RefPositions,
+		const TArray<uint32>& RefIndices,
+		const TArray<FVector3f>& TargetPositions,
+		float MaxDistance,
+		TArray<FFleshRingSurfaceBinding>& OutBindings);
+
+	/**
+	 * Simplification error of a target mesh relative to the reference surface
+	 * Percentile of the valid binding distances; the top tail (LOD-only geometry, holes closed by reduction) is ignored
+	 *
+	 * @param Bindings - Bindings from BindToClosestSurface
+	 * @param Percentile - Fraction of valid bindings the error must cover (0-1)
+	 * @return Error distance (0 if no binding is valid)
+	 */
+	FLESHRINGRUNTIME_API float EstimateSimplificationError(
+		const TArray<FFleshRingSurfaceBinding>& Bindings,
+		float Percentile = 0.95f);
+
+	/**
+	 * LOD0 offsets at the vertices of a lower LOD (full mesh bake MeshDescriptions, sparse bake render LODs)
+	 * Vertices farther from the rest surface than twice the LOD's simplification error get zero offsets
+	 *
+	 * @param Source - Rest LOD0 surface and offsets
+	 * @param TargetPositions - Lower LOD rest positions (same space as Source)
+	 * @param OutPositionOffsets / OutNormalOffsets - One per target position
+	 * @return Simplification error of the target (see EstimateSimplificationError)
+	 */
+	FLESHRINGRUNTIME_API float TransferOffsets(
+		const FFleshRingLODTransferSource& Source,
+		const TArray<FVector3f>& TargetPositions,
+		TArray<FVector3f>& OutPositionOffsets,
+		TArray<FVector3f>& OutNormalOffsets);
+
+	/** Barycentric blend of a per-reference-vertex value at a binding */
+	template <typename ValueType>
+	ValueType InterpolateAtBinding(
+		const FFleshRingSurfaceBinding& Binding,
+		const TArray<uint32>& RefIndices,
+		const TArray<ValueType>& Values)
+	{
+		const int32 Base = Binding.TriangleIndex * 3;
+		return Values[RefIndices[Base + 0]] * Binding.Barycentric.X +
+			Values[RefIndices[Base + 1]] * Binding.Barycentric.Y +
+			Values[RefIndices[Base + 2]] * Binding.Barycentric.Z;
+	}
+}
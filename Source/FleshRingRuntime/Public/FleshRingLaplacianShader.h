@@ -22,6 +22,7 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphResources.h"
 #include "RenderGraphUtils.h"
+#include "FleshRingRuntimeSettings.h"
 
 // Maximum neighbors per vertex (must match shader)
 #define FLESHRING_MAX_NEIGHBORS 12
@@ -117,7 +118,7 @@ public:
 
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
     {
-        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+        return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
     }
 
     static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -22,6 +22,7 @@
 #include "RenderGraphResources.h"
 #include "RenderGraphUtils.h"
 #include "FleshRingTypes.h"
+#include "FleshRingRuntimeSettings.h"
 
 // ============================================================================
 // Layer Type Constants (must match EFleshRingLayerType enum)
@@ -92,7 +93,7 @@ public:
 
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
     {
-        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+        return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
     }
 
     static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -129,7 +130,7 @@ public:
 
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
     {
-        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+        return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
     }
 
     static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
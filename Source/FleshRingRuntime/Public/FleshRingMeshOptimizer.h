@@ -0,0 +1,41 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingMeshOptimizer.h
+// Bake-time vertex cache / fetch locality optimization of subdivision topology
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSubdivisionTopologyResult;
+
+/**
+ * Subdivision appends midpoint vertices and split faces at the end of the buffers,
+ * so Ring regions end up scattered. This pass restores locality before the mesh is built:
+ * - Triangles: Forsyth linear-speed vertex cache optimization, per material section
+ * - Vertices: renumbered in first-use order of the optimized index buffer
+ *
+ * Operates on the topology result, so everything interpolated from it afterwards
+ * (positions, normals, UVs, bone weights) follows the new order.
+ */
+namespace FleshRingMeshOptimizer
+{
+	/** Post-transform cache size used for ACMR reporting (FIFO) */
+	constexpr int32 ACMRCacheSize = 16;
+
+	/**
+	 * Average cache miss ratio (transformed vertices per triangle) with a FIFO cache
+	 * 0.5 = ideal for large regular meshes, 3.0 = no reuse
+	 */
+	FLESHRINGRUNTIME_API float ComputeACMR(const TArray<uint32>& Indices, int32 CacheSize = ACMRCacheSize);
+
+	/** Reorder triangles of one index range for vertex cache reuse (Forsyth) */
+	FLESHRINGRUNTIME_API void OptimizeTriangleOrder(TArrayView<uint32> Indices, int32 NumVertices);
+
+	/**
+	 * Optimize a topology result in place
+	 * Triangles are grouped by material index (stable), optimized per group, then vertices are renumbered
+	 *
+	 * @param OutACMRBefore / OutACMRAfter - ACMR of the index buffer before and after
+	 */
+	FLESHRINGRUNTIME_API void OptimizeTopology(FSubdivisionTopologyResult& Result, float& OutACMRBefore, float& OutACMRAfter);
+}
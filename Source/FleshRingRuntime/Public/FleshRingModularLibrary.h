@@ -11,12 +11,16 @@ class USkeletalMesh;
 class USkeletalMeshComponent;
 class UFleshRingComponent;
 class UFleshRingAsset;
+class USkeleton;
+
+/** Completion of RebuildMergedMeshAsync (game thread) */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FFleshRingMergeCompleteDelegate, const FFleshRingMergeOutput&, Output);
 
 /**
  * Unified FleshRing library for modular characters
  *
  * Supported systems:
- * - Skeletal Merging: RebuildMergedMesh()
+ * - Skeletal Merging: RebuildMergedMesh(), RebuildMergedMeshAsync()
  * - Leader Pose / Copy Pose: SwapModularRingAsset(), SwapModularPartMesh()
  */
 UCLASS()
@@ -35,6 +39,8 @@ public:
 	 * Ring visuals are automatically set up.
 	 * Invalid parts (null BaseMesh) will be excluded with warning.
 	 * Parts with RingAsset but no BakedMesh will use BaseMesh with warning.
+	 * Results are kept in an LRU cache keyed by the ordered part meshes, ring assets and part mesh geometry;
+	 * recurring combinations reuse the cached mesh without merging.
 	 *
 	 * @param TargetComponent Target SkeletalMeshComponent to apply result (nullptr = only create mesh)
 	 * @param Parts Array of modular parts to merge (all parts must share the same skeleton)
@@ -48,6 +54,40 @@ public:
 		USkeletalMeshComponent* TargetComponent,
 		const TArray<FFleshRingModularPart>& Parts);
 
+	/**
+	 * RebuildMergedMesh with the part mesh hashing on a worker thread.
+	 * Validation failures complete immediately; otherwise the cache lookup (and the merge on a miss)
+	 * runs on the game thread once hashing finishes, and OnComplete runs after the mesh is applied.
+	 * Concurrent requests for the same combination share one merge.
+	 * A newer rebuild on the same TargetComponent supersedes this one (result is still reported, not applied).
+	 *
+	 * @param TargetComponent Target SkeletalMeshComponent to apply result (nullptr = only create mesh)
+	 * @param Parts Array of modular parts to merge (all parts must share the same skeleton)
+	 * @param OnComplete Called with the merge result
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FleshRing|Modular|Skeletal Merging",
+		meta = (DisplayName = "Rebuild Merged Mesh Async",
+			ToolTip = "Merges modular parts into a single skeletal mesh, hashing the parts on a worker thread.\nRecurring part combinations are served from the merged-mesh cache without merging.\nOnComplete is called on the game thread after the mesh and ring visuals are applied.",
+			Keywords = "merge combine modular skeletal mesh ring async cache"))
+	static void RebuildMergedMeshAsync(
+		USkeletalMeshComponent* TargetComponent,
+		const TArray<FFleshRingModularPart>& Parts,
+		FFleshRingMergeCompleteDelegate OnComplete);
+
+	/**
+	 * Sets the number of merged meshes kept by the merged-mesh cache (least recently used evicted first).
+	 *
+	 * @param Capacity Maximum cached combinations (0 = disable caching)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FleshRing|Modular|Skeletal Merging",
+		meta = (DisplayName = "Set Merged Mesh Cache Capacity"))
+	static void SetMergedMeshCacheCapacity(int32 Capacity);
+
+	/** Drops all cached merged meshes (meshes still assigned to components stay alive) */
+	UFUNCTION(BlueprintCallable, Category = "FleshRing|Modular|Skeletal Merging",
+		meta = (DisplayName = "Clear Merged Mesh Cache"))
+	static void ClearMergedMeshCache();
+
 	//==========================================================================
 	// Leader Pose / Copy Pose API
 	//==========================================================================
@@ -105,4 +145,25 @@ private:
 	 */
 	static int32 DetachAllRingVisuals(
 		USkeletalMeshComponent* MergedMeshComponent);
+
+	/**
+	 * Resolves the mesh of each valid part (BakedMesh or BaseMesh) and checks skeletons.
+	 * Fills warnings into Output; on failure Output carries the error.
+	 */
+	static bool ResolveMergeSources(
+		const TArray<FFleshRingModularPart>& Parts,
+		FFleshRingMergeOutput& Output,
+		TArray<USkeletalMesh*>& OutMeshes,
+		TArray<UFleshRingAsset*>& OutRingAssets,
+		USkeleton*& OutSkeleton);
+
+	/**
+	 * Applies merged mesh to target and recreates ring visuals.
+	 */
+	static void ApplyMergedMesh(
+		USkeletalMeshComponent* TargetComponent,
+		USkeletalMesh* MergedMesh,
+		const TArray<UFleshRingAsset*>& RingAssets);
+
+	friend class FFleshRingMergedMeshCache;
 };
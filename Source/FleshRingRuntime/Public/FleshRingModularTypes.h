@@ -87,6 +87,10 @@ struct FLESHRINGRUNTIME_API FFleshRingMergeOutput
 	UPROPERTY(BlueprintReadOnly, Category = "FleshRing")
 	TArray<int32> UnbakedRingPartIndices;
 
+	/** MergedMesh was reused from the merged-mesh cache (same ordered part meshes and ring assets) */
+	UPROPERTY(BlueprintReadOnly, Category = "FleshRing")
+	bool bFromCache = false;
+
 	/** Returns true if merge succeeded */
 	bool Succeeded() const { return Result == EFleshRingMergeResult::Success; }
 
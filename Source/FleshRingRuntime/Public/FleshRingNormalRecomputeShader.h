@@ -17,6 +17,7 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphResources.h"
 #include "RenderGraphUtils.h"
+#include "FleshRingRuntimeSettings.h"
 
 // ============================================================================
 // FFleshRingNormalRecomputeCS - Normal Recompute Compute Shader
@@ -82,7 +83,7 @@ public:
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
-		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+		return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
 	}
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -26,6 +26,7 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphResources.h"
 #include "RenderGraphUtils.h"
+#include "FleshRingRuntimeSettings.h"
 
 // Maximum neighbors per vertex (must match shader and FleshRingLaplacianShader.h)
 #ifndef FLESHRING_MAX_NEIGHBORS
@@ -59,12 +60,9 @@ public:
 		// Affected Vertices (Tightness region) are fixed, others move freely
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, IsAnchorFlags)
 
-		// Full mesh anchor map (indexed by absolute vertex index)
-		// For neighbor anchor lookup (neighbors might not be in current region)
-		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, FullVertexAnchorFlags)
-
 		// Adjacency data with rest lengths
 		// Format per vertex: [Count, Neighbor0, RestLen0, Neighbor1, RestLen1, ...]
+		// Neighbor high bit = neighbor is an anchor (FRingAffectedData::PBD_NEIGHBOR_ANCHOR_BIT)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, AdjacencyWithRestLengths)
 
 		// Counts
@@ -78,11 +76,14 @@ public:
 		// Allowed range: [RestLength * (1-Tolerance), RestLength * (1+Tolerance)]
 		// Example: Tolerance=0.2 → allows 80%~120% of original length
 		SHADER_PARAMETER(float, Tolerance)
+
+		// 1 = honor neighbor anchor bits, 0 = all neighbors free (bPBDAnchorAffectedVertices off)
+		SHADER_PARAMETER(uint32, bAnchorNeighbors)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
-		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+		return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
 	}
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -117,12 +118,16 @@ struct FPBDEdgeDispatchParams
 	 */
 	float Tolerance;
 
+	/** Whether neighbor anchor bits in the adjacency data are honored */
+	bool bAnchorNeighbors;
+
 	FPBDEdgeDispatchParams()
 		: NumAffectedVertices(0)
 		, NumTotalVertices(0)
 		, Stiffness(0.8f)
 		, NumIterations(3)
 		, Tolerance(0.2f)
+		, bAnchorNeighbors(true)
 	{
 	}
 };
@@ -141,8 +146,7 @@ struct FPBDEdgeDispatchParams
  * @param AffectedIndicesBuffer - Affected vertex indices
  * @param RepresentativeIndicesBuffer - Representative vertex indices for UV seam welding (nullptr = use AffectedIndices)
  * @param IsAnchorFlagsBuffer - Per-vertex anchor flags (1=anchor, 0=free)
- * @param FullVertexAnchorFlagsBuffer - Full mesh anchor map for neighbor lookup
- * @param AdjacencyWithRestLengthsBuffer - Packed adjacency with rest lengths
+ * @param AdjacencyWithRestLengthsBuffer - Packed adjacency with rest lengths and neighbor anchor bits
  */
 void DispatchFleshRingPBDEdgeCS(
 	FRDGBuilder& GraphBuilder,
@@ -152,7 +156,6 @@ void DispatchFleshRingPBDEdgeCS(
 	FRDGBufferRef AffectedIndicesBuffer,
 	FRDGBufferRef RepresentativeIndicesBuffer,
 	FRDGBufferRef IsAnchorFlagsBuffer,
-	FRDGBufferRef FullVertexAnchorFlagsBuffer,
 	FRDGBufferRef AdjacencyWithRestLengthsBuffer);
 
 /**
@@ -165,8 +168,7 @@ void DispatchFleshRingPBDEdgeCS(
  * @param AffectedIndicesBuffer - Affected vertex indices
  * @param RepresentativeIndicesBuffer - Representative vertex indices for UV seam welding (nullptr = use AffectedIndices)
  * @param IsAnchorFlagsBuffer - Per-vertex anchor flags (1=anchor, 0=free)
- * @param FullVertexAnchorFlagsBuffer - Full mesh anchor map for neighbor lookup
- * @param AdjacencyWithRestLengthsBuffer - Packed adjacency with rest lengths
+ * @param AdjacencyWithRestLengthsBuffer - Packed adjacency with rest lengths and neighbor anchor bits
  */
 void DispatchFleshRingPBDEdgeCS_MultiPass(
 	FRDGBuilder& GraphBuilder,
@@ -175,5 +177,4 @@ void DispatchFleshRingPBDEdgeCS_MultiPass(
 	FRDGBufferRef AffectedIndicesBuffer,
 	FRDGBufferRef RepresentativeIndicesBuffer,
 	FRDGBufferRef IsAnchorFlagsBuffer,
-	FRDGBufferRef FullVertexAnchorFlagsBuffer,
 	FRDGBufferRef AdjacencyWithRestLengthsBuffer);
@@ -0,0 +1,60 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "RHIDefinitions.h"
+#include "FleshRingRuntimeSettings.generated.h"
+
+struct FGlobalShaderPermutationParameters;
+
+/**
+ * Project-wide FleshRing settings (Project Settings > Plugins > FleshRing)
+ */
+UCLASS(config = Engine, defaultconfig, meta = (DisplayName = "FleshRing"))
+class FLESHRINGRUNTIME_API UFleshRingRuntimeSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UFleshRingRuntimeSettings();
+
+	/**
+	 * Cooked games consume Baked / Sparse Baked meshes only
+	 *
+	 * Deformer shaders (tightness, bulge, smoothing, PBD, SDF, ...) are not compiled for
+	 * cooked game targets, the compute system is not registered and the Flesh Ring Deformer
+	 * is stripped from cooked content. Editor and PIE keep the full deformer for baking.
+	 * Assets without a bake show the undeformed mesh. Requires a recook when changed.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Runtime", meta = (ConfigRestartRequired = true))
+	bool bBakedMeshOnlyRuntime = false;
+
+	/**
+	 * Reads bBakedMeshOnlyRuntime straight from the engine config
+	 * Safe before the CDO exists (global shaders are gathered during early startup)
+	 */
+	static bool IsBakedMeshOnlyRuntime();
+
+	/**
+	 * bBakedMeshOnlyRuntime of the platform a shader is compiled for (its Engine ini hierarchy, not the host's)
+	 * Cached per platform, the setting requires a restart
+	 */
+	static bool IsBakedMeshOnlyRuntime(EShaderPlatform Platform);
+
+	/**
+	 * bBakedMeshOnlyRuntime of a platform by its ini name (e.g. ITargetPlatform::IniPlatformName() when cooking)
+	 * Shares the per-platform cache of the EShaderPlatform overload
+	 */
+	static bool IsBakedMeshOnlyRuntime(const FString& IniPlatformName);
+
+	/** false in non-editor builds running in bake-only mode (no SDF generation / deformer setup) */
+	static bool IsDeformerAvailable();
+
+	/** ShouldCompilePermutation filter for shaders used only by the deformer (SM5+) */
+	static bool ShouldCompileDeformerShader(const FGlobalShaderPermutationParameters& Parameters);
+
+	/** ShouldCompilePermutation filter for SDF generation shaders (no feature level requirement, as before bake-only mode) */
+	static bool ShouldCompileSDFShader(const FGlobalShaderPermutationParameters& Parameters);
+};
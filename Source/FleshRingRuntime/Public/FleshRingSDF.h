@@ -7,6 +7,7 @@
 #include "GlobalShader.h"
 #include "ShaderParameterStruct.h"
 #include "RenderGraphUtils.h"
+#include "FleshRingRuntimeSettings.h"
 
 // Mesh SDF Generation Compute Shader
 // Generates SDF using Point-to-Triangle distance calculation
@@ -16,6 +17,11 @@ public:
     DECLARE_GLOBAL_SHADER(FMeshSDFGenerateCS)
     SHADER_USE_PARAMETER_STRUCT(FMeshSDFGenerateCS, FGlobalShader)
 
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+        return UFleshRingRuntimeSettings::ShouldCompileSDFShader(Parameters);
+    }
+
     BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
         // Mesh data
         SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FVector3f>, MeshVertices)
@@ -38,6 +44,11 @@ public:
     DECLARE_GLOBAL_SHADER(FSDFSliceVisualizeCS)
     SHADER_USE_PARAMETER_STRUCT(FSDFSliceVisualizeCS, FGlobalShader)
 
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+        return UFleshRingRuntimeSettings::ShouldCompileSDFShader(Parameters);
+    }
+
     BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
         // Input SDF texture
         SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture3D<float>, SDFTexture)
@@ -54,7 +65,7 @@ public:
 // Mesh SDF generation function
 // Generates SDF from MeshData triangles
 // Donut hole correction is performed separately via Apply2DSliceFloodFill
-void GenerateMeshSDF(
+FLESHRINGRUNTIME_API void GenerateMeshSDF(
     FRDGBuilder& GraphBuilder,
     FRDGTextureRef OutputTexture,
     const TArray<FVector3f>& Vertices,
@@ -73,33 +84,27 @@ void GenerateSDFSlice(
     float MaxDisplayDist);
 
 // 2D Slice Flood Fill - Donut hole correction
-// Floods from XY boundary in each Z slice to detect donut holes
+// Floods outside reachability from the XY boundary of each Z slice to detect donut holes
+// (open voxel not reachable from the boundary = hole)
 
-// 2D Flood initialization shader
-class F2DFloodInitializeCS : public FGlobalShader
+// 2D flood shader - one thread group per Z slice, labels outside components in O(log N) hook / jump rounds
+class F2DSliceFloodCS : public FGlobalShader
 {
 public:
-    DECLARE_GLOBAL_SHADER(F2DFloodInitializeCS)
-    SHADER_USE_PARAMETER_STRUCT(F2DFloodInitializeCS, FGlobalShader)
+    DECLARE_GLOBAL_SHADER(F2DSliceFloodCS)
+    SHADER_USE_PARAMETER_STRUCT(F2DSliceFloodCS, FGlobalShader)
 
-    BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-        SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture3D<float>, InputSDF)
-        SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture3D<uint>, FloodMask)
-        SHADER_PARAMETER(FIntVector, GridResolution)
-    END_SHADER_PARAMETER_STRUCT()
-};
+    // Groupshared reached bitset holds one slice (SLICE_FLOOD_MAX_WORDS in FleshRing2DSliceFlood.usf)
+    static constexpr int32 MaxSliceVoxels = 256 * 256;
 
-// 2D Flood propagation pass shader
-class F2DFloodPassCS : public FGlobalShader
-{
-public:
-    DECLARE_GLOBAL_SHADER(F2DFloodPassCS)
-    SHADER_USE_PARAMETER_STRUCT(F2DFloodPassCS, FGlobalShader)
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+        return UFleshRingRuntimeSettings::ShouldCompileSDFShader(Parameters);
+    }
 
     BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-        SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture3D<uint>, FloodMaskInput)
-        SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture3D<uint>, FloodMaskOutput)
-        SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture3D<float>, SDFForFlood)
+        SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture3D<float>, InputSDF)
+        SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture3D<uint>, FloodMask)
         SHADER_PARAMETER(FIntVector, GridResolution)
     END_SHADER_PARAMETER_STRUCT()
 };
@@ -112,6 +117,11 @@ public:
     DECLARE_GLOBAL_SHADER(FZAxisVoteCS)
     SHADER_USE_PARAMETER_STRUCT(FZAxisVoteCS, FGlobalShader)
 
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+        return UFleshRingRuntimeSettings::ShouldCompileSDFShader(Parameters);
+    }
+
     BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
         SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture3D<uint>, VoteMaskInput)
         SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture3D<uint>, VoteMaskOutput)
@@ -127,6 +137,11 @@ public:
     DECLARE_GLOBAL_SHADER(F2DFloodFinalizeCS)
     SHADER_USE_PARAMETER_STRUCT(F2DFloodFinalizeCS, FGlobalShader)
 
+    static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+    {
+        return UFleshRingRuntimeSettings::ShouldCompileSDFShader(Parameters);
+    }
+
     BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
         SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture3D<uint>, FinalFloodMask)
         SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture3D<float>, OriginalSDF)
@@ -137,8 +152,18 @@ public:
 
 // 2D Slice Flood Fill application function
 // Converts donut holes (exterior regions unreachable from XY boundary) to interior
-void Apply2DSliceFloodFill(
+// Slices larger than F2DSliceFloodCS::MaxSliceVoxels are copied uncorrected, as are slices whose
+// labeling does not converge within SLICE_FLOOD_MAX_ROUNDS (bounds the dispatch time)
+FLESHRINGRUNTIME_API void Apply2DSliceFloodFill(
     FRDGBuilder& GraphBuilder,
     FRDGTextureRef InputSDF,
     FRDGTextureRef OutputSDF,
+    FIntVector Resolution);
+
+// CPU reference of Apply2DSliceFloodFill (same reachability + vote, bit-identical result)
+// Used for validating the GPU path and for offline SDF processing
+// Voxel layout: Index = X + Y * Res.X + Z * Res.X * Res.Y
+FLESHRINGRUNTIME_API void Apply2DSliceFloodFillCPU(
+    const TArray<float>& InputSDF,
+    TArray<float>& OutputSDF,
     FIntVector Resolution);
\ No newline at end of file
@@ -0,0 +1,82 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingSDFVolume.h
+// CPU-readable copy of a Ring SDF (read back once after GPU generation)
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FRHIGPUTextureReadback;
+
+/**
+ * CPU copy of the corrected Ring SDF (after donut hole correction)
+ *
+ * Same convention as the GPU texture sampled by FleshRingTightnessCS:
+ * - Negative = donut hole (flesh space), positive = air, 0 = ring surface/solid
+ * - Voxel (i,j,k) center = BoundsMin + (i+0.5, j+0.5, k+0.5) / Resolution * BoundsSize
+ * - Index = X + Y * Resolution.X + Z * Resolution.X * Resolution.Y
+ *
+ * Lets CPU-side vertex selection reject vertices the GPU would never move,
+ * instead of selecting the whole SDF bounding box.
+ */
+struct FLESHRINGRUNTIME_API FFleshRingSDFVolume
+{
+	/** Distance values (Resolution.X * Resolution.Y * Resolution.Z) */
+	TArray<float> Distances;
+
+	/** SDF volume bounds (Ring local space) */
+	FVector3f BoundsMin = FVector3f::ZeroVector;
+	FVector3f BoundsMax = FVector3f::ZeroVector;
+
+	/** SDF resolution */
+	FIntVector Resolution = FIntVector::ZeroValue;
+
+	/** Validity check (distances read back and matching resolution) */
+	bool IsValid() const
+	{
+		return Resolution.X > 0 && Resolution.Y > 0 && Resolution.Z > 0 &&
+			Distances.Num() == Resolution.X * Resolution.Y * Resolution.Z;
+	}
+
+	/** Whether a Ring local position is inside the SDF bounds */
+	bool IsInsideBounds(const FVector3f& LocalPos) const
+	{
+		return LocalPos.X >= BoundsMin.X && LocalPos.X <= BoundsMax.X &&
+			LocalPos.Y >= BoundsMin.Y && LocalPos.Y <= BoundsMax.Y &&
+			LocalPos.Z >= BoundsMin.Z && LocalPos.Z <= BoundsMax.Z;
+	}
+
+	/** Largest voxel edge length (Ring local units) */
+	float GetMaxVoxelSize() const;
+
+	/**
+	 * Trilinear sample at Ring local position
+	 * Matches GPU SampleLevel with SF_Trilinear + AM_Clamp (positions outside bounds are clamped)
+	 */
+	float SampleTrilinear(const FVector3f& LocalPos) const;
+
+	/**
+	 * Narrow band query: true if the position is inside the SDF bounds and lies
+	 * deeper than BandWidth inside the donut hole (distance < -BandWidth)
+	 *
+	 * TightnessCS leaves such vertices untouched (raymarch starts inside the hole),
+	 * so selectors can skip them without changing the deformation result.
+	 */
+	bool IsBeyondInnerBand(const FVector3f& LocalPos, float BandWidth) const
+	{
+		return IsInsideBounds(LocalPos) && SampleTrilinear(LocalPos) < -BandWidth;
+	}
+
+	/**
+	 * Fill Distances from a completed 3D texture readback (render thread)
+	 * Resolution and bounds must be set beforehand
+	 * @return false if readback was not ready or returned no data
+	 */
+	bool CopyFromReadback(FRHIGPUTextureReadback& Readback);
+
+	/** Memory used by the distance array */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Distances.GetAllocatedSize();
+	}
+};
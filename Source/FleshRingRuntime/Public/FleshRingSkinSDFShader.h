@@ -7,6 +7,7 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphResources.h"
 #include "RenderGraphBuilder.h"
+#include "FleshRingRuntimeSettings.h"
 
 // ============================================================================
 // Skin SDF Layer Separation Shader Parameters
@@ -90,7 +91,7 @@ class FSkinSDFLayerSeparationCS : public FGlobalShader
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
-		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+		return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
 	}
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
@@ -42,17 +42,23 @@ public:
 	);
 
 private:
+	/** Reusable per-worker query buffers for SampleBoneWeightsAtPosition */
+	struct FBoneWeightSampleScratch;
+
 	/**
 	 * Samples bone weights at a given position from nearby skin vertices
 	 * Uses distance-weighted average of nearby vertices' bone weights
 	 * Filters to only include bones in the allowed set (bone chain filtering)
+	 * Falls back to the nearest skin vertex when the radius query finds none
+	 * Thread-safe (called from ParallelFor with one Scratch per task)
 	 *
 	 * @param RingVertexPosition - Position to sample weights at (component space)
 	 * @param SkinVertices - Array of skin mesh vertex positions
 	 * @param SkinBoneInfluences - Array of skin mesh bone influences
-	 * @param SpatialHash - Spatial hash for fast nearest neighbor lookup
+	 * @param SpatialHash - Spatial hash for radius and nearest neighbor queries
 	 * @param SamplingRadius - Search radius in cm
-	 * @param AllowedBoneIndices - Set of bone indices to allow (empty = allow all)
+	 * @param AllowedBones - Allowed flag per bone index (empty = allow all)
+	 * @param Scratch - Query buffers reused between calls
 	 * @param OutBoneIndices - Output bone indices (MAX_INFLUENCES elements)
 	 * @param OutBoneWeights - Output bone weights (MAX_INFLUENCES elements, 0-255 normalized)
 	 */
@@ -62,9 +68,10 @@ private:
 		const TArray<FVertexBoneInfluence>& SkinBoneInfluences,
 		const FVertexSpatialHash& SpatialHash,
 		float SamplingRadius,
-		const TSet<int32>& AllowedBoneIndices,
-		TArray<uint16>& OutBoneIndices,
-		TArray<uint8>& OutBoneWeights
+		const TBitArray<>& AllowedBones,
+		FBoneWeightSampleScratch& Scratch,
+		uint16* OutBoneIndices,
+		uint8* OutBoneWeights
 	);
 
 	/**
@@ -0,0 +1,95 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "UObject/SoftObjectPtr.h"
+#include "FleshRingSkinnedRingLibrary.generated.h"
+
+class UStaticMesh;
+class USkeletalMesh;
+class UFleshRingAsset;
+
+/**
+ * One shared skinned ring mesh and the FleshRing Assets referencing it
+ */
+USTRUCT()
+struct FLESHRINGRUNTIME_API FFleshRingSkinnedRingEntry
+{
+	GENERATED_BODY()
+
+	/** Ring mesh | ring geometry hash | sampled mesh geometry hash | skeleton | attach bone | sampling radius | quantized ring transform */
+	UPROPERTY(VisibleAnywhere, Category = "Skinned Ring")
+	FString Key;
+
+	/** Shared skinned ring mesh (subobject of the library) */
+	UPROPERTY(VisibleAnywhere, Category = "Skinned Ring")
+	TObjectPtr<USkeletalMesh> Mesh;
+
+	/** Assets whose BakedSkinnedRingMeshes reference Mesh (entry is dropped once empty) */
+	UPROPERTY(VisibleAnywhere, Category = "Skinned Ring")
+	TArray<TSoftObjectPtr<UFleshRingAsset>> Users;
+};
+
+/**
+ * Shared skinned ring meshes (bake once, load many)
+ *
+ * FleshRing Assets assigned to the same library reuse one skinned ring mesh per
+ * ring mesh / skinned body / attach bone chain / sampling radius / ring transform
+ * instead of generating and storing a copy each.
+ * Matching entries skip bone weight sampling entirely on bake.
+ */
+UCLASS(BlueprintType)
+class FLESHRINGRUNTIME_API UFleshRingSkinnedRingLibrary : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Shared meshes */
+	UPROPERTY(VisibleAnywhere, Category = "Skinned Ring")
+	TArray<FFleshRingSkinnedRingEntry> Entries;
+
+	/** Total number of shared meshes */
+	UFUNCTION(BlueprintPure, Category = "FleshRing|Skinned Ring")
+	int32 GetNumMeshes() const { return Entries.Num(); }
+
+#if WITH_EDITOR
+	/**
+	 * Returns the shared mesh for the key, generating it on first use, and registers User
+	 *
+	 * @param User - Asset that will reference the mesh
+	 * @param RingMesh - Ring StaticMesh
+	 * @param SampleMesh - Mesh bone weights are sampled from (bake source, may be a transient SubdividedMesh)
+	 * @param BoneName - Attach bone (bone chain filter root)
+	 * @param BoneIndex - Attach bone index in SampleMesh's skeleton
+	 * @param RingTransform - Ring mesh transform in component space
+	 * @param SamplingRadius - Skin sampling radius
+	 * @param bOutGenerated - true if the mesh was generated by this call
+	 * @return Shared mesh, nullptr if generation failed
+	 */
+	USkeletalMesh* FindOrGenerate(
+		UFleshRingAsset* User,
+		UStaticMesh* RingMesh,
+		USkeletalMesh* SampleMesh,
+		FName BoneName,
+		int32 BoneIndex,
+		const FTransform& RingTransform,
+		float SamplingRadius,
+		bool& bOutGenerated);
+
+	/**
+	 * Unregisters User from every entry whose mesh is not in KeepMeshes
+	 * Entries left without users are removed and their meshes discarded
+	 */
+	void ReleaseUser(UFleshRingAsset* User, const TArray<USkeletalMesh*>& KeepMeshes);
+
+	/** Key of a skinned ring mesh (ring / sampled mesh geometry hashes, ring transform quantized to 0.01 cm / 1e-4) */
+	static FString MakeKey(
+		const UStaticMesh* RingMesh,
+		const USkeletalMesh* SampleMesh,
+		FName BoneName,
+		const FTransform& RingTransform,
+		float SamplingRadius);
+#endif
+};
@@ -0,0 +1,88 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingSparseBake.h
+// Sparse delta bake: extraction at bake time, external morph set at runtime
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FFleshRingSparseBakeData;
+struct FExternalMorphSet;
+class FSkeletalMeshLODRenderData;
+class USkeletalMesh;
+class USkinnedMeshComponent;
+
+/**
+ * Alternative to the full duplicated BakedMesh:
+ * only vertices displaced by the rings are stored (index + position / normal / tangent delta),
+ * and applied on the original mesh as a pre-skinning morph through the engine external morph target path.
+ *
+ * - One base mesh (and its GPU buffers) shared by any number of ring variants
+ * - One small compressed morph buffer per asset and LOD, shared by every component using it, weight fixed at 1
+ * - Lower LODs carry the LOD0 deformation transferred to their own vertices at bake time
+ */
+namespace FleshRingSparseBake
+{
+	/** Normal delta length below which a vertex counts as unchanged */
+	constexpr float DirectionThreshold = 1.0e-3f;
+
+	/** Position error tolerance of the compressed GPU morph buffer (cm) */
+	constexpr float MorphPositionTolerance = 0.001f;
+
+	/** Quantization result (bake log) */
+	struct FQuantizeStats
+	{
+		SIZE_T FloatSize = 0;
+		SIZE_T QuantizedSize = 0;
+		float MaxPositionError = 0.0f;
+		float MaxNormalError = 0.0f;
+	};
+
+	/**
+	 * Compare readback geometry against the rest LOD and keep displaced vertices (bake time)
+	 *
+	 * @param RestLOD - Original mesh LOD render data (rest pose, CPU vertex data required)
+	 * @param DeformedPositions / DeformedNormals - Readback, indexed like RestLOD vertices
+	 * @param PositionThreshold - Minimum displacement (cm) for a vertex to be stored
+	 * @param OutData - Sparse result (reset first)
+	 * @return false on vertex count mismatch
+	 */
+	FLESHRINGRUNTIME_API bool ExtractDeltas(
+		const FSkeletalMeshLODRenderData& RestLOD,
+		const TArray<FVector3f>& DeformedPositions,
+		const TArray<FVector3f>& DeformedNormals,
+		float PositionThreshold,
+		FFleshRingSparseBakeData& OutData);
+
+	/**
+	 * Convert float deltas to 16-bit fixed point (positions and normals)
+	 * Kept as float when the 16-bit position step can't meet PositionErrorBound
+	 *
+	 * @param PositionErrorBound - Maximum position error (cm)
+	 * @param OutStats - Sizes and measured round-trip errors
+	 * @return true if the data is now quantized
+	 */
+	FLESHRINGRUNTIME_API bool Quantize(
+		float PositionErrorBound,
+		FFleshRingSparseBakeData& InOutData,
+		FQuantizeStats& OutStats);
+
+	/** Float deltas of Data (quantized or not), no base mesh access */
+	FLESHRINGRUNTIME_API bool Decode(
+		const FFleshRingSparseBakeData& Data,
+		TArray<FVector3f>& OutPositionDeltas,
+		TArray<FVector3f>& OutNormalDeltas);
+
+	/**
+	 * Build a GPU morph set for one LOD of BaseMesh from sparse data (render resource init is enqueued)
+	 * GPU buffers are released on the render thread when the last reference is dropped
+	 * @return nullptr if BaseMesh doesn't match the data
+	 */
+	FLESHRINGRUNTIME_API TSharedPtr<FExternalMorphSet> CreateMorphSet(const USkeletalMesh* BaseMesh, int32 LODIndex, const FFleshRingSparseBakeData& Data, FName Name);
+
+	/** Register MorphSets (index = LOD, null entries skipped) on Component with weight 1 */
+	FLESHRINGRUNTIME_API void AddToComponent(USkinnedMeshComponent* Component, int32 MorphSetID, const TArray<TSharedPtr<FExternalMorphSet>>& MorphSets);
+
+	/** Unregister from Component (if still alive) and drop this component's references (shared buffers outlive it) */
+	FLESHRINGRUNTIME_API void RemoveFromComponent(USkinnedMeshComponent* Component, int32 MorphSetID, TArray<TSharedPtr<FExternalMorphSet>>& MorphSets);
+}
@@ -13,6 +13,7 @@
 #include "FleshRingSubdivisionProcessor.h"
 #include "FleshRingSubdivisionShader.h"
 #include "RenderGraphResources.h"
+#include "Tasks/Task.h"
 #include "FleshRingSubdivisionComponent.generated.h"
 
 class UFleshRingComponent;
@@ -84,7 +85,8 @@ struct FSubdivisionResultCache
 /**
  * FleshRing Subdivision Component
  *
- * Performs adaptive subdivision on triangles within Ring influence area for Low-Poly SkeletalMesh
+ * Performs adaptive subdivision on triangles within all Rings' influence areas for Low-Poly SkeletalMesh
+ * CPU refinement runs on a worker thread and is swapped in on completion
  * Guarantees T-Junction free crack-free subdivision using Red-Green Refinement / LEB algorithm
  *
  * Architecture:
@@ -163,6 +165,46 @@ public:
 		meta = (ClampMin = "50.0", EditCondition = "bEnableDistanceFalloff"))
 	float SubdivisionFullDistance = 500.0f;
 
+	/** Extra margin (in levels) the distance-driven level must pass before switching level (prevents popping at band edges) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subdivision|LOD",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bEnableDistanceFalloff"))
+	float DistanceLevelHysteresis = 0.3f;
+
+	/**
+	 * Screen-space error refinement (replaces distance falloff)
+	 * Each Ring is refined until its edges project below MaxScreenSpaceError pixels;
+	 * Rings too small on screen are not refined at all
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subdivision|LOD")
+	bool bUseScreenSpaceError = false;
+
+	/** Target projected edge length (pixels) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subdivision|LOD",
+		meta = (ClampMin = "0.5", EditCondition = "bUseScreenSpaceError"))
+	float MaxScreenSpaceError = 6.0f;
+
+	/** Error tightening per unit of Ring TightnessStrength (stronger compression folds skin into higher curvature) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subdivision|LOD",
+		meta = (ClampMin = "0.0", EditCondition = "bUseScreenSpaceError"))
+	float CompressionErrorScale = 0.5f;
+
+	/** Extra margin (in levels) the ideal level must pass before a Ring switches level (prevents popping) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subdivision|LOD",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bUseScreenSpaceError"))
+	float ScreenSpaceErrorHysteresis = 0.3f;
+
+	// =====================================
+	// Budget Settings
+	// =====================================
+
+	/**
+	 * Max vertices one refinement update may add (0 = unlimited)
+	 * Raising the level is spread over successive updates that each fit the budget,
+	 * bounding the GPU interpolation cost of every swap frame
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subdivision|Budget", meta = (ClampMin = "0"))
+	int32 MaxAddedVerticesPerUpdate = 20000;
+
 	// =====================================
 	// Bake Settings (Editor Only)
 	// =====================================
@@ -198,11 +240,26 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Debug")
 	bool bShowSubdividedWireframe = false;
 
+	/** Applied result kept for debug draw (stays valid while the processor is out on a worker) */
+	struct FSubdivisionDebugSnapshot
+	{
+		TArray<FVector3f> Positions;	// Component space
+		TArray<uint32> Indices;
+		TBitArray<> NewVertexMask;
+	};
+	FSubdivisionDebugSnapshot DebugSnapshot;
+
+	/** Rebuild DebugSnapshot from the processor's cached result */
+	void UpdateDebugSnapshot();
+
 	/** Subdivided vertex debug visualization */
 	void DrawSubdividedVerticesDebug();
 
 	/** Subdivided wireframe debug visualization */
 	void DrawSubdividedWireframeDebug();
+
+	/** Component-space positions of all subdivided vertices (shared bake interpolation kernel) */
+	bool InterpolateSubdividedPositions(TArray<FVector3f>& OutPositions) const;
 #endif
 
 #if WITH_EDITOR
@@ -270,11 +327,48 @@ private:
 	/** Current distance scale */
 	float CurrentDistanceScale = 1.0f;
 
+	/** Worker refinement output (processor is moved into the task and returned with the result) */
+	struct FAsyncSubdivisionResult
+	{
+		TUniquePtr<FFleshRingSubdivisionProcessor> Processor;
+		int32 SubdivisionLevel = 0;  // Level of this update (may be a step toward the requested level, see vertex budget)
+		int32 AddedVertices = 0;
+		bool bSuccess = false;
+	};
+
+	/** In-flight refinement (Processor is null while valid) */
+	UE::Tasks::TTask<FAsyncSubdivisionResult> PendingSubdivision;
+
+	/** Distance-driven level of the last launched refinement (0 = none yet) */
+	int32 RequestedSubdivisionLevel = 0;
+
+	/** Level of the applied result (0 = none); below RequestedSubdivisionLevel while a budgeted ramp is in progress */
+	int32 AppliedSubdivisionLevel = 0;
+
+	/** Vertices added at each level by past updates (INDEX_NONE = not measured), used to size budgeted steps */
+	TArray<int32> AddedVerticesPerLevel;
+
+	/** Counts of the applied result (stats stay valid while the processor is out on a worker) */
+	int32 AppliedOriginalVertexCount = 0;
+	int32 AppliedSubdividedVertexCount = 0;
+	int32 AppliedSubdividedTriangleCount = 0;
+
+	/** Per-Ring screen-space error level (hysteresis state, 0 = Ring not refined, INDEX_NONE = not evaluated yet) */
+	TArray<int32> RingErrorLevels;
+
+	/** Average source edge length (level 0 reference for screen-space error) */
+	float SourceAverageEdgeLength = 0.0f;
+
 	// Internal functions
 	void FindDependencies();
 	void Initialize();
 	void Cleanup();
 	void UpdateDistanceScale();
 	void ComputeSubdivision();
+	void CompletePendingSubdivision(bool bApplyResult);
+	int32 GetDistanceSubdivisionLevel() const;
+	int32 GetBudgetedUpdateLevel(int32 TargetLevel) const;
+	void ResetAppliedResult(bool bReleaseOnRenderThread = false);
+	bool UpdateScreenSpaceErrorLevels();
 	void ExecuteGPUInterpolation();
 };
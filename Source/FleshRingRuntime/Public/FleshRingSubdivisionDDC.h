@@ -0,0 +1,39 @@
+﻿// Copyright 2026 LgThx. All Rights Reserved.
+
+// FleshRingSubdivisionDDC.h
+// Derived data cache for CPU subdivision topology (editor only)
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USkeletalMesh;
+struct FSubdivisionTopologyResult;
+
+#if WITH_EDITOR
+
+/**
+ * Subdivision topology DDC
+ *
+ * Stores FSubdivisionTopologyResult (parent/barycentric data, indices, material indices)
+ * keyed by source mesh model GUID + UFleshRingAsset::CalculateSubdivisionParamsHash().
+ * Reopening an asset or re-baking unchanged parameters skips the topology step.
+ */
+namespace FleshRingSubdivisionDDC
+{
+	/**
+	 * Build cache key for a source mesh + subdivision params hash
+	 * @return Empty string if the source mesh has no imported model (no stable identity)
+	 */
+	FLESHRINGRUNTIME_API FString BuildKey(const USkeletalMesh* SourceMesh, uint32 SubdivisionParamsHash);
+
+	/**
+	 * Load topology result from DDC
+	 * @param ExpectedVertexCount - Source vertex count the result must match (stale data guard)
+	 */
+	FLESHRINGRUNTIME_API bool Get(const FString& Key, int32 ExpectedVertexCount, FSubdivisionTopologyResult& OutResult);
+
+	/** Store topology result in DDC */
+	FLESHRINGRUNTIME_API void Put(const FString& Key, const FSubdivisionTopologyResult& Result);
+}
+
+#endif
@@ -146,6 +146,13 @@ struct FSubdivisionVertexData
 		Data.BarycentricCoords = Bary;
 		return Data;
 	}
+
+	friend FArchive& operator<<(FArchive& Ar, FSubdivisionVertexData& Data)
+	{
+		Ar << Data.ParentV0 << Data.ParentV1 << Data.ParentV2;
+		Ar << Data.BarycentricCoords;
+		return Ar;
+	}
 };
 
 /**
@@ -183,6 +190,17 @@ struct FSubdivisionTopologyResult
 	{
 		return VertexData.Num() > 0 && Indices.Num() > 0;
 	}
+
+	// Serialization (derived data cache)
+	friend FArchive& operator<<(FArchive& Ar, FSubdivisionTopologyResult& Result)
+	{
+		Ar << Result.VertexData;
+		Ar << Result.Indices;
+		Ar << Result.TriangleMaterialIndices;
+		Ar << Result.OriginalVertexCount << Result.OriginalTriangleCount;
+		Ar << Result.SubdividedVertexCount << Result.SubdividedTriangleCount;
+		return Ar;
+	}
 };
 
 /**
@@ -217,6 +235,12 @@ struct FSubdivisionRingParams
 	/** SDF influence range expansion multiplier */
 	float SDFInfluenceMultiplier = 1.5f;
 
+	// =====================================
+	// Per-Ring refinement depth
+	// =====================================
+	/** Max LEB level for this Ring, capped by processor settings (INDEX_NONE = processor setting, 0 = placeholder, not refined) */
+	int32 MaxSubdivisionLevel = INDEX_NONE;
+
 	// Get influence radius (VirtualRing mode)
 	float GetInfluenceRadius() const
 	{
@@ -278,7 +302,7 @@ struct FSubdivisionProcessorSettings
  * CPU-based Subdivision topology processor
  *
  * Uses existing FHalfEdgeMesh and FLEBSubdivision to perform
- * Red-Green Refinement based crack-free adaptive subdivision
+ * LEB based crack-free adaptive subdivision
  *
  * GPU handles only final vertex interpolation
  */
@@ -490,6 +514,12 @@ public:
 	 */
 	void InvalidateCache();
 
+	/**
+	 * Drop refined island patches kept for incremental re-subdivision
+	 * (Source mesh / settings changes do this automatically; Ring parameter / target set changes keep them)
+	 */
+	void InvalidateIslandCache();
+
 	/**
 	 * Source mesh data accessors (for GPU upload)
 	 */
@@ -543,9 +573,72 @@ private:
 	// Per-vertex bone influence info (extracted from SetSourceMeshWithBoneInfo)
 	TArray<FVertexBoneInfluence> VertexBoneInfluences;
 
+	/**
+	 * Independently refined island (see SubdivideIslands)
+	 * Kept across Process() calls: an island whose faces and refinement inputs are unchanged
+	 * reuses its refined patch instead of re-subdividing
+	 */
+	struct FSubdivisionIsland
+	{
+		TArray<int32> RingIndices;                     // Ring mode
+		TArray<FSubdivisionRingParams> RingParams;    // Snapshot used to refine the patch (parallel to RingIndices)
+		TArray<int32> TargetFaces;                     // Target face mode: selected base mesh faces (ascending)
+		TArray<int32> Faces;                           // Patch faces in base mesh (ascending)
+		TArray<int32> LocalToGlobalVertex;             // Unrefined patch vertex -> source vertex
+		TArray<int32> PatchTriangles;                  // Refined patch (new vertices follow the LocalToGlobalVertex ones)
+		TArray<int32> PatchMaterialIndices;            // Per refined patch triangle
+		TArray<FSubdivisionVertexData> NewVertexData;  // New patch vertices, parents resolved to source vertices
+		int32 FacesAdded = 0;
+		bool bReused = false;
+	};
+
+	// Refined islands from the last island-based Process()
+	TArray<FSubdivisionIsland> CachedIslands;
+
+	/** Region faces of one Ring on the base mesh (reused while its parameters are unchanged) */
+	struct FRingRegion
+	{
+		FSubdivisionRingParams RingParams;
+		TArray<int32> Faces;
+		bool bValid = false;
+	};
+
+	// Per-Ring region faces from the last Ring parameter-based island Process() (parallel to RingParamsArray)
+	TArray<FRingRegion> CachedRingRegions;
+
+	// Unrefined source mesh + vertex -> face adjacency (CSR), built once per source mesh
+	FHalfEdgeMesh BaseHalfEdgeMesh;
+	TArray<int32> BaseVertexFaceOffsets;
+	TArray<int32> BaseVertexFaces;
+	bool bBaseMeshValid = false;
+
+	// Build BaseHalfEdgeMesh + adjacency if the source mesh changed
+	bool BuildBaseMesh();
+
 	// Extract topology result from Half-Edge mesh
 	bool ExtractTopologyResult(FSubdivisionTopologyResult& OutResult);
 
+	/**
+	 * Subdivide the refinement region as independent islands
+	 *
+	 * Seed groups (one per Ring, or one per selected face in target face mode) whose faces (+ one-ring halo)
+	 * overlap are grouped into one island with union-find. Each island is extracted into a local patch
+	 * with its border locked, refined concurrently, then stitched back in island order (deterministic vertex/face order).
+	 * Islands matching a cached island (same faces + Ring parameters / selected faces) skip refinement.
+	 * Islands keep their extracted topology, so the result is written directly without rebuilding the stitched mesh.
+	 *
+	 * @param TargetFaces - Selected base mesh faces, ascending (nullptr = Ring parameter regions)
+	 * @param OutResult - Receives the stitched topology (untouched if INDEX_NONE is returned)
+	 * @return Number of faces added, or INDEX_NONE if everything forms a single island (caller refines in place)
+	 */
+	int32 SubdivideIslands(const TArray<int32>* TargetFaces, FSubdivisionTopologyResult& OutResult);
+
+	// Refine one Ring's region (OBB for SDF mode, torus for VirtualRing mode)
+	int32 SubdivideRingRegion(FHalfEdgeMesh& Mesh, const FSubdivisionRingParams& RingParams) const;
+
+	/** Effective LEB level of a Ring (its own level capped by CurrentSettings) */
+	int32 GetRingMaxSubdivisionLevel(const FSubdivisionRingParams& RingParams) const;
+
 	// Check if triangle is within target bone region
 	bool IsTriangleInBoneRegion(int32 V0, int32 V1, int32 V2, const TSet<int32>& TargetBones, uint8 WeightThreshold) const;
 
@@ -14,6 +14,7 @@
 #include "RenderGraphUtils.h"
 #include "FleshRingAffectedVertices.h"
 #include "FleshRingDebugTypes.h"
+#include "FleshRingRuntimeSettings.h"
 
 // ============================================================================
 // FFleshRingTightnessCS - Tightness Compute Shader
@@ -164,9 +165,7 @@ public:
     // Shader Compilation Settings
     static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
     {
-        // SM5 = Shader Model 5 (~=DX11)
-        // Require SM5 for compute shader support
-        return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+        return UFleshRingRuntimeSettings::ShouldCompileDeformerShader(Parameters);
     }
 
     static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
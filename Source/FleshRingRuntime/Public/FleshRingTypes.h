@@ -8,6 +8,7 @@
 
 class UStaticMesh;
 class USkeletalMesh;
+class UFleshRingSkinnedRingLibrary;
 
 // =====================================
 // Enum Definitions
@@ -190,10 +191,191 @@ enum class ENormalRecomputeMethod : uint8
 	SurfaceRotation	UMETA(DisplayName = "Surface Rotation")
 };
 
+/**
+ * Bake output format
+ * Trade-off between runtime flexibility vs asset size
+ */
+UENUM(BlueprintType)
+enum class EFleshRingBakeOutput : uint8
+{
+	/**
+	 * Full Mesh (default)
+	 * - Duplicated SkeletalMesh with deformation baked in (supports Subdivision, all LODs)
+	 * - Runtime swaps the whole mesh
+	 */
+	FullMesh		UMETA(DisplayName = "Full Mesh"),
+
+	/**
+	 * Sparse Deltas
+	 * - Only displaced vertices of the original mesh (position / normal deltas)
+	 * - Applied at runtime as a pre-skinning morph on the original mesh (all LODs, no Subdivision)
+	 * - Ring variants share one base mesh
+	 */
+	SparseDeltas	UMETA(DisplayName = "Sparse Deltas")
+};
+
 // =====================================
 // Struct Definitions
 // =====================================
 
+/**
+ * Sparse bake result of one LOD (EFleshRingBakeOutput::SparseDeltas)
+ * Deltas against the original mesh render vertices of that LOD, sorted by vertex index
+ *
+ * Stored either quantized (default) or as float deltas (error bound not reachable with 16 bits):
+ * - Position / normal delta: 16-bit fixed point per axis within the delta bounding box
+ * Deltas are final at bake time, so decoding never reads the base mesh vertex buffers (cooked builds drop their CPU copy)
+ * Tangents are not stored: GPU skinning re-orthogonalizes TangentX against the morphed normal
+ */
+USTRUCT()
+struct FLESHRINGRUNTIME_API FFleshRingSparseBakeData
+{
+	GENERATED_BODY()
+
+	/** Render vertex indices of the original mesh LOD */
+	UPROPERTY()
+	TArray<uint32> VertexIndices;
+
+	// ===== Float form (bake working data, serialized only when not quantized) =====
+
+	/** Deformed - rest position (component space, pre-skinning) */
+	UPROPERTY()
+	TArray<FVector3f> PositionDeltas;
+
+	/** Deformed - rest normal (TangentZ) */
+	UPROPERTY()
+	TArray<FVector3f> NormalDeltas;
+
+	// ===== Quantized form =====
+
+	/** True when the quantized arrays are authoritative (float arrays empty) */
+	UPROPERTY()
+	bool bQuantized = false;
+
+	/** Position delta bounding box minimum */
+	UPROPERTY()
+	FVector3f PositionDeltaMin = FVector3f::ZeroVector;
+
+	/** Position delta bounding box size / 65535 (per axis step) */
+	UPROPERTY()
+	FVector3f PositionDeltaStep = FVector3f::ZeroVector;
+
+	/** Fixed point position deltas (3 per vertex) */
+	UPROPERTY()
+	TArray<uint16> QuantizedPositionDeltas;
+
+	/** Normal delta bounding box minimum */
+	UPROPERTY()
+	FVector3f NormalDeltaMin = FVector3f::ZeroVector;
+
+	/** Normal delta bounding box size / 65535 (per axis step) */
+	UPROPERTY()
+	FVector3f NormalDeltaStep = FVector3f::ZeroVector;
+
+	/** Fixed point normal deltas (3 per vertex) */
+	UPROPERTY()
+	TArray<uint16> QuantizedNormalDeltas;
+
+	/** Original mesh LOD vertex count at bake time (validated before applying) */
+	UPROPERTY()
+	int32 SourceVertexCount = 0;
+
+	int32 Num() const { return VertexIndices.Num(); }
+
+	bool IsValid() const
+	{
+		const int32 NumVertices = VertexIndices.Num();
+		if (SourceVertexCount <= 0 || NumVertices == 0)
+		{
+			return false;
+		}
+		if (bQuantized)
+		{
+			return QuantizedPositionDeltas.Num() == NumVertices * 3 &&
+				QuantizedNormalDeltas.Num() == NumVertices * 3;
+		}
+		return PositionDeltas.Num() == NumVertices &&
+			NormalDeltas.Num() == NumVertices;
+	}
+
+	/** Serialized payload size in bytes */
+	SIZE_T GetDataSize() const
+	{
+		return VertexIndices.Num() * sizeof(uint32) +
+			(PositionDeltas.Num() + NormalDeltas.Num()) * sizeof(FVector3f) +
+			(QuantizedPositionDeltas.Num() + QuantizedNormalDeltas.Num()) * sizeof(uint16);
+	}
+
+	void Reset()
+	{
+		VertexIndices.Empty();
+		PositionDeltas.Empty();
+		NormalDeltas.Empty();
+		bQuantized = false;
+		PositionDeltaMin = FVector3f::ZeroVector;
+		PositionDeltaStep = FVector3f::ZeroVector;
+		QuantizedPositionDeltas.Empty();
+		NormalDeltaMin = FVector3f::ZeroVector;
+		NormalDeltaStep = FVector3f::ZeroVector;
+		QuantizedNormalDeltas.Empty();
+		SourceVertexCount = 0;
+	}
+};
+
+/**
+ * Cooked affected vertex data of one Ring (serialized FRingAffectedData)
+ */
+USTRUCT()
+struct FLESHRINGRUNTIME_API FFleshRingCookedRingAffectedData
+{
+	GENERATED_BODY()
+
+	/** FRingAffectedData::CookKey at cook time (0 = Ring not cooked) */
+	UPROPERTY()
+	uint32 CookKey = 0;
+
+	/** Whether the Ring was selected with its SDF */
+	UPROPERTY()
+	bool bSelectedWithSDF = false;
+
+	/** Serialized FRingAffectedData */
+	UPROPERTY()
+	TArray<uint8> Payload;
+};
+
+/**
+ * Cooked affected vertex data of one mesh LOD
+ * Loaded by FFleshRingAffectedVerticesManager instead of selecting / building per Ring
+ */
+USTRUCT()
+struct FLESHRINGRUNTIME_API FFleshRingCookedLODAffectedData
+{
+	GENERATED_BODY()
+
+	/** FFleshRingAffectedVerticesManager::CookedDataVersion at cook time */
+	UPROPERTY()
+	int32 Version = 0;
+
+	/** CRC of the LOD's bind pose vertices + indices */
+	UPROPERTY()
+	uint32 MeshDataHash = 0;
+
+	/** Per-Ring payloads (index = Ring index) */
+	UPROPERTY()
+	TArray<FFleshRingCookedRingAffectedData> Rings;
+
+	/** Serialized payload size in bytes */
+	SIZE_T GetDataSize() const
+	{
+		SIZE_T Size = 0;
+		for (const FFleshRingCookedRingAffectedData& Ring : Rings)
+		{
+			Size += Ring.Payload.Num();
+		}
+		return Size;
+	}
+};
+
 /**
  * Subdivision settings (editor preview + runtime)
  * Used by UFleshRingAsset, can be grouped via IPropertyTypeCustomization
@@ -245,6 +427,24 @@ struct FLESHRINGRUNTIME_API FSubdivisionSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeletal Mesh Detail Settings", meta = (ClampMin = "1", ClampMax = "6", EditCondition = "bEnableSubdivision"))
 	int32 MaxSubdivisionLevel = 2;
 
+	/**
+	 * Maximum Subdivision level for lower LODs (element 0 = LOD1, element 1 = LOD2, ...)
+	 * - Missing entries or 0: LOD keeps its native topology
+	 * - Baked mesh transfers LOD0 deformation to every lower LOD (closest-surface mapping)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeletal Mesh Detail Settings", meta = (ClampMin = "0", ClampMax = "6", EditCondition = "bEnableSubdivision"))
+	TArray<int32> LowerLODSubdivisionLevels;
+
+	/** Maximum Subdivision level of a LOD (0 = not subdivided) */
+	int32 GetMaxSubdivisionLevelForLOD(int32 LODIndex) const
+	{
+		if (LODIndex == 0)
+		{
+			return MaxSubdivisionLevel;
+		}
+		return LowerLODSubdivisionLevels.IsValidIndex(LODIndex - 1) ? FMath::Max(LowerLODSubdivisionLevels[LODIndex - 1], 0) : 0;
+	}
+
 	// ===== Generated Mesh (Runtime) =====
 
 	/**
@@ -261,6 +461,25 @@ struct FLESHRINGRUNTIME_API FSubdivisionSettings
 
 	// ===== Baked Mesh (Runtime, deformation applied) =====
 
+	/**
+	 * Bake output format
+	 * - Full Mesh: duplicated SkeletalMesh (BakedMesh)
+	 * - Sparse Deltas: displaced vertices only (SparseBakeLODs), Subdivision is skipped
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Baked Mesh")
+	EFleshRingBakeOutput BakeOutput = EFleshRingBakeOutput::FullMesh;
+
+	/** Vertices moved less than this (cm) with unchanged normal are not stored in Sparse Deltas */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Baked Mesh", meta = (ClampMin = "0.0001", ClampMax = "1.0", EditCondition = "BakeOutput == EFleshRingBakeOutput::SparseDeltas", EditConditionHides))
+	float SparseDeltaThreshold = 0.001f;
+
+	/**
+	 * Maximum position error (cm) of quantized Sparse Deltas
+	 * 16-bit storage is skipped (float deltas kept) when the delta range is too large for this bound
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Baked Mesh", meta = (ClampMin = "0.00001", ClampMax = "0.1", EditCondition = "BakeOutput == EFleshRingBakeOutput::SparseDeltas", EditConditionHides))
+	float SparseQuantizationErrorBound = 0.005f;
+
 	/**
 	 * Baked mesh (for runtime)
 	 * - Final state with Tightness + Bulge + Smoothing applied
@@ -270,6 +489,14 @@ struct FLESHRINGRUNTIME_API FSubdivisionSettings
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Baked Mesh", NonTransactional)
 	TObjectPtr<USkeletalMesh> BakedMesh;
 
+	/**
+	 * Sparse bake result (for runtime, BakeOutput == Sparse Deltas)
+	 * - Displaced vertices of the original mesh only, no duplicated mesh
+	 * - One entry per original mesh LOD (lower LODs follow LOD0 by closest-surface transfer, empty entry = LOD unchanged)
+	 */
+	UPROPERTY()
+	TArray<FFleshRingSparseBakeData> SparseBakeLODs;
+
 	/**
 	 * Baked Ring transform array (for ring mesh placement)
 	 * Ring meshes are placed at these positions at runtime
@@ -286,6 +513,29 @@ struct FLESHRINGRUNTIME_API FSubdivisionSettings
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Baked Mesh", NonTransactional)
 	TArray<TObjectPtr<USkeletalMesh>> BakedSkinnedRingMeshes;
 
+	/**
+	 * Shared skinned ring mesh library (optional)
+	 * - Set: skinned ring meshes are taken from / generated into the library and shared with other assets
+	 *   using the same ring mesh, body, attach bone, sampling radius and ring placement
+	 * - None: each asset stores its own skinned ring meshes
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Baked Mesh")
+	TObjectPtr<UFleshRingSkinnedRingLibrary> SkinnedRingLibrary;
+
+	/**
+	 * Store the Deformer's per-LOD affected vertex data on bake
+	 * Deformers on the bake source mesh then load it instead of rebuilding
+	 * selection, adjacency and hop data (faster editor preview / re-bake setup)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Baked Mesh")
+	bool bCookAffectedVertexData = false;
+
+#if WITH_EDITORONLY_DATA
+	/** Cooked affected vertex data (one entry per LOD of the bake source mesh) */
+	UPROPERTY()
+	TArray<FFleshRingCookedLODAffectedData> CookedAffectedData;
+#endif
+
 	/**
 	 * Parameter hash at bake time
 	 * Includes all parameters: Ring settings, Tightness, Bulge, etc.
@@ -812,6 +1062,29 @@ struct FLESHRINGRUNTIME_API FFleshRingSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (ClampMin = "0.01"))
 	FVector MeshScale = FVector::OneVector;
 
+	// ===== Analytic Proxy (MeshBased only) =====
+
+	/**
+	 * Use a fitted Virtual Band instead of the Ring SDF when the mesh is close enough to a band
+	 * - Fit runs in the editor when Ring Mesh / Mesh Scale changes (offline, stored in asset)
+	 * - If fit error <= Max Fit Error: SDF generation and sampling are skipped (VirtualBand path)
+	 * - Otherwise the Ring stays on the SDF path
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ring", meta = (DisplayName = "Use Analytic Proxy", EditCondition = "InfluenceMode == EFleshRingInfluenceMode::MeshBased"))
+	bool bUseAnalyticProxy = false;
+
+	/** Max allowed distance between Ring mesh vertices and the fitted band (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ring", meta = (DisplayName = "Analytic Proxy Max Error", EditCondition = "InfluenceMode == EFleshRingInfluenceMode::MeshBased && bUseAnalyticProxy", ClampMin = "0.0", Units = "cm"))
+	float AnalyticProxyMaxError = 0.1f;
+
+	/** Fitted band in Ring mesh local space (MeshScale applied), written by the editor fitter */
+	UPROPERTY()
+	FVirtualBandSettings FittedBandProxy;
+
+	/** Max fit error of FittedBandProxy (cm, -1 = not fitted / fit failed) */
+	UPROPERTY(VisibleAnywhere, Category = "Ring", meta = (DisplayName = "Analytic Proxy Fit Error", EditCondition = "bUseAnalyticProxy", Units = "cm"))
+	float AnalyticProxyFitError = -1.0f;
+
 	// ===== Skinned Ring Mesh (For Runtime Deformation) =====
 
 	/**
@@ -1106,6 +1379,37 @@ struct FLESHRINGRUNTIME_API FFleshRingSettings
 		return FTransform(WorldRotation, WorldLocation, MeshScale);
 	}
 
+	/** Whether this MeshBased Ring runs on its fitted analytic proxy (fit present and within error budget) */
+	bool UsesAnalyticProxy() const
+	{
+		return InfluenceMode == EFleshRingInfluenceMode::MeshBased && bUseAnalyticProxy &&
+			AnalyticProxyFitError >= 0.0f && AnalyticProxyFitError <= AnalyticProxyMaxError;
+	}
+
+	/** Influence mode actually used at runtime (MeshBased rings with a valid proxy run as VirtualBand) */
+	EFleshRingInfluenceMode GetEffectiveInfluenceMode() const
+	{
+		return UsesAnalyticProxy() ? EFleshRingInfluenceMode::VirtualBand : InfluenceMode;
+	}
+
+	/**
+	 * Virtual band used at runtime (bone space)
+	 * For analytic proxies, the fitted band is moved from Ring mesh local space by MeshOffset/MeshRotation
+	 */
+	FVirtualBandSettings GetEffectiveVirtualBand() const
+	{
+		if (!UsesAnalyticProxy())
+		{
+			return VirtualBand;
+		}
+
+		FVirtualBandSettings Band = FittedBandProxy;
+		Band.BandOffset = MeshOffset + MeshRotation.RotateVector(FittedBandProxy.BandOffset);
+		Band.BandRotation = MeshRotation * FittedBandProxy.BandRotation;
+		Band.BandEulerRotation = Band.BandRotation.Rotator();
+		return Band;
+	}
+
 	/**
 	 * Get display name for Ring
 	 * @param Index Array index (fallback when no custom name)
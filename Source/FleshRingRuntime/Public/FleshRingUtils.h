@@ -3,8 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "FleshRingTypes.h"
 
 class USkeletalMesh;
+class UStaticMesh;
+struct FReferenceSkeleton;
+struct FSubdivisionRingParams;
 
 /**
  * FleshRing plugin common utility functions
@@ -27,4 +31,77 @@ namespace FleshRingUtils
 	 * @return true if mesh is valid
 	 */
 	FLESHRINGRUNTIME_API bool IsSkeletalMeshValid(USkeletalMesh* Mesh, bool bLogWarnings = false);
+
+	/**
+	 * Content hash of a static mesh's geometry (bounds + LOD0 positions + indices)
+	 * Used in cache keys so editing a Ring mesh in place invalidates data derived from it
+	 * Falls back to bounds only when the render data has no CPU copy
+	 *
+	 * @param Mesh Static mesh to hash (nullptr returns 0)
+	 * @return Geometry hash
+	 */
+	FLESHRINGRUNTIME_API uint32 HashStaticMeshGeometry(const UStaticMesh* Mesh);
+
+	/**
+	 * Content hash of a skeletal mesh's geometry
+	 * Editor: ImportedModel id string (regenerated on every reimport / LOD model change)
+	 * Otherwise: bounds + LOD0 positions + indices (bounds only when the render data has no CPU copy)
+	 * Reads CPU data only, callable off the game thread while the mesh is kept alive
+	 *
+	 * @param Mesh Skeletal mesh to hash (nullptr returns 0)
+	 * @return Geometry hash
+	 */
+	FLESHRINGRUNTIME_API uint32 HashSkeletalMeshGeometry(const USkeletalMesh* Mesh);
+
+	/**
+	 * Calculate component space transform along bone chain
+	 * @param BoneIndex - Bone index
+	 * @param RefSkeleton - Reference skeleton
+	 * @param RefBonePose - Reference bone pose
+	 * @return Component space bone transform (identity if the bone is missing)
+	 */
+	FLESHRINGRUNTIME_API FTransform CalculateBoneTransform(
+		int32 BoneIndex,
+		const FReferenceSkeleton& RefSkeleton,
+		const TArray<FTransform>& RefBonePose);
+
+	/**
+	 * Get the Ring-local OBB used for subdivision region selection
+	 * - VirtualBand / analytic proxy: bounds of the (fitted) band (the shape actually deformed at runtime)
+	 * - MeshBased: RingMesh bounds
+	 * @param Ring - Ring settings
+	 * @param BoneTransform - Bone's component space transform
+	 * @param OutLocalBounds - Output: bounds in Ring local space
+	 * @param OutLocalToComponent - Output: Ring local -> component transform
+	 * @return false if the Ring does not select by bounds (VirtualRing, or no RingMesh)
+	 */
+	FLESHRINGRUNTIME_API bool GetRingSelectionBounds(
+		const FFleshRingSettings& Ring,
+		const FTransform& BoneTransform,
+		FBox& OutLocalBounds,
+		FTransform& OutLocalToComponent);
+
+	/** Ring settings with the bone / RingMesh data its selection needs (resolved on the game thread, used on any thread) */
+	struct FRingSelectionVolume
+	{
+		FFleshRingSettings Ring;
+
+		/** Bone's component space transform (identity if the bone is missing) */
+		FTransform BoneTransform;
+
+		/** Selects by LocalBounds (see GetRingSelectionBounds), otherwise by the VirtualRing torus */
+		bool bBoundsBased = false;
+		FBox LocalBounds = FBox(ForceInit);
+		FTransform LocalToComponent;
+	};
+
+	/** Resolve a Ring's selection volume (loads the RingMesh if needed, game thread) */
+	FLESHRINGRUNTIME_API FRingSelectionVolume ResolveRingSelectionVolume(const FFleshRingSettings& Ring, const FTransform& BoneTransform);
+
+	/**
+	 * Subdivision processor region of a resolved selection volume (bind pose component space)
+	 * Bounds-based volumes become an OBB region, VirtualRing volumes a torus around the Ring axis
+	 * Keeps OutRingParams.MaxSubdivisionLevel untouched
+	 */
+	FLESHRINGRUNTIME_API void MakeSubdivisionRingParams(const FRingSelectionVolume& Volume, FSubdivisionRingParams& OutRingParams);
 }
@@ -24,4 +24,23 @@ namespace FleshRingVirtualBandMesh
 		const FVirtualBandSettings& Settings,
 		TArray<TPair<FVector, FVector>>& OutLines,
 		int32 NumSegments = 24);
+
+	/**
+	 * Generate closed triangle shell of the band (for SDF generation / benchmarking)
+	 *
+	 * Inner surface follows GetRadiusAtHeight(), outer surface is offset by BandThickness,
+	 * top/bottom are closed with annular caps. Band local space (Z=0 is Mid Band center).
+	 *
+	 * @param Settings Band settings
+	 * @param OutVertices Output vertex positions
+	 * @param OutIndices Output triangle indices (3 per triangle)
+	 * @param NumSegments Number of circular segments
+	 * @param NumHeightSteps Number of profile steps along Z
+	 */
+	FLESHRINGRUNTIME_API void GenerateBandTriangles(
+		const FVirtualBandSettings& Settings,
+		TArray<FVector3f>& OutVertices,
+		TArray<uint32>& OutIndices,
+		int32 NumSegments = 48,
+		int32 NumHeightSteps = 16);
 }
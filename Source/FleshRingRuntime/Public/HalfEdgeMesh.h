@@ -2,7 +2,7 @@
 
 // HalfEdgeMesh.h
 // Half-Edge data structure for topology-aware mesh operations
-// Supports Red-Green Refinement for crack-free adaptive subdivision
+// Supports in-place Longest Edge Bisection (LEB) for crack-free adaptive subdivision
 
 #pragma once
 
@@ -19,6 +19,7 @@ struct FHalfEdge
 	int32 NextIndex = -1;        // Next half-edge in the same face (CCW)
 	int32 PrevIndex = -1;        // Previous half-edge in the same face
 	int32 FaceIndex = -1;        // Face this half-edge belongs to
+	int32 SeamTwinIndex = -1;    // Coincident boundary half-edge across a UV seam (split vertices), -1 if none
 
 	bool IsBoundary() const { return TwinIndex == -1; }
 };
@@ -31,7 +32,7 @@ struct FHalfEdgeFace
 	int32 HalfEdgeIndex = -1;    // One of the half-edges of this face
 	int32 SubdivisionLevel = 0;  // How many times this face has been subdivided
 	int32 MaterialIndex = 0;     // Material slot index for this face (inherited during subdivision)
-	bool bMarkedForSubdivision = false;
+	bool bMarkedForSubdivision = false;  // Refinement target (inherited by both halves on bisection)
 };
 
 /**
@@ -72,8 +73,13 @@ public:
 	TArray<FHalfEdge> HalfEdges;
 	TArray<FHalfEdgeFace> Faces;
 
+	// Half-edges that refinement must not split (e.g. patch borders shared with the rest of the mesh)
+	// Empty = nothing locked; half-edges created by refinement are never locked
+	TBitArray<> LockedHalfEdges;
+
 	// Build from triangle mesh data (MaterialIndices: per-triangle material index, optional)
 	// ParentIndices: per-vertex parent info (optional, pairs of int32 for each vertex)
+	// Twins are paired by radix-sorting undirected edge keys (no persistent edge map)
 	bool BuildFromTriangles(
 		const TArray<FVector>& InVertices,
 		const TArray<int32>& InTriangles,
@@ -102,6 +108,26 @@ public:
 	// Get the opposite vertex of an edge in a face
 	int32 GetOppositeVertex(int32 HalfEdgeIndex) const;
 
+	// Get twin half-edge if it links back (-1 if boundary or non-manifold)
+	int32 GetValidTwin(int32 HalfEdgeIndex) const
+	{
+		const int32 Twin = HalfEdges[HalfEdgeIndex].TwinIndex;
+		return (HalfEdges.IsValidIndex(Twin) && HalfEdges[Twin].TwinIndex == HalfEdgeIndex) ? Twin : -1;
+	}
+
+	// Check if refinement may split this half-edge
+	bool IsHalfEdgeLocked(int32 HalfEdgeIndex) const
+	{
+		return LockedHalfEdges.IsValidIndex(HalfEdgeIndex) && LockedHalfEdges[HalfEdgeIndex];
+	}
+
+	// Get seam twin half-edge if it links back (-1 if none)
+	int32 GetValidSeamTwin(int32 HalfEdgeIndex) const
+	{
+		const int32 SeamTwin = HalfEdges[HalfEdgeIndex].SeamTwinIndex;
+		return (HalfEdges.IsValidIndex(SeamTwin) && HalfEdges[SeamTwin].SeamTwinIndex == HalfEdgeIndex) ? SeamTwin : -1;
+	}
+
 	// Check if a face intersects with a sphere/torus region
 	bool FaceIntersectsRegion(int32 FaceIndex, const FVector& RegionCenter, float RegionRadius) const;
 
@@ -117,8 +143,9 @@ public:
 	int32 GetHalfEdgeCount() const { return HalfEdges.Num(); }
 
 private:
-	// Helper to find twin half-edge during construction
-	TMap<TPair<int32, int32>, int32> EdgeToHalfEdge;
+	// Pair boundary half-edges with matching (reversed) positions across UV seams
+	// Refinement splits both sides so seams stay watertight
+	void LinkSeamTwins();
 };
 
 /**
@@ -131,6 +158,19 @@ struct FTorusParams
 	float MajorRadius = 22.0f;        // Distance from center to tube center
 	float MinorRadius = 5.0f;         // Tube thickness
 	float InfluenceMargin = 10.0f;    // Extra margin around torus for subdivision
+
+	/** Check if a point is near the torus surface (signed distance within InfluenceMargin) */
+	bool IsPointInInfluence(const FVector& Point) const
+	{
+		FVector TorusAxis = Axis.GetSafeNormal();
+		if (TorusAxis.IsNearlyZero()) TorusAxis = FVector(0, 1, 0);
+
+		const FVector ToP = Point - Center;
+		const float AxisDist = FVector::DotProduct(ToP, TorusAxis);
+		const FVector RadialVec = ToP - (AxisDist * TorusAxis);
+		const FVector2D Q(RadialVec.Size() - MajorRadius, AxisDist);
+		return Q.Size() - MinorRadius <= InfluenceMargin;
+	}
 };
 
 /**
@@ -282,15 +322,16 @@ struct FSubdivisionOBB
 };
 
 /**
- * Red-Green Refinement subdivision algorithm
- * Provides crack-free adaptive subdivision
+ * Longest Edge Bisection (LEB) subdivision algorithm
+ * Refines the half-edge mesh in place (Rivara LEPP propagation), so cost scales with the refined region
+ * Provides crack-free adaptive subdivision (every edge split is applied to both adjacent faces)
  */
 class FLESHRINGRUNTIME_API FLEBSubdivision
 {
 public:
 	/**
 	 * Subdivide faces that intersect with the torus influence region (for VirtualRing mode)
-	 * Uses Red-Green refinement to ensure no T-junctions
+	 * Uses LEB refinement to ensure no T-junctions
 	 *
 	 * @param Mesh - Half-edge mesh to subdivide (modified in place)
 	 * @param TorusParams - Torus shape parameters defining influence region
@@ -307,7 +348,7 @@ public:
 
 	/**
 	 * Subdivide faces that intersect with the OBB influence region
-	 * Uses Red-Green refinement to ensure no T-junctions
+	 * Uses LEB refinement to ensure no T-junctions
 	 *
 	 * @param Mesh - Half-edge mesh to subdivide (modified in place)
 	 * @param OBB - Oriented Bounding Box defining influence region
@@ -325,7 +366,7 @@ public:
 	/**
 	 * Uniformly subdivide the entire mesh (for editor preview)
 	 * Subdivides all triangles without region check
-	 * Prevents T-junctions using Red-Green refinement
+	 * Prevents T-junctions using LEB refinement
 	 *
 	 * @param Mesh - Half-edge mesh to subdivide (modified in place)
 	 * @param MaxLevel - Maximum subdivision depth
@@ -341,7 +382,7 @@ public:
 	/**
 	 * Subdivide only selected triangles (for editor preview - bone-based optimization)
 	 * Subdivides only the specified set of triangle indices
-	 * Prevents T-junctions using Red-Green refinement
+	 * Prevents T-junctions using LEB refinement
 	 *
 	 * @param Mesh - Half-edge mesh to subdivide (modified in place)
 	 * @param TargetFaces - Set of target triangle indices
@@ -357,14 +398,24 @@ public:
 	);
 
 	/**
-	 * Subdivide a single edge using LEB
-	 * Automatically propagates to maintain mesh consistency
+	 * Collect faces touching an influence region (vertices, edge midpoints or centroid inside)
+	 * Same test SubdivideRegion uses to pick faces at the first level
+	 *
+	 * @param OutFaces - Face indices in ascending order
+	 */
+	static void CollectRegionFaces(const FHalfEdgeMesh& Mesh, const FTorusParams& TorusParams, TArray<int32>& OutFaces);
+	static void CollectRegionFaces(const FHalfEdgeMesh& Mesh, const FSubdivisionOBB& OBB, TArray<int32>& OutFaces);
+
+	/**
+	 * Split a single edge at its midpoint, bisecting both adjacent faces
+	 * Across a UV seam the other side gets its own midpoint vertex at the same position
 	 *
 	 * @param Mesh - Half-edge mesh
 	 * @param HalfEdgeIndex - The edge to split
+	 * @param OutSplitFaces - Optional (parent face, new face) pairs for every bisected face
 	 * @return Index of the new vertex at the midpoint
 	 */
-	static int32 SplitEdge(FHalfEdgeMesh& Mesh, int32 HalfEdgeIndex);
+	static int32 SplitEdge(FHalfEdgeMesh& Mesh, int32 HalfEdgeIndex, TArray<TPair<int32, int32>>* OutSplitFaces = nullptr);
 
 	/**
 	 * Subdivide a single face into 4 triangles (1-to-4 split)
@@ -375,14 +426,31 @@ public:
 
 private:
 	/**
-	 * Recursively ensure the edge being split is the longest in its face
-	 * This is key to LEB - we may need to split other edges first
+	 * Shared refinement driver
+	 * Each level bisects faces passing ShouldRefineFace (and MinEdgeLength) twice;
+	 * levels after the first only revisit faces split in the previous level
+	 *
+	 * @param InitialCandidates - Level 0 faces to test (nullptr = all faces)
+	 * @return Number of faces added
+	 */
+	static int32 RefineFaces(
+		FHalfEdgeMesh& Mesh,
+		const TArray<int32>* InitialCandidates,
+		int32 MaxLevel,
+		float MinEdgeLength,
+		TFunctionRef<bool(const FHalfEdgeMesh&, int32)> ShouldRefineFace);
+
+	/**
+	 * Bisect a face by its longest edge, first bisecting neighbors along the
+	 * longest edge propagation path (LEPP) so the split edge is longest on both sides
+	 * Locked half-edges are skipped (the longest unlocked edge is used instead)
 	 */
-	static void EnsureLongestEdge(FHalfEdgeMesh& Mesh, int32 HalfEdgeIndex, TSet<int32>& ProcessedFaces);
+	static void RefineFaceLEPP(FHalfEdgeMesh& Mesh, int32 FaceIndex, TArray<TPair<int32, int32>>& OutSplitFaces);
 
 	/**
-	 * Split a face by its longest edge
-	 * Creates two new faces from one
+	 * Split one face at a midpoint on the given half-edge (one side only)
+	 * The face keeps the first half, a new face is appended for the second half
+	 * @return Index of the new face
 	 */
-	static void SplitFaceByEdge(FHalfEdgeMesh& Mesh, int32 FaceIndex, int32 MidpointVertex);
+	static int32 SplitFaceByEdge(FHalfEdgeMesh& Mesh, int32 HalfEdgeIndex, int32 MidpointVertex);
 };